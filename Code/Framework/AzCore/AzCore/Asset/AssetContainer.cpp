@@ -10,12 +10,18 @@
 #include <AzCore/Outcome/Outcome.h>
 #include <AzCore/Asset/AssetManagerBus.h>
 #include <AzCore/Asset/AssetManager.h>
+#include <AzCore/Console/IConsole.h>
+
+AZ_CVAR(bool, cl_assetContainerGradedDeadlines, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "When a container load has a deadline, give preload dependencies proportionally earlier deadlines the deeper they are in the "
+    "preload chain so the streamer reads the assets that block everything else first.");
 
 namespace AZ
 {
     namespace Data
     {
         AssetContainer::AssetContainer(Asset<AssetData> rootAsset, const AssetLoadParameters& loadParams)
+            : m_loadStart(AZStd::chrono::system_clock::now())
         {
             m_rootAsset = AssetInternal::WeakAsset<AssetData>(rootAsset);
             m_containerAssetId = m_rootAsset.GetId();
@@ -197,13 +203,41 @@ namespace AZ
                 dependencyAssets.emplace_back(thisInfo, AZStd::move(dependentAsset));
             }
 
+            // Preload dependencies hold up everything that waits on them, so when there's a deadline the ones at the bottom of the
+            // preload chain get the earliest deadlines.  All reads are still issued right away, the deadlines only order them in the streamer.
+            AZStd::unordered_map<AssetId, int> preloadDepths;
+            int maxPreloadDepth = 0;
+            if (cl_assetContainerGradedDeadlines)
+            {
+                AZStd::lock_guard<AZStd::recursive_mutex> preloadLock(m_preloadMutex);
+                for (const auto& [waitingId, preloads] : m_preloadList)
+                {
+                    for (const AssetId& preloadId : preloads)
+                    {
+                        if (preloadId != waitingId)
+                        {
+                            maxPreloadDepth = AZStd::max(maxPreloadDepth, CalculatePreloadDepth(preloadId, preloadDepths));
+                        }
+                    }
+                }
+            }
+
             // Queue the loading of all of the dependent assets before loading the root asset.  
             for (auto& [dependentAssetInfo, dependentAsset] : dependencyAssets)
             {
+                const AssetLoadParameters* dependentLoadParams = &loadParamsCopyWithNoLoadingFilter;
+                AssetLoadParameters gradedLoadParams;
+                if (auto depthIt = preloadDepths.find(dependentAsset.GetId()); depthIt != preloadDepths.end())
+                {
+                    gradedLoadParams = loadParamsCopyWithNoLoadingFilter;
+                    gradedLoadParams.m_deadline = GetGradedDeadline(dependentAsset.GetType(), loadParams, depthIt->second, maxPreloadDepth);
+                    dependentLoadParams = &gradedLoadParams;
+                }
+
                 // Queue each asset to load.
                 auto queuedDependentAsset = AssetManager::Instance().GetAssetInternal(
                     dependentAsset.GetId(), dependentAsset.GetType(),
-                    AZ::Data::AssetLoadBehavior::Default, loadParamsCopyWithNoLoadingFilter,
+                    AZ::Data::AssetLoadBehavior::Default, *dependentLoadParams,
                     dependentAssetInfo, HasPreloads(dependentAsset.GetId()));
 
                 // Verify that the returned asset reference matches the one that we found or created and queued to load.
@@ -244,6 +278,58 @@ namespace AZ
             CheckReady();
         }
 
+        int AssetContainer::CalculatePreloadDepth(const AssetId& assetId, AZStd::unordered_map<AssetId, int>& depths) const
+        {
+            if (auto depthIt = depths.find(assetId); depthIt != depths.end())
+            {
+                return depthIt->second;
+            }
+
+            // Mark the asset before recursing so a circular preload chain that slipped through can't recurse forever
+            depths[assetId] = 0;
+            int depth = 0;
+            if (auto preloadIt = m_preloadList.find(assetId); preloadIt != m_preloadList.end())
+            {
+                for (const AssetId& preloadId : preloadIt->second)
+                {
+                    if (preloadId != assetId)
+                    {
+                        depth = AZStd::max(depth, CalculatePreloadDepth(preloadId, depths) + 1);
+                    }
+                }
+            }
+            depths[assetId] = depth;
+            return depth;
+        }
+
+        AZStd::optional<AZStd::chrono::milliseconds> AssetContainer::GetGradedDeadline(
+            const AssetType& assetType, const AssetLoadParameters& loadParams, int depth, int maxDepth) const
+        {
+            AZStd::chrono::milliseconds deadline = IO::IStreamerTypes::s_noDeadline;
+            if (loadParams.m_deadline)
+            {
+                deadline = loadParams.m_deadline.value();
+            }
+            else if (AssetHandler* handler = AssetManager::Instance().GetHandler(assetType))
+            {
+                IO::IStreamerTypes::Priority priority;
+                handler->GetDefaultAssetLoadPriority(assetType, deadline, priority);
+            }
+
+            if (deadline >= AZStd::chrono::duration_cast<AZStd::chrono::milliseconds>(IO::IStreamerTypes::s_noDeadline))
+            {
+                return loadParams.m_deadline;
+            }
+
+            // Assets without preloads of their own get the smallest share, the root which isn't graded keeps the full deadline
+            return AZStd::chrono::milliseconds(deadline.count() * (depth + 1) / (maxDepth + 2));
+        }
+
+        AZStd::chrono::milliseconds AssetContainer::GetTimeToReady() const
+        {
+            return m_timeToReady;
+        }
+
         bool AssetContainer::IsReady() const
         {
             return (m_rootAsset && m_waitingCount == 0);
@@ -517,6 +603,8 @@ namespace AZ
                 m_finalNotificationSent = true;
                 if (m_rootAsset)
                 {
+                    m_timeToReady = AZStd::chrono::duration_cast<AZStd::chrono::milliseconds>(
+                        AZStd::chrono::system_clock::now() - m_loadStart);
                     AssetManagerBus::Broadcast(&AssetManagerBus::Events::OnAssetContainerReady, this);
                 }
                 else
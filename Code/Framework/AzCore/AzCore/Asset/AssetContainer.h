@@ -15,6 +15,8 @@
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/set.h>
+#include <AzCore/std/chrono/clocks.h>
+#include <AzCore/std/optional.h>
 
 namespace AZ
 {
@@ -55,6 +57,9 @@ namespace AZ
             // Remove an asset from the container.
             void ClearRootAsset();
 
+            //! Time from the creation of the container until it signaled OnAssetContainerReady, zero until then.
+            AZStd::chrono::milliseconds GetTimeToReady() const;
+
 
             operator bool() const;
 
@@ -107,6 +112,14 @@ namespace AZ
             void SetupPreloadLists(PreloadAssetListType&& preloadList, const AZ::Data::AssetId& rootAssetId);
             bool HasPreloads(const AZ::Data::AssetId& assetId) const;
 
+            // Number of preload levels below an asset, 0 if it has no preloads of its own.  Results are cached in depths.
+            // Expects m_preloadMutex to be held.
+            int CalculatePreloadDepth(const AZ::Data::AssetId& assetId, AZStd::unordered_map<AZ::Data::AssetId, int>& depths) const;
+            // Share of the container's deadline given to a preload dependency, so lower preloads are read first.
+            // Returns the unmodified deadline from loadParams if there's no deadline to grade.
+            AZStd::optional<AZStd::chrono::milliseconds> GetGradedDeadline(
+                const AssetType& assetType, const AssetLoadParameters& loadParams, int depth, int maxDepth) const;
+
             // Remove a specific id from the list an asset is waiting for and complete the load if everything is ready
             void RemoveFromWaitingPreloads(const AZ::Data::AssetId& waitingId, const AZ::Data::AssetId& preloadAssetId);
             // Iterate over the list that was waiting for this asset and remove it from each
@@ -135,6 +148,9 @@ namespace AZ
             AZStd::atomic_bool m_initComplete{ false };
             AZStd::atomic_bool m_finalNotificationSent{false};
 
+            AZStd::chrono::system_clock::time_point m_loadStart;
+            AZStd::chrono::milliseconds m_timeToReady{ 0 };
+
             mutable AZStd::recursive_mutex m_preloadMutex;
             // AssetId -> List of assets it is still waiting on 
             PreloadAssetListType m_preloadList;
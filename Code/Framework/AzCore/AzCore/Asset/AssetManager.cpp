@@ -545,9 +545,6 @@ namespace AZ
 
             DispatchEvents();
 
-            // Acquire the asset lock to make sure nobody else is trying to do anything fancy with assets
-            AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
-
             while (!m_handlers.empty())
             {
                 AssetHandlerMap::iterator it = m_handlers.begin();
@@ -673,10 +670,11 @@ namespace AZ
                         // (~1 per 5000 runs) trigger the error case if we didn't wait for the jobs to finish here.
                         WaitForActiveJobsAndStreamerRequestsToFinish();
 
+                        for (AssetShard& shard : m_assetShards)
                         {
                             // this scope is used to control the scope of the lock.
-                            AZStd::lock_guard<AZStd::recursive_mutex> assetLock(m_assetMutex);
-                            for (const auto &assetEntry : m_assets)
+                            AZStd::lock_guard<AZStd::shared_mutex> shardLock(shard.m_mutex);
+                            for (const auto &assetEntry : shard.m_assets)
                             {
                                 // is the handler that handles this type, this handler we're removing?
                                 if (assetEntry.second->m_registeredHandler == handler)
@@ -708,7 +706,7 @@ namespace AZ
             AZ_Error("AssetDatabase", catalog != nullptr, "Attempting to register a null catalog!");
             if (catalog)
             {
-                AZStd::scoped_lock<AZStd::recursive_mutex> l(m_catalogMutex);
+                AZStd::lock_guard<AZStd::shared_mutex> l(m_catalogMutex);
                 if (m_catalogs.insert(AZStd::make_pair(assetType, catalog)).second == false)
                 {
                     AZ_Error("AssetDatabase", false, "Asset type %s already has a catalog registered! New registration ignored!", assetType.ToString<AZStd::string>().c_str());
@@ -725,7 +723,7 @@ namespace AZ
             AZ_Error("AssetDatabase", catalog != nullptr, "Attempting to unregister a null catalog!");
             if (catalog)
             {
-                AZStd::scoped_lock<AZStd::recursive_mutex> l(m_catalogMutex);
+                AZStd::lock_guard<AZStd::shared_mutex> l(m_catalogMutex);
                 for (AssetCatalogMap::iterator iter = m_catalogs.begin(); iter != m_catalogs.end(); )
                 {
                     if (iter->second == catalog)
@@ -768,43 +766,62 @@ namespace AZ
                 return;
             }
 
-            AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
-            // First, release any containers that were loading this asset
-            for (auto asset = m_assets.begin();asset != m_assets.end();)
+            // First, release any containers that were loading this asset.
+            // The ids are collected first because releasing the containers can release assets, which needs the shard locks.
+            AZStd::vector<AssetId> unusedAssetIds;
+            for (AssetShard& shard : m_assetShards)
             {
-                if (asset->second->m_useCount == 0)
-                {
-                    auto releaseAsset = asset->second;
-                    ++asset;
-                    ReleaseAssetContainersForAsset(releaseAsset);
-                }
-                else
+                AZStd::shared_lock<AZStd::shared_mutex> shardLock(shard.m_mutex);
+                for (const auto& asset : shard.m_assets)
                 {
-                    ++asset;
+                    if (asset.second->m_useCount == 0)
+                    {
+                        unusedAssetIds.push_back(asset.first);
+                    }
                 }
             }
 
+            for (const AssetId& assetId : unusedAssetIds)
+            {
+                ReleaseAssetContainersForAsset(assetId);
+            }
+
             // Second, release the assets themselves
 
-            AZStd::vector<AssetData*> assetsToRelease;
+            struct AssetToRelease
+            {
+                AssetData* m_asset;
+                AssetId m_assetId;
+                AssetType m_assetType;
+                int m_creationToken;
+                bool m_removeFromHash;
+            };
+            AZStd::vector<AssetToRelease> assetsToRelease;
 
-            for(auto&& asset : m_assets)
+            for (AssetShard& shard : m_assetShards)
             {
-                if(asset.second->m_weakUseCount == 0)
+                AZStd::shared_lock<AZStd::shared_mutex> shardLock(shard.m_mutex);
+                for (const auto& asset : shard.m_assets)
                 {
-                    // Keep a separate list of assets to release, because releasing them will modify the m_assets list that we're
-                    // currently looping on.
-                    assetsToRelease.push_back(asset.second);
+                    AssetData* assetData = asset.second;
+                    if (assetData->m_weakUseCount == 0)
+                    {
+                        // Keep a separate list of assets to release, because releasing them will modify the asset maps that we're
+                        // currently looping on. Everything needed is copied while the lock is held, ReleaseAsset validates the
+                        // creation token again before it touches an asset that another thread might have released in the meantime.
+                        bool removeFromHash = assetData->IsRegisterReadonlyAndShareable();
+                        // default creation token implies that the asset was not created by the asset manager and therefore it cannot be in the asset map. 
+                        removeFromHash = assetData->m_creationToken == s_defaultCreationToken ? false : removeFromHash;
+
+                        assetsToRelease.push_back(
+                            { assetData, assetData->GetId(), assetData->GetType(), assetData->m_creationToken, removeFromHash });
+                    }
                 }
             }
 
-            for(auto&& asset : assetsToRelease)
+            for (const AssetToRelease& asset : assetsToRelease)
             {
-                bool removeFromHash = asset->IsRegisterReadonlyAndShareable();
-                // default creation token implies that the asset was not created by the asset manager and therefore it cannot be in the asset map. 
-                removeFromHash = asset->m_creationToken == s_defaultCreationToken ? false : removeFromHash;
-
-                ReleaseAsset(asset, asset->GetId(), asset->GetType(), removeFromHash, asset->m_creationToken);
+                ReleaseAsset(asset.m_asset, asset.m_assetId, asset.m_assetType, asset.m_removeFromHash, asset.m_creationToken);
             }
         }
 
@@ -837,7 +854,7 @@ namespace AZ
         {
             // Look up the asset id in the catalog, and use the result of that instead.
             // If assetId is a legacy id, assetInfo.m_assetId will be the canonical id. Otherwise, assetInfo.m_assetID == assetId.
-            // This is because only canonical ids are stored in m_assets (see below).
+            // This is because only canonical ids are stored in the asset map (see below).
             // Only do the look up if upgrading is enabled
             AZ::Data::AssetInfo assetInfo;
             if (GetAssetInfoUpgradingEnabled())
@@ -848,16 +865,7 @@ namespace AZ
             // If the catalog is not available, use the original assetId
             const AssetId& assetToFind(assetInfo.m_assetId.IsValid() ? assetInfo.m_assetId : assetId);
 
-            AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
-            AssetMap::iterator it = m_assets.find(assetToFind);
-            if (it != m_assets.end())
-            {
-                Asset<AssetData> asset(assetReferenceLoadBehavior);
-                asset.SetData(it->second);
-
-                return asset;
-            }
-            return Asset<AssetData>(assetReferenceLoadBehavior);
+            return FindRegisteredAsset(assetToFind, assetReferenceLoadBehavior);
         }
 
         AZStd::pair<AZStd::chrono::milliseconds, AZ::IO::IStreamerTypes::Priority> GetEffectiveDeadlineAndPriority(
@@ -983,27 +991,14 @@ namespace AZ
             bool wasUnloaded = false;
             AssetHandler* handler = nullptr;
             AssetData* assetData = nullptr;
-            Asset<AssetData> asset; // Used to hold a reference while job is dispatched and while outside of the assetMutex lock.
+            Asset<AssetData> asset; // Used to hold a reference while job is dispatched.
 
-            // Control the scope of the assetMutex lock
             {
-                AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
-                bool isNewEntry = false;
-
                 // check if asset already exists
                 {
                     AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzCore, "GetAsset: FindAsset");
 
-                    AssetMap::iterator it = m_assets.find(assetInfo.m_assetId);
-                    if (it != m_assets.end())
-                    {
-                        assetData = it->second;
-                        asset.SetData(assetData);
-                    }
-                    else
-                    {
-                        isNewEntry = true;
-                    }
+                    asset = FindRegisteredAsset(assetInfo.m_assetId, asset.GetAutoLoadBehavior());
                 }
 
                 {
@@ -1017,45 +1012,31 @@ namespace AZ
                     {
                         // Create the asset ptr and insert it into our asset map.
                         handler = handlerIt->second;
-                        if (isNewEntry)
+                        if (!asset)
                         {
                             AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzCore, "GetAsset: CreateAsset");
 
-                            assetData = handler->CreateAsset(assetInfo.m_assetId, assetInfo.m_assetType);
-                            if (assetData)
-                            {
-                                assetData->m_assetId = assetInfo.m_assetId;
-                                assetData->m_creationToken = ++m_creationTokenGenerator;
-                                assetData->RegisterWithHandler(handler);
-                                asset.SetData(assetData);
-                            }
-                            else
-                            {
-                                AZ_Error("AssetDatabase", false, "Failed to create asset with (id=%s, type=%s)",
-                                    assetInfo.m_assetId.ToString<AZ::OSString>().c_str(),
-                                    assetInfo.m_assetType.ToString<AZ::OSString>().c_str());
-                            }
+                            bool isNewEntry = false;
+                            asset = CreateAndRegisterAsset(
+                                assetInfo.m_assetId, assetInfo.m_assetType, handler, asset.GetAutoLoadBehavior(), isNewEntry);
                         }
                     }
                 }
 
+                assetData = asset.Get();
                 if (assetData)
                 {
-                    if (isNewEntry && assetData->IsRegisterReadonlyAndShareable())
-                    {
-                        AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzCore, "GetAsset: RegisterAsset");
-                        m_assets.insert(AZStd::make_pair(assetInfo.m_assetId, assetData));
-                    }
-                    if (assetData->GetStatus() == AssetData::AssetStatus::NotLoaded)
+                    // Only the thread that moves the asset out of the NotLoaded state queues the load
+                    AssetData::AssetStatus expectedStatus = AssetData::AssetStatus::NotLoaded;
+                    if (assetData->m_status.compare_exchange_strong(expectedStatus, AssetData::AssetStatus::Queued))
                     {
-                        assetData->m_status = AssetData::AssetStatus::Queued;
                         UpdateDebugStatus(asset);
                         loadInfo = GetModifiedLoadStreamInfoForAsset(asset, handler);
                         wasUnloaded = true;
 
                         if (loadInfo.IsValid())
                         {
-                            // Create the AssetDataStream instance here so it can claim an asset reference inside the lock (for a total
+                            // Create the AssetDataStream instance here while the asset reference is held (for a total
                             // count of 2 before starting the load), otherwise the refcount will be 1, and the load could be canceled
                             // before it is started, which creates state consistency issues.
 
@@ -1077,7 +1058,7 @@ namespace AZ
 
             asset.SetAutoLoadBehavior(assetReferenceLoadBehavior);
 
-            // We delay queueing the async file I/O until we release m_assetMutex
+            // We delay queueing the async file I/O until the asset handle is fully set up
             if (dataStream)
             {
                 AZ_Assert(loadInfo.IsValid(), "Expected valid stream info when dataStream is valid.");
@@ -1128,13 +1109,19 @@ namespace AZ
 
         Asset<AssetData> AssetManager::FindOrCreateAsset(const AssetId& assetId, const AssetType& assetType, AssetLoadBehavior assetReferenceLoadBehavior)
         {
-            AZStd::scoped_lock<AZStd::recursive_mutex> asset_lock(m_assetMutex);
-
             Asset<AssetData> asset = FindAsset(assetId, assetReferenceLoadBehavior);
 
             if (!asset)
             {
-                asset = CreateAsset(assetId, assetType, assetReferenceLoadBehavior);
+                // find the asset type handler
+                AssetHandlerMap::iterator handlerIt = m_handlers.find(assetType);
+                AZ_Error("AssetDatabase", handlerIt != m_handlers.end(), "No handler was registered for this asset (id=%s, type=%s)!", assetId.ToString<AZ::OSString>().c_str(), assetType.ToString<AZ::OSString>().c_str());
+                if (handlerIt != m_handlers.end())
+                {
+                    // If another thread created the asset in the meantime, that asset is returned
+                    bool isNewEntry = false;
+                    asset = CreateAndRegisterAsset(assetId, assetType, handlerIt->second, assetReferenceLoadBehavior, isNewEntry);
+                }
             }
 
             return asset;
@@ -1146,43 +1133,122 @@ namespace AZ
         //=========================================================================
         Asset<AssetData> AssetManager::CreateAsset(const AssetId& assetId, const AssetType& assetType, AssetLoadBehavior assetReferenceLoadBehavior)
         {
-            AZStd::scoped_lock<AZStd::recursive_mutex> asset_lock(m_assetMutex);
-
             // check if asset already exist
-            AssetMap::iterator it = m_assets.find(assetId);
-            if (it == m_assets.end())
+            bool assetExists = false;
+            {
+                AssetShard& shard = GetAssetShard(assetId);
+                AZStd::shared_lock<AZStd::shared_mutex> shardLock(shard.m_mutex);
+                assetExists = shard.m_assets.find(assetId) != shard.m_assets.end();
+            }
+
+            if (!assetExists)
             {
                 // find the asset type handler
                 AssetHandlerMap::iterator handlerIt = m_handlers.find(assetType);
                 AZ_Error("AssetDatabase", handlerIt != m_handlers.end(), "No handler was registered for this asset (id=%s, type=%s)!", assetId.ToString<AZ::OSString>().c_str(), assetType.ToString<AZ::OSString>().c_str());
                 if (handlerIt != m_handlers.end())
                 {
-                    // Create the asset ptr
-                    AssetHandler* handler = handlerIt->second;
-                    auto assetData = handler->CreateAsset(assetId, assetType);
-                    AZ_Error("AssetDatabase", assetData, "Failed to create asset with (id=%s, type=%s)", assetId.ToString<AZ::OSString>().c_str(), assetType.ToString<AZ::OSString>().c_str());
-                    if (assetData)
+                    bool isNewEntry = false;
+                    Asset<AssetData> asset = CreateAndRegisterAsset(assetId, assetType, handlerIt->second, assetReferenceLoadBehavior, isNewEntry);
+                    if (isNewEntry)
                     {
-                        assetData->m_assetId = assetId;
-                        assetData->m_creationToken = ++m_creationTokenGenerator;
-                        assetData->RegisterWithHandler(handler);
-                        if (assetData->IsRegisterReadonlyAndShareable())
-                        {
-                            m_assets.insert(AZStd::make_pair(assetId, assetData));
-                        }
-
-                        Asset<AssetData> asset(assetReferenceLoadBehavior);
-                        asset.SetData(assetData);
-
                         return asset;
                     }
+                    // Another thread registered the asset after the check above
+                    assetExists = asset.Get() != nullptr;
                 }
             }
-            else
+
+            AZ_Error("AssetDatabase", !assetExists, "Asset (id=%s, type=%s) already exists in the database! Asset not created!", assetId.ToString<AZ::OSString>().c_str(), assetType.ToString<AZ::OSString>().c_str());
+            return Asset<AssetData>(assetReferenceLoadBehavior);
+        }
+
+        //=========================================================================
+        // FindRegisteredAsset
+        //=========================================================================
+        Asset<AssetData> AssetManager::FindRegisteredAsset(const AssetId& assetId, AssetLoadBehavior assetReferenceLoadBehavior)
+        {
+            AssetData* assetData = nullptr;
             {
-                AZ_Error("AssetDatabase", false, "Asset (id=%s, type=%s) already exists in the database! Asset not created!", assetId.ToString<AZ::OSString>().c_str(), assetType.ToString<AZ::OSString>().c_str());
+                AssetShard& shard = GetAssetShard(assetId);
+                AZStd::shared_lock<AZStd::shared_mutex> shardLock(shard.m_mutex);
+                AssetMap::iterator it = shard.m_assets.find(assetId);
+                if (it == shard.m_assets.end())
+                {
+                    return Asset<AssetData>(assetReferenceLoadBehavior);
+                }
+
+                // Take a reference while the entry can't be removed, a concurrent ReleaseAsset will see the non-zero count and
+                // keep the asset alive.
+                assetData = it->second;
+                assetData->Acquire();
             }
-            return Asset<AssetData>(assetReferenceLoadBehavior);
+
+            // Creating the handle can query the catalog, so it's done outside of the lock
+            Asset<AssetData> asset(assetReferenceLoadBehavior);
+            asset.SetData(assetData);
+            assetData->Release();
+            return asset;
+        }
+
+        //=========================================================================
+        // CreateAndRegisterAsset
+        //=========================================================================
+        Asset<AssetData> AssetManager::CreateAndRegisterAsset(const AssetId& assetId, const AssetType& assetType, AssetHandler* handler,
+            AssetLoadBehavior assetReferenceLoadBehavior, bool& isNewEntry)
+        {
+            isNewEntry = false;
+
+            // The data is created before taking the shard lock so the lock is only held for the map insertion
+            AssetData* assetData = handler->CreateAsset(assetId, assetType);
+            if (!assetData)
+            {
+                AZ_Error("AssetDatabase", false, "Failed to create asset with (id=%s, type=%s)",
+                    assetId.ToString<AZ::OSString>().c_str(), assetType.ToString<AZ::OSString>().c_str());
+                return Asset<AssetData>(assetReferenceLoadBehavior);
+            }
+
+            assetData->m_assetId = assetId;
+            assetData->m_creationToken = ++m_creationTokenGenerator;
+            assetData->RegisterWithHandler(handler);
+
+            Asset<AssetData> asset(assetReferenceLoadBehavior);
+            if (!assetData->IsRegisterReadonlyAndShareable())
+            {
+                isNewEntry = true;
+                asset.SetData(assetData);
+                return asset;
+            }
+
+            AssetData* registeredData = nullptr;
+            {
+                AssetShard& shard = GetAssetShard(assetId);
+                AZStd::lock_guard<AZStd::shared_mutex> shardLock(shard.m_mutex);
+                registeredData = shard.m_assets.emplace(assetId, assetData).first->second;
+
+                // The entry is visible to other threads as soon as the lock is released, take a reference first so a concurrent
+                // find and release can't destroy it before the handle is set up.
+                registeredData->Acquire();
+            }
+
+            isNewEntry = registeredData == assetData;
+            if (!isNewEntry)
+            {
+                // Another thread registered the asset first, use that one instead
+                handler->DestroyAsset(assetData);
+            }
+
+            asset.SetData(registeredData);
+            registeredData->Release();
+            return asset;
+        }
+
+        //=========================================================================
+        // GetAssetShard
+        //=========================================================================
+        AssetManager::AssetShard& AssetManager::GetAssetShard(const AssetId& assetId)
+        {
+            return m_assetShards[AZStd::hash<AssetId>()(assetId) % AssetShardCount];
         }
 
         //=========================================================================
@@ -1202,8 +1268,9 @@ namespace AZ
 
             if (removeAssetFromHash)
             {
-                AZStd::scoped_lock<AZStd::recursive_mutex> asset_lock(m_assetMutex);
-                AssetMap::iterator it = m_assets.find(assetId);
+                AssetShard& shard = GetAssetShard(assetId);
+                AZStd::lock_guard<AZStd::shared_mutex> shardLock(shard.m_mutex);
+                AssetMap::iterator it = shard.m_assets.find(assetId);
                 // need to check the count again in here in case
                // someone was trying to get the asset on another thread
                // Set it to -1 so only this thread will attempt to clean up the cache and delete the asset
@@ -1211,10 +1278,10 @@ namespace AZ
                 // if the assetId is not in the map or if the identifierId
                 // do not match it implies that the asset has been already destroyed.
                 // if the usecount is non zero it implies that we cannot destroy this asset.
-                if (it != m_assets.end() && it->second->m_creationToken == creationToken && it->second->m_weakUseCount.compare_exchange_strong(expectedRefCount, -1))
+                if (it != shard.m_assets.end() && it->second->m_creationToken == creationToken && it->second->m_weakUseCount.compare_exchange_strong(expectedRefCount, -1))
                 {
                     wasInAssetsHash = true;
-                    m_assets.erase(it);
+                    shard.m_assets.erase(it);
                     destroyAsset = true;
                 }
             }
@@ -1264,16 +1331,14 @@ namespace AZ
                 return;
             }
 
-            ReleaseAssetContainersForAsset(asset);
+            ReleaseAssetContainersForAsset(asset->GetId());
         }
 
-        void AssetManager::ReleaseAssetContainersForAsset(AssetData* asset)
+        void AssetManager::ReleaseAssetContainersForAsset(const AssetId& assetId)
         {
             // Release any containers that were loading this asset
             AZStd::scoped_lock lock(m_assetContainerMutex);
 
-            AssetId assetId = asset->GetId();
-
             auto rangeItr = m_ownedAssetContainerLookup.equal_range(assetId);
 
             for (auto itr = rangeItr.first; itr != rangeItr.second;)
@@ -1314,6 +1379,7 @@ namespace AZ
 
             // start the data saving
             SaveAssetJob* saveJob = aznew SaveAssetJob(JobContext::GetGlobalContext(), this, asset, handler);
+            saveJob->SetPriorityClass(JobPriorityClass::Background);
             saveJob->Start();
         }
 
@@ -1322,10 +1388,14 @@ namespace AZ
         //=========================================================================
         void AssetManager::ReloadAsset(const AssetId& assetId, AssetLoadBehavior assetReferenceLoadBehavior, bool isAutoReload)
         {
-            AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
-            auto assetIter = m_assets.find(assetId);
+            AZStd::scoped_lock<AZStd::recursive_mutex> reloadLock(m_reloadMutex);
+
+            // when Asset<T>'s constructor is called (the one that takes an AssetData), it updates the AssetID
+            // of the Asset<T> to be the real latest canonical assetId of the asset, so we cache that here instead of have it happen
+            // implicitly and repeatedly for anything we call.
+            Asset<AssetData> currentAsset = FindRegisteredAsset(assetId, AZ::Data::AssetLoadBehavior::Default);
 
-            if (assetIter == m_assets.end() || assetIter->second->IsLoading())
+            if (!currentAsset || currentAsset->IsLoading())
             {
                 // Only existing assets can be reloaded.
                 return;
@@ -1353,14 +1423,9 @@ namespace AZ
             AssetData* newAssetData = nullptr;
             AssetHandler* handler = nullptr;
 
-            bool preventAutoReload = isAutoReload && assetIter->second && !assetIter->second->HandleAutoReload();
-
-            // when Asset<T>'s constructor is called (the one that takes an AssetData), it updates the AssetID
-            // of the Asset<T> to be the real latest canonical assetId of the asset, so we cache that here instead of have it happen
-            // implicitly and repeatedly for anything we call.
-            Asset<AssetData> currentAsset(assetIter->second, AZ::Data::AssetLoadBehavior::Default);
+            bool preventAutoReload = isAutoReload && !currentAsset->HandleAutoReload();
 
-            if (!assetIter->second->IsRegisterReadonlyAndShareable() && !preventAutoReload)
+            if (!currentAsset->IsRegisterReadonlyAndShareable() && !preventAutoReload)
             {
                 // Reloading an "instance asset" is basically a no-op.
                 // We'll simply notify users to reload the asset.
@@ -1454,24 +1519,22 @@ namespace AZ
 
             {
                 AZ_Assert(asset.Get(), "Asset data for reload is missing.");
-                AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
+                Asset<AssetData> registeredAsset = FindRegisteredAsset(asset.GetId(), AZ::Data::AssetLoadBehavior::Default);
                 AZ_Assert(
-                    m_assets.find(asset.GetId()) != m_assets.end(),
+                    registeredAsset,
                     "Unable to reload asset %s because it's not in the AssetManager's asset list.", asset.ToString<AZStd::string>().c_str());
                 AZ_Assert(
-                    m_assets.find(asset.GetId()) == m_assets.end() ||
-                        asset->RTTI_GetType() == m_assets.find(asset.GetId())->second->RTTI_GetType(),
+                    !registeredAsset || asset->RTTI_GetType() == registeredAsset->RTTI_GetType(),
                     "New and old data types are mismatched!");
 
-                auto found = m_assets.find(asset.GetId());
-                if ((found == m_assets.end()) || (asset->RTTI_GetType() != found->second->RTTI_GetType()))
+                if (!registeredAsset || (asset->RTTI_GetType() != registeredAsset->RTTI_GetType()))
                 {
                     return; // this will just lead to crashes down the line and the above asserts cover this.
                 }
 
                 AssetData* newData = asset.Get();
 
-                if (found->second != newData)
+                if (registeredAsset.Get() != newData)
                 {
                     // Notify users that we are about to change asset
                     AssetBus::Event(asset.GetId(), &AssetBus::Events::OnAssetPreReload, asset);
@@ -1488,8 +1551,8 @@ namespace AZ
                 }
             }
 
-            // We specifically perform this outside of the m_assetMutex lock so that the lock isn't held at the point that
-            // OnAssetReload is triggered inside of AssignAssetData.  Otherwise, we open up a high potential for deadlocks.
+            // We specifically perform this outside of the scope above so that the reference to the old data has been released at the
+            // point that OnAssetReload is triggered inside of AssignAssetData.
             if (shouldAssignAssetData)
             {
                 AssignAssetData(asset);
@@ -1525,9 +1588,10 @@ namespace AZ
             {
                 bool requeue{ false };
                 {
-                    AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
-                    auto found = m_assets.find(assetId);
-                    AZ_Assert(found == m_assets.end() || asset.Get()->RTTI_GetType() == found->second->RTTI_GetType(),
+                    AssetShard& shard = GetAssetShard(assetId);
+                    AZStd::lock_guard<AZStd::shared_mutex> shardLock(shard.m_mutex);
+                    auto found = shard.m_assets.find(assetId);
+                    AZ_Assert(found == shard.m_assets.end() || asset.Get()->RTTI_GetType() == found->second->RTTI_GetType(),
                         "New and old data types are mismatched!");
 
                     // if we are here it implies that we have two assets with the same asset id, and we are 
@@ -1536,14 +1600,17 @@ namespace AZ
                     // because of creation token mismatch when it's ref count finally goes to zero. Since the old asset is not shareable anymore 
                     // manually setting the creationToken to default creation token will ensure that the asset is destroyed correctly.  
                     asset.m_assetData->m_creationToken = ++m_creationTokenGenerator;
-                    if (found != m_assets.end())
+                    if (found != shard.m_assets.end())
                     {
                         found->second->m_creationToken = AZ::Data::s_defaultCreationToken;
                     }
 
                     // Held references to old data are retained, but replace the entry in the DB for future requests.
                     // Fire an OnAssetReloaded message so listeners can react to the new data.
-                    m_assets[assetId] = asset.Get();
+                    shard.m_assets[assetId] = asset.Get();
+                }
+                {
+                    AZStd::scoped_lock<AZStd::recursive_mutex> reloadLock(m_reloadMutex);
 
                     // Release the reload reference.
                     auto reloadInfo = m_reloads.find(assetId);
@@ -1615,15 +1682,11 @@ namespace AZ
                 {
                     AZ_PROFILE_SCOPE_DYNAMIC(AZ::Debug::ProfileCategory::AzCore, "AZ::Data::LoadAssetStreamerCallback %s",
                         loadingAsset.GetHint().c_str());
+                    AssetData::AssetStatus expectedStatus = AssetData::AssetStatus::Queued;
+                    if (!loadingAsset.Get()->m_status.compare_exchange_strong(expectedStatus, AssetData::AssetStatus::StreamReady))
                     {
-                        AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
-                        AssetData* data = loadingAsset.Get();
-                        if (data->GetStatus() != AssetData::AssetStatus::Queued)
-                        {
-                            AZ_Warning("AssetManager", false, "Asset %s no longer in Queued state, abandoning load", loadingAsset.GetId().ToString<AZStd::string>().c_str());
-                            return;
-                        }
-                        data->m_status = AssetData::AssetStatus::StreamReady;
+                        AZ_Warning("AssetManager", false, "Asset %s no longer in Queued state, abandoning load", loadingAsset.GetId().ToString<AZStd::string>().c_str());
+                        return;
                     }
 
                     // The callback from AZ Streamer blocks the streaming thread until this function completes. To minimize the overhead, 
@@ -1636,7 +1699,7 @@ namespace AZ
                     // If there's already an active blocking request waiting for this load to complete, let that thread handle
                     // the load itself instead of consuming a second thread.
                     {
-                        AZStd::scoped_lock<AZStd::recursive_mutex> requestLock(m_activeBlockingRequestMutex);
+                        AZStd::scoped_lock<AZStd::mutex> requestLock(m_activeBlockingRequestMutex);
                         auto range = m_activeBlockingRequests.equal_range(assetId);
                         for(auto blockingRequest = range.first; blockingRequest != range.second; ++blockingRequest)
                         {
@@ -1650,6 +1713,8 @@ namespace AZ
 
                     if (!jobQueued)
                     {
+                        // Nothing is blocked on this load yet, so don't let it hold up frame critical jobs.
+                        loadJob->SetPriorityClass(JobPriorityClass::Background);
                         loadJob->Start();
                     }
                 }
@@ -1719,7 +1784,7 @@ namespace AZ
         {
             // Failed reloads have no side effects. Just notify observers (error reporting, etc).
             {
-                AZStd::lock_guard<AZStd::recursive_mutex> assetLock(m_assetMutex);
+                AZStd::lock_guard<AZStd::recursive_mutex> reloadLock(m_reloadMutex);
                 m_reloads.erase(asset.GetId());
             }
             AssetBus::Event(asset.GetId(), &AssetBus::Events::OnAssetReloadError, asset);
@@ -1750,7 +1815,7 @@ namespace AZ
         //=========================================================================
         void AssetManager::AddJob(AssetDatabaseJob* job)
         {
-            AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_activeJobOrRequestMutex);
+            AZStd::scoped_lock<AZStd::mutex> assetLock(m_activeJobOrRequestMutex);
 
             m_activeJobs.push_back(*job);
         }
@@ -1761,23 +1826,19 @@ namespace AZ
         bool AssetManager::ValidateAndRegisterAssetLoading(const Asset<AssetData>& asset)
         {
             AssetData* data = asset.Get();
+            if (data)
             {
-
-                AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
-                if (data)
+                // The purpose of this function is to validate this asset is still in a StreamReady
+                // and only then continue the load.  We change status to loading if everything
+                // is expected which the blocking RegisterAssetLoading call does not do because it
+                // is already in loading status
+                AssetData::AssetStatus expectedStatus = AssetData::AssetStatus::StreamReady;
+                if (!data->m_status.compare_exchange_strong(expectedStatus, AssetData::AssetStatus::Loading))
                 {
-                    // The purpose of this function is to validate this asset is still in a StreamReady
-                    // and only then continue the load.  We change status to loading if everything
-                    // is expected which the blocking RegisterAssetLoading call does not do because it
-                    // is already in loading status
-                    if (data->GetStatus() != AssetData::AssetStatus::StreamReady)
-                    {
-                        // Something else has attempted to load this asset
-                        return false;
-                    }
-                    data->m_status = AssetData::AssetStatus::Loading;
-                    UpdateDebugStatus(asset);
+                    // Something else has attempted to load this asset
+                    return false;
                 }
+                UpdateDebugStatus(asset);
             }
 
             return true;
@@ -1812,7 +1873,7 @@ namespace AZ
         //=========================================================================
         void AssetManager::RemoveJob(AssetDatabaseJob* job)
         {
-            AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_activeJobOrRequestMutex);
+            AZStd::scoped_lock<AZStd::mutex> assetLock(m_activeJobOrRequestMutex);
 
             m_activeJobs.erase(*job);
         }
@@ -1822,7 +1883,7 @@ namespace AZ
         //=========================================================================
         void AssetManager::AddActiveStreamerRequest(AssetId assetId, AZStd::shared_ptr<AssetDataStream> readRequest)
         {
-            AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_activeJobOrRequestMutex);
+            AZStd::scoped_lock<AZStd::mutex> assetLock(m_activeJobOrRequestMutex);
 
             // Track the request to allow for manual cancellation and for validating completion before AssetManager shutdown
             [[maybe_unused]] auto inserted =
@@ -1833,13 +1894,20 @@ namespace AZ
 
         void AssetManager::RescheduleStreamerRequest(AssetId assetId, AZStd::chrono::milliseconds newDeadline, AZ::IO::IStreamerTypes::Priority newPriority)
         {
-            AZStd::scoped_lock lock(m_activeJobOrRequestMutex);
-
-            auto iterator = m_activeAssetDataStreamRequests.find(assetId);
+            AZStd::shared_ptr<AssetDataStream> request;
+            {
+                AZStd::scoped_lock<AZStd::mutex> lock(m_activeJobOrRequestMutex);
+                auto iterator = m_activeAssetDataStreamRequests.find(assetId);
+                if (iterator != m_activeAssetDataStreamRequests.end())
+                {
+                    request = iterator->second;
+                }
+            }
 
-            if (iterator != m_activeAssetDataStreamRequests.end())
+            // Reschedule outside of the lock, the request is kept alive by the local reference.
+            if (request)
             {
-                iterator->second->Reschedule(newDeadline, newPriority);
+                request->Reschedule(newDeadline, newPriority);
             }
         }
 
@@ -1848,8 +1916,17 @@ namespace AZ
         //=========================================================================
         void AssetManager::RemoveActiveStreamerRequest(AssetId assetData)
         {
-            AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_activeJobOrRequestMutex);
-            m_activeAssetDataStreamRequests.erase(assetData);
+            // The request is released after the lock so its destruction doesn't happen while other threads wait on the lock.
+            AZStd::shared_ptr<AssetDataStream> request;
+            {
+                AZStd::scoped_lock<AZStd::mutex> assetLock(m_activeJobOrRequestMutex);
+                auto iterator = m_activeAssetDataStreamRequests.find(assetData);
+                if (iterator != m_activeAssetDataStreamRequests.end())
+                {
+                    request = AZStd::move(iterator->second);
+                    m_activeAssetDataStreamRequests.erase(iterator);
+                }
+            }
         }
 
         //=========================================================================
@@ -1857,7 +1934,7 @@ namespace AZ
         //=========================================================================
         bool AssetManager::HasActiveJobsOrStreamerRequests()
         {
-            AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_activeJobOrRequestMutex);
+            AZStd::scoped_lock<AZStd::mutex> assetLock(m_activeJobOrRequestMutex);
 
             return (!(m_activeJobs.empty() && m_activeAssetDataStreamRequests.empty()));
         }
@@ -1867,7 +1944,7 @@ namespace AZ
         //=========================================================================
         void AssetManager::AddBlockingRequest(AssetId assetId, WaitForAsset* blockingRequest)
         {
-            AZStd::scoped_lock<AZStd::recursive_mutex> requestLock(m_activeBlockingRequestMutex);
+            AZStd::scoped_lock<AZStd::mutex> requestLock(m_activeBlockingRequestMutex);
 
             auto inserted = m_activeBlockingRequests.insert(AZStd::make_pair(assetId, blockingRequest));
             AZ_Assert(inserted.second, "Failed to track blocking request for asset %s", assetId.ToString<AZStd::string>().c_str());
@@ -1878,7 +1955,7 @@ namespace AZ
         //=========================================================================
         void AssetManager::RemoveBlockingRequest(AssetId assetId, WaitForAsset* blockingRequest)
         {
-            AZStd::scoped_lock<AZStd::recursive_mutex> requestLock(m_activeBlockingRequestMutex);
+            AZStd::scoped_lock<AZStd::mutex> requestLock(m_activeBlockingRequestMutex);
             [[maybe_unused]] bool requestFound = false;
             for (auto assetIdIterator = m_activeBlockingRequests.find(assetId); assetIdIterator != m_activeBlockingRequests.end(); )
             {
@@ -1904,7 +1981,7 @@ namespace AZ
         //=========================================================================
         AssetStreamInfo AssetManager::GetLoadStreamInfoForAsset(const AssetId& assetId, const AssetType& assetType)
         {
-            AZStd::scoped_lock<AZStd::recursive_mutex> catalogLock(m_catalogMutex);
+            AZStd::shared_lock<AZStd::shared_mutex> catalogLock(m_catalogMutex);
             AssetCatalogMap::iterator catIt = m_catalogs.find(assetType);
             if (catIt == m_catalogs.end())
             {
@@ -1920,7 +1997,7 @@ namespace AZ
         //=========================================================================
         AssetStreamInfo AssetManager::GetSaveStreamInfoForAsset(const AssetId& assetId, const AssetType& assetType)
         {
-            AZStd::scoped_lock<AZStd::recursive_mutex> catalogLock(m_catalogMutex);
+            AZStd::shared_lock<AZStd::shared_mutex> catalogLock(m_catalogMutex);
             AssetCatalogMap::iterator catIt = m_catalogs.find(assetType);
             if (catIt == m_catalogs.end())
             {
@@ -1987,6 +2064,16 @@ namespace AZ
         {
             AssetBus::QueueFunction([this, assetContainer, asset = assetContainer->GetRootAsset()]()
             {
+                if (!m_debugAssetEvents)
+                {
+                    m_debugAssetEvents = AZ::Interface<IDebugAssetEvent>::Get();
+                }
+
+                if (m_debugAssetEvents)
+                {
+                    m_debugAssetEvents->AssetContainerReady(assetContainer->GetContainerAssetId(), assetContainer->GetTimeToReady());
+                }
+
                 NotifyAssetContainerReady(asset);
                 ReleaseOwnedAssetContainer(assetContainer);
             });
@@ -2104,13 +2191,17 @@ namespace AZ
                                                bool isReload, AZ::Data::AssetHandler* assetHandler)
         {
             {
-                // We may need to revalidate that this asset hasn't already passed through postLoad
-                AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
-                if (asset->IsReady() || asset->m_status == AssetData::AssetStatus::LoadedPreReady)
+                // We may need to revalidate that this asset hasn't already passed through postLoad. Only the thread that
+                // moves the status to LoadedPreReady continues.
+                AssetData::AssetStatus currentStatus = asset->m_status.load();
+                do
                 {
-                    return;
-                }
-                asset->m_status = AssetData::AssetStatus::LoadedPreReady;
+                    if (currentStatus == AssetData::AssetStatus::Ready || currentStatus == AssetData::AssetStatus::ReadyPreNotify ||
+                        currentStatus == AssetData::AssetStatus::LoadedPreReady)
+                    {
+                        return;
+                    }
+                } while (!asset->m_status.compare_exchange_weak(currentStatus, AssetData::AssetStatus::LoadedPreReady));
                 UpdateDebugStatus(asset);
             }
             PostLoad(asset, loadSucceeded, isReload, assetHandler);
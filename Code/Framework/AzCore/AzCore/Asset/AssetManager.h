@@ -16,8 +16,10 @@
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/SystemAllocator.h> // used as allocator for most components
 #include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/shared_mutex.h>
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/string/string.h>
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/intrusive_list.h>
 #include <AzCore/std/parallel/binary_semaphore.h>
@@ -66,6 +68,8 @@ namespace AZ
 
             virtual void AssetStatusUpdate(AZ::Data::AssetId id, AZ::Data::AssetData::AssetStatus status) = 0;
             virtual void ReleaseAsset(AZ::Data::AssetId id) = 0;
+            //! Called once an asset container and all of its dependencies are ready, with the time it took from creation.
+            virtual void AssetContainerReady([[maybe_unused]] AZ::Data::AssetId id, [[maybe_unused]] AZStd::chrono::milliseconds timeToReady) {}
         };
 
         struct AssetContainerKey
@@ -356,6 +360,15 @@ namespace AZ
 
             void UpdateDebugStatus(const AZ::Data::Asset<AZ::Data::AssetData>& asset);
 
+            //! Returns the asset registered under the given canonical id, or an empty asset if there isn't one.
+            Asset<AssetData> FindRegisteredAsset(const AssetId& assetId, AssetLoadBehavior assetReferenceLoadBehavior);
+
+            //! Creates new data for an asset and registers it if it's shareable. If another thread registered an asset with the
+            //! same id in the meantime, the new data is discarded and the registered asset is returned instead.
+            //! @param isNewEntry Set to true if the returned asset was created by this call.
+            Asset<AssetData> CreateAndRegisterAsset(const AssetId& assetId, const AssetType& assetType, AssetHandler* handler,
+                AssetLoadBehavior assetReferenceLoadBehavior, bool& isNewEntry);
+
             /**
             * Gets a root asset and dependencies as individual async loads if necessary.
             * \param assetId a valid id of the asset
@@ -374,7 +387,7 @@ namespace AZ
             * If all "external" references to the asset are destroyed (i.e. nothing but loading code references the asset),
             * this makes sure that the containers are cleaned up and the loading is canceled as a part of destroying the AssetData.
             **/
-            void ReleaseAssetContainersForAsset(AssetData* asset);
+            void ReleaseAssetContainersForAsset(const AssetId& assetId);
 
             /**
             * Clears all references to the owned asset container.
@@ -401,11 +414,23 @@ namespace AZ
                 const AZ::Data::AssetStreamInfo& streamInfo, bool isReload,
                 AssetHandler* handler, const AssetLoadParameters& loadParameters, bool signalLoaded);
 
+            //! Registered assets are spread over independently locked shards by their id, so threads working on different assets
+            //! rarely contend. Looking up an existing asset only takes the shard lock in shared mode, it's only taken exclusively
+            //! to add or remove an entry. Asset status changes during loading don't take any of these locks, they're atomic
+            //! transitions on the asset itself.
+            struct AssetShard
+            {
+                AZStd::shared_mutex m_mutex;   // lock when accessing the asset map of this shard
+                AssetMap m_assets;
+            };
+            static constexpr size_t AssetShardCount = 64;
+
+            AssetShard& GetAssetShard(const AssetId& assetId);
+
             AssetHandlerMap         m_handlers;
             AssetCatalogMap         m_catalogs;
-            AZStd::recursive_mutex  m_catalogMutex;     // lock when accessing the catalog map
-            AssetMap                m_assets;
-            AZStd::recursive_mutex  m_assetMutex;       // lock when accessing the asset map
+            AZStd::shared_mutex     m_catalogMutex;     // lock when accessing the catalog map, lookups only need shared access
+            AZStd::array<AssetShard, AssetShardCount> m_assetShards;
 
             WeakAssetContainerMap   m_assetContainers;
             OwnedAssetContainerMap  m_ownedAssetContainers;
@@ -415,10 +440,11 @@ namespace AZ
             AZStd::thread::id m_mainThreadId;
             IDebugAssetEvent* m_debugAssetEvents{ nullptr };
 
-            int m_creationTokenGenerator = 0; // this is used to generate unique identifiers for assets
+            AZStd::atomic_int m_creationTokenGenerator{ 0 }; // this is used to generate unique identifiers for assets
 
             typedef AZStd::unordered_map<AssetId, Asset<AssetData> > ReloadMap;
             ReloadMap               m_reloads;          // book-keeping and reference-holding for asset reloads
+            AZStd::recursive_mutex  m_reloadMutex;      // lock when accessing the reload map
 
             typedef AZStd::intrusive_list<AssetDatabaseJob, AZStd::list_base_hook<AssetDatabaseJob> > ActiveJobList;
             ActiveJobList           m_activeJobs;
@@ -428,7 +454,7 @@ namespace AZ
             AssetRequestMap m_activeAssetDataStreamRequests;
 
             // Lock when accessing the list of active jobs or streamer requests
-            AZStd::recursive_mutex  m_activeJobOrRequestMutex;
+            AZStd::mutex            m_activeJobOrRequestMutex;
 
             //! The set of all blocking requests that currently exist, grouped by AssetId.
             //! The information is used internally to route LoadAssetJob processing to any thread that currently is blocked waiting
@@ -436,7 +462,7 @@ namespace AZ
             using BlockingRequestMap = AZStd::unordered_multimap<AssetId, WaitForAsset*>;
             BlockingRequestMap m_activeBlockingRequests;
             // Mutex lock when accessing the list of active blocking requests
-            AZStd::recursive_mutex  m_activeBlockingRequestMutex;
+            AZStd::mutex            m_activeBlockingRequestMutex;
 
             //! Enable or disable parallel loading of dependent assets via the use of Asset Containers.
             //! default = true, but Asset Builders and other tools using real-time in-progress dependency information need
@@ -22,6 +22,7 @@
 
 #include <AzCore/Memory/OverrunDetectionAllocator.h>
 #include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/Memory/FrameArenaAllocator.h>
 #include <AzCore/Memory/MallocSchema.h>
 
 #include <AzCore/NativeUI/NativeUIRequests.h>
@@ -479,6 +480,11 @@ namespace AZ
         // for the application root.
         CalculateAppRoot();
 
+        // The cache of parsed registry folders is shared by all processes of the user, so it's opt-in. Applications that are
+        // launched often enable it after construction, otherwise it can be turned on from the command line. This is done after
+        // the command line has been merged as that can override the home directory.
+        SettingsRegistryMergeUtils::ConfigureMergeCache(*m_settingsRegistry, false);
+
         SettingsRegistryMergeUtils::MergeSettingsToRegistry_O3deUserRegistry(*m_settingsRegistry, AZ_TRAIT_OS_PLATFORM_CODENAME, {});
         SettingsRegistryMergeUtils::MergeSettingsToRegistry_CommandLine(*m_settingsRegistry, m_commandLine, executeRegDumpCommands);
         SettingsRegistryMergeUtils::MergeSettingsToRegistry_AddRuntimeFilePaths(*m_settingsRegistry);
@@ -1420,6 +1426,12 @@ namespace AZ
         {
             m_drillerManager->FrameUpdate();
         }
+
+        // The end of the tick is the frame boundary for transient per-frame memory
+        if (AllocatorInstance<FrameArenaAllocator>::IsReady())
+        {
+            static_cast<FrameArenaAllocator&>(AllocatorInstance<FrameArenaAllocator>::GetAllocator()).AdvanceFrame();
+        }
     }
 
     //=========================================================================
@@ -409,6 +409,11 @@ namespace AZ
         //! A static transform will never move.
         bool m_isStatic = false;
 
+        //! Whether the transforms are stored in the AzFramework::ITransformHierarchySystem.
+        //! The world transforms of the entity and its children are then updated once per tick instead of immediately,
+        //! and the transform notifications are sent when the changes are processed.
+        bool m_useTransformHierarchy = false;
+
         /// @cond EXCLUDE_DOCS
 
         /// @deprecated Deprecated, access properties directly.
@@ -472,9 +472,11 @@ namespace AZ
                 && result.GetProcessing() == JsonSerializationResult::Processing::Completed
                 && inputKey.IsRelativeTo(consoleRootCommandKey))
             {
-                if (auto type = m_settingsRegistry.GetType(path); type != SettingsRegistryInterface::Type::NoType)
+                // Parse the path once for both the type and the value lookup.
+                const SettingsRegistryInterface::PathHandle pathHandle(path);
+                if (auto type = m_settingsRegistry.GetType(pathHandle); type != SettingsRegistryInterface::Type::NoType)
                 {
-                    operator()(path, type);
+                    operator()(pathHandle, type);
                 }
             }
 
@@ -493,11 +495,16 @@ namespace AZ
         }
 
         void operator()(AZStd::string_view path, SettingsRegistryInterface::Type type)
+        {
+            operator()(SettingsRegistryInterface::PathHandle(path), type);
+        }
+
+        void operator()(const SettingsRegistryInterface::PathHandle& path, SettingsRegistryInterface::Type type)
         {
             using FixedValueString = AZ::SettingsRegistryInterface::FixedValueString;
 
             AZ::IO::PathView consoleRootCommandKey{ IConsole::ConsoleRootCommandKey, AZ::IO::PosixPathSeparator };
-            AZ::IO::PathView inputKey{ path, AZ::IO::PosixPathSeparator };
+            AZ::IO::PathView inputKey{ path.GetPath(), AZ::IO::PosixPathSeparator };
             if (inputKey.IsRelativeTo(consoleRootCommandKey))
             {
                 FixedValueString command = inputKey.LexicallyRelative(consoleRootCommandKey).Native();
@@ -637,6 +637,19 @@ namespace AZ
             */
             using ConnectLockGuard = AZStd::conditional_t<AZStd::is_same_v<ContextMutexType, AZ::NullMutex>, AZ::Internal::NullLockGuard<ContextMutexType>, AZStd::unique_lock<ContextMutexType>>;
 
+            /**
+             * True if the bus doesn't have a MutexType and isn't lockless, which means it may only be used from a single thread
+             * at a time (typically the main thread, e.g. TickBus and TransformNotificationBus).
+             * Dispatching on these buses doesn't take a lock and doesn't use any atomic operations.
+             * Set EBUS_AUDIT_THREADS to 1 to report buses that are used from multiple threads regardless.
+             */
+            static constexpr bool SingleThreadedDispatch = AZStd::is_same_v<ContextMutexType, AZ::NullMutex>;
+
+            /**
+             * The counter of active dispatches only needs to be atomic if the bus can be dispatched on from multiple threads.
+             */
+            using DispatchCounterType = AZStd::conditional_t<SingleThreadedDispatch, unsigned int, AZStd::atomic_uint>;
+
             BusesContainer          m_buses;         ///< The actual bus container, which is a static map for each bus type.
             ContextMutexType        m_contextMutex;  ///< Mutex to control access when modifying the context
             QueuePolicy             m_queue;
@@ -659,7 +672,11 @@ namespace AZ
 
             mutable AZStd::unordered_map<AZStd::native_thread_id_type, CallstackEntryRoot, AZStd::hash<AZStd::native_thread_id_type>, AZStd::equal_to<AZStd::native_thread_id_type>, AZ::Internal::EBusEnvironmentAllocator> m_callstackRoots;
             CallstackEntryStorageType s_callstack;    ///< Linked list of other bus calls to this bus on the stack, per thread if MutexType is defined
-            AZStd::atomic_uint m_dispatches;   ///< Number of active dispatches in progress
+            DispatchCounterType m_dispatches;   ///< Number of active dispatches in progress
+#if EBUS_AUDIT_THREADS
+            AZStd::atomic<AZStd::native_thread_id_type> m_auditThreadId{}; ///< First thread that used a single threaded bus
+            AZStd::atomic_bool m_auditReported{ false };
+#endif
 
             friend CallstackEntry;
         };
@@ -13,8 +13,9 @@
 #include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/std/containers/vector.h>
-#include <AzCore/std/containers/stack.h>
 #include <AzCore/std/function/function_template.h>
+#include <AzCore/std/function/invoke.h>
+#include <AzCore/std/typetraits/remove_cvref.h>
 
 namespace AZ
 {
@@ -39,6 +40,67 @@ namespace AZ
     template <typename... Params>
     class EventHandler;
 
+    namespace Internal
+    {
+        //! Type erased callable stored by an EventHandler.
+        //! Callables that fit in the inline buffer (lambdas capturing a few values, function pointers and AZStd::function itself)
+        //! are stored in place, so binding, moving and invoking them never allocates. Larger or over-aligned callables fall back to
+        //! a single SystemAllocator allocation.
+        template <typename... Params>
+        class EventCallback final
+        {
+        public:
+            static constexpr size_t InlineSize = sizeof(AZStd::function<void(Params...)>) > 4 * sizeof(void*)
+                ? sizeof(AZStd::function<void(Params...)>) : 4 * sizeof(void*);
+            static constexpr size_t InlineAlignment = alignof(AZStd::function<void(Params...)>) > alignof(double)
+                ? alignof(AZStd::function<void(Params...)>) : alignof(double);
+
+            template <typename Function>
+            static constexpr bool IsStoredInline = sizeof(Function) <= InlineSize && alignof(Function) <= InlineAlignment;
+
+            EventCallback() = default;
+            template <typename Function, typename = AZStd::enable_if_t<!AZStd::is_same_v<AZStd::remove_cvref_t<Function>, EventCallback>>>
+            explicit EventCallback(Function&& function);
+            EventCallback(const EventCallback& rhs);
+            EventCallback(EventCallback&& rhs);
+
+            ~EventCallback();
+
+            EventCallback& operator=(const EventCallback& rhs);
+            EventCallback& operator=(EventCallback&& rhs);
+
+            //! Returns true if a callable is bound.
+            explicit operator bool() const;
+
+            //! Returns true if the bound callable lives on the heap instead of in the inline buffer.
+            bool IsHeapAllocated() const;
+
+            void operator()(const Params&... params);
+
+        private:
+            struct Operations
+            {
+                void (*m_invoke)(void* storage, const Params&... params);
+                void (*m_relocate)(void* destination, void* source); //< Move constructs into destination and destroys source
+                void (*m_copy)(void* destination, const void* source); //< nullptr if the callable isn't copy constructible
+                void (*m_destroy)(void* storage);
+                bool m_isHeapAllocated;
+            };
+
+            template <typename Function>
+            struct OperationsFor;
+
+            //! Expects this callback to be unbound
+            void CopyFrom(const EventCallback& rhs);
+            //! Expects this callback to be unbound, leaves rhs unbound
+            void MoveFrom(EventCallback& rhs);
+            void Reset();
+
+            const Operations* m_operations = nullptr;
+            alignas(InlineAlignment) unsigned char m_storage[InlineSize];
+        };
+    }
+
     template <typename... Params>
     class Event final
     {
@@ -78,12 +140,17 @@ namespace AZ
 
     private:
 
-        // Note that these are mutable because we want Signal() to be const, but we do a bunch of book-keeping during Signal()
-        mutable AZStd::vector<Handler*> m_handlers; //< Active handlers
-        mutable AZStd::vector<Handler*> m_addList; //< Handlers added during a Signal, pending being added to the active handlers
-        mutable AZStd::stack<size_t> m_freeList; //< Set of unused handler indices
+        //! Removes the slots of handlers that disconnected during a Signal, used once the outermost Signal has finished
+        void CompactHandlers() const;
 
-        mutable bool m_updating = false; //< Raised during a Signal, false otherwise, used to guard m_handlers during handler iteration
+    private:
+
+        // Note that these are mutable because we want Signal() to be const, but we do a bunch of book-keeping during Signal()
+        // Handlers are stored densely. Outside of a Signal a disconnect swaps the last handler into the freed slot, during a Signal
+        // the slot is cleared instead and the array is compacted when the outermost Signal completes. Neither path allocates.
+        mutable AZStd::vector<Handler*> m_handlers; //< Connected handlers, may contain nullptr entries while signaling
+        mutable uint32_t m_signalDepth = 0; //< Number of active (possibly nested) Signal calls
+        mutable bool m_hasDisconnectedHandlers = false; //< True if m_handlers contains nullptr entries that need compacting
     };
 
     //! A handler class that can connect to an Event
@@ -97,12 +164,19 @@ namespace AZ
 
         AZ_CLASS_ALLOCATOR(EventHandler<Params...>, AZ::SystemAllocator, 0);
 
+        //! Returns true if a callable of the provided type is stored inside the handler rather than in a separate allocation.
+        template <typename Function>
+        static constexpr bool IsCallbackStoredInline = Internal::EventCallback<Params...>::template IsStoredInline<AZStd::decay_t<Function>>;
+
         // We support default constructing of event handles (with no callback function being bound) to allow for better usage with container types
         // An unbound event handle cannot be added to an event and we do not support dynamically binding the callback post construction
         // (except for on assignment since that will also add the handle to the event; i.e. there is no way to unbind the callback after being added to an event)
         EventHandler() = default;
         explicit EventHandler(std::nullptr_t);
-        explicit EventHandler(Callback callback);
+        //! Binds any callable invocable with the event parameters. Small callables are stored inline in the handler.
+        template <typename Function, typename = AZStd::enable_if_t<
+            !AZStd::is_same_v<AZStd::remove_cvref_t<Function>, EventHandler> && !AZStd::is_same_v<AZStd::remove_cvref_t<Function>, std::nullptr_t>>>
+        explicit EventHandler(Function&& callback);
         EventHandler(const EventHandler& rhs);
         EventHandler(EventHandler&& rhs);
 
@@ -129,8 +203,8 @@ namespace AZ
         void SwapEventHandlerPointers(const EventHandler& from);
 
         const Event<Params...>* m_event = nullptr; //< The connected event
-        int32_t m_index = 0; //< Index into the add or handler vectors (negative means pending add)
-        Callback m_callback; //< The lambda to invoke during events
+        int32_t m_index = 0; //< Index into the handler vector of the connected event
+        Internal::EventCallback<Params...> m_callback; //< The lambda to invoke during events
     };
 
     AZ_TYPE_INFO_INTERNAL_SPECIALIZED_TEMPLATE_PREFIX_UUID(AZ::Event, "Event", "{B7388760-18BF-486A-BE96-D5765791C53C}", AZ_TYPE_INFO_INTERNAL_TYPENAME_VARARGS);
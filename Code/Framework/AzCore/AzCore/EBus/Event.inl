@@ -10,6 +10,216 @@
 
 namespace AZ
 {
+    namespace Internal
+    {
+        template <typename... Params>
+        template <typename Function>
+        struct EventCallback<Params...>::OperationsFor
+        {
+            static constexpr bool StoredInline = IsStoredInline<Function>;
+
+            static Function* Get(void* storage)
+            {
+                if constexpr (StoredInline)
+                {
+                    return reinterpret_cast<Function*>(storage);
+                }
+                else
+                {
+                    return *reinterpret_cast<Function**>(storage);
+                }
+            }
+
+            template <typename Arg>
+            static void Construct(void* storage, Arg&& function)
+            {
+                if constexpr (StoredInline)
+                {
+                    new (storage) Function(AZStd::forward<Arg>(function));
+                }
+                else
+                {
+                    void* memory = AZ::AllocatorInstance<AZ::SystemAllocator>::Get().Allocate(
+                        sizeof(Function), alignof(Function), 0, "AZ::EventHandler callback", __FILE__, __LINE__);
+                    *reinterpret_cast<Function**>(storage) = new (memory) Function(AZStd::forward<Arg>(function));
+                }
+            }
+
+            static void Invoke(void* storage, const Params&... params)
+            {
+                AZStd::invoke(*Get(storage), params...);
+            }
+
+            static void Relocate(void* destination, void* source)
+            {
+                if constexpr (StoredInline)
+                {
+                    Function* function = Get(source);
+                    new (destination) Function(AZStd::move(*function));
+                    function->~Function();
+                }
+                else
+                {
+                    // Heap allocated callables only need their pointer handed over
+                    *reinterpret_cast<Function**>(destination) = Get(source);
+                }
+            }
+
+            static void Copy(void* destination, const void* source)
+            {
+                Construct(destination, *Get(const_cast<void*>(source)));
+            }
+
+            static void Destroy(void* storage)
+            {
+                Function* function = Get(storage);
+                function->~Function();
+                if constexpr (!StoredInline)
+                {
+                    AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(function, sizeof(Function), alignof(Function));
+                }
+            }
+
+            static const Operations* GetOperations()
+            {
+                if constexpr (AZStd::is_copy_constructible_v<Function>)
+                {
+                    static constexpr Operations operations{ &Invoke, &Relocate, &Copy, &Destroy, !StoredInline };
+                    return &operations;
+                }
+                else
+                {
+                    static constexpr Operations operations{ &Invoke, &Relocate, nullptr, &Destroy, !StoredInline };
+                    return &operations;
+                }
+            }
+        };
+
+
+        template <typename... Params>
+        template <typename Function, typename>
+        EventCallback<Params...>::EventCallback(Function&& function)
+        {
+            using FunctionType = AZStd::decay_t<Function>;
+            // Null function pointers and empty AZStd::functions leave the callback unbound
+            if constexpr (AZStd::is_constructible_v<bool, const FunctionType&>)
+            {
+                if (!static_cast<bool>(function))
+                {
+                    return;
+                }
+            }
+
+            OperationsFor<FunctionType>::Construct(m_storage, AZStd::forward<Function>(function));
+            m_operations = OperationsFor<FunctionType>::GetOperations();
+        }
+
+
+        template <typename... Params>
+        EventCallback<Params...>::EventCallback(const EventCallback& rhs)
+        {
+            CopyFrom(rhs);
+        }
+
+
+        template <typename... Params>
+        EventCallback<Params...>::EventCallback(EventCallback&& rhs)
+        {
+            MoveFrom(rhs);
+        }
+
+
+        template <typename... Params>
+        EventCallback<Params...>::~EventCallback()
+        {
+            Reset();
+        }
+
+
+        template <typename... Params>
+        EventCallback<Params...>& EventCallback<Params...>::operator=(const EventCallback& rhs)
+        {
+            if (this != &rhs)
+            {
+                Reset();
+                CopyFrom(rhs);
+            }
+            return *this;
+        }
+
+
+        template <typename... Params>
+        EventCallback<Params...>& EventCallback<Params...>::operator=(EventCallback&& rhs)
+        {
+            if (this != &rhs)
+            {
+                Reset();
+                MoveFrom(rhs);
+            }
+            return *this;
+        }
+
+
+        template <typename... Params>
+        EventCallback<Params...>::operator bool() const
+        {
+            return m_operations != nullptr;
+        }
+
+
+        template <typename... Params>
+        bool EventCallback<Params...>::IsHeapAllocated() const
+        {
+            return m_operations && m_operations->m_isHeapAllocated;
+        }
+
+
+        template <typename... Params>
+        void EventCallback<Params...>::operator()(const Params&... params)
+        {
+            m_operations->m_invoke(m_storage, params...);
+        }
+
+
+        template <typename... Params>
+        void EventCallback<Params...>::CopyFrom(const EventCallback& rhs)
+        {
+            if (rhs.m_operations)
+            {
+                AZ_Assert(rhs.m_operations->m_copy, "Event handler callback is not copy constructible");
+                if (rhs.m_operations->m_copy)
+                {
+                    rhs.m_operations->m_copy(m_storage, rhs.m_storage);
+                    m_operations = rhs.m_operations;
+                }
+            }
+        }
+
+
+        template <typename... Params>
+        void EventCallback<Params...>::MoveFrom(EventCallback& rhs)
+        {
+            if (rhs.m_operations)
+            {
+                rhs.m_operations->m_relocate(m_storage, rhs.m_storage);
+                m_operations = rhs.m_operations;
+                rhs.m_operations = nullptr;
+            }
+        }
+
+
+        template <typename... Params>
+        void EventCallback<Params...>::Reset()
+        {
+            if (m_operations)
+            {
+                m_operations->m_destroy(m_storage);
+                m_operations = nullptr;
+            }
+        }
+    }
+
+
     template <typename... Params>
     EventHandler<Params...>::EventHandler(std::nullptr_t)
     {
@@ -18,8 +228,9 @@ namespace AZ
 
 
     template <typename... Params>
-    EventHandler<Params...>::EventHandler(Callback callback)
-        : m_callback(AZStd::move(callback))
+    template <typename Function, typename>
+    EventHandler<Params...>::EventHandler(Function&& callback)
+        : m_callback(AZStd::forward<Function>(callback))
     {
         ;
     }
@@ -149,18 +360,8 @@ namespace AZ
         // Find the pointer to the 'from' handler and point it to this handler
         if (m_event)
         {
-            // The index is negative if the handle is in the pending add list
-            // The index can then be converted to the add list index in which it lives
-            if (m_index < 0)
-            {
-                AZ_Assert(m_event->m_addList[-(m_index + 1)] == &from, "From handle does not match");
-                m_event->m_addList[-(m_index + 1)] = this;
-            }
-            else
-            {
-                AZ_Assert(m_event->m_handlers[m_index] == &from, "From handle does not match");
-                m_event->m_handlers[m_index] = this;
-            }
+            AZ_Assert(m_event->m_handlers[m_index] == &from, "From handle does not match");
+            m_event->m_handlers[m_index] = this;
         }
     }
 
@@ -168,14 +369,14 @@ namespace AZ
     template <typename... Params>
     Event<Params...>::Event(Event&& rhs)
         : m_handlers(AZStd::move(rhs.m_handlers))
-        , m_addList(AZStd::move(rhs.m_addList))
-        , m_freeList(AZStd::move(rhs.m_freeList))
-        , m_updating(rhs.m_updating)
+        , m_hasDisconnectedHandlers(rhs.m_hasDisconnectedHandlers)
     {
         // Move all sub-objects into this event and fixup each handle to point to this event
         // Revert the r-value event to it's default state (the moves should do it but PODs need to be set)
+        AZ_Assert(rhs.m_signalDepth == 0, "Moving an event while it is being signaled is unsupported");
+        CompactHandlers();
         BindHandlerEventPointers();
-        rhs.m_updating = false;
+        rhs.m_hasDisconnectedHandlers = false;
     }
 
 
@@ -192,16 +393,16 @@ namespace AZ
         // Remove all previous handles which will update them as needed
         // Move all sub-objects into this event and fixup each handle to point to this event
         // Revert the r-value event to it's default state (the moves should do it but PODs need to be set)
+        AZ_Assert(m_signalDepth == 0 && rhs.m_signalDepth == 0, "Moving an event while it is being signaled is unsupported");
         DisconnectAllHandlers();
 
         m_handlers = AZStd::move(rhs.m_handlers);
-        m_addList = AZStd::move(rhs.m_addList);
-        m_freeList = AZStd::move(rhs.m_freeList);
-        m_updating = rhs.m_updating;
+        m_hasDisconnectedHandlers = rhs.m_hasDisconnectedHandlers;
 
+        CompactHandlers();
         BindHandlerEventPointers();
 
-        rhs.m_updating = false;
+        rhs.m_hasDisconnectedHandlers = false;
 
         return *this;
     }
@@ -210,6 +411,12 @@ namespace AZ
     template <typename... Params>
     bool Event<Params...>::HasHandlerConnected() const
     {
+        // Disconnected slots only exist while a signal is in progress
+        if (!m_hasDisconnectedHandlers)
+        {
+            return !m_handlers.empty();
+        }
+
         for (Handler* handler : m_handlers)
         {
             if (handler)
@@ -225,72 +432,50 @@ namespace AZ
     template <typename... Params>
     void Event<Params...>::DisconnectAllHandlers()
     {
-        // Clear all our added handlers
-        for (Handler* handler : m_handlers)
+        for (Handler*& handler : m_handlers)
         {
             if (handler)
             {
                 AZ_Assert(handler->m_event == this, "Entry event does not match");
-                handler->Disconnect();
+                handler->m_event = nullptr;
+                handler = nullptr;
             }
         }
 
-        // Clear any handlers still pending registration
-        for (Handler* handler : m_addList)
+        if (m_signalDepth > 0)
         {
-            AZ_Assert(handler, "NULL handler encountered in Event addList");
-            AZ_Assert(handler->m_event == this, "Entry event does not match");
-            handler->Disconnect();
+            // A signal is iterating over the handlers, leave removing the cleared slots to the outermost signal
+            m_hasDisconnectedHandlers = !m_handlers.empty();
+        }
+        else
+        {
+            // Keep the capacity so reconnecting handlers doesn't allocate again, it's released when the event is destroyed
+            m_handlers.clear();
+            m_hasDisconnectedHandlers = false;
         }
-
-        // Free up any owned memory
-        AZStd::vector<Handler*> freeHandlers;
-        m_handlers.swap(freeHandlers);
-        AZStd::vector<Handler*> freeAdds;
-        m_addList.swap(freeAdds);
-        AZStd::stack<size_t> freeFree;
-        m_freeList.swap(freeFree);
     }
 
 
     template <typename... Params>
     void Event<Params...>::Signal(const Params&... params) const
     {
-        m_updating = true;
+        ++m_signalDepth;
 
-        // Trigger all added handler callbacks
-        for (Handler* handler : m_handlers)
+        // Handlers connected during the signal are appended to m_handlers and are only invoked by later signals,
+        // handlers disconnected during the signal leave a nullptr behind and are skipped
+        const size_t handlerCount = m_handlers.size();
+        for (size_t i = 0; i < handlerCount; ++i)
         {
-            if (handler)
+            if (Handler* handler = m_handlers[i])
             {
                 handler->m_callback(params...);
             }
         }
 
-        // Update our handlers if we have pending adds
-        if (!m_addList.empty())
+        if (--m_signalDepth == 0 && m_hasDisconnectedHandlers)
         {
-            for (Handler* handler : m_addList)
-            {
-                AZ_Assert(handler, "NULL handler encountered in Event addList");
-                if (m_freeList.empty())
-                {
-                    handler->m_index = aznumeric_cast<int32_t>(m_handlers.size());
-                    m_handlers.push_back(handler);
-                }
-                else
-                {
-                    handler->m_index = aznumeric_cast<int32_t>(m_freeList.top());
-                    m_freeList.pop();
-
-                    AZ_Assert(m_handlers[handler->m_index] == nullptr, "Callback already registered");
-                    m_handlers[handler->m_index] = handler;
-                }
-            }
-            m_addList.clear();
+            CompactHandlers();
         }
-
-        m_updating = false;
     }
 
 
@@ -298,19 +483,9 @@ namespace AZ
     inline void Event<Params...>::BindHandlerEventPointers()
     {
         for (Handler* handler : m_handlers)
-        {
-            if (handler)
-            {
-                // This should have happened as part of a move so none of the pointers should refer to this event (they should also all refer to the same event)
-                AZ_Assert(handler->m_event != this, "Should not refer to this");
-                handler->m_event = this;
-            }
-        }
-
-        for (Handler* handler : m_addList)
         {
             // This should have happened as part of a move so none of the pointers should refer to this event (they should also all refer to the same event)
-            AZ_Assert(handler, "NULL handler encountered in Event addList");
+            AZ_Assert(handler, "NULL handler encountered in Event handlers");
             AZ_Assert(handler->m_event != this, "Should not refer to this");
             handler->m_event = this;
         }
@@ -318,28 +493,34 @@ namespace AZ
 
 
     template <typename... Params>
-    inline void Event<Params...>::Connect(Handler& handler) const
+    inline void Event<Params...>::CompactHandlers() const
     {
-        if (m_updating)
+        if (!m_hasDisconnectedHandlers)
         {
-            handler.m_index = -aznumeric_cast<int32_t>(m_addList.size() + 1);
-            m_addList.push_back(&handler);
             return;
         }
 
-        if (m_freeList.empty())
+        // Stable compaction, handlers keep their relative order
+        size_t writeIndex = 0;
+        for (size_t readIndex = 0; readIndex < m_handlers.size(); ++readIndex)
         {
-            handler.m_index = aznumeric_cast<int32_t>(m_handlers.size());
-            m_handlers.push_back(&handler);
+            if (Handler* handler = m_handlers[readIndex])
+            {
+                handler->m_index = aznumeric_cast<int32_t>(writeIndex);
+                m_handlers[writeIndex++] = handler;
+            }
         }
-        else
-        {
-            handler.m_index = aznumeric_cast<int32_t>(m_freeList.top());
-            m_freeList.pop();
+        m_handlers.resize(writeIndex);
+        m_hasDisconnectedHandlers = false;
+    }
 
-            AZ_Assert(m_handlers[handler.m_index] == nullptr, "Replacing non nullptr event");
-            m_handlers[handler.m_index] = &handler;
-        }
+
+    template <typename... Params>
+    inline void Event<Params...>::Connect(Handler& handler) const
+    {
+        // Appending is safe during a signal as the signal only visits the handlers that were connected when it started
+        handler.m_index = aznumeric_cast<int32_t>(m_handlers.size());
+        m_handlers.push_back(&handler);
     }
 
 
@@ -348,17 +529,21 @@ namespace AZ
     {
         AZ_Assert(eventHandle.m_event == this, "Trying to remove a handler bound to a different event");
 
-        int32_t index = eventHandle.m_index;
-        if (index < 0)
+        const size_t index = aznumeric_cast<size_t>(eventHandle.m_index);
+        AZ_Assert(index < m_handlers.size() && m_handlers[index] == &eventHandle, "Entry does not refer to handle");
+
+        if (m_signalDepth > 0)
         {
-            AZ_Assert(m_addList[-(index + 1)] == &eventHandle, "Entry does not refer to handle");
-            m_addList[-(index + 1)] = nullptr;
+            // Don't reorder handlers while a signal is iterating over them
+            m_handlers[index] = nullptr;
+            m_hasDisconnectedHandlers = true;
         }
         else
         {
-            AZ_Assert(m_handlers[index] == &eventHandle, "Entry does not refer to handle");
-            m_handlers[index] = nullptr;
-            m_freeList.push(index);
+            Handler* lastHandler = m_handlers.back();
+            lastHandler->m_index = aznumeric_cast<int32_t>(index);
+            m_handlers[index] = lastHandler;
+            m_handlers.pop_back();
         }
 
         eventHandle.m_event = nullptr;
@@ -71,6 +71,13 @@ namespace AZ
                 EBUS_ASSERT(context, "Internal error: context deleted while execution still in progress.");
                 m_context = context;
 
+#if EBUS_AUDIT_THREADS
+                if constexpr (BusType::Context::SingleThreadedDispatch)
+                {
+                    AuditThread();
+                }
+#endif
+
                 this->m_prev = m_context->s_callstack->m_prev;
 
                 // We don't use the AZ_Assert macro here because it places the assert call (unlikely) before the
@@ -101,6 +108,19 @@ namespace AZ
                 m_context->s_callstack->m_prev = this->m_prev;
             }
 
+#if EBUS_AUDIT_THREADS
+            void AuditThread()
+            {
+                AZStd::native_thread_id_type expectedThreadId{};
+                if (!m_context->m_auditThreadId.compare_exchange_strong(expectedThreadId, m_threadId) && expectedThreadId != m_threadId &&
+                    !m_context->m_auditReported.exchange(true))
+                {
+                    AZ_Warning("EBus", false, "%s has no MutexType but is used from multiple threads. Configure MutexType on the bus.",
+                        BusType::GetName());
+                }
+            }
+#endif
+
             BusContextPtr m_context = nullptr;
             AZStd::native_thread_id_type m_threadId;
         };
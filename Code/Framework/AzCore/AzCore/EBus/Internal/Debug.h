@@ -16,3 +16,14 @@
 #else
 #define EBUS_ASSERT(...)
 #endif
+
+// Set to 1 to report buses without a MutexType that are used from more than one thread.
+// These buses dispatch without any synchronization, see EBus::Context::SingleThreadedDispatch.
+// Can also be defined by the build, e.g. in a project's compile definitions, without editing this header.
+#ifndef EBUS_AUDIT_THREADS
+#define EBUS_AUDIT_THREADS 0
+#endif
+
+#if EBUS_AUDIT_THREADS
+#include <AzCore/Debug/Trace.h>
+#endif
@@ -21,6 +21,8 @@ namespace AZ
         {
             m_decompressor = AZStd::move(rhs.m_decompressor);
             m_archiveFilename = AZStd::move(rhs.m_archiveFilename);
+            m_seekTable = AZStd::move(rhs.m_seekTable);
+            m_seekTableLoader = AZStd::move(rhs.m_seekTableLoader);
             m_compressionTag = rhs.m_compressionTag;
             m_offset = rhs.m_offset;
             m_compressedSize = rhs.m_compressedSize;
@@ -10,7 +10,9 @@
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/IO/Streamer/RequestPath.h>
 #include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/functional.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/string/string_view.h>
 
@@ -31,6 +33,19 @@ namespace AZ
             UseArchiveOnly
         };
 
+        //! Location in compressed data from which decompression can start without needing any of the data that comes before it.
+        struct CompressionSeekPoint
+        {
+            //! Offset from the start of the compressed data.
+            u64 m_compressedOffset{ 0 };
+            //! Offset in the uncompressed data that corresponds to the compressed offset.
+            u64 m_uncompressedOffset{ 0 };
+        };
+        //! Seek points sorted by offset. The first point is always at the start of the data and the last point marks the end of
+        //! the compressed blocks, so every pair of neighboring points describes a block that can be decompressed on its own.
+        using CompressionSeekTable = AZStd::vector<CompressionSeekPoint>;
+        using CompressionSeekTableLoader = AZStd::function<AZStd::shared_ptr<const CompressionSeekTable>()>;
+
         struct CompressionInfo;
         using DecompressionFunc = AZStd::function<bool(const CompressionInfo& info, const void* compressed, size_t compressedSize, void* uncompressed, size_t uncompressedBufferSize)>;
 
@@ -47,6 +62,13 @@ namespace AZ
             RequestPath m_archiveFilename;
             //< The function to use to decompress the data.
             DecompressionFunc m_decompressor;
+            //! Optional table with the locations of independently compressed blocks. If available, partial reads only need to
+            //! read and decompress the blocks that overlap with the requested range instead of the entire file. The decompressor
+            //! needs to be able to decompress any sequence of consecutive blocks.
+            AZStd::shared_ptr<const CompressionSeekTable> m_seekTable;
+            //! Optional function to load m_seekTable with. Set this instead of m_seekTable if reading the table is expensive, for
+            //! instance because it's stored with the compressed data, so it's only loaded when the first partial read is queued.
+            CompressionSeekTableLoader m_seekTableLoader;
             //< Tag that uniquely identifies the compressor responsible for decompressing the referenced data.
             CompressionTag m_compressionTag{ 0 };
             //! Offset into the archive file for the found file.
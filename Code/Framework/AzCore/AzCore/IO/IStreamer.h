@@ -130,6 +130,25 @@ namespace AZ::IO
             IStreamerTypes::Priority priority = IStreamerTypes::s_priorityMedium,
             size_t offset = 0) = 0;
 
+        //! Creates a request to map a range of a file into memory instead of reading it into a buffer.
+        //! Mapping avoids copying data into an intermediate buffer, which is beneficial for large, read-only assets that are
+        //! consumed directly from memory. Files inside archives can only be mapped if they're stored uncompressed. Requests
+        //! for files that can't be mapped will fail, in which case the file can be loaded with one of the Read functions instead.
+        //! Use GetMapRequestResult to retrieve the view once the request has completed.
+        //! @param relativePath Relative path to the file to map. This can include aliases such as @assets@.
+        //! @param size The number of bytes to map.
+        //! @param offset The offset into the file where the mapped range begins.
+        //! @return A smart pointer to the newly created request with the map command.
+        virtual FileRequestPtr Map(AZStd::string_view relativePath, size_t size, size_t offset = 0) = 0;
+
+        //! Sets a request to the map command.
+        //! @param request The request that will store the map command.
+        //! @param relativePath Relative path to the file to map. This can include aliases such as @assets@.
+        //! @param size The number of bytes to map.
+        //! @param offset The offset into the file where the mapped range begins.
+        //! @return A reference to the provided request.
+        virtual FileRequestPtr& Map(FileRequestPtr& request, AZStd::string_view relativePath, size_t size, size_t offset = 0) = 0;
+
         //! Creates a request to cancel a previously queued request.
         //! When this request completes it's not guaranteed to have canceled the target request. Not all requests can be canceled and requests
         //! that already processing may complete. It's recommended to let the target request handle the completion of the request as normal
@@ -329,6 +348,12 @@ namespace AZ::IO
         virtual bool GetReadRequestResult(FileRequestHandle request, void*& buffer, u64& numBytesRead,
             IStreamerTypes::ClaimMemory claimMemory = IStreamerTypes::ClaimMemory::No) const = 0;
 
+        //! Get the result for map operations.
+        //! @param request The request to query.
+        //! @param view The view on the mapped data. This remains valid after the request has been released.
+        //! @return True if the request is a completed map request, otherwise false.
+        virtual bool GetMapRequestResult(FileRequestHandle request, MappedFileViewPtr& view) const = 0;
+
         //
         // General Streamer functions
         //
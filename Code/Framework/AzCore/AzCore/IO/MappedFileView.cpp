@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/MappedFileView.h>
+
+namespace AZ::IO
+{
+    namespace Platform
+    {
+        // Forward declaration of platform specific implementations
+
+        //! Returns the alignment the offset of a mapping needs to have.
+        u64 GetMappingGranularity();
+        //! Maps the range of the file. The offset is aligned to the mapping granularity. Returns null on failure, including
+        //! when the range extends past the end of the file.
+        void* MapFileRange(const char* absolutePath, u64 alignedOffset, u64 size);
+        void UnmapFileRange(void* mapping, u64 size);
+    }
+
+    MappedFileViewPtr MappedFileView::Create(const char* absolutePath, u64 offset, u64 size)
+    {
+        if (absolutePath == nullptr || size == 0)
+        {
+            return {};
+        }
+
+        const u64 granularity = Platform::GetMappingGranularity();
+        const u64 alignedOffset = AZ_SIZE_ALIGN_DOWN(offset, granularity);
+        const u64 dataOffset = offset - alignedOffset;
+        void* mapping = Platform::MapFileRange(absolutePath, alignedOffset, dataOffset + size);
+        if (mapping == nullptr)
+        {
+            return {};
+        }
+        return MappedFileViewPtr(aznew MappedFileView(mapping, dataOffset + size, dataOffset, size));
+    }
+
+    MappedFileView::MappedFileView(void* mapping, u64 mappingSize, u64 dataOffset, u64 size)
+        : m_mapping(mapping)
+        , m_mappingSize(mappingSize)
+        , m_dataOffset(dataOffset)
+        , m_size(size)
+    {
+    }
+
+    MappedFileView::~MappedFileView()
+    {
+        Platform::UnmapFileRange(m_mapping, m_mappingSize);
+    }
+
+    const void* MappedFileView::GetData() const
+    {
+        return reinterpret_cast<const u8*>(m_mapping) + m_dataOffset;
+    }
+
+    u64 MappedFileView::GetSize() const
+    {
+        return m_size;
+    }
+} // namespace AZ::IO
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/smart_ptr/intrusive_base.h>
+#include <AzCore/std/smart_ptr/intrusive_ptr.h>
+
+namespace AZ::IO
+{
+    class MappedFileView;
+    using MappedFileViewPtr = AZStd::intrusive_ptr<const MappedFileView>;
+
+    //! Read-only view into a range of a file that's mapped into the address space of the process. Data is paged in by the OS
+    //! on first access, directly from the OS file cache, so no copies are made. The mapping stays alive as long as there are
+    //! references to the view. Views are thread safe as the mapped data can't be changed.
+    //! Writing to the file while it's mapped is not supported and results in undefined behavior.
+    class MappedFileView final
+        : public AZStd::intrusive_base
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(MappedFileView, SystemAllocator, 0);
+
+        //! Maps a range of the file at the provided absolute path.
+        //! @param absolutePath The absolute path to the file to map.
+        //! @param offset Offset in bytes into the file where the view starts. This doesn't need to be aligned.
+        //! @param size The number of bytes to map. The entire range needs to be inside the file.
+        //! @return The view or null if the file couldn't be opened or mapped, or if the range falls outside the file.
+        static MappedFileViewPtr Create(const char* absolutePath, u64 offset, u64 size);
+
+        ~MappedFileView() override;
+
+        //! Returns the address of the first mapped byte at the requested offset.
+        const void* GetData() const;
+        //! Returns the number of bytes that can be accessed through GetData.
+        u64 GetSize() const;
+
+    private:
+        MappedFileView(void* mapping, u64 mappingSize, u64 dataOffset, u64 size);
+
+        void* m_mapping; //!< The start of the mapping, which is aligned to the platform's mapping granularity.
+        u64 m_mappingSize; //!< The total size of the mapping, including the part before the requested offset.
+        u64 m_dataOffset; //!< Offset from the start of the mapping to the requested data.
+        u64 m_size; //!< Size of the requested data.
+    };
+} // namespace AZ::IO
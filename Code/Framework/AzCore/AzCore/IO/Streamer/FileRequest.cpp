@@ -75,6 +75,18 @@ namespace AZ
             , m_sharedRead(sharedRead)
         {}
 
+        FileRequest::MapRequestData::MapRequestData(RequestPath path, u64 offset, u64 size)
+            : m_path(AZStd::move(path))
+            , m_offset(offset)
+            , m_size(size)
+        {}
+
+        FileRequest::MapData::MapData(const RequestPath& path, u64 offset, u64 size)
+            : m_path(path)
+            , m_offset(offset)
+            , m_size(size)
+        {}
+
         FileRequest::CompressedReadData::CompressedReadData(CompressionInfo&& compressionInfo, void* output, u64 readOffset, u64 readSize)
             : m_compressionInfo(AZStd::move(compressionInfo))
             , m_output(output)
@@ -183,6 +195,21 @@ namespace AZ
             SetOptionalParent(parent);
         }
 
+        void FileRequest::CreateMapRequest(RequestPath path, u64 offset, u64 size)
+        {
+            AZ_Assert(AZStd::holds_alternative<AZStd::monostate>(m_command),
+                "Attempting to set FileRequest to 'MapRequest', but another task was already assigned.");
+            m_command.emplace<MapRequestData>(AZStd::move(path), offset, size);
+        }
+
+        void FileRequest::CreateMap(FileRequest* parent, const RequestPath& path, u64 offset, u64 size)
+        {
+            AZ_Assert(AZStd::holds_alternative<AZStd::monostate>(m_command),
+                "Attempting to set FileRequest to 'Map', but another task was already assigned.");
+            m_command.emplace<MapData>(path, offset, size);
+            SetOptionalParent(parent);
+        }
+
         void FileRequest::CreateCompressedRead(FileRequest* parent, const CompressionInfo& compressionInfo,
             void* output, u64 readOffset, u64 readSize)
         {
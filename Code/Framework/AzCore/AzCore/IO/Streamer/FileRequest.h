@@ -10,6 +10,7 @@
 #include <AzCore/base.h>
 #include <AzCore/IO/CompressionBus.h>
 #include <AzCore/IO/IStreamerTypes.h>
+#include <AzCore/IO/MappedFileView.h>
 #include <AzCore/IO/Streamer/FileRange.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/std/any.h>
@@ -106,6 +107,35 @@ namespace AZ
                 bool m_sharedRead; //!< True if other code will be reading from the file or the stack entry can exclusively lock.
             };
 
+            //! Request to map a range of a file into memory. This is an untranslated request and holds a relative path. The
+            //! result is a read-only view that's stored with this request once it completes.
+            struct MapRequestData
+            {
+                inline constexpr static IStreamerTypes::Priority s_orderPriority = IStreamerTypes::s_priorityMedium;
+                inline constexpr static bool s_failWhenUnhandled = true;
+
+                MapRequestData(RequestPath path, u64 offset, u64 size);
+
+                RequestPath m_path; //!< Relative path to the target file.
+                MappedFileViewPtr m_view; //!< The view on the mapped data. This is set once the request has successfully completed.
+                u64 m_offset; //!< The offset in bytes into the file.
+                u64 m_size; //!< The number of bytes to map.
+            };
+
+            //! Request to map a range of a file into memory. This is a translated request and holds an absolute path and has
+            //! been resolved to the archive file if needed. The created view is stored in the MapRequestData in the chain.
+            struct MapData
+            {
+                inline constexpr static IStreamerTypes::Priority s_orderPriority = IStreamerTypes::s_priorityMedium;
+                inline constexpr static bool s_failWhenUnhandled = true;
+
+                MapData(const RequestPath& path, u64 offset, u64 size);
+
+                const RequestPath& m_path; //!< The path to the file that contains the requested data.
+                u64 m_offset; //!< The offset in bytes into the file.
+                u64 m_size; //!< The number of bytes to map.
+            };
+
             //! Request to read and decompress data.
             struct CompressedReadData
             {
@@ -248,8 +278,8 @@ namespace AZ
             };
 
             using CommandVariant = AZStd::variant<AZStd::monostate, ExternalRequestData, RequestPathStoreData, ReadRequestData, ReadData,
-                CompressedReadData, WaitData, FileExistsCheckData, FileMetaDataRetrievalData, CancelData, RescheduleData, FlushData,
-                FlushAllData, CreateDedicatedCacheData, DestroyDedicatedCacheData, ReportData, CustomData>;
+                MapRequestData, MapData, CompressedReadData, WaitData, FileExistsCheckData, FileMetaDataRetrievalData, CancelData,
+                RescheduleData, FlushData, FlushAllData, CreateDedicatedCacheData, DestroyDedicatedCacheData, ReportData, CustomData>;
             using OnCompletionCallback = AZStd::function<void(FileRequest& request)>;
 
             AZ_CLASS_ALLOCATOR(FileRequest, SystemAllocator, 0);
@@ -267,6 +297,8 @@ namespace AZ
             void CreateReadRequest(RequestPath path, IStreamerTypes::RequestMemoryAllocator* allocator, u64 offset, u64 size,
                 AZStd::chrono::system_clock::time_point deadline, IStreamerTypes::Priority priority);
             void CreateRead(FileRequest* parent, void* output, u64 outputSize, const RequestPath& path, u64 offset, u64 size, bool sharedRead = false);
+            void CreateMapRequest(RequestPath path, u64 offset, u64 size);
+            void CreateMap(FileRequest* parent, const RequestPath& path, u64 offset, u64 size);
             void CreateCompressedRead(FileRequest* parent, const CompressionInfo& compressionInfo, void* output,
                 u64 readOffset, u64 readSize);
             void CreateCompressedRead(FileRequest* parent, CompressionInfo&& compressionInfo, void* output,
@@ -28,7 +28,7 @@ namespace AZ
             const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent)
         {
             auto stackEntry = AZStd::make_shared<FullFileDecompressor>(
-                m_maxNumReads, m_maxNumJobs, aznumeric_caster(hardware.m_maxPhysicalSectorSize));
+                m_maxNumReads, m_maxNumJobs, aznumeric_caster(hardware.m_maxPhysicalSectorSize), size_t{ m_maxMemoryUsageMib } * 1_mib);
             stackEntry->SetNext(AZStd::move(parent));
             return stackEntry;
         }
@@ -38,9 +38,10 @@ namespace AZ
             if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context); serializeContext != nullptr)
             {
                 serializeContext->Class<FullFileDecompressorConfig, IStreamerStackConfig>()
-                    ->Version(1)
+                    ->Version(2)
                     ->Field("MaxNumReads", &FullFileDecompressorConfig::m_maxNumReads)
-                    ->Field("MaxNumJobs", &FullFileDecompressorConfig::m_maxNumJobs);
+                    ->Field("MaxNumJobs", &FullFileDecompressorConfig::m_maxNumJobs)
+                    ->Field("MaxMemoryUsageMib", &FullFileDecompressorConfig::m_maxMemoryUsageMib);
             }
         }
 
@@ -52,12 +53,20 @@ namespace AZ
             return !!m_compressedData;
         }
         
-        FullFileDecompressor::FullFileDecompressor(u32 maxNumReads, u32 maxNumJobs, u32 alignment)
+        FullFileDecompressor::FullFileDecompressor(u32 maxNumReads, u32 maxNumJobs, u32 alignment, size_t maxMemoryUsage)
             : StreamStackEntry("Full file decompressor")
+            , m_maxMemoryUsage(maxMemoryUsage)
             , m_maxNumReads(maxNumReads)
             , m_maxNumJobs(maxNumJobs)
             , m_alignment(alignment)
         {
+            if (m_maxNumJobs == 0)
+            {
+                // Leave a hardware thread for the Streamer thread itself.
+                m_maxNumJobs = AZ::GetMax(AZStd::thread::hardware_concurrency(), 2u) - 1;
+            }
+            maxNumJobs = m_maxNumJobs;
+
             JobManagerDesc jobDesc;
             u32 numThreads = AZ::GetMin(maxNumJobs, AZStd::thread::hardware_concurrency());
             for (u32 i = 0; i < numThreads; ++i)
@@ -93,6 +102,10 @@ namespace AZ
                 {
                     PrepareReadRequest(request, args);
                 }
+                else if constexpr (AZStd::is_same_v<Command, FileRequest::MapRequestData>)
+                {
+                    PrepareMapRequest(request, args);
+                }
                 else if constexpr (AZStd::is_same_v<Command, FileRequest::CreateDedicatedCacheData> ||
                     AZStd::is_same_v<Command, FileRequest::DestroyDedicatedCacheData>)
                 {
@@ -114,6 +127,14 @@ namespace AZ
                 using Command = AZStd::decay_t<decltype(args)>;
                 if constexpr (AZStd::is_same_v<Command, FileRequest::CompressedReadData>)
                 {
+                    // Only partial reads benefit from a seek table, so if loading it has been deferred, load it now. This has to
+                    // happen before the request is queued so memory accounting and estimates use the same range as the read.
+                    CompressionInfo& info = args.m_compressionInfo;
+                    const bool isPartialRead = args.m_readOffset != 0 || args.m_readSize < info.m_uncompressedSize;
+                    if (isPartialRead && !info.m_seekTable && info.m_seekTableLoader)
+                    {
+                        info.m_seekTable = info.m_seekTableLoader();
+                    }
                     m_pendingReads.push_back(request);
                 }
                 else if constexpr (AZStd::is_same_v<Command, FileRequest::FileExistsCheckData>)
@@ -137,7 +158,7 @@ namespace AZ
             }
 
             // Queue as many new reads as possible.
-            while (!m_pendingReads.empty() && m_numInFlightReads < m_maxNumReads)
+            while (!m_pendingReads.empty() && m_numInFlightReads < m_maxNumReads && IsWithinMemoryBudget(m_pendingReads.front()))
             {
                 StartArchiveRead(m_pendingReads.front());
                 m_pendingReads.pop_front();
@@ -176,7 +197,9 @@ namespace AZ
         void FullFileDecompressor::UpdateStatus(Status& status) const
         {
             StreamStackEntry::UpdateStatus(status);
-            s32 numAvailableSlots = aznumeric_cast<s32>(m_maxNumReads - m_numInFlightReads);
+            s32 numAvailableSlots = (m_maxMemoryUsage == 0 || m_memoryUsage < m_maxMemoryUsage)
+                ? aznumeric_cast<s32>(m_maxNumReads - m_numInFlightReads)
+                : 0;
             status.m_numAvailableSlots = AZStd::min(status.m_numAvailableSlots, numAvailableSlots);
             status.m_isIdle = status.m_isIdle && IsIdle();    
         }
@@ -204,7 +227,7 @@ namespace AZ
                     auto data = AZStd::get_if<FileRequest::CompressedReadData>(&compressedRequest->GetCommand());
                     AZ_Assert(data, "Compressed request in the decompression queue in FullFileDecompressor didn't contain compression read data.");
 
-                    size_t bytesToDecompress = data->m_compressionInfo.m_compressedSize;
+                    size_t bytesToDecompress = m_processingJobs[i].m_range.m_compressedSize;
                     auto decompressionDuration = AZStd::chrono::microseconds(
                         aznumeric_cast<u64>((bytesToDecompress * totalDecompressionDuration) / totalBytesDecompressed));
                     auto timeInProcessing = now - m_processingJobs[i].m_jobStartTime;
@@ -255,7 +278,7 @@ namespace AZ
                 FileRequest* compressedRequest = m_readRequests[i]->GetParent();
                 auto data = AZStd::get_if<FileRequest::CompressedReadData>(&compressedRequest->GetCommand());
                 
-                size_t bytesToDecompress = data->m_compressionInfo.m_compressedSize;
+                size_t bytesToDecompress = CalculateCompressedRange(*data).m_compressedSize;
                 auto decompressionDuration = AZStd::chrono::microseconds(
                     aznumeric_cast<u64>((bytesToDecompress * totalDecompressionDuration) / totalBytesDecompressed));
                 smallestDecompressionDuration = AZStd::min(smallestDecompressionDuration, decompressionDuration);
@@ -292,7 +315,7 @@ namespace AZ
             if (data)
             {
                 AZStd::chrono::microseconds processingTime = decompressionDelay;
-                size_t bytesToDecompress = data->m_compressionInfo.m_compressedSize;
+                size_t bytesToDecompress = CalculateCompressedRange(*data).m_compressedSize;
                 processingTime += AZStd::chrono::microseconds(
                     aznumeric_cast<u64>((bytesToDecompress * totalDecompressionDurationUs) / totalBytesDecompressed));
                 
@@ -314,6 +337,10 @@ namespace AZ
                 statistics.push_back(Statistic::CreateInteger(m_name, "Available read slots", m_maxNumReads - m_numInFlightReads));
                 statistics.push_back(Statistic::CreateInteger(m_name, "Pending decompression", m_numPendingDecompression));
                 statistics.push_back(Statistic::CreateFloat(m_name, "Buffer memory (MB)", m_memoryUsage * bytesToMB));
+                if (m_maxMemoryUsage != 0)
+                {
+                    statistics.push_back(Statistic::CreateFloat(m_name, "Buffer memory budget (MB)", m_maxMemoryUsage * bytesToMB));
+                }
 
                 double averageJobStartDelay = m_decompressionJobDelayMicroSec.CalculateAverage() * usToMs;
                 statistics.push_back(Statistic::CreateFloat(m_name, "Decompression job delay (avg. ms)", averageJobStartDelay));
@@ -322,6 +349,19 @@ namespace AZ
                 double totalDecompressionTimeSec = m_decompressionDurationMicroSec.GetTotal() * usToSec;
                 statistics.push_back(Statistic::CreateFloat(m_name, "Decompression Speed per job (avg. mbps)", totalBytesDecompressedMB / totalDecompressionTimeSec));
 
+                // Codec entries are only appended and never moved, so reading them while a new codec is added at worst reports
+                // slightly out of date values.
+                size_t numTrackedCodecs = AZStd::min(m_numTrackedCodecs, s_maxNumTrackedCodecs);
+                for (size_t i = 0; i < numTrackedCodecs; ++i)
+                {
+                    const CodecStatistics& codec = m_codecStatistics[i];
+                    if (codec.m_decompressionDurationMicroSec > 0)
+                    {
+                        statistics.push_back(Statistic::CreateFloat(m_name, codec.m_statisticName,
+                            (codec.m_bytesDecompressed * bytesToMB) / (codec.m_decompressionDurationMicroSec * usToSec)));
+                    }
+                }
+
 #if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
                 statistics.push_back(Statistic::CreatePercentage(m_name, DecompBoundName, m_decompressionBoundStat.GetAverage()));
                 statistics.push_back(Statistic::CreatePercentage(m_name, ReadBoundName, m_readBoundStat.GetAverage()));
@@ -341,6 +381,117 @@ namespace AZ
                 m_numRunningJobs == 0;
         }
 
+        FullFileDecompressor::CompressedRange FullFileDecompressor::CalculateCompressedRange(const FileRequest::CompressedReadData& data)
+        {
+            const CompressionInfo& info = data.m_compressionInfo;
+
+            CompressedRange range;
+            range.m_compressedSize = info.m_compressedSize;
+            range.m_uncompressedSize = info.m_uncompressedSize;
+            if (!info.m_seekTable || info.m_seekTable->size() < 2 || data.m_readSize == 0)
+            {
+                return range;
+            }
+
+            // Find the last seek point at or before the start of the read and the first seek point at or after the end of the read.
+            // The seek table always starts at zero so the first search will never return the first entry.
+            const CompressionSeekTable& table = *info.m_seekTable;
+            u64 readEnd = data.m_readOffset + data.m_readSize;
+            auto first = AZStd::upper_bound(table.begin(), table.end(), data.m_readOffset,
+                [](u64 offset, const CompressionSeekPoint& point) { return offset < point.m_uncompressedOffset; });
+            auto last = AZStd::lower_bound(first, table.end(), readEnd,
+                [](const CompressionSeekPoint& point, u64 offset) { return point.m_uncompressedOffset < offset; });
+            if (first == table.begin() || last == table.end())
+            {
+                AZ_Assert(false, "Seek table for '%s' doesn't cover the range %llu to %llu.",
+                    info.m_archiveFilename.GetRelativePath(), data.m_readOffset, readEnd);
+                return range;
+            }
+            --first;
+
+            range.m_compressedOffset = aznumeric_caster(first->m_compressedOffset);
+            range.m_compressedSize = aznumeric_caster(last->m_compressedOffset - first->m_compressedOffset);
+            range.m_uncompressedOffset = aznumeric_caster(first->m_uncompressedOffset);
+            range.m_uncompressedSize = aznumeric_caster(last->m_uncompressedOffset - first->m_uncompressedOffset);
+            return range;
+        }
+
+        bool FullFileDecompressor::RequiresIntermediateBuffer(const FileRequest::CompressedReadData& data, const CompressedRange& range)
+        {
+            return data.m_readOffset != range.m_uncompressedOffset || data.m_readSize != range.m_uncompressedSize;
+        }
+
+        size_t FullFileDecompressor::CalculateReadBufferSize(const CompressionInfo& info, const CompressedRange& range) const
+        {
+            size_t offset = info.m_offset + range.m_compressedOffset;
+            size_t offsetAdjustment = offset - AZ_SIZE_ALIGN_DOWN(offset, aznumeric_cast<size_t>(m_alignment));
+            return AZ_SIZE_ALIGN_UP((range.m_compressedSize + offsetAdjustment), aznumeric_cast<size_t>(m_alignment));
+        }
+
+        bool FullFileDecompressor::IsWithinMemoryBudget(const FileRequest* compressedReadRequest) const
+        {
+            // Always allow at least one file to be processed, even if it's larger than the budget, to avoid stalling indefinitely.
+            if (m_maxMemoryUsage == 0 || m_memoryUsage == 0)
+            {
+                return true;
+            }
+
+            auto data = AZStd::get_if<FileRequest::CompressedReadData>(&compressedReadRequest->GetCommand());
+            AZ_Assert(data, "Compressed request that's waiting to be read in FullFileDecompressor didn't contain compression read data.");
+            CompressedRange range = CalculateCompressedRange(*data);
+            size_t requiredMemory = CalculateReadBufferSize(data->m_compressionInfo, range);
+            if (RequiresIntermediateBuffer(*data, range))
+            {
+                // Partial reads need an additional buffer for the decompressed blocks.
+                requiredMemory += range.m_uncompressedSize;
+            }
+            return m_memoryUsage + requiredMemory <= m_maxMemoryUsage;
+        }
+
+        void FullFileDecompressor::RecordCodecStatistics(CompressionTag tag, size_t bytesDecompressed, AZStd::chrono::microseconds duration)
+        {
+            size_t index = 0;
+            for (; index < m_numTrackedCodecs; ++index)
+            {
+                if (m_codecStatistics[index].m_compressionTag == tag.m_code)
+                {
+                    break;
+                }
+            }
+
+            if (index == m_numTrackedCodecs)
+            {
+                if (m_numTrackedCodecs == s_maxNumTrackedCodecs)
+                {
+                    return;
+                }
+
+                CodecStatistics& codec = m_codecStatistics[index];
+                codec.m_compressionTag = tag.m_code;
+                if (tag.m_code == 0)
+                {
+                    azstrcpy(codec.m_statisticName, CodecStatistics::s_maxNameLength, "Decompression Speed default (avg. mbps)");
+                }
+                else
+                {
+                    // Tags are stored as four character codes with the first character in the most significant byte.
+                    char tagName[5];
+                    for (size_t i = 0; i < 4; ++i)
+                    {
+                        char c = static_cast<char>((tag.m_code >> (24 - i * 8)) & 0xff);
+                        tagName[i] = (c >= ' ' && c <= '~') ? c : '?';
+                    }
+                    tagName[4] = 0;
+                    azsnprintf(codec.m_statisticName, CodecStatistics::s_maxNameLength, "Decompression Speed %s (avg. mbps)", tagName);
+                }
+                ++m_numTrackedCodecs;
+            }
+
+            CodecStatistics& codec = m_codecStatistics[index];
+            codec.m_bytesDecompressed += bytesDecompressed;
+            codec.m_decompressionDurationMicroSec += duration.count();
+        }
+
         void FullFileDecompressor::PrepareReadRequest(FileRequest* request, FileRequest::ReadRequestData& data)
         {
             CompressionInfo info;
@@ -401,6 +552,61 @@ namespace AZ
             }
         }
 
+        void FullFileDecompressor::PrepareMapRequest(FileRequest* request, FileRequest::MapRequestData& data)
+        {
+            CompressionInfo info;
+            if (CompressionUtils::FindCompressionInfo(info, data.m_path.GetRelativePath()))
+            {
+                if (info.m_isCompressed)
+                {
+                    // Compressed data can't be used directly from the archive so there's nothing to map. The caller is
+                    // expected to fall back to a regular read.
+                    request->SetStatus(IStreamerTypes::RequestStatus::Failed);
+                    m_context->MarkRequestAsCompleted(request);
+                    return;
+                }
+
+                FileRequest* pathStorageRequest = m_context->GetNewInternalRequest();
+                pathStorageRequest->CreateRequestPathStore(request, AZStd::move(info.m_archiveFilename));
+                auto& pathStorage = AZStd::get<FileRequest::RequestPathStoreData>(pathStorageRequest->GetCommand());
+
+                FileRequest* nextRequest = m_context->GetNewInternalRequest();
+                nextRequest->CreateMap(pathStorageRequest, pathStorage.m_path, info.m_offset + data.m_offset, data.m_size);
+
+                if (info.m_conflictResolution == ConflictResolution::PreferFile)
+                {
+                    auto callback = [this, nextRequest](const FileRequest& checkRequest)
+                    {
+                        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+                        auto check = AZStd::get_if<FileRequest::FileExistsCheckData>(&checkRequest.GetCommand());
+                        AZ_Assert(check,
+                            "Callback in FullFileDecompressor::PrepareMapRequest expected FileExistsCheck but got another command.");
+                        if (check->m_found)
+                        {
+                            FileRequest* pathStoreRequest = m_context->RejectRequest(nextRequest);
+                            StreamStackEntry::PrepareRequest(m_context->RejectRequest(pathStoreRequest));
+                        }
+                        else
+                        {
+                            m_context->PushPreparedRequest(nextRequest);
+                        }
+                    };
+                    FileRequest* fileCheckRequest = m_context->GetNewInternalRequest();
+                    fileCheckRequest->CreateFileExistsCheck(data.m_path);
+                    fileCheckRequest->SetCompletionCallback(AZStd::move(callback));
+                    StreamStackEntry::QueueRequest(fileCheckRequest);
+                }
+                else
+                {
+                    m_context->PushPreparedRequest(nextRequest);
+                }
+            }
+            else
+            {
+                StreamStackEntry::PrepareRequest(request);
+            }
+        }
+
         void FullFileDecompressor::PrepareDedicatedCache(FileRequest* request, const RequestPath& path)
         {
             CompressionInfo info;
@@ -496,15 +702,17 @@ namespace AZ
                     // The buffer is aligned down but the offset is not corrected. If the offset was adjusted it would mean the same data is read
                     // multiple times and negates the block cache's ability to detect these cases. By still adjusting it means that the reads between
                     // the BlockCache's prolog and epilog are read into aligned buffers.
-                    size_t offsetAdjustment = info.m_offset - AZ_SIZE_ALIGN_DOWN(info.m_offset, aznumeric_cast<size_t>(m_alignment));
-                    size_t bufferSize = AZ_SIZE_ALIGN_UP((info.m_compressedSize + offsetAdjustment), aznumeric_cast<size_t>(m_alignment));
+                    CompressedRange range = CalculateCompressedRange(*data);
+                    size_t readOffset = info.m_offset + range.m_compressedOffset;
+                    size_t offsetAdjustment = readOffset - AZ_SIZE_ALIGN_DOWN(readOffset, aznumeric_cast<size_t>(m_alignment));
+                    size_t bufferSize = CalculateReadBufferSize(info, range);
                     m_readBuffers[i] = reinterpret_cast<Buffer>(AZ::AllocatorInstance<AZ::SystemAllocator>::Get().Allocate(
                         bufferSize, m_alignment, 0, "AZ::IO::Streamer FullFileDecompressor", __FILE__, __LINE__));
                     m_memoryUsage += bufferSize;
 
                     FileRequest* archiveReadRequest = m_context->GetNewInternalRequest();
                     archiveReadRequest->CreateRead(compressedReadRequest, m_readBuffers[i] + offsetAdjustment, bufferSize, info.m_archiveFilename,
-                        info.m_offset, info.m_compressedSize, info.m_isSharedPak);
+                        readOffset, range.m_compressedSize, info.m_isSharedPak);
                     archiveReadRequest->SetCompletionCallback(
                         [this, readSlot = i](FileRequest& request)
                         {
@@ -549,9 +757,7 @@ namespace AZ
             {
                 auto data = AZStd::get_if<FileRequest::CompressedReadData>(&compressedRequest->GetCommand());
                 AZ_Assert(data, "Compressed request in FullFileDecompressor that finished unsuccessfully didn't contain compression read data.");
-                CompressionInfo& info = data->m_compressionInfo;
-                size_t offsetAdjustment = info.m_offset - AZ_SIZE_ALIGN_DOWN(info.m_offset, aznumeric_cast<size_t>(m_alignment));
-                size_t bufferSize = AZ_SIZE_ALIGN_UP((info.m_compressedSize + offsetAdjustment), aznumeric_cast<size_t>(m_alignment));
+                size_t bufferSize = CalculateReadBufferSize(data->m_compressionInfo, CalculateCompressedRange(*data));
                 m_memoryUsage -= bufferSize;
 
                 if (m_readBuffers[readSlot] != nullptr)
@@ -612,10 +818,11 @@ namespace AZ
                     AZ_Assert(data, "Compressed request in FullFileDecompressor that's starting decompression didn't contain compression read data.");
                     AZ_Assert(data->m_compressionInfo.m_decompressor, "FullFileDecompressor is queuing a decompression job but couldn't find a decompressor.");
 
-                    info.m_alignmentOffset = aznumeric_caster(data->m_compressionInfo.m_offset -
-                        AZ_SIZE_ALIGN_DOWN(data->m_compressionInfo.m_offset, aznumeric_cast<size_t>(m_alignment)));
+                    info.m_range = CalculateCompressedRange(*data);
+                    size_t readOffset = data->m_compressionInfo.m_offset + info.m_range.m_compressedOffset;
+                    info.m_alignmentOffset = aznumeric_caster(readOffset - AZ_SIZE_ALIGN_DOWN(readOffset, aznumeric_cast<size_t>(m_alignment)));
 
-                    if (data->m_readOffset == 0 && data->m_readSize == data->m_compressionInfo.m_uncompressedSize)
+                    if (!RequiresIntermediateBuffer(*data, info.m_range))
                     {
                         auto job = [this, &info]()
                         {
@@ -625,7 +832,7 @@ namespace AZ
                     }
                     else
                     {
-                        m_memoryUsage += data->m_compressionInfo.m_uncompressedSize;
+                        m_memoryUsage += info.m_range.m_uncompressedSize;
                         auto job = [this, &info]()
                         {
                             PartialDecompression(m_context, info);
@@ -664,20 +871,19 @@ namespace AZ
             AZ_Assert(compressedRequest, "A wait request attached to FullFileDecompressor was completed but didn't have a parent compressed request.");
             auto data = AZStd::get_if<FileRequest::CompressedReadData>(&compressedRequest->GetCommand());
             AZ_Assert(data, "Compressed request in FullFileDecompressor that completed decompression didn't contain compression read data.");
-            CompressionInfo& info = data->m_compressionInfo;
-            size_t offsetAdjustment = info.m_offset - AZ_SIZE_ALIGN_DOWN(info.m_offset, aznumeric_cast<size_t>(m_alignment));
-            size_t bufferSize = AZ_SIZE_ALIGN_UP((info.m_compressedSize + offsetAdjustment), aznumeric_cast<size_t>(m_alignment));
+            size_t bufferSize = CalculateReadBufferSize(data->m_compressionInfo, jobInfo.m_range);
             m_memoryUsage -= bufferSize;
-            if (data->m_readOffset != 0 || data->m_readSize != data->m_compressionInfo.m_uncompressedSize)
+            if (RequiresIntermediateBuffer(*data, jobInfo.m_range))
             {
-                m_memoryUsage -= data->m_compressionInfo.m_uncompressedSize;
+                m_memoryUsage -= jobInfo.m_range.m_uncompressedSize;
             }
 
             m_decompressionJobDelayMicroSec.PushEntry(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
                 jobInfo.m_jobStartTime - jobInfo.m_queueStartTime).count());
-            m_decompressionDurationMicroSec.PushEntry(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
-                endTime - jobInfo.m_jobStartTime).count());
-            m_bytesDecompressed.PushEntry(data->m_compressionInfo.m_compressedSize);
+            auto decompressionDuration = AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(endTime - jobInfo.m_jobStartTime);
+            m_decompressionDurationMicroSec.PushEntry(decompressionDuration.count());
+            m_bytesDecompressed.PushEntry(jobInfo.m_range.m_compressedSize);
+            RecordCodecStatistics(data->m_compressionInfo.m_compressionTag, jobInfo.m_range.m_compressedSize, decompressionDuration);
 
             AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(jobInfo.m_compressedData, bufferSize, m_alignment);
             jobInfo.m_compressedData = nullptr;
@@ -697,14 +903,15 @@ namespace AZ
             CompressionInfo& compressionInfo = request->m_compressionInfo;
             AZ_Assert(compressionInfo.m_decompressor, "Full decompressor job started, but there's no decompressor callback assigned.");
 
-            AZ_Assert(request->m_readOffset == 0, "FullFileDecompressor is doing a full decompression on a file request with an offset (%zu).", 
-                request->m_readOffset);
-            AZ_Assert(compressionInfo.m_uncompressedSize == request->m_readSize,
+            AZ_Assert(request->m_readOffset == info.m_range.m_uncompressedOffset,
+                "FullFileDecompressor is doing a full decompression on a file request with an offset (%llu) that doesn't match the "
+                "start of the decompressed data (%zu).", request->m_readOffset, info.m_range.m_uncompressedOffset);
+            AZ_Assert(info.m_range.m_uncompressedSize == request->m_readSize,
                 "FullFileDecompressor is doing a full decompression, but the target buffer size (%llu) doesn't match the decompressed size (%zu).",
-                request->m_readSize, compressionInfo.m_uncompressedSize);
+                request->m_readSize, info.m_range.m_uncompressedSize);
             
             bool success = compressionInfo.m_decompressor(compressionInfo, info.m_compressedData + info.m_alignmentOffset,
-                compressionInfo.m_compressedSize, request->m_output, compressionInfo.m_uncompressedSize);
+                info.m_range.m_compressedSize, request->m_output, info.m_range.m_uncompressedSize);
             info.m_waitRequest->SetStatus(success ? IStreamerTypes::RequestStatus::Completed : IStreamerTypes::RequestStatus::Failed);
             
             context->MarkRequestAsCompleted(info.m_waitRequest);
@@ -722,12 +929,12 @@ namespace AZ
             CompressionInfo& compressionInfo = request->m_compressionInfo;
             AZ_Assert(compressionInfo.m_decompressor, "Partial decompressor job started, but there's no decompressor callback assigned.");
 
-            AZStd::unique_ptr<u8[]> decompressionBuffer = AZStd::unique_ptr<u8[]>(new u8[compressionInfo.m_uncompressedSize]);
+            AZStd::unique_ptr<u8[]> decompressionBuffer = AZStd::unique_ptr<u8[]>(new u8[info.m_range.m_uncompressedSize]);
             bool success = compressionInfo.m_decompressor(compressionInfo, info.m_compressedData + info.m_alignmentOffset,
-                compressionInfo.m_compressedSize, decompressionBuffer.get(), compressionInfo.m_uncompressedSize);
+                info.m_range.m_compressedSize, decompressionBuffer.get(), info.m_range.m_uncompressedSize);
             info.m_waitRequest->SetStatus(success ? IStreamerTypes::RequestStatus::Completed : IStreamerTypes::RequestStatus::Failed);
             
-            memcpy(request->m_output, decompressionBuffer.get() + request->m_readOffset, request->m_readSize);
+            memcpy(request->m_output, decompressionBuffer.get() + (request->m_readOffset - info.m_range.m_uncompressedOffset), request->m_readSize);
 
             context->MarkRequestAsCompleted(info.m_waitRequest);
             context->WakeUpSchedulingThread();
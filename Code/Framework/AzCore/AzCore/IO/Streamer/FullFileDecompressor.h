@@ -36,8 +36,13 @@ namespace AZ
 
             //! Maximum number of reads that are kept in flight.
             u32 m_maxNumReads{ 2 };
-            //! Maximum number of decompression jobs that can run simultaneously.
+            //! Maximum number of decompression jobs that can run simultaneously. If set to zero, one job per available hardware
+            //! thread, minus one for the Streamer thread, is used.
             u32 m_maxNumJobs{ 2 };
+            //! Maximum amount of memory in megabytes that's used for buffers with compressed data and partially decompressed
+            //! files. No new reads are started while the budget is exceeded, unless there's no other work in flight. If set to
+            //! zero, memory usage is only limited by the number of reads and jobs.
+            u32 m_maxMemoryUsageMib{ 0 };
         };
 
         //! Entry in the streaming stack that decompresses files from an archive that are stored
@@ -46,6 +51,8 @@ namespace AZ
         //! completely, so even if the file is partially read, it needs to be fully loaded. This
         //! also means that there's no upper limit to the memory so every decompression job will
         //! need to allocate memory as a temporary buffer (in-place decompression is not supported).
+        //! The exception are files that provide a seek table, in which case partial reads only load
+        //! and decompress the blocks that overlap with the requested range.
         //! Finally, the lack of an upper limit also means that the duration of the decompression job
         //! can vary largely so a dedicated job system is used to decompress on to avoid blocking
         //! the main job system from working.
@@ -53,7 +60,12 @@ namespace AZ
             : public StreamStackEntry
         {
         public:
-            FullFileDecompressor(u32 maxNumReads, u32 maxNumJobs, u32 alignment);
+            //! @param maxNumReads The maximum number of reads for compressed data that are kept in flight.
+            //! @param maxNumJobs The maximum number of decompression jobs that can run simultaneously. If zero, the number of
+            //!     jobs is derived from the number of hardware threads.
+            //! @param alignment The alignment for the buffers the compressed data is read into.
+            //! @param maxMemoryUsage The maximum number of bytes used for buffers by the decompressor or zero for no limit.
+            FullFileDecompressor(u32 maxNumReads, u32 maxNumJobs, u32 alignment, size_t maxMemoryUsage = 0);
             ~FullFileDecompressor() override = default;
 
             void PrepareRequest(FileRequest* request) override;
@@ -76,20 +88,50 @@ namespace AZ
                 PendingDecompression
             };
 
+            //! Decompression statistics for a single compression algorithm.
+            struct CodecStatistics
+            {
+                static constexpr size_t s_maxNameLength = 64;
+
+                char m_statisticName[s_maxNameLength]{}; //!< The name of the statistic, which includes the compression tag.
+                u64 m_bytesDecompressed{ 0 };
+                u64 m_decompressionDurationMicroSec{ 0 };
+                u32 m_compressionTag{ 0 };
+            };
+            static constexpr size_t s_maxNumTrackedCodecs = 8;
+
+            //! The section of a compressed file that needs to be read and decompressed to fulfill a request. This is the entire
+            //! file unless the file has a seek table.
+            struct CompressedRange
+            {
+                size_t m_compressedOffset{ 0 }; //!< Offset relative to the start of the compressed file.
+                size_t m_compressedSize{ 0 };
+                size_t m_uncompressedOffset{ 0 };
+                size_t m_uncompressedSize{ 0 };
+            };
+
             struct DecompressionInformation
             {
                 bool IsProcessing() const;
 
                 AZStd::chrono::high_resolution_clock::time_point m_queueStartTime;
                 AZStd::chrono::high_resolution_clock::time_point m_jobStartTime;
+                CompressedRange m_range;
                 Buffer m_compressedData{ nullptr };
                 FileRequest* m_waitRequest{ nullptr };
                 u32 m_alignmentOffset{ 0 };
             };
 
             bool IsIdle() const;
+            static CompressedRange CalculateCompressedRange(const FileRequest::CompressedReadData& data);
+            //! Whether or not the decompressed data has to go into an intermediate buffer because only a part of it is requested.
+            static bool RequiresIntermediateBuffer(const FileRequest::CompressedReadData& data, const CompressedRange& range);
+            size_t CalculateReadBufferSize(const CompressionInfo& info, const CompressedRange& range) const;
+            bool IsWithinMemoryBudget(const FileRequest* compressedReadRequest) const;
+            void RecordCodecStatistics(CompressionTag tag, size_t bytesDecompressed, AZStd::chrono::microseconds duration);
 
             void PrepareReadRequest(FileRequest* request, FileRequest::ReadRequestData& data);
+            void PrepareMapRequest(FileRequest* request, FileRequest::MapRequestData& data);
             void PrepareDedicatedCache(FileRequest* request, const RequestPath& path);
             void FileExistsCheck(FileRequest* checkRequest);
 
@@ -110,6 +152,8 @@ namespace AZ
             AverageWindow<size_t, double, s_statisticsWindowSize> m_decompressionJobDelayMicroSec;
             AverageWindow<size_t, double, s_statisticsWindowSize> m_decompressionDurationMicroSec;
             AverageWindow<size_t, double, s_statisticsWindowSize> m_bytesDecompressed;
+            CodecStatistics m_codecStatistics[s_maxNumTrackedCodecs];
+            size_t m_numTrackedCodecs{ 0 };
 #if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
             AZ::Statistics::RunningStatistic m_decompressionBoundStat;
             AZ::Statistics::RunningStatistic m_readBoundStat;
@@ -125,6 +169,7 @@ namespace AZ
             AZStd::unique_ptr<JobContext> m_decompressionjobContext;
 
             size_t m_memoryUsage{ 0 }; //!< Amount of memory used for buffers by the decompressor.
+            size_t m_maxMemoryUsage{ 0 }; //!< Maximum amount of memory used for buffers by the decompressor or zero for no limit.
             u32 m_maxNumReads{ 2 };
             u32 m_numInFlightReads{ 0 };
             u32 m_numPendingDecompression{ 0 };
@@ -9,6 +9,7 @@
 #include <limits>
 #include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/MappedFileView.h>
 #include <AzCore/IO/Streamer/FileRequest.h>
 #include <AzCore/IO/Streamer/StreamerContext.h>
 #include <AzCore/IO/Streamer/StorageDrive.h>
@@ -72,6 +73,15 @@ namespace AZ
                 m_context->PushPreparedRequest(read);
                 return;
             }
+            else if (AZStd::holds_alternative<FileRequest::MapRequestData>(request->GetCommand()))
+            {
+                auto& mapRequest = AZStd::get<FileRequest::MapRequestData>(request->GetCommand());
+
+                FileRequest* map = m_context->GetNewInternalRequest();
+                map->CreateMap(request, mapRequest.m_path, mapRequest.m_offset, mapRequest.m_size);
+                m_context->PushPreparedRequest(map);
+                return;
+            }
             StreamStackEntry::PrepareRequest(request);
         }
 
@@ -82,6 +92,7 @@ namespace AZ
             {
                 using Command = AZStd::decay_t<decltype(args)>;
                 if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData> ||
+                    AZStd::is_same_v<Command, FileRequest::MapData> ||
                     AZStd::is_same_v<Command, FileRequest::FileExistsCheckData> ||
                     AZStd::is_same_v<Command, FileRequest::FileMetaDataRetrievalData>)
                 {
@@ -124,6 +135,10 @@ namespace AZ
                     {
                         ReadFile(request);
                     }
+                    else if constexpr (AZStd::is_same_v<Command, FileRequest::MapData>)
+                    {
+                        MapFile(request);
+                    }
                     else if constexpr (AZStd::is_same_v<Command, FileRequest::FileExistsCheckData>)
                     {
                         FileExistsRequest(request);
@@ -225,6 +240,12 @@ namespace AZ
                     AZStd::chrono::microseconds averageTime = m_getFileMetaDataTimeAverage.CalculateAverage();
                     startTime += averageTime;
                 }
+                else if constexpr (AZStd::is_same_v<Command, FileRequest::MapData>)
+                {
+                    readSize = 0;
+                    AZStd::chrono::microseconds averageTime = m_mapTimeAverage.CalculateAverage();
+                    startTime += averageTime;
+                }
             }, request->GetCommand());
 
             if (readSize > 0)
@@ -320,6 +341,20 @@ namespace AZ
             m_context->MarkRequestAsCompleted(request);
         }
 
+        void StorageDrive::MapFile(FileRequest* request)
+        {
+            AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+            TIMED_AVERAGE_WINDOW_SCOPE(m_mapTimeAverage);
+
+            auto& data = AZStd::get<FileRequest::MapData>(request->GetCommand());
+            auto mapRequest = request->GetCommandFromChain<FileRequest::MapRequestData>();
+            AZ_Assert(mapRequest, "Map command for '%s' isn't part of a map request.", data.m_path.GetRelativePath());
+
+            mapRequest->m_view = MappedFileView::Create(data.m_path.GetAbsolutePath(), data.m_offset, data.m_size);
+            request->SetStatus(mapRequest->m_view ? IStreamerTypes::RequestStatus::Completed : IStreamerTypes::RequestStatus::Failed);
+            m_context->MarkRequestAsCompleted(request);
+        }
+
         void StorageDrive::CancelRequest(FileRequest* cancelRequest, FileRequestPtr& target)
         {
             for (auto it = m_pendingRequests.begin(); it != m_pendingRequests.end();)
@@ -446,6 +481,10 @@ namespace AZ
                 statistics.push_back(Statistic::CreateInteger(m_name, "Get file meta data (avg. us)", m_getFileMetaDataTimeAverage.CalculateAverage().count()));
                 statistics.push_back(Statistic::CreateInteger(m_name, "Available slots", s64{ s_maxRequests } - m_pendingRequests.size()));
             }
+            if (m_mapTimeAverage.GetNumRecorded() > 0)
+            {
+                statistics.push_back(Statistic::CreateInteger(m_name, "Map file (avg. us)", m_mapTimeAverage.CalculateAverage().count()));
+            }
         }
 
         void StorageDrive::Report(const FileRequest::ReportData& data) const
@@ -65,6 +65,7 @@ namespace AZ
 
             size_t FindFileInCache(const RequestPath& filePath) const;
             void ReadFile(FileRequest* request);
+            void MapFile(FileRequest* request);
             void CancelRequest(FileRequest* cancelRequest, FileRequestPtr& target);
             void FileExistsRequest(FileRequest* request);
             void FileMetaDataRetrievalRequest(FileRequest* request);
@@ -80,6 +81,7 @@ namespace AZ
             TimedAverageWindow<s_statisticsWindowSize> m_getFileExistsTimeAverage;
             TimedAverageWindow<s_statisticsWindowSize> m_getFileMetaDataTimeAverage;
             TimedAverageWindow<s_statisticsWindowSize> m_readTimeAverage;
+            TimedAverageWindow<s_statisticsWindowSize> m_mapTimeAverage;
             AverageWindow<u64, float, s_statisticsWindowSize> m_readSizeAverage;
             //! File requests that are queued for processing.
             AZStd::deque<FileRequest*> m_pendingRequests;
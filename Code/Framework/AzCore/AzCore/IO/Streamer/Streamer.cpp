@@ -55,6 +55,21 @@ namespace AZ::IO
         return request;
     }
 
+    FileRequestPtr Streamer::Map(AZStd::string_view relativePath, size_t size, size_t offset)
+    {
+        FileRequestPtr result = CreateRequest();
+        Map(result, relativePath, size, offset);
+        return result;
+    }
+
+    FileRequestPtr& Streamer::Map(FileRequestPtr& request, AZStd::string_view relativePath, size_t size, size_t offset)
+    {
+        RequestPath path;
+        path.InitFromRelativePath(relativePath);
+        request->m_request.CreateMapRequest(AZStd::move(path), offset, size);
+        return request;
+    }
+
     FileRequestPtr Streamer::Cancel(FileRequestPtr target)
     {
         FileRequestPtr result = CreateRequest();
@@ -233,6 +248,23 @@ namespace AZ::IO
         }
     }
 
+    bool Streamer::GetMapRequestResult(FileRequestHandle request, MappedFileViewPtr& view) const
+    {
+        AZ_Assert(request.m_request, "The request handle provided to Streamer::GetMapRequestResult is invalid.");
+        auto mapRequest = AZStd::get_if<FileRequest::MapRequestData>(&request.m_request->GetCommand());
+        if (mapRequest != nullptr)
+        {
+            view = mapRequest->m_view;
+            return view != nullptr;
+        }
+        else
+        {
+            AZ_Assert(false, "Provided file request did not contain map information");
+            view = nullptr;
+            return false;
+        }
+    }
+
     void Streamer::CollectStatistics(AZStd::vector<Statistic>& statistics)
     {
         m_streamStack->CollectStatistics(statistics);
@@ -59,6 +59,12 @@ namespace AZ::IO
             size_t size, AZStd::chrono::microseconds deadline = IStreamerTypes::s_noDeadline,
             IStreamerTypes::Priority priority = IStreamerTypes::s_priorityMedium, size_t offset = 0) override;
 
+        //! Creates a request to map a range of a file into memory.
+        FileRequestPtr Map(AZStd::string_view relativePath, size_t size, size_t offset = 0) override;
+
+        //! Sets a request to the map command.
+        FileRequestPtr& Map(FileRequestPtr& request, AZStd::string_view relativePath, size_t size, size_t offset = 0) override;
+
 
         //! Creates a request to cancel a previously queued request.
         FileRequestPtr Cancel(FileRequestPtr target) override;
@@ -160,6 +166,9 @@ namespace AZ::IO
         bool GetReadRequestResult(FileRequestHandle request, void*& buffer, u64& numBytesRead,
             IStreamerTypes::ClaimMemory claimMemory = IStreamerTypes::ClaimMemory::No) const override;
 
+        //! Gets the result for map operations.
+        bool GetMapRequestResult(FileRequestHandle request, MappedFileViewPtr& view) const override;
+
         //
         // General Streamer functions
         //
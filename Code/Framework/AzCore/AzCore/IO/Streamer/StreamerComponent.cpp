@@ -62,10 +62,12 @@ namespace AZ
             return CreateSimpleStreamerStack();
         }
 
+        const AZ::SettingsRegistryInterface::PathHandle useAllHardwarePath("/Amazon/AzCore/Streamer/UseAllHardware");
+        const AZ::SettingsRegistryInterface::PathHandle reportHardwarePath("/Amazon/AzCore/Streamer/ReportHardware");
         bool useAllHardware = true;
-        settingsRegistry->Get(useAllHardware, "/Amazon/AzCore/Streamer/UseAllHardware");
+        settingsRegistry->Get(useAllHardware, useAllHardwarePath);
         bool reportHardware = true;
-        settingsRegistry->Get(reportHardware, "/Amazon/AzCore/Streamer/ReportHardware");
+        settingsRegistry->Get(reportHardware, reportHardwarePath);
 
         AZ::IO::HardwareInformation hardwareInfo;
         if (!AZ::IO::CollectIoHardwareInformation(hardwareInfo, useAllHardware, reportHardware))
@@ -13,6 +13,7 @@
 
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/exponential_backoff.h>
 #include <AzCore/std/functional.h>
 
 #include <AzCore/Debug/Profiler.h>
@@ -24,58 +25,228 @@
 using namespace AZ;
 using namespace AZ::Internal;
 
-bool CompareJobPriorities(AZ::s8 value, const Job* job)
+//orders jobs within a class, higher priority first, then jobs with a deadline (earliest first) before jobs without one
+bool CompareJobPriorities(const Job* value, const Job* job)
 {
-    return value > job->GetPriority();
+    if (value->GetPriority() != job->GetPriority())
+    {
+        return value->GetPriority() > job->GetPriority();
+    }
+    if (value->GetDeadline() == 0)
+    {
+        return false;
+    }
+    return (job->GetDeadline() == 0) || (value->GetDeadline() < job->GetDeadline());
+}
+
+//true if the job is kept in the prioritized queue and runs before the default priority jobs
+bool RunsBeforeDefaultPriority(const Job* job)
+{
+    return (job->GetPriority() > 0) || ((job->GetPriority() == 0) && (job->GetDeadline() != 0));
+}
+
+WorkStealingDeque::Ring::Ring(AZ::s64 capacity)
+    : m_capacity(capacity)
+    , m_slots(new AZStd::atomic<Job*>[capacity])
+{
+    AZ_Assert((capacity & (capacity - 1)) == 0, "Ring capacity must be a power of two");
+}
+
+Job* WorkStealingDeque::Ring::Load(AZ::s64 index) const
+{
+    return m_slots[index & (m_capacity - 1)].load(AZStd::memory_order_relaxed);
+}
+
+void WorkStealingDeque::Ring::Store(AZ::s64 index, Job* job)
+{
+    m_slots[index & (m_capacity - 1)].store(job, AZStd::memory_order_relaxed);
+}
+
+WorkStealingDeque::Ring* WorkStealingDeque::Ring::Grow(AZ::s64 top, AZ::s64 bottom) const
+{
+    Ring* ring = new Ring(m_capacity * 2);
+    for (AZ::s64 index = top; index < bottom; ++index)
+    {
+        ring->Store(index, Load(index));
+    }
+    return ring;
+}
+
+WorkStealingDeque::WorkStealingDeque()
+{
+    m_rings.emplace_back(new Ring(InitialCapacity));
+    m_ring.store(m_rings.back().get(), AZStd::memory_order_relaxed);
+}
+
+WorkStealingDeque::~WorkStealingDeque() = default;
+
+void WorkStealingDeque::Push(Job* job)
+{
+    const AZ::s64 bottom = m_bottom.load(AZStd::memory_order_relaxed);
+    const AZ::s64 top = m_top.load(AZStd::memory_order_acquire);
+    Ring* ring = m_ring.load(AZStd::memory_order_relaxed);
+    if (bottom - top > ring->m_capacity - 1)
+    {
+        //full, thieves may still be reading the old ring so it is retired rather than freed
+        ring = ring->Grow(top, bottom);
+        m_rings.emplace_back(ring);
+        m_ring.store(ring, AZStd::memory_order_release);
+    }
+    ring->Store(bottom, job);
+    AZStd::atomic_thread_fence(AZStd::memory_order_release);
+    m_bottom.store(bottom + 1, AZStd::memory_order_relaxed);
+}
+
+Job* WorkStealingDeque::Pop()
+{
+    const AZ::s64 bottom = m_bottom.load(AZStd::memory_order_relaxed) - 1;
+    Ring* ring = m_ring.load(AZStd::memory_order_relaxed);
+    m_bottom.store(bottom, AZStd::memory_order_relaxed);
+    AZStd::atomic_thread_fence(AZStd::memory_order_seq_cst);
+    AZ::s64 top = m_top.load(AZStd::memory_order_relaxed);
+
+    Job* result = nullptr;
+    if (top <= bottom)
+    {
+        result = ring->Load(bottom);
+        if (top == bottom)
+        {
+            //last job in the deque, race any thieves for it
+            if (!m_top.compare_exchange_strong(top, top + 1, AZStd::memory_order_seq_cst, AZStd::memory_order_relaxed))
+            {
+                result = nullptr;
+            }
+            m_bottom.store(bottom + 1, AZStd::memory_order_relaxed);
+        }
+    }
+    else
+    {
+        m_bottom.store(bottom + 1, AZStd::memory_order_relaxed);
+    }
+    return result;
+}
+
+Job* WorkStealingDeque::Steal()
+{
+    AZ::s64 top = m_top.load(AZStd::memory_order_acquire);
+    AZStd::atomic_thread_fence(AZStd::memory_order_seq_cst);
+    const AZ::s64 bottom = m_bottom.load(AZStd::memory_order_acquire);
+
+    if (top < bottom)
+    {
+        Ring* ring = m_ring.load(AZStd::memory_order_acquire);
+        Job* result = ring->Load(top);
+        if (m_top.compare_exchange_strong(top, top + 1, AZStd::memory_order_seq_cst, AZStd::memory_order_relaxed))
+        {
+            return result;
+        }
+    }
+    return nullptr;
+}
+
+bool WorkStealingDeque::IsEmpty() const
+{
+    return m_bottom.load(AZStd::memory_order_relaxed) <= m_top.load(AZStd::memory_order_relaxed);
 }
 
 void WorkQueue::LocalInsert(Job* job)
 {
+    if ((job->GetPriority() == 0) && (job->GetDeadline() == 0))
+    {
+        m_defaultPriorityJobs.Push(job);
+        return;
+    }
+
     LockGuard lock(m_lock);
     const AZStd::deque<Job*>::const_iterator locationToinsert = AZStd::upper_bound(m_queue.begin(),
                                                                                    m_queue.end(),
-                                                                                   job->GetPriority(),
+                                                                                   job,
                                                                                    CompareJobPriorities);
     m_queue.insert(locationToinsert, job);
+    if (RunsBeforeDefaultPriority(job))
+    {
+        m_numHigherPriority.fetch_add(1, AZStd::memory_order_release);
+    }
+    else
+    {
+        m_numLowerPriority.fetch_add(1, AZStd::memory_order_release);
+    }
 }
 
 Job* WorkQueue::LocalPopFront()
 {
-    LockGuard lock(m_lock);
-
     Job* result = nullptr;
-    if (!m_queue.empty())
+    if (m_numHigherPriority.load(AZStd::memory_order_acquire) > 0)
     {
-        result = m_queue.front();
-        m_queue.pop_front();
+        result = TryPopPrioritized(false);
+    }
+    if (!result)
+    {
+        result = m_defaultPriorityJobs.Pop();
+    }
+    if (!result && m_numLowerPriority.load(AZStd::memory_order_acquire) > 0)
+    {
+        result = TryPopPrioritized(false);
     }
-
     return result;
 }
 
 Job* WorkQueue::TryStealFront()
 {
-    AZStd::exponential_backoff backoff;
-    for (unsigned attempCount = 0; attempCount < TryStealSpinAttemps; ++attempCount)
+    Job* result = nullptr;
+    if (m_numHigherPriority.load(AZStd::memory_order_acquire) > 0)
+    {
+        result = TryPopPrioritized(true);
+    }
+    if (!result)
+    {
+        result = m_defaultPriorityJobs.Steal();
+    }
+    if (!result && m_numLowerPriority.load(AZStd::memory_order_acquire) > 0)
+    {
+        result = TryPopPrioritized(true);
+    }
+    return result;
+}
+
+Job* WorkQueue::TryPopPrioritized(bool spinForLock)
+{
+    if (spinForLock)
     {
         // Do a bounded spin with backoff to acquire the lock
-        if (m_lock.try_lock())
+        AZStd::exponential_backoff backoff;
+        unsigned attempCount = 0;
+        while (!m_lock.try_lock())
         {
-            Job* result = nullptr;
-            if (!m_queue.empty())
+            if (++attempCount >= TryStealSpinAttemps)
             {
-                result = m_queue.front();
-                m_queue.pop_front();
+                return nullptr;
             }
-
-            m_lock.unlock();
-            return result;
+            backoff.wait();
         }
+    }
+    else
+    {
+        m_lock.lock();
+    }
 
-        backoff.wait();
+    Job* result = nullptr;
+    if (!m_queue.empty())
+    {
+        result = m_queue.front();
+        m_queue.pop_front();
+        if (RunsBeforeDefaultPriority(result))
+        {
+            m_numHigherPriority.fetch_sub(1, AZStd::memory_order_release);
+        }
+        else
+        {
+            m_numLowerPriority.fetch_sub(1, AZStd::memory_order_release);
+        }
     }
 
-    return nullptr;
+    m_lock.unlock();
+    return result;
 }
 
 
@@ -85,6 +256,8 @@ JobManagerWorkStealing::JobManagerWorkStealing(const JobManagerDesc& desc)
     : m_isAsynchronous(!desc.m_workerThreads.empty())
     , m_workerThreads(AZStd::move(CreateWorkerThreads(desc.m_workerThreads)))
 {
+    BuildStealVictims(desc.m_workerThreads);
+
     //allow workers to begin processing after they have all been created, needed to wait since they may access each others queues
     m_initSemaphore.release(static_cast<unsigned int>(desc.m_workerThreads.size()));
 }
@@ -142,46 +315,57 @@ void JobManagerWorkStealing::AddPendingJob(Job* job)
 #endif
         }
     }
-    else if (info && info->m_isWorker && (info->m_owningManager == this))
-    {
-        //current thread is a worker, insert into the local queue based on the job's priority
-        info->m_pendingJobs.LocalInsert(job);
-#ifdef JOBMANAGER_ENABLE_STATS
-        ++info->m_jobsForked;
-#endif
-        // if there are threads asleep wake one up
-        ActivateWorker();
-    }
     else
     {
-        //current thread is not a worker thread, insert into the global queue based on the job's priority
-        if (IsAsynchronous())
+        const size_t classIndex = static_cast<size_t>(GetEffectiveClass(job));
+        job->m_queuedTime = AZStd::GetTimeNowTicks();
+        //count the job before it becomes visible to other threads, so dequeuing never drops the depth below 0
+        m_queueDepths[classIndex].fetch_add(1, AZStd::memory_order_release);
+
+        if (info && info->m_isWorker && (info->m_owningManager == this))
         {
-            AZStd::lock_guard<GlobalQueueMutexType> lock(m_globalJobQueueMutex);
-            const GlobalJobQueue::const_iterator locationToinsert = AZStd::upper_bound(m_globalJobQueue.begin(),
-                                                                                       m_globalJobQueue.end(),
-                                                                                       job->GetPriority(),
-                                                                                       CompareJobPriorities);
-            m_globalJobQueue.insert(locationToinsert, job);
-
-            //checking/changing global queue empty state or worker availability must be done atomically while holding the global queue lock
+            //current thread is a worker, insert into the local queue based on the job's class and priority
+            info->m_pendingJobs[classIndex].LocalInsert(job);
+#ifdef JOBMANAGER_ENABLE_STATS
+            ++info->m_jobsForked;
+#endif
+            // if there are threads asleep wake one up
             ActivateWorker();
         }
         else
         {
+            //current thread is not a worker thread, insert into the global queue based on the job's class and priority
+            GlobalJobQueue& globalJobQueue = m_globalJobQueues[classIndex];
+            if (IsAsynchronous())
             {
                 AZStd::lock_guard<GlobalQueueMutexType> lock(m_globalJobQueueMutex);
-                const GlobalJobQueue::const_iterator locationToinsert = AZStd::upper_bound(m_globalJobQueue.begin(),
-                                                                                           m_globalJobQueue.end(),
-                                                                                           job->GetPriority(),
+                const GlobalJobQueue::const_iterator locationToinsert = AZStd::upper_bound(globalJobQueue.begin(),
+                                                                                           globalJobQueue.end(),
+                                                                                           job,
                                                                                            CompareJobPriorities);
-                m_globalJobQueue.insert(locationToinsert, job);
-            }
+                globalJobQueue.insert(locationToinsert, job);
+                m_globalJobQueueSizes[classIndex].fetch_add(1, AZStd::memory_order_release);
 
-            //no workers, so must process the jobs right now
-            if (!info)  //unless we're already processing
+                //checking/changing global queue empty state or worker availability must be done atomically while holding the global queue lock
+                ActivateWorker();
+            }
+            else
             {
-                ProcessJobsSynchronous(GetCurrentOrCreateThreadInfo(), nullptr, nullptr);
+                {
+                    AZStd::lock_guard<GlobalQueueMutexType> lock(m_globalJobQueueMutex);
+                    const GlobalJobQueue::const_iterator locationToinsert = AZStd::upper_bound(globalJobQueue.begin(),
+                                                                                               globalJobQueue.end(),
+                                                                                               job,
+                                                                                               CompareJobPriorities);
+                    globalJobQueue.insert(locationToinsert, job);
+                    m_globalJobQueueSizes[classIndex].fetch_add(1, AZStd::memory_order_release);
+                }
+
+                //no workers, so must process the jobs right now
+                if (!info)  //unless we're already processing
+                {
+                    ProcessJobsSynchronous(GetCurrentOrCreateThreadInfo(), nullptr, nullptr);
+                }
             }
         }
     }
@@ -248,6 +432,13 @@ void JobManagerWorkStealing::ClearStats()
         info->m_stealTime = 0;
     }
 #endif
+    for (ClassCounters& counters : m_classCounters)
+    {
+        counters.m_jobsRun.store(0, AZStd::memory_order_relaxed);
+        counters.m_deadlinesMissed.store(0, AZStd::memory_order_relaxed);
+        counters.m_totalWaitTime.store(0, AZStd::memory_order_relaxed);
+        counters.m_maxWaitTime.store(0, AZStd::memory_order_relaxed);
+    }
 }
 
 void JobManagerWorkStealing::PrintStats()
@@ -267,6 +458,19 @@ void JobManagerWorkStealing::PrintStats()
             i, info->m_globalJobs, info->m_jobsForked, info->m_jobsDone, info->m_jobsStolen, jobTime, stealTime, jobTime + stealTime);
         printf(str);
     }
+
+    printf("Class        Queued   Jobs run   Avg wait (ms)  Max wait (ms)  Deadlines missed\n");
+    printf("----------   ------   --------   -------------  -------------  ----------------\n");
+    for (size_t classIndex = 0; classIndex < static_cast<size_t>(JobPriorityClass::Count); ++classIndex)
+    {
+        const JobPriorityClassStats stats = GetPriorityClassStats(static_cast<JobPriorityClass>(classIndex));
+        double avgWaitTime = stats.m_jobsRun ? 1000.0 * static_cast<double>(stats.m_totalWaitTime) / stats.m_jobsRun / AZStd::GetTimeTicksPerSecond() : 0.0;
+        double maxWaitTimeMs = 1000.0 * static_cast<double>(stats.m_maxWaitTime) / AZStd::GetTimeTicksPerSecond();
+        azsnprintf(str, AZ_ARRAY_SIZE(str), " %-10s   %6u   %8llu   %13.3f  %13.3f  %16llu\n",
+            ToString(static_cast<JobPriorityClass>(classIndex)), stats.m_queueDepth, static_cast<unsigned long long>(stats.m_jobsRun),
+            avgWaitTime, maxWaitTimeMs, static_cast<unsigned long long>(stats.m_deadlinesMissed));
+        printf(str);
+    }
 #endif
 }
 
@@ -296,6 +500,24 @@ AZ::u32 JobManagerWorkStealing::GetWorkerThreadId() const
     return info ? info->m_workerId : JobManagerBase::InvalidWorkerThreadId;
 }
 
+AZ::u32 JobManagerWorkStealing::GetQueueDepth(JobPriorityClass priorityClass) const
+{
+    return m_queueDepths[static_cast<size_t>(priorityClass)].load(AZStd::memory_order_acquire);
+}
+
+JobPriorityClassStats JobManagerWorkStealing::GetPriorityClassStats(JobPriorityClass priorityClass) const
+{
+    const size_t classIndex = static_cast<size_t>(priorityClass);
+    const ClassCounters& counters = m_classCounters[classIndex];
+    JobPriorityClassStats stats;
+    stats.m_queueDepth = m_queueDepths[classIndex].load(AZStd::memory_order_acquire);
+    stats.m_jobsRun = counters.m_jobsRun.load(AZStd::memory_order_relaxed);
+    stats.m_deadlinesMissed = counters.m_deadlinesMissed.load(AZStd::memory_order_relaxed);
+    stats.m_totalWaitTime = counters.m_totalWaitTime.load(AZStd::memory_order_relaxed);
+    stats.m_maxWaitTime = counters.m_maxWaitTime.load(AZStd::memory_order_relaxed);
+    return stats;
+}
+
 
 
 void JobManagerWorkStealing::ProcessJobsWorker(ThreadInfo* info)
@@ -325,9 +547,9 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
 {
     AZ_Assert(IsAsynchronous(), "ProcessJobs is only to be used when we have worker threads (can be called on non-workers too though)");
 
-    //get thread local job queue
-    WorkQueue* pendingJobs = info->m_isWorker ? &info->m_pendingJobs : nullptr;
-    unsigned int victim = ((m_workerThreads.size() > 1) && (m_workerThreads[0] == info)) ? 1 : 0;
+    //only workers have thread local job queues
+    const bool hasLocalQueues = info->m_isWorker;
+    unsigned int victim = (m_workerThreads.size() > 1) ? SelectStealVictim(info, 1) : 0;
 
     while (true)
     {
@@ -349,11 +571,18 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                     return;
                 }
 
+                //poll for new work for a while before going to sleep, waking a sleeping worker is far more expensive than a short spin
                 bool shouldSleep = false;
+                if (!SpinForWork(info))
                 {
                     //checking/changing global queue empty state or worker availability must be done atomically while holding the global queue lock
                     AZStd::lock_guard<GlobalQueueMutexType> lock(m_globalJobQueueMutex);
-                    if (m_globalJobQueue.empty())
+                    bool globalQueuesEmpty = true;
+                    for (const GlobalJobQueue& globalJobQueue : m_globalJobQueues)
+                    {
+                        globalQueuesEmpty = globalQueuesEmpty && globalJobQueue.empty();
+                    }
+                    if (globalQueuesEmpty)
                     {
                         shouldSleep = true;
 
@@ -387,23 +616,8 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                 return;
             }
 
-            {
-                AZStd::lock_guard<GlobalQueueMutexType> lock(m_globalJobQueueMutex);
-                if (!m_globalJobQueue.empty())
-                {
-                    job = m_globalJobQueue.front();
-                    m_globalJobQueue.pop_front();
-#ifdef JOBMANAGER_ENABLE_STATS
-                    ++info->m_globalJobs;
-#endif
-                }
-            }
-        }
-
-        if (!job && pendingJobs)
-        {
-            //nothing on the global queue, try to pop from the local queue
-            job = pendingJobs->LocalPopFront();
+            //take the most urgent job available, either from the global queues or our local queues
+            job = TakeJob(info, hasLocalQueues);
         }
 
         bool isTerminated = false;
@@ -430,19 +644,13 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                     return;
                 }
 
-                //pop a new job from the local queue
-                if (pendingJobs)
-                {
-                    job = pendingJobs->LocalPopFront();
-                    if (job)
-                    {
-                        // not necessary, just an optimization - wakeup sleeping threads, there's work to be done
-                        ActivateWorker();
-                    }
-                }
-                else
+                //take a new job, this is where running jobs yield to more urgent ones: jobs of a higher class, even from the
+                //global queue, are always taken before the local jobs of a lower class
+                job = TakeJob(info, hasLocalQueues);
+                if (job && hasLocalQueues)
                 {
-                    job = nullptr;
+                    // not necessary, just an optimization - wakeup sleeping threads, there's work to be done
+                    ActivateWorker();
                 }
             }
 
@@ -470,17 +678,11 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                         return;
                     }
 
-                    //select a victim thread, using the same victim as the previous successful steal if possible
-                    WorkQueue* victimQueue = &m_workerThreads[victim]->m_pendingJobs;
-
-                    //attempt the steal
-                    job = victimQueue->TryStealFront();
+                    //attempt the steal, using the same victim as the previous successful steal if possible
+                    job = TryStealJob(info, victim);
                     if (job)
                     {
                         //success, continue with the stolen job
-#ifdef JOBMANAGER_ENABLE_STATS
-                        ++info->m_jobsStolen;
-#endif
                         break;
                     }
 
@@ -500,12 +702,7 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                     }
 
                     //steal failed, choose a new victim for next time
-                    victim = (victim + 1) % m_workerThreads.size();
-                    if (m_workerThreads[victim] == info)
-                    {
-                        //don't steal from ourselves
-                        victim = (victim + 1) % m_workerThreads.size();
-                    }
+                    victim = SelectStealVictim(info, numStealAttempts);
                 }
             }
 #ifdef JOBMANAGER_ENABLE_STATS
@@ -522,11 +719,8 @@ void JobManagerWorkStealing::ProcessJobsSynchronous(ThreadInfo* info, Job* suspe
     ThreadInfo* oldInfo = m_currentThreadInfo;
     m_currentThreadInfo = info;
 
-    while (!m_globalJobQueue.empty())
+    while (Job* job = TakeJob(info, false))
     {
-        Job* job = m_globalJobQueue.front();
-        m_globalJobQueue.pop_front();
-
         info->m_currentJob = job;
         Process(job);
         info->m_currentJob = NULL;
@@ -660,6 +854,206 @@ JobManagerWorkStealing::ThreadList JobManagerWorkStealing::CreateWorkerThreads(c
     return workerThreads;
 }
 
+void JobManagerWorkStealing::BuildStealVictims(const JobManagerDesc::DescList& workerDescList)
+{
+    for (unsigned int iThread = 0; iThread < m_workerThreads.size(); ++iThread)
+    {
+        ThreadInfo* info = m_workerThreads[iThread];
+        const int cacheGroup = workerDescList[iThread].m_cacheGroup;
+
+        //siblings sharing a cache group come first, followed by every other worker
+        info->m_stealVictims.clear();
+        for (unsigned int iVictim = 0; iVictim < m_workerThreads.size(); ++iVictim)
+        {
+            if ((iVictim != iThread) && (workerDescList[iVictim].m_cacheGroup == cacheGroup))
+            {
+                info->m_stealVictims.push_back(iVictim);
+            }
+        }
+        info->m_numSiblingVictims = static_cast<unsigned int>(info->m_stealVictims.size());
+        for (unsigned int iVictim = 0; iVictim < m_workerThreads.size(); ++iVictim)
+        {
+            if (workerDescList[iVictim].m_cacheGroup != cacheGroup)
+            {
+                info->m_stealVictims.push_back(iVictim);
+            }
+        }
+
+        //seed each worker differently so workers don't all hammer the same victim
+        info->m_randomState = (iThread + 1) * 2654435761u;
+    }
+}
+
+unsigned int JobManagerWorkStealing::SelectStealVictim(ThreadInfo* info, unsigned int stealAttempt) const
+{
+    //xorshift32, cheap and good enough to spread steal attempts between victims
+    unsigned int random = info->m_randomState;
+    random ^= random << 13;
+    random ^= random >> 17;
+    random ^= random << 5;
+    info->m_randomState = random;
+
+    if ((info->m_owningManager != this) || info->m_stealVictims.empty())
+    {
+        //not a worker of this job manager (a user thread or another manager's worker assisting with jobs), any worker is a valid victim
+        return random % m_workerThreads.size();
+    }
+
+    //mostly target workers sharing a cache, but regularly try the remaining workers so their work is not starved of thieves
+    const bool preferSibling = (info->m_numSiblingVictims > 0) && ((stealAttempt % SiblingStealRatio) != 0);
+    const unsigned int numCandidates = preferSibling ? info->m_numSiblingVictims : static_cast<unsigned int>(info->m_stealVictims.size());
+    return info->m_stealVictims[random % numCandidates];
+}
+
+bool JobManagerWorkStealing::SpinForWork(ThreadInfo* info) const
+{
+    //the spin limit adapts to the workload, it grows while spinning keeps finding work (bursts of fine grained jobs) and shrinks
+    //while it doesn't (idle periods), so idle workers quickly stop burning cycles
+    for (unsigned int spin = 0; spin < info->m_idleSpinLimit; ++spin)
+    {
+        if (m_quitRequested)
+        {
+            return false;
+        }
+
+        if (HasPendingWork())
+        {
+            info->m_idleSpinLimit = AZ::GetMin<unsigned int>(info->m_idleSpinLimit * 2, IdleSpinLimitMax);
+            return true;
+        }
+
+        AZStd::this_thread::pause(1);
+    }
+
+    info->m_idleSpinLimit = AZ::GetMax<unsigned int>(info->m_idleSpinLimit / 2, IdleSpinLimitMin);
+    return false;
+}
+
+bool JobManagerWorkStealing::HasPendingWork() const
+{
+    //the depths cover the global and all local queues
+    for (const AZStd::atomic_uint& queueDepth : m_queueDepths)
+    {
+        if (queueDepth.load(AZStd::memory_order_acquire) > 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+JobPriorityClass JobManagerWorkStealing::GetEffectiveClass(const Job* job) const
+{
+    //a job which is already late when it becomes ready can't wait behind other work any longer
+    const AZStd::sys_time_t deadline = job->GetDeadline();
+    if ((deadline != 0) && (AZStd::GetTimeNowTicks() >= deadline))
+    {
+        return JobPriorityClass::Critical;
+    }
+    return job->GetPriorityClass();
+}
+
+Job* JobManagerWorkStealing::TakeGlobalJob(ThreadInfo* info, JobPriorityClass priorityClass)
+{
+    const size_t classIndex = static_cast<size_t>(priorityClass);
+    if (m_globalJobQueueSizes[classIndex].load(AZStd::memory_order_acquire) == 0)
+    {
+        return nullptr;
+    }
+
+    Job* job = nullptr;
+    {
+        AZStd::lock_guard<GlobalQueueMutexType> lock(m_globalJobQueueMutex);
+        GlobalJobQueue& globalJobQueue = m_globalJobQueues[classIndex];
+        if (!globalJobQueue.empty())
+        {
+            job = globalJobQueue.front();
+            globalJobQueue.pop_front();
+            m_globalJobQueueSizes[classIndex].fetch_sub(1, AZStd::memory_order_release);
+        }
+    }
+
+    if (job)
+    {
+#ifdef JOBMANAGER_ENABLE_STATS
+        ++info->m_globalJobs;
+#endif
+        OnJobDequeued(job, priorityClass);
+    }
+    return job;
+}
+
+Job* JobManagerWorkStealing::TakeJob(ThreadInfo* info, bool includeLocal)
+{
+    for (size_t classIndex = 0; classIndex < static_cast<size_t>(JobPriorityClass::Count); ++classIndex)
+    {
+        //skip classes with no pending jobs anywhere, avoids touching the queues of classes which are not in use
+        if (m_queueDepths[classIndex].load(AZStd::memory_order_acquire) == 0)
+        {
+            continue;
+        }
+
+        const JobPriorityClass priorityClass = static_cast<JobPriorityClass>(classIndex);
+
+        //within a class prefer the local queue, its jobs were forked by this thread and are likely to be cache hot
+        if (includeLocal)
+        {
+            if (Job* job = info->m_pendingJobs[classIndex].LocalPopFront())
+            {
+                OnJobDequeued(job, priorityClass);
+                return job;
+            }
+        }
+
+        if (Job* job = TakeGlobalJob(info, priorityClass))
+        {
+            return job;
+        }
+    }
+    return nullptr;
+}
+
+Job* JobManagerWorkStealing::TryStealJob(ThreadInfo* info, unsigned int victim)
+{
+    for (size_t classIndex = 0; classIndex < static_cast<size_t>(JobPriorityClass::Count); ++classIndex)
+    {
+        if (m_queueDepths[classIndex].load(AZStd::memory_order_acquire) == 0)
+        {
+            continue;
+        }
+
+        if (Job* job = m_workerThreads[victim]->m_pendingJobs[classIndex].TryStealFront())
+        {
+#ifdef JOBMANAGER_ENABLE_STATS
+            ++info->m_jobsStolen;
+#endif
+            OnJobDequeued(job, static_cast<JobPriorityClass>(classIndex));
+            return job;
+        }
+    }
+    return nullptr;
+}
+
+void JobManagerWorkStealing::OnJobDequeued(Job* job, JobPriorityClass priorityClass)
+{
+    const size_t classIndex = static_cast<size_t>(priorityClass);
+    m_queueDepths[classIndex].fetch_sub(1, AZStd::memory_order_acq_rel);
+
+    ClassCounters& counters = m_classCounters[classIndex];
+    const AZStd::sys_time_t now = AZStd::GetTimeNowTicks();
+    const AZStd::sys_time_t waitTime = now - job->m_queuedTime;
+    counters.m_jobsRun.fetch_add(1, AZStd::memory_order_relaxed);
+    counters.m_totalWaitTime.fetch_add(waitTime, AZStd::memory_order_relaxed);
+    AZStd::sys_time_t maxWaitTime = counters.m_maxWaitTime.load(AZStd::memory_order_relaxed);
+    while ((waitTime > maxWaitTime) && !counters.m_maxWaitTime.compare_exchange_weak(maxWaitTime, waitTime, AZStd::memory_order_relaxed))
+    {
+    }
+    if ((job->GetDeadline() != 0) && (now > job->GetDeadline()))
+    {
+        counters.m_deadlinesMissed.fetch_add(1, AZStd::memory_order_relaxed);
+    }
+}
+
 inline void JobManagerWorkStealing::ActivateWorker()
 {
     // find an available worker thread (we do it brute force because the number of threads is small)
@@ -12,9 +12,12 @@
 
 #include <AzCore/Jobs/Internal/JobManagerBase.h>
 #include <AzCore/Jobs/JobManagerDesc.h>
+#include <AzCore/Jobs/JobPriorityClass.h>
 #include <AzCore/Memory/PoolAllocator.h>
 
 #include <AzCore/std/containers/queue.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/parallel/shared_mutex.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/semaphore.h>
@@ -27,6 +30,70 @@ namespace AZ
 
     namespace Internal
     {
+        /**
+         * Lock free work stealing deque (Chase-Lev), owned by a single worker thread.
+         * The owner pushes and pops jobs at the bottom (LIFO, which keeps recently forked and cache hot work on the forking thread),
+         * while any other thread may steal the oldest jobs from the top. Only the owner and a thief racing for the last job need
+         * an atomic read-modify-write, every other operation is plain loads and stores.
+         * The ring buffer grows on demand, retired rings are kept alive until the deque is destroyed because a thief may still be
+         * reading from them.
+         */
+        class WorkStealingDeque final
+        {
+        public:
+            WorkStealingDeque();
+            ~WorkStealingDeque();
+
+            //! Owner only, adds a job to the bottom of the deque.
+            void Push(Job* job);
+
+            //! Owner only, removes the most recently pushed job.
+            //! @return the job, or nullptr if the deque is empty
+            Job* Pop();
+
+            //! Any thread, removes the oldest job.
+            //! @return the job, or nullptr if the deque is empty or another thread won the race for the job
+            Job* Steal();
+
+            //! Any thread, approximate as the deque may be modified concurrently.
+            bool IsEmpty() const;
+
+        private:
+            AZ_DISABLE_COPY_MOVE(WorkStealingDeque);
+
+            enum
+            {
+                InitialCapacity = 256,
+                CacheLineSize = 64,
+            };
+
+            struct Ring
+            {
+                explicit Ring(AZ::s64 capacity);
+
+                Job* Load(AZ::s64 index) const;
+                void Store(AZ::s64 index, Job* job);
+                Ring* Grow(AZ::s64 top, AZ::s64 bottom) const;
+
+                AZ::s64 m_capacity;
+                AZStd::unique_ptr<AZStd::atomic<Job*>[]> m_slots;
+            };
+
+            //top and bottom are written by different threads, keep them on separate cache lines
+            AZStd::atomic<AZ::s64> m_top{ 0 };
+            char m_topPadding[CacheLineSize - sizeof(AZStd::atomic<AZ::s64>)];
+            AZStd::atomic<AZ::s64> m_bottom{ 0 };
+            AZStd::atomic<Ring*> m_ring{ nullptr };
+            char m_bottomPadding[CacheLineSize - sizeof(AZStd::atomic<AZ::s64>) - sizeof(AZStd::atomic<Ring*>)];
+            AZStd::vector<AZStd::unique_ptr<Ring>> m_rings; //current and retired rings, only touched by the owner
+        };
+
+        /**
+         * Per worker job queue, a worker has one for each JobPriorityClass. Default priority jobs without a deadline, which make up
+         * nearly all of the jobs in practice, go through the lock free WorkStealingDeque. Jobs with an explicit priority or a deadline
+         * are kept sorted in a locked queue, jobs with a higher than default priority or a deadline are run before the default
+         * priority jobs and jobs with a lower priority after them.
+         */
         class WorkQueue final
         {
         public:
@@ -42,8 +109,16 @@ namespace AZ
             using LockType = AZStd::shared_mutex;
             using LockGuard = AZStd::lock_guard<LockType>;
 
-            AZStd::deque<Job*> m_queue;
+            //! Pops the highest priority job from the prioritized queue.
+            //! @param spinForLock true to give up after a bounded spin if the lock is contended, false to block on the lock
+            Job* TryPopPrioritized(bool spinForLock);
+
+            WorkStealingDeque m_defaultPriorityJobs;
+
+            AZStd::deque<Job*> m_queue; //jobs with non default priorities, sorted by priority
             LockType m_lock;
+            AZStd::atomic_uint m_numHigherPriority{ 0 };
+            AZStd::atomic_uint m_numLowerPriority{ 0 };
         };
 
         /**
@@ -80,7 +155,17 @@ namespace AZ
 
             AZ::u32 GetWorkerThreadId() const;
 
+            AZ::u32 GetQueueDepth(JobPriorityClass priorityClass) const;
+
+            JobPriorityClassStats GetPriorityClassStats(JobPriorityClass priorityClass) const;
+
         private:
+            enum
+            {
+                IdleSpinLimitMin = 16,      ///< Minimum number of polls an idle worker makes for new work before going to sleep
+                IdleSpinLimitMax = 4096,    ///< Maximum number of polls, the limit adapts between the two based on whether spinning found work
+                SiblingStealRatio = 4,      ///< Out of every SiblingStealRatio steal attempts, all but one target workers in the same cache group
+            };
 
             void ActivateWorker();
 
@@ -97,9 +182,15 @@ namespace AZ
                 AZStd::thread m_thread;
                 AZStd::atomic_bool m_isAvailable{false};
                 AZStd::binary_semaphore m_waitEvent;
-                WorkQueue m_pendingJobs;
+                WorkQueue m_pendingJobs[static_cast<size_t>(JobPriorityClass::Count)];
                 unsigned int m_workerId = JobManagerBase::InvalidWorkerThreadId;
 
+                // steal victims as worker indices, workers in the same cache group first followed by all other workers
+                AZStd::vector<unsigned int> m_stealVictims;
+                unsigned int m_numSiblingVictims = 0;
+                unsigned int m_randomState = 1;
+                unsigned int m_idleSpinLimit = IdleSpinLimitMin;
+
 #ifdef JOBMANAGER_ENABLE_STATS
                 unsigned int m_globalJobs = 0;
                 unsigned int m_jobsForked = 0;
@@ -116,6 +207,15 @@ namespace AZ
             void ProcessJobsSynchronous(ThreadInfo* info, Job* suspendedJob, AZStd::atomic<bool>* notifyFlag);
             void ProcessJobsInternal(ThreadInfo* info, Job* suspendedJob, AZStd::atomic<bool>* notifyFlag);
             ThreadList CreateWorkerThreads(const JobManagerDesc::DescList& workerDescList);
+            void BuildStealVictims(const JobManagerDesc::DescList& workerDescList);
+            unsigned int SelectStealVictim(ThreadInfo* info, unsigned int stealAttempt) const;
+            bool SpinForWork(ThreadInfo* info) const;
+            bool HasPendingWork() const;
+            JobPriorityClass GetEffectiveClass(const Job* job) const;
+            Job* TakeGlobalJob(ThreadInfo* info, JobPriorityClass priorityClass);
+            Job* TakeJob(ThreadInfo* info, bool includeLocal);
+            Job* TryStealJob(ThreadInfo* info, unsigned int victim);
+            void OnJobDequeued(Job* job, JobPriorityClass priorityClass);
 #ifndef AZ_MONOLITHIC_BUILD
             ThreadInfo* CrossModuleFindAndSetWorkerThreadInfo() const;
 #endif
@@ -134,8 +234,20 @@ namespace AZ
             using GlobalJobQueue = AZStd::deque<Job*>;
             using GlobalQueueMutexType = AZStd::mutex;
 
-            GlobalJobQueue              m_globalJobQueue;
-            GlobalQueueMutexType        m_globalJobQueueMutex;
+            GlobalJobQueue              m_globalJobQueues[static_cast<size_t>(JobPriorityClass::Count)];
+            GlobalQueueMutexType        m_globalJobQueueMutex; //guards the global queues of all classes
+            AZStd::atomic_uint          m_globalJobQueueSizes[static_cast<size_t>(JobPriorityClass::Count)] = {}; //mirror the global queue sizes so idle workers can poll without taking the lock
+            AZStd::atomic_uint          m_queueDepths[static_cast<size_t>(JobPriorityClass::Count)] = {}; //jobs waiting in any global or local queue, per class
+
+            //per class counters behind GetPriorityClassStats, measured from the time a job is queued until a thread picks it up
+            struct ClassCounters
+            {
+                AZStd::atomic<u64> m_jobsRun{0};
+                AZStd::atomic<u64> m_deadlinesMissed{0};
+                AZStd::atomic<AZStd::sys_time_t> m_totalWaitTime{0};
+                AZStd::atomic<AZStd::sys_time_t> m_maxWaitTime{0};
+            };
+            ClassCounters               m_classCounters[static_cast<size_t>(JobPriorityClass::Count)];
 
             volatile bool               m_quitRequested = false;
             AZStd::atomic_uint          m_numAvailableWorkers{0};
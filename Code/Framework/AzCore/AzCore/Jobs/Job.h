@@ -12,7 +12,9 @@
 #include <AzCore/Jobs/JobCancelGroup.h>
 #include <AzCore/Jobs/JobContext.h>
 #include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Jobs/JobPriorityClass.h>
 #include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/time.h>
 
 #include <AzCore/Memory/PoolAllocator.h>
 
@@ -60,6 +62,8 @@ namespace AZ
          * priority is used to sort jobs such that higher priority jobs are run before lower priority ones.
          *          The valid range is -128 (lowest priority) to 127 (highest priority), the default is 0,
          *          and jobs with equal priority values will be run in the same order as added to the queue.
+         *          The exception is default priority jobs started from within a worker thread, the worker runs those
+         *          most recent first (depth first) while idle workers steal the oldest ones.
          */
         Job(bool isAutoDelete, JobContext* context, bool isCompletion = false, AZ::s8 priority = 0);
 
@@ -173,6 +177,22 @@ namespace AZ
          */
         AZ::s8 GetPriority() const;
 
+        /**
+         * Sets the scheduling class of this job, see \ref JobPriorityClass. The default is JobPriorityClass::Normal.
+         * Must be called before the job is started.
+         */
+        void SetPriorityClass(JobPriorityClass priorityClass);
+        JobPriorityClass GetPriorityClass() const;
+
+        /**
+         * Sets an optional deadline, as a time in AZStd::GetTimeNowTicks() ticks. Within a class, jobs with a deadline run
+         * before jobs without one, earliest deadline first. A job whose deadline has already passed when it becomes ready to
+         * run is promoted to the critical class. Deadline misses are counted in the job manager stats.
+         * Must be called before the job is started, 0 (the default) means no deadline.
+         */
+        void SetDeadline(AZStd::sys_time_t deadline);
+        AZStd::sys_time_t GetDeadline() const;
+
 #ifdef AZ_DEBUG_JOB_STATE
         int GetState() const    { return m_state; }
 #endif // AZ_DEBUG_JOB_STATE
@@ -233,6 +253,11 @@ namespace AZ
         //state is only really necessary for debugging... we could squeeze it into the dependent count member, but it
         //would require atomic ops to set/read it, so not really worth it.
         int m_state;
+
+        JobPriorityClass m_priorityClass = JobPriorityClass::Normal;
+        AZStd::sys_time_t m_deadline = 0;
+        AZStd::sys_time_t m_queuedTime = 0; //when the job was last queued, used to measure wait times
+        friend class Internal::JobManagerWorkStealing;
     };
 
     //============================================================================================================
@@ -498,6 +523,33 @@ namespace AZ
         return (GetDependentCountAndFlags() >> FLAG_PRIORITY_START_BIT) & 0xff;
     }
 
+    inline void Job::SetPriorityClass(JobPriorityClass priorityClass)
+    {
+#ifdef AZ_DEBUG_JOB_STATE
+        AZ_Assert(m_state == STATE_SETUP, "Priority class must be set before the job is started");
+#endif
+        AZ_Assert(priorityClass < JobPriorityClass::Count, "Invalid job priority class");
+        m_priorityClass = priorityClass;
+    }
+
+    inline JobPriorityClass Job::GetPriorityClass() const
+    {
+        return m_priorityClass;
+    }
+
+    inline void Job::SetDeadline(AZStd::sys_time_t deadline)
+    {
+#ifdef AZ_DEBUG_JOB_STATE
+        AZ_Assert(m_state == STATE_SETUP, "Deadline must be set before the job is started");
+#endif
+        m_deadline = deadline;
+    }
+
+    inline AZStd::sys_time_t Job::GetDeadline() const
+    {
+        return m_deadline;
+    }
+
 #ifdef AZ_DEBUG_JOB_STATE
     AZ_FORCE_INLINE void Job::SetState(int state)
     {
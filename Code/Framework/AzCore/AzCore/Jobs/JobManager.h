@@ -77,6 +77,13 @@ namespace AZ
         /// Returns 0 based worker index (for legacy Job compatibility)
         AZ::u32 GetWorkerThreadId() const { return m_impl.GetWorkerThreadId(); }
 
+        /// Returns the number of jobs of the given class which are ready to run but have not been picked up by a thread yet.
+        AZ::u32 GetQueueDepth(JobPriorityClass priorityClass) const { return m_impl.GetQueueDepth(priorityClass); }
+
+        /// Returns the queue depth, wait times and deadline misses of the given class. These are always tracked, unlike the
+        /// per thread stats printed by PrintStats, and are reset by ClearStats.
+        JobPriorityClassStats GetPriorityClassStats(JobPriorityClass priorityClass) const { return m_impl.GetPriorityClassStats(priorityClass); }
+
     private:
         //non-copyable
         JobManager(const JobManager& manager);
@@ -36,10 +36,19 @@ namespace AZ
         */
         int     m_stackSize;
 
-        JobManagerThreadDesc(int cpuId = -1, int priority = -100000, int stackSize = -1)
+        /**
+        *  Cache group of this thread, used to pick work stealing victims.
+        *  Workers that share a cache group (e.g. are pinned to cores sharing an L2 or L3 cache) prefer stealing from each other
+        *  before stealing from workers in other groups, keeping stolen work and its data closer in the cache hierarchy.
+        *  Default is -1, which places the worker in a single group with all other workers that don't specify a group.
+        */
+        int     m_cacheGroup;
+
+        JobManagerThreadDesc(int cpuId = -1, int priority = -100000, int stackSize = -1, int cacheGroup = -1)
             : m_cpuId(cpuId)
             , m_priority(priority)
             , m_stackSize(stackSize)
+            , m_cacheGroup(cacheGroup)
         {
         }
     };
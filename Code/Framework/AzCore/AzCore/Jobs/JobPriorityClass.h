@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/time.h>
+
+namespace AZ
+{
+    /**
+     * Scheduling class of a job. Workers always take available jobs of a higher class before jobs of a lower class, a job's
+     * priority value only orders jobs within its class. Jobs are never preempted, so a worker running a long background job
+     * only picks up more urgent work once that job returns.
+     */
+    enum class JobPriorityClass : AZ::u8
+    {
+        Critical,   ///< Work the current frame is waiting on, such as culling.
+        Normal,     ///< The default class.
+        Background, ///< Long running work (asset loading, procedural generation, ...) that should only use otherwise idle workers.
+        Count
+    };
+
+    /**
+     * Scheduling counters of a priority class, accumulated since the job manager was created or its stats were last cleared.
+     * Wait times are measured from the moment a job is queued until a thread picks it up, in AZStd::GetTimeNowTicks() ticks.
+     */
+    struct JobPriorityClassStats
+    {
+        AZ::u32 m_queueDepth = 0;           ///< Jobs that are ready to run but haven't been picked up by a thread yet.
+        AZ::u64 m_jobsRun = 0;
+        AZ::u64 m_deadlinesMissed = 0;      ///< Jobs with a deadline that were picked up after their deadline had passed.
+        AZStd::sys_time_t m_totalWaitTime = 0;
+        AZStd::sys_time_t m_maxWaitTime = 0;
+    };
+
+    inline const char* ToString(JobPriorityClass priorityClass)
+    {
+        switch (priorityClass)
+        {
+        case JobPriorityClass::Critical:
+            return "Critical";
+        case JobPriorityClass::Normal:
+            return "Normal";
+        case JobPriorityClass::Background:
+            return "Background";
+        default:
+            return "Unknown";
+        }
+    }
+}
@@ -0,0 +1,338 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Memory/AllocationSampler.h>
+#include <AzCore/Memory/OSAllocator.h>
+#include <AzCore/Debug/Trace.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ
+{
+    namespace Debug
+    {
+        namespace AllocationSamplerInternal
+        {
+            // The countdown is kept per thread so allocations that aren't sampled don't touch shared memory.
+            static AZ_THREAD_LOCAL size_t s_bytesUntilSample = 0;
+            static AZ_THREAD_LOCAL size_t s_countdownInterval = 0;
+            static AZ_THREAD_LOCAL u64 s_randomState = 0;
+
+            // Returns a countdown uniformly distributed in [interval / 2, interval * 3 / 2].
+            static size_t NextCountdown(size_t interval)
+            {
+                if (s_randomState == 0)
+                {
+                    s_randomState = static_cast<u64>(reinterpret_cast<uintptr_t>(&s_randomState)) | 1;
+                }
+                // xorshift64
+                s_randomState ^= s_randomState << 13;
+                s_randomState ^= s_randomState >> 7;
+                s_randomState ^= s_randomState << 17;
+                return interval / 2 + static_cast<size_t>(s_randomState % (interval + 1));
+            }
+
+            static bool IsSameCallSite(const AllocationSampler::Sample& lhs, const AllocationSampler::Sample& rhs, unsigned int callSiteDepth)
+            {
+                const unsigned int depth = AZStd::min(lhs.m_numFrames, callSiteDepth);
+                if (lhs.m_allocatorName != rhs.m_allocatorName || depth != AZStd::min(rhs.m_numFrames, callSiteDepth))
+                {
+                    return false;
+                }
+                for (unsigned int i = 0; i < depth; ++i)
+                {
+                    if (lhs.m_frames[i].m_programCounter != rhs.m_frames[i].m_programCounter)
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            static bool CallSiteLess(const AllocationSampler::Sample& lhs, const AllocationSampler::Sample& rhs, unsigned int callSiteDepth)
+            {
+                if (lhs.m_allocatorName != rhs.m_allocatorName)
+                {
+                    return AZStd::less<const char*>()(lhs.m_allocatorName, rhs.m_allocatorName);
+                }
+                const unsigned int lhsDepth = AZStd::min(lhs.m_numFrames, callSiteDepth);
+                const unsigned int rhsDepth = AZStd::min(rhs.m_numFrames, callSiteDepth);
+                for (unsigned int i = 0; i < lhsDepth && i < rhsDepth; ++i)
+                {
+                    if (lhs.m_frames[i].m_programCounter != rhs.m_frames[i].m_programCounter)
+                    {
+                        return lhs.m_frames[i].m_programCounter < rhs.m_frames[i].m_programCounter;
+                    }
+                }
+                return lhsDepth < rhsDepth;
+            }
+        }
+
+        // Ring buffer slot guarded by a sequence lock. The sequence is odd while a writer fills the slot, readers copy the
+        // sample and discard it if the sequence changed in the meantime.
+        struct AllocationSampler::Slot
+        {
+            AZStd::atomic<u64>  m_sequence{ 0 };
+            u32                 m_generation = 0;
+            Sample              m_sample;
+        };
+
+        AllocationSampler::AllocationSampler()
+            : m_sampleInterval(0)
+            , m_writeIndex(0)
+            , m_generation(0)
+            , m_slots(nullptr)
+        {
+        }
+
+        AllocationSampler::~AllocationSampler()
+        {
+            if (Slot* slots = m_slots.exchange(nullptr))
+            {
+                for (size_t i = 0; i < SampleCapacity; ++i)
+                {
+                    slots[i].~Slot();
+                }
+                AZ_OS_FREE(slots);
+            }
+        }
+
+        void AllocationSampler::SetSampleInterval(size_t byteInterval)
+        {
+            if (byteInterval && !m_slots.load(AZStd::memory_order_acquire))
+            {
+                Slot* slots = reinterpret_cast<Slot*>(AZ_OS_MALLOC(sizeof(Slot) * SampleCapacity, alignof(Slot)));
+                for (size_t i = 0; i < SampleCapacity; ++i)
+                {
+                    new (&slots[i]) Slot();
+                }
+
+                Slot* expected = nullptr;
+                if (!m_slots.compare_exchange_strong(expected, slots, AZStd::memory_order_acq_rel))
+                {
+                    // Another thread enabled sampling at the same time
+                    for (size_t i = 0; i < SampleCapacity; ++i)
+                    {
+                        slots[i].~Slot();
+                    }
+                    AZ_OS_FREE(slots);
+                }
+            }
+            m_sampleInterval.store(byteInterval, AZStd::memory_order_release);
+        }
+
+        void AllocationSampler::RecordAllocation(const char* allocatorName, size_t byteSize, unsigned int suppressStackRecord)
+        {
+            using namespace AllocationSamplerInternal;
+
+            const size_t interval = m_sampleInterval.load(AZStd::memory_order_relaxed);
+            if (interval == 0)
+            {
+                return;
+            }
+
+            if (s_countdownInterval != interval)
+            {
+                // The interval changed since this thread's last allocation
+                s_countdownInterval = interval;
+                s_bytesUntilSample = NextCountdown(interval);
+            }
+
+            if (byteSize < s_bytesUntilSample)
+            {
+                s_bytesUntilSample -= byteSize;
+                return;
+            }
+
+            // On average a sample is taken every interval bytes. Allocations larger than that are always sampled and stand
+            // for themselves, otherwise the bytes past the end of the countdown count towards the next one.
+            const size_t overshoot = byteSize < interval ? byteSize - s_bytesUntilSample : 0;
+            const size_t countdown = NextCountdown(interval);
+            s_bytesUntilSample = countdown > overshoot ? countdown - overshoot : 0;
+            RecordSample(allocatorName, byteSize, AZStd::max(interval, byteSize), suppressStackRecord + 1);
+        }
+
+        void AllocationSampler::RecordSample(const char* allocatorName, size_t byteSize, size_t weight, unsigned int suppressStackRecord)
+        {
+            Slot* slots = m_slots.load(AZStd::memory_order_acquire);
+            if (!slots)
+            {
+                return;
+            }
+
+            const u64 index = m_writeIndex.fetch_add(1, AZStd::memory_order_relaxed);
+            Slot& slot = slots[index % SampleCapacity];
+
+            // A writer that wrapped around the whole buffer is still filling the slot, drop the sample instead of waiting
+            u64 sequence = slot.m_sequence.load(AZStd::memory_order_relaxed);
+            if ((sequence & 1) || !slot.m_sequence.compare_exchange_strong(sequence, sequence + 1, AZStd::memory_order_acq_rel, AZStd::memory_order_relaxed))
+            {
+                return;
+            }
+
+            slot.m_generation = m_generation.load(AZStd::memory_order_relaxed);
+            Sample& sample = slot.m_sample;
+            sample.m_allocatorName = allocatorName;
+            sample.m_byteSize = byteSize;
+            sample.m_weight = weight;
+            sample.m_numFrames = StackRecorder::Record(sample.m_frames, MaxStackFrames, suppressStackRecord + 1);
+
+            slot.m_sequence.store(sequence + 2, AZStd::memory_order_release);
+        }
+
+        void AllocationSampler::Reset()
+        {
+            m_generation.fetch_add(1, AZStd::memory_order_relaxed);
+            m_writeIndex.store(0, AZStd::memory_order_relaxed);
+        }
+
+        size_t AllocationSampler::GetNumSamples() const
+        {
+            return static_cast<size_t>(m_writeIndex.load(AZStd::memory_order_relaxed));
+        }
+
+        void AllocationSampler::CollectSamples(AZStd::vector<Sample>& samples) const
+        {
+            samples.clear();
+            const Slot* slots = m_slots.load(AZStd::memory_order_acquire);
+            if (!slots)
+            {
+                return;
+            }
+
+            const u32 generation = m_generation.load(AZStd::memory_order_relaxed);
+            const size_t numSlots = static_cast<size_t>(AZStd::min<u64>(m_writeIndex.load(AZStd::memory_order_relaxed), SampleCapacity));
+            samples.reserve(numSlots);
+            for (size_t i = 0; i < numSlots; ++i)
+            {
+                const Slot& slot = slots[i];
+                const u64 sequence = slot.m_sequence.load(AZStd::memory_order_acquire);
+                if (sequence == 0 || (sequence & 1))
+                {
+                    continue;
+                }
+
+                const u32 sampleGeneration = slot.m_generation;
+                Sample sample = slot.m_sample;
+                AZStd::atomic_thread_fence(AZStd::memory_order_acquire);
+                if (slot.m_sequence.load(AZStd::memory_order_relaxed) != sequence || sampleGeneration != generation)
+                {
+                    continue;
+                }
+
+                sample.m_numFrames = AZStd::min(sample.m_numFrames, MaxStackFrames);
+                samples.push_back(sample);
+            }
+        }
+
+        void AllocationSampler::GetReport(AZStd::vector<ReportEntry>& report, unsigned int callSiteDepth) const
+        {
+            using namespace AllocationSamplerInternal;
+
+            report.clear();
+
+            AZStd::vector<Sample> samples;
+            CollectSamples(samples);
+            AZStd::sort(samples.begin(), samples.end(), [callSiteDepth](const Sample& lhs, const Sample& rhs)
+            {
+                return CallSiteLess(lhs, rhs, callSiteDepth);
+            });
+
+            for (size_t i = 0; i < samples.size(); ++i)
+            {
+                const Sample& sample = samples[i];
+                if (i == 0 || !IsSameCallSite(samples[i - 1], sample, callSiteDepth))
+                {
+                    ReportEntry& entry = report.emplace_back();
+                    entry.m_allocatorName = sample.m_allocatorName;
+                    entry.m_sampleCount = 0;
+                    entry.m_estimatedBytes = 0;
+                    entry.m_largestAllocation = 0;
+                    entry.m_numFrames = sample.m_numFrames;
+                    memcpy(entry.m_frames, sample.m_frames, sizeof(entry.m_frames));
+                }
+
+                ReportEntry& entry = report.back();
+                ++entry.m_sampleCount;
+                entry.m_estimatedBytes += sample.m_weight;
+                entry.m_largestAllocation = AZStd::max(entry.m_largestAllocation, sample.m_byteSize);
+            }
+
+            AZStd::sort(report.begin(), report.end(), [](const ReportEntry& lhs, const ReportEntry& rhs)
+            {
+                return lhs.m_estimatedBytes > rhs.m_estimatedBytes;
+            });
+        }
+
+        void AllocationSampler::PrintReport(size_t maxEntries, unsigned int callSiteDepth) const
+        {
+            static const char TAG[] = "mem";
+
+            AZStd::vector<ReportEntry> report;
+            GetReport(report, callSiteDepth);
+
+            AZ_Printf(TAG, "%zu allocations sampled, one every %zu bytes on average\n", GetNumSamples(), GetSampleInterval());
+            AZ_Printf(TAG, "Index,Allocator,Samples,Estimated kb,Largest allocation kb\n");
+            SymbolStorage::StackLine stackLines[MaxStackFrames];
+            for (size_t i = 0; i < report.size() && i < maxEntries; ++i)
+            {
+                const ReportEntry& entry = report[i];
+                AZ_Printf(TAG, "%zu,%s,%zu,%.2f,%.2f\n", i, entry.m_allocatorName, entry.m_sampleCount,
+                    entry.m_estimatedBytes / 1024.0f, entry.m_largestAllocation / 1024.0f);
+
+                SymbolStorage::DecodeFrames(entry.m_frames, entry.m_numFrames, stackLines);
+                for (unsigned int frame = 0; frame < entry.m_numFrames; ++frame)
+                {
+                    AZ_Printf(TAG, "    %s\n", stackLines[frame]);
+                }
+            }
+        }
+
+        bool AllocationSampler::ExportReport(const char* filePath, unsigned int callSiteDepth) const
+        {
+            AZStd::vector<ReportEntry> report;
+            GetReport(report, callSiteDepth);
+
+            IO::SystemFile file;
+            if (!file.Open(filePath, IO::SystemFile::SF_OPEN_CREATE | IO::SystemFile::SF_OPEN_CREATE_PATH | IO::SystemFile::SF_OPEN_WRITE_ONLY))
+            {
+                AZ_Warning("AllocationSampler", false, "Unable to open '%s' to export the allocation samples.", filePath);
+                return false;
+            }
+
+            AZStd::string line = "Allocator,Samples,EstimatedBytes,LargestAllocation,CallStack\n";
+            bool success = file.Write(line.data(), line.size()) == line.size();
+
+            SymbolStorage::StackLine stackLines[MaxStackFrames];
+            for (const ReportEntry& entry : report)
+            {
+                line = AZStd::string::format("%s,%zu,%zu,%zu,\"", entry.m_allocatorName, entry.m_sampleCount, entry.m_estimatedBytes, entry.m_largestAllocation);
+
+                SymbolStorage::DecodeFrames(entry.m_frames, entry.m_numFrames, stackLines);
+                for (unsigned int frame = 0; frame < entry.m_numFrames; ++frame)
+                {
+                    if (frame > 0)
+                    {
+                        line += " | ";
+                    }
+                    AZStd::string stackLine(stackLines[frame]);
+                    AZStd::replace(stackLine.begin(), stackLine.end(), '"', '\'');
+                    line += stackLine;
+                }
+                line += "\"\n";
+
+                success = success && file.Write(line.data(), line.size()) == line.size();
+            }
+
+            file.Close();
+            return success;
+        }
+    } // namespace Debug
+} // namespace AZ
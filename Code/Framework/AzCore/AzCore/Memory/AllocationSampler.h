@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Debug/StackTracer.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+
+namespace AZ
+{
+    namespace Debug
+    {
+        /**
+         * Sampled allocation tracing.
+         * Instead of recording every allocation like \ref AllocationRecords, the sampler captures the call stack of roughly
+         * one allocation per sample interval of allocated bytes. Every thread counts down the bytes it allocated and takes a
+         * sample when the countdown runs out, so allocations that aren't sampled only cost a thread local subtraction.
+         * The countdown is jittered to avoid aliasing with allocation patterns that repeat at a fixed stride.
+         * Samples are written to a fixed size lock-free ring buffer, once it's full the oldest samples are overwritten.
+         * Each sample is weighted with the number of bytes it stands for, so the report estimates how many bytes were
+         * allocated from every call site and allocator since the last reset.
+         * Samples are taken from AllocatorBase::ProfileAllocation, so allocators that don't profile their allocations
+         * are never sampled and sampling isn't available in release builds.
+         */
+        class AllocationSampler
+        {
+        public:
+            static constexpr unsigned int MaxStackFrames = 16;      ///< Maximum number of frames captured for a sample.
+            static constexpr size_t SampleCapacity = 4096;          ///< Number of samples kept in the ring buffer.
+            static constexpr unsigned int DefaultCallSiteDepth = 4; ///< Number of frames that identify a call site in the report.
+
+            struct Sample
+            {
+                const char*     m_allocatorName;
+                size_t          m_byteSize;         ///< Size of the sampled allocation.
+                size_t          m_weight;           ///< Number of allocated bytes the sample stands for.
+                unsigned int    m_numFrames;
+                StackFrame      m_frames[MaxStackFrames];
+            };
+
+            struct ReportEntry
+            {
+                const char*     m_allocatorName;
+                size_t          m_sampleCount;
+                size_t          m_estimatedBytes;   ///< Estimated number of bytes allocated from the call site.
+                size_t          m_largestAllocation;
+                unsigned int    m_numFrames;
+                StackFrame      m_frames[MaxStackFrames]; ///< Stack of the first sample recorded for the call site.
+            };
+
+            AllocationSampler();
+            ~AllocationSampler();
+
+            /// Sets the average number of allocated bytes between samples, 0 disables sampling.
+            /// The sample buffer is allocated from the OS the first time sampling is enabled.
+            void            SetSampleInterval(size_t byteInterval);
+            size_t          GetSampleInterval() const           { return m_sampleInterval.load(AZStd::memory_order_relaxed); }
+            bool            IsEnabled() const                   { return GetSampleInterval() != 0; }
+
+            /// Counts an allocation towards the calling thread's countdown and records a sample when it runs out.
+            /// \param suppressStackRecord number of frames above the caller that shouldn't be part of the sample.
+            void            RecordAllocation(const char* allocatorName, size_t byteSize, unsigned int suppressStackRecord = 0);
+
+            /// Discards all recorded samples.
+            void            Reset();
+            /// Returns the number of samples recorded since the last reset, including the ones that have been overwritten.
+            size_t          GetNumSamples() const;
+
+            /// Aggregates the samples in the buffer by allocator and call site, sorted by estimated bytes in descending order.
+            /// \param callSiteDepth number of leading frames that have to match for two samples to share a call site.
+            void            GetReport(AZStd::vector<ReportEntry>& report, unsigned int callSiteDepth = DefaultCallSiteDepth) const;
+            /// Prints the call sites with the most estimated bytes.
+            void            PrintReport(size_t maxEntries = 20, unsigned int callSiteDepth = DefaultCallSiteDepth) const;
+            /// Writes the full report as CSV, returns false if the file can't be written.
+            bool            ExportReport(const char* filePath, unsigned int callSiteDepth = DefaultCallSiteDepth) const;
+
+        private:
+            AllocationSampler(const AllocationSampler&) = delete;
+            AllocationSampler& operator=(const AllocationSampler&) = delete;
+
+            struct Slot;
+
+            void            RecordSample(const char* allocatorName, size_t byteSize, size_t weight, unsigned int suppressStackRecord);
+            void            CollectSamples(AZStd::vector<Sample>& samples) const;
+
+            AZStd::atomic<size_t>   m_sampleInterval;
+            AZStd::atomic<u64>      m_writeIndex;       ///< Number of samples recorded since the last reset.
+            AZStd::atomic<u32>      m_generation;       ///< Incremented on reset, samples from older generations are ignored.
+            AZStd::atomic<Slot*>    m_slots;
+        };
+    } // namespace Debug
+} // namespace AZ
@@ -8,7 +8,9 @@
 
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/Memory/AllocationSampler.h>
 #include <AzCore/Memory/MemoryDrillerBus.h>
+#include <AzCore/std/parallel/thread.h>
 
 using namespace AZ;
 
@@ -112,6 +114,20 @@ bool AllocatorBase::IsProfilingActive() const
     return m_isProfilingActive;
 }
 
+void AllocatorBase::SetAllocationSampler(Debug::AllocationSampler* sampler)
+{
+    // The store and the user count are sequentially consistent, together with ProfileAllocation this guarantees that every
+    // allocation either sees the new sampler or is counted here, so the old sampler can be destroyed once this returns.
+    Debug::AllocationSampler* previousSampler = m_allocationSampler.exchange(sampler, AZStd::memory_order_seq_cst);
+    if (previousSampler && previousSampler != sampler)
+    {
+        while (m_allocationSamplerUsers.load(AZStd::memory_order_seq_cst) != 0)
+        {
+            AZStd::this_thread::yield();
+        }
+    }
+}
+
 void AllocatorBase::DisableOverriding()
 {
     m_canBeOverridden = false;
@@ -124,6 +140,17 @@ void AllocatorBase::DisableRegistration()
 
 void AllocatorBase::ProfileAllocation(void* ptr, size_t byteSize, size_t alignment, const char* name, const char* fileName, int lineNum, int suppressStackRecord)
 {
+    // Only allocations that could be sampled pay for the user count
+    if (m_allocationSampler.load(AZStd::memory_order_acquire))
+    {
+        m_allocationSamplerUsers.fetch_add(1, AZStd::memory_order_seq_cst);
+        if (Debug::AllocationSampler* sampler = m_allocationSampler.load(AZStd::memory_order_seq_cst))
+        {
+            sampler->RecordAllocation(m_name, byteSize, suppressStackRecord + 1);
+        }
+        m_allocationSamplerUsers.fetch_sub(1, AZStd::memory_order_release);
+    }
+
 #if defined(AZ_HAS_VARIADIC_TEMPLATES) && defined(AZ_DEBUG_BUILD)
     ++suppressStackRecord; // one more for the fact the ebus is a function
 #endif // AZ_HAS_VARIADIC_TEMPLATES
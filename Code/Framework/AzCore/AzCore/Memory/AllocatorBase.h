@@ -9,6 +9,7 @@
 
 #include <AzCore/Memory/IAllocator.h>
 #include <AzCore/Memory/PlatformMemoryInstrumentation.h>
+#include <AzCore/std/parallel/atomic.h>
 
 namespace AZ
 {
@@ -44,6 +45,7 @@ namespace AZ
         bool IsLazilyCreated() const final;
         void SetProfilingActive(bool active) final;
         bool IsProfilingActive() const final;
+        void SetAllocationSampler(Debug::AllocationSampler* sampler) final;
         //---------------------------------------------------------------------
 
     protected:
@@ -104,6 +106,8 @@ namespace AZ
         const char* m_name = nullptr;
         const char* m_desc = nullptr;
         Debug::AllocationRecords* m_records = nullptr;  // Cached pointer to allocation records. Works together with the MemoryDriller.
+        AZStd::atomic<Debug::AllocationSampler*> m_allocationSampler{ nullptr }; // Set by the AllocatorManager while allocation sampling is enabled.
+        AZStd::atomic<u32> m_allocationSamplerUsers{ 0 }; // Allocations currently recording into m_allocationSampler.
         size_t m_memoryGuardSize = 0;
         bool m_isLazilyCreated = false;
         bool m_isProfilingActive = false;
@@ -15,6 +15,7 @@
 #include <AzCore/Memory/AllocatorOverrideShim.h>
 #include <AzCore/Memory/MallocSchema.h>
 #include <AzCore/Memory/MemoryDrillerBus.h>
+#include <AzCore/Console/IConsole.h>
 
 #include <AzCore/std/parallel/lock.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
@@ -211,6 +212,7 @@ AllocatorManager::RegisterAllocator(class IAllocator* alloc)
     }
 
     alloc->SetProfilingActive(m_profilingRefcount.load() > 0);
+    alloc->SetAllocationSampler(m_allocationSampler.IsEnabled() ? &m_allocationSampler : nullptr);
 
     m_allocators[m_numAllocators++] = alloc;
 
@@ -231,8 +233,9 @@ AllocatorManager::InternalDestroy()
     while (m_numAllocators > 0)
     {
         IAllocator* allocator = m_allocators[m_numAllocators - 1];
-        (void)allocator;
         AZ_Assert(allocator->IsLazilyCreated(), "Manually created allocator '%s (%s)' must be manually destroyed before shutdown", allocator->GetName(), allocator->GetDescription());
+        // The sampler is destroyed with the manager while lazy allocators keep allocating
+        allocator->SetAllocationSampler(nullptr);
         m_allocators[--m_numAllocators] = nullptr;
         // Do not actually destroy the lazy allocator as it may have work to do during non-deterministic shutdown
     }
@@ -326,6 +329,8 @@ AllocatorManager::UnRegisterAllocator(class IAllocator* alloc)
         EBUS_EVENT(Debug::MemoryDrillerBus, UnregisterAllocator, alloc);
     }
 
+    alloc->SetAllocationSampler(nullptr);
+
     for (int i = 0; i < m_numAllocators; ++i)
     {
         if (m_allocators[i] == alloc)
@@ -544,6 +549,54 @@ AllocatorManager::ExitProfilingMode()
     AZ_Assert(m_profilingRefcount.load() >= 0, "ExitProfilingMode called without matching EnterProfilingMode");
 }
 
+void
+AllocatorManager::SetAllocationSampleInterval(size_t byteInterval)
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_allocatorListMutex);
+
+    m_allocationSampler.SetSampleInterval(byteInterval);
+    for (int i = 0; i < m_numAllocators; ++i)
+    {
+        m_allocators[i]->SetAllocationSampler(byteInterval ? &m_allocationSampler : nullptr);
+    }
+}
+
+namespace AZ
+{
+    static void OnAllocationSampleIntervalChanged(const uint32_t& byteInterval)
+    {
+        if (AllocatorManager::IsReady())
+        {
+            AllocatorManager::Instance().SetAllocationSampleInterval(byteInterval);
+        }
+    }
+
+    AZ_CVAR(uint32_t, mem_allocationSampleInterval, 0, OnAllocationSampleIntervalChanged, ConsoleFunctorFlags::Null,
+        "Average number of allocated bytes between two sampled allocation call stacks, 0 disables allocation sampling.");
+
+    static void mem_dumpAllocationSamples(const ConsoleCommandContainer& arguments)
+    {
+        if (!AllocatorManager::IsReady())
+        {
+            return;
+        }
+
+        const Debug::AllocationSampler& sampler = AllocatorManager::Instance().GetAllocationSampler();
+        if (arguments.empty())
+        {
+            sampler.PrintReport();
+        }
+        else
+        {
+            const AZStd::string filePath(arguments.front());
+            sampler.ExportReport(filePath.c_str());
+        }
+    }
+
+    AZ_CONSOLEFREEFUNC(mem_dumpAllocationSamples, ConsoleFunctorFlags::Null,
+        "Prints the call sites with the most sampled allocations, pass a file path to export the full report as CSV instead.");
+}
+
 void
 AllocatorManager::DumpAllocators()
 {
@@ -558,7 +611,7 @@ AllocatorManager::DumpAllocators()
     void* sourceList[m_maxNumAllocators];
 
     AZ_Printf(TAG, "%d allocators active\n", m_numAllocators);
-    AZ_Printf(TAG, "Index,Name,Used kb,Reserved kb,Consumed kb\n");
+    AZ_Printf(TAG, "Index,Name,Used kb,Reserved kb,Consumed kb,Peak kb\n");
 
     for (int i = 0; i < m_numAllocators; i++)
     {
@@ -568,6 +621,7 @@ AllocatorManager::DumpAllocators()
         size_t usedBytes = source->NumAllocatedBytes();
         size_t reservedBytes = source->Capacity();
         size_t consumedBytes = reservedBytes;
+        size_t peakBytes = source->GetPeakAllocatedBytes();
 
         // Very hacky and inefficient check to see if this allocator obtains its memory from another allocator
         sourceList[i] = source;
@@ -583,10 +637,11 @@ AllocatorManager::DumpAllocators()
         m_dumpInfo[i].m_used = usedBytes;
         m_dumpInfo[i].m_reserved = reservedBytes;
         m_dumpInfo[i].m_consumed = consumedBytes;
-        AZ_Printf(TAG, "%d,%s,%.2f,%.2f,%.2f\n", i, name, usedBytes / 1024.0f, reservedBytes / 1024.0f, consumedBytes / 1024.0f);
+        m_dumpInfo[i].m_peak = peakBytes;
+        AZ_Printf(TAG, "%d,%s,%.2f,%.2f,%.2f,%.2f\n", i, name, usedBytes / 1024.0f, reservedBytes / 1024.0f, consumedBytes / 1024.0f, peakBytes / 1024.0f);
     }
 
-    AZ_Printf(TAG, "-,Totals,%.2f,%.2f,%.2f\n", totalUsedBytes / 1024.0f, totalReservedBytes / 1024.0f, totalConsumedBytes / 1024.0f);
+    AZ_Printf(TAG, "-,Totals,%.2f,%.2f,%.2f,-\n", totalUsedBytes / 1024.0f, totalReservedBytes / 1024.0f, totalConsumedBytes / 1024.0f);
 }
 void AllocatorManager::GetAllocatorStats(size_t& allocatedBytes, size_t& capacityBytes, AZStd::vector<AllocatorStats>* outStats)
 {
@@ -643,7 +698,7 @@ void AllocatorManager::GetAllocatorStats(size_t& allocatedBytes, size_t& capacit
 
         if (outStats)
         {
-            outStats->emplace(outStats->end(), allocator->GetName(), alias ? alias->GetName() : allocator->GetDescription(), sourceAllocatedBytes, sourceCapacityBytes, alias != nullptr);
+            outStats->emplace(outStats->end(), allocator->GetName(), alias ? alias->GetName() : allocator->GetDescription(), sourceAllocatedBytes, sourceCapacityBytes, alias != nullptr, source->GetPeakAllocatedBytes());
         }
 
         if (!alias)
@@ -9,6 +9,7 @@
 
 #include <AzCore/base.h>
 #include <AzCore/Memory/AllocationRecords.h>
+#include <AzCore/Memory/AllocationSampler.h>
 #include <AzCore/std/algorithm.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/string/string.h>
@@ -97,6 +98,13 @@ namespace AZ
         void EnterProfilingMode();
         void ExitProfilingMode();
 
+        /// Enables sampled allocation tracing for all allocators, on average one allocation is sampled every byteInterval
+        /// allocated bytes. 0 disables sampling. Can also be set with the mem_allocationSampleInterval console variable.
+        /// \ref Debug::AllocationSampler
+        void SetAllocationSampleInterval(size_t byteInterval);
+        size_t GetAllocationSampleInterval() const              { return m_allocationSampler.GetSampleInterval(); }
+        Debug::AllocationSampler& GetAllocationSampler()        { return m_allocationSampler; }
+
         /// Outputs allocator useage to the console, and also stores the values in m_dumpInfo for viewing in the crash dump
         void DumpAllocators();
 
@@ -107,15 +115,17 @@ namespace AZ
             size_t m_used;
             size_t m_reserved;
             size_t m_consumed;
+            size_t m_peak;
         };
 
         struct AllocatorStats
         {
-            AllocatorStats(const char* name, const char* aliasOrDescription, size_t allocatedBytes, size_t capacityBytes, bool isAlias)
+            AllocatorStats(const char* name, const char* aliasOrDescription, size_t allocatedBytes, size_t capacityBytes, bool isAlias, size_t peakAllocatedBytes = 0)
                 : m_name(name)
                 , m_aliasOrDescription(aliasOrDescription)
                 , m_allocatedBytes(allocatedBytes)
                 , m_capacityBytes(capacityBytes)
+                , m_peakAllocatedBytes(peakAllocatedBytes)
                 , m_isAlias(isAlias)
             {}
 
@@ -123,6 +133,7 @@ namespace AZ
             AZStd::string m_aliasOrDescription;
             size_t m_allocatedBytes;
             size_t m_capacityBytes;
+            size_t m_peakAllocatedBytes; ///< Highest number of allocated bytes, 0 if the allocator doesn't keep track of it
             bool   m_isAlias;
         };
 
@@ -179,6 +190,7 @@ namespace AZ
         InternalData*       m_data;
         bool                m_configurationFinalized;
         AZStd::atomic<int>  m_profilingRefcount;
+        Debug::AllocationSampler m_allocationSampler;
 
         AZ::Debug::AllocationRecords::Mode m_defaultTrackingRecordMode;
         AZStd::unique_ptr<AZ::MallocSchema, void(*)(AZ::MallocSchema*)> m_mallocSchema;
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Memory/FrameArenaSchema.h>
+#include <AzCore/Memory/SimpleSchemaAllocator.h>
+
+namespace AZ
+{
+    namespace Internal
+    {
+        /*!
+        * Template you can use to create your own frame arena allocators, as you can't inherit from FrameArenaAllocator.
+        * This is the case because we use thread local storage and we need a separate "static" instance for each allocator.
+        * Allocations aren't profiled or recorded, arena memory is released in bulk without individual deallocations.
+        */
+        template<class Schema>
+        class FrameArenaAllocatorHelper
+            : public SimpleSchemaAllocator<Schema, typename Schema::Descriptor, /* ProfileAllocations */ false, /* ReportOutOfMemory */ true>
+        {
+        public:
+            using Base = SimpleSchemaAllocator<Schema, typename Schema::Descriptor, false, true>;
+            using Descriptor = typename Base::Descriptor;
+
+            FrameArenaAllocatorHelper(const char* name, const char* desc) : Base(name, desc)
+            {
+            }
+
+            bool Create(const Descriptor& descriptor = Descriptor())
+            {
+                AZ_Assert(this->IsReady() == false, "Allocator was already created!");
+                if (this->IsReady())
+                {
+                    return false;
+                }
+
+                bool isReady = static_cast<Base*>(this)->Create(descriptor);
+                if (isReady)
+                {
+                    isReady = static_cast<Schema*>(this->m_schema)->Create(descriptor);
+                }
+                return isReady;
+            }
+
+            void Destroy() override
+            {
+                static_cast<Schema*>(this->m_schema)->Destroy();
+                Base::Destroy();
+            }
+
+            AllocatorDebugConfig GetDebugConfig() override
+            {
+                return AllocatorDebugConfig().ExcludeFromDebugging();
+            }
+
+            //! Starts a new frame. Call this once per frame from the thread that drives the frame, memory allocated during
+            //! the previous frame stays valid until the next call.
+            void AdvanceFrame()
+            {
+                static_cast<Schema*>(this->m_schema)->AdvanceFrame();
+            }
+
+            u64 GetFrameIndex() const
+            {
+                return static_cast<const Schema*>(this->m_schema)->GetFrameIndex();
+            }
+
+            bool IsFrameAlive(u64 frameIndex) const
+            {
+                return static_cast<const Schema*>(this->m_schema)->IsFrameAlive(frameIndex);
+            }
+
+            void ResetPeakAllocatedBytes()
+            {
+                static_cast<Schema*>(this->m_schema)->ResetPeakAllocatedBytes();
+            }
+        };
+    }
+
+    /*!
+     * Frame arena allocator.
+     * Thread safe linear allocator for transient memory that doesn't outlive the next frame, such as temporary containers
+     * used during culling or replication. Every thread bumps through its own double buffered arena which is recycled as a
+     * whole at frame boundaries, so neither allocating nor freeing takes a lock. \ref FrameArenaSchema
+     * The frames are advanced by ComponentApplication::Tick once the allocator has been created.
+     * Use \ref FrameArenaStdAllocator to back AZStd containers with the arena.
+     */
+    class FrameArenaAllocator final
+        : public Internal::FrameArenaAllocatorHelper<FrameArenaSchemaHelper<FrameArenaAllocator>>
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(FrameArenaAllocator, SystemAllocator, 0);
+        AZ_TYPE_INFO(FrameArenaAllocator, "{0C8F6A7E-6E0E-4B8C-9F33-4C6F0D9D3A51}");
+
+        using Base = Internal::FrameArenaAllocatorHelper<FrameArenaSchemaHelper<FrameArenaAllocator>>;
+
+        FrameArenaAllocator()
+            : Base("FrameArenaAllocator", "Thread safe linear allocator for memory that lives for at most two frames")
+        {
+        }
+    };
+
+    /**
+     * AZStd allocator that binds containers to the \ref FrameArenaAllocator.
+     * The allocator remembers the frame it was created in. In builds with asserts enabled it verifies that the container
+     * doesn't allocate or free memory after the arena recycled that frame, which catches containers that outlived their frame.
+     */
+    class FrameArenaStdAllocator
+    {
+    public:
+        typedef void*               pointer_type;
+        typedef AZStd::size_t       size_type;
+        typedef AZStd::ptrdiff_t    difference_type;
+        typedef AZStd::false_type   allow_memory_leaks;
+
+        FrameArenaStdAllocator(const char* name = "AZ::FrameArenaStdAllocator")
+            : m_name(name)
+            , m_frameIndex(GetArena().GetFrameIndex())
+        {
+        }
+        FrameArenaStdAllocator(const FrameArenaStdAllocator& rhs) = default;
+        FrameArenaStdAllocator(const FrameArenaStdAllocator& rhs, const char* name)
+            : m_name(name)
+            , m_frameIndex(rhs.m_frameIndex)
+        {
+        }
+        FrameArenaStdAllocator& operator=(const FrameArenaStdAllocator& rhs) = default;
+
+        pointer_type allocate(size_type byteSize, size_type alignment, int flags = 0)
+        {
+            AZ_Assert(GetArena().IsFrameAlive(m_frameIndex),
+                "%s is used after the frame arena recycled the frame it was created in.", m_name);
+            return AllocatorInstance<FrameArenaAllocator>::Get().Allocate(byteSize, alignment, flags, m_name, __FILE__, __LINE__, 1);
+        }
+        size_type resize(pointer_type ptr, size_type newSize)
+        {
+            return AllocatorInstance<FrameArenaAllocator>::Get().Resize(ptr, newSize);
+        }
+        void deallocate(pointer_type ptr, size_type byteSize, size_type alignment)
+        {
+            AZ_Assert(GetArena().IsFrameAlive(m_frameIndex),
+                "%s released memory after the frame arena recycled the frame it was created in.", m_name);
+            AllocatorInstance<FrameArenaAllocator>::Get().DeAllocate(ptr, byteSize, alignment);
+        }
+        const char* get_name() const            { return m_name; }
+        void        set_name(const char* name)  { m_name = name; }
+        size_type   get_max_size() const        { return AllocatorInstance<FrameArenaAllocator>::Get().GetMaxAllocationSize(); }
+        size_type   get_allocated_size() const  { return AllocatorInstance<FrameArenaAllocator>::Get().NumAllocatedBytes(); }
+
+        //! Returns the frame the allocator was created in.
+        u64 GetFrameIndex() const { return m_frameIndex; }
+
+    private:
+        static FrameArenaAllocator& GetArena()
+        {
+            return static_cast<FrameArenaAllocator&>(AllocatorInstance<FrameArenaAllocator>::GetAllocator());
+        }
+
+        const char* m_name;
+        u64 m_frameIndex;
+    };
+
+    inline bool operator==(const FrameArenaStdAllocator&, const FrameArenaStdAllocator&) { return true; } // always true since they use the same instance of AllocatorInstance<FrameArenaAllocator>
+    inline bool operator!=(const FrameArenaStdAllocator&, const FrameArenaStdAllocator&) { return false; }
+}
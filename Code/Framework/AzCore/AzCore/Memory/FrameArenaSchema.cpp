@@ -0,0 +1,443 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Memory/FrameArenaSchema.h>
+
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ
+{
+    namespace FrameArenaInternal
+    {
+        static constexpr size_t PageAlignment = 16;
+        // Same value the allocation records use to mark unallocated memory.
+        [[maybe_unused]] static constexpr int RecycledMemoryMarkValue = 0xcd;
+
+        //! Header at the start of every page, the allocations follow it.
+        struct Page
+        {
+            Page* m_next;
+            size_t m_size; //!< Size of the page including the header.
+
+            char* GetStart() { return reinterpret_cast<char*>(this) + AZ::SizeAlignUp(sizeof(Page), PageAlignment); }
+            char* GetEnd() { return reinterpret_cast<char*>(this) + m_size; }
+        };
+
+        //! One half of the double buffered arena.
+        struct Buffer
+        {
+            Page* m_pages = nullptr; //!< Pages in use, the first one is being allocated from.
+            char* m_cursor = nullptr;
+            char* m_end = nullptr;
+            char* m_lastAllocation = nullptr; //!< Start of the most recent allocation, which can be resized in place.
+            AZStd::atomic<u64> m_frameIndex{ 0 }; //!< Frame the buffer is allocating for.
+            AZStd::atomic<size_t> m_allocatedBytes{ 0 }; //!< Only written by the owning thread, read by the statistics functions.
+            AZStd::atomic<size_t> m_capacity{ 0 };
+        };
+    }
+
+    //! Arena of a single thread, only the owning thread allocates from it.
+    struct FrameArenaThreadData
+    {
+        AZ_CLASS_ALLOCATOR(FrameArenaThreadData, SystemAllocator, 0)
+
+        FrameArenaInternal::Buffer m_buffers[2];
+        FrameArenaInternal::Page* m_freePages = nullptr; //!< Recycled pages of the default size.
+        AZStd::atomic<size_t> m_freeCapacity{ 0 };
+        u64 m_frameIndex = 0;
+    };
+
+    class FrameArenaSchemaImpl
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(FrameArenaSchemaImpl, SystemAllocator, 0)
+
+        using Page = FrameArenaInternal::Page;
+        using Buffer = FrameArenaInternal::Buffer;
+
+        FrameArenaSchemaImpl(const FrameArenaSchema::Descriptor& desc, FrameArenaSchema::GetThreadData threadDataGetter,
+            FrameArenaSchema::SetThreadData threadDataSetter)
+            : m_threadDataGetter(threadDataGetter)
+            , m_threadDataSetter(threadDataSetter)
+            , m_pageAllocator(desc.m_pageAllocator ? desc.m_pageAllocator : &AllocatorInstance<SystemAllocator>::Get())
+            , m_pageSize(AZ::GetMax(desc.m_pageSize, size_t(4096)))
+        {
+        }
+
+        ~FrameArenaSchemaImpl()
+        {
+            // IMPORTANT: We assume/rely that all threads (except the calling one) are done allocating from the arena.
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            for (FrameArenaThreadData* threadData : m_threads)
+            {
+                for (Buffer& buffer : threadData->m_buffers)
+                {
+                    FreePages(buffer.m_pages);
+                }
+                FreePages(threadData->m_freePages);
+                delete threadData;
+            }
+            m_threads.clear();
+            m_threadDataSetter(nullptr);
+        }
+
+        FrameArenaThreadData* GetThreadData()
+        {
+            FrameArenaThreadData* threadData = m_threadDataGetter();
+            if (threadData == nullptr)
+            {
+                threadData = aznew FrameArenaThreadData;
+                threadData->m_frameIndex = m_frameIndex.load(AZStd::memory_order_acquire);
+                for (Buffer& buffer : threadData->m_buffers)
+                {
+                    buffer.m_frameIndex = threadData->m_frameIndex;
+                }
+                m_threadDataSetter(threadData);
+
+                AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+                m_threads.push_back(threadData);
+            }
+            return threadData;
+        }
+
+        //! Returns the buffer the calling thread allocates from in the current frame, recycling the buffer's old content if needed.
+        Buffer& GetCurrentBuffer(FrameArenaThreadData& threadData)
+        {
+            const u64 frameIndex = m_frameIndex.load(AZStd::memory_order_acquire);
+            Buffer& buffer = threadData.m_buffers[frameIndex & 1];
+            if (threadData.m_frameIndex != frameIndex)
+            {
+                threadData.m_frameIndex = frameIndex;
+                if (buffer.m_frameIndex.load(AZStd::memory_order_relaxed) != frameIndex)
+                {
+                    // The buffer with the same parity holds the allocations of two (or more) frames ago which are now dead.
+                    RecycleBuffer(threadData, buffer);
+                    buffer.m_frameIndex.store(frameIndex, AZStd::memory_order_relaxed);
+                }
+            }
+            return buffer;
+        }
+
+        void* Allocate(size_t byteSize, size_t alignment)
+        {
+            AZ_Assert(alignment > 0 && (alignment & (alignment - 1)) == 0, "Alignment must be >0 and power of 2!");
+            byteSize = AZ::GetMax(byteSize, size_t(1));
+
+            FrameArenaThreadData& threadData = *GetThreadData();
+            Buffer& buffer = GetCurrentBuffer(threadData);
+
+            char* address = AlignUp(buffer.m_cursor, alignment);
+            if (buffer.m_cursor == nullptr || address + byteSize > buffer.m_end)
+            {
+                if (!AddPage(threadData, buffer, byteSize + alignment))
+                {
+                    return nullptr;
+                }
+                address = AlignUp(buffer.m_cursor, alignment);
+            }
+
+            buffer.m_cursor = address + byteSize;
+            buffer.m_lastAllocation = address;
+            buffer.m_allocatedBytes.store(buffer.m_allocatedBytes.load(AZStd::memory_order_relaxed) + byteSize, AZStd::memory_order_relaxed);
+            return address;
+        }
+
+        size_t Resize(void* ptr, size_t newSize)
+        {
+            FrameArenaThreadData* threadData = m_threadDataGetter();
+            if (threadData == nullptr)
+            {
+                return 0;
+            }
+
+            Buffer& buffer = threadData->m_buffers[threadData->m_frameIndex & 1];
+            char* address = reinterpret_cast<char*>(ptr);
+            if (address == nullptr || address != buffer.m_lastAllocation || address + newSize > buffer.m_end)
+            {
+                return 0;
+            }
+
+            const size_t oldSize = buffer.m_cursor - address;
+            buffer.m_cursor = address + newSize;
+            buffer.m_allocatedBytes.store(buffer.m_allocatedBytes.load(AZStd::memory_order_relaxed) + newSize - oldSize, AZStd::memory_order_relaxed);
+            return newSize;
+        }
+
+        void GarbageCollect()
+        {
+            if (FrameArenaThreadData* threadData = m_threadDataGetter())
+            {
+                FreePages(threadData->m_freePages);
+                threadData->m_freePages = nullptr;
+                threadData->m_freeCapacity.store(0, AZStd::memory_order_relaxed);
+            }
+        }
+
+        size_t NumAllocatedBytes() const
+        {
+            const u64 frameIndex = m_frameIndex.load(AZStd::memory_order_acquire);
+            size_t allocatedBytes = 0;
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            for (const FrameArenaThreadData* threadData : m_threads)
+            {
+                for (const Buffer& buffer : threadData->m_buffers)
+                {
+                    // Buffers that haven't been recycled yet by their thread still count their allocations, skip the dead ones.
+                    if (buffer.m_frameIndex.load(AZStd::memory_order_relaxed) + 1 >= frameIndex)
+                    {
+                        allocatedBytes += buffer.m_allocatedBytes.load(AZStd::memory_order_relaxed);
+                    }
+                }
+            }
+            return allocatedBytes;
+        }
+
+        size_t Capacity() const
+        {
+            size_t capacity = 0;
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            for (const FrameArenaThreadData* threadData : m_threads)
+            {
+                for (const Buffer& buffer : threadData->m_buffers)
+                {
+                    capacity += buffer.m_capacity.load(AZStd::memory_order_relaxed);
+                }
+                capacity += threadData->m_freeCapacity.load(AZStd::memory_order_relaxed);
+            }
+            return capacity;
+        }
+
+        void AdvanceFrame()
+        {
+            // Sample the live memory before dropping a frame, this is the highest point of the frame.
+            const size_t allocatedBytes = NumAllocatedBytes();
+            size_t peakBytes = m_peakAllocatedBytes.load(AZStd::memory_order_relaxed);
+            while (allocatedBytes > peakBytes && !m_peakAllocatedBytes.compare_exchange_weak(peakBytes, allocatedBytes))
+            {
+            }
+
+            m_frameIndex.fetch_add(1, AZStd::memory_order_acq_rel);
+
+            // Recycle the calling thread's old buffer right away, other threads do this the next time they allocate.
+            if (FrameArenaThreadData* threadData = m_threadDataGetter())
+            {
+                GetCurrentBuffer(*threadData);
+            }
+        }
+
+        static char* AlignUp(char* address, size_t alignment)
+        {
+            return reinterpret_cast<char*>(AZ::SizeAlignUp(reinterpret_cast<size_t>(address), alignment));
+        }
+
+        bool AddPage(FrameArenaThreadData& threadData, Buffer& buffer, size_t requiredBytes)
+        {
+            const size_t headerSize = AZ::SizeAlignUp(sizeof(Page), FrameArenaInternal::PageAlignment);
+            Page* page = nullptr;
+            if (requiredBytes + headerSize <= m_pageSize && threadData.m_freePages)
+            {
+                page = threadData.m_freePages;
+                threadData.m_freePages = page->m_next;
+                threadData.m_freeCapacity.store(threadData.m_freeCapacity.load(AZStd::memory_order_relaxed) - page->m_size, AZStd::memory_order_relaxed);
+            }
+            else
+            {
+                const size_t pageSize = AZ::GetMax(m_pageSize, AZ::SizeAlignUp(requiredBytes + headerSize, FrameArenaInternal::PageAlignment));
+                void* memory = m_pageAllocator->Allocate(pageSize, FrameArenaInternal::PageAlignment, 0, "AZ::FrameArenaSchema page", __FILE__, __LINE__);
+                if (memory == nullptr)
+                {
+                    return false;
+                }
+                page = new (memory) Page{ nullptr, pageSize };
+            }
+
+            page->m_next = buffer.m_pages;
+            buffer.m_pages = page;
+            buffer.m_cursor = page->GetStart();
+            buffer.m_end = page->GetEnd();
+            buffer.m_lastAllocation = nullptr;
+            buffer.m_capacity.store(buffer.m_capacity.load(AZStd::memory_order_relaxed) + page->m_size, AZStd::memory_order_relaxed);
+            return true;
+        }
+
+        void RecycleBuffer(FrameArenaThreadData& threadData, Buffer& buffer)
+        {
+            Page* page = buffer.m_pages;
+            while (page)
+            {
+                Page* next = page->m_next;
+#if defined(AZ_DEBUG_BUILD)
+                // Make reads through pointers that outlived their frame obvious.
+                memset(page->GetStart(), FrameArenaInternal::RecycledMemoryMarkValue, page->GetEnd() - page->GetStart());
+#endif
+                if (page->m_size == m_pageSize)
+                {
+                    page->m_next = threadData.m_freePages;
+                    threadData.m_freePages = page;
+                    threadData.m_freeCapacity.store(threadData.m_freeCapacity.load(AZStd::memory_order_relaxed) + page->m_size, AZStd::memory_order_relaxed);
+                }
+                else
+                {
+                    // Dedicated pages of large allocations aren't reused.
+                    m_pageAllocator->DeAllocate(page, page->m_size, FrameArenaInternal::PageAlignment);
+                }
+                page = next;
+            }
+
+            buffer.m_pages = nullptr;
+            buffer.m_cursor = nullptr;
+            buffer.m_end = nullptr;
+            buffer.m_lastAllocation = nullptr;
+            buffer.m_allocatedBytes.store(0, AZStd::memory_order_relaxed);
+            buffer.m_capacity.store(0, AZStd::memory_order_relaxed);
+        }
+
+        void FreePages(Page* page)
+        {
+            while (page)
+            {
+                Page* next = page->m_next;
+                m_pageAllocator->DeAllocate(page, page->m_size, FrameArenaInternal::PageAlignment);
+                page = next;
+            }
+        }
+
+        FrameArenaSchema::GetThreadData m_threadDataGetter;
+        FrameArenaSchema::SetThreadData m_threadDataSetter;
+        IAllocatorAllocate* m_pageAllocator;
+        size_t m_pageSize;
+        AZStd::atomic<u64> m_frameIndex{ 0 };
+        AZStd::atomic<size_t> m_peakAllocatedBytes{ 0 };
+        AZStd::vector<FrameArenaThreadData*> m_threads; ///< All thread arenas, used for statistics and to free the pages.
+        mutable AZStd::mutex m_mutex;
+    };
+
+    FrameArenaSchema::FrameArenaSchema(GetThreadData getThreadData, SetThreadData setThreadData)
+        : m_threadDataGetter(getThreadData)
+        , m_threadDataSetter(setThreadData)
+    {
+    }
+
+    FrameArenaSchema::~FrameArenaSchema()
+    {
+        AZ_Assert(m_impl == nullptr, "You did not destroy the frame arena schema!");
+        delete m_impl;
+    }
+
+    bool FrameArenaSchema::Create(const Descriptor& desc)
+    {
+        AZ_Assert(m_impl == nullptr, "FrameArenaSchema already created!");
+        if (m_impl == nullptr)
+        {
+            m_impl = aznew FrameArenaSchemaImpl(desc, m_threadDataGetter, m_threadDataSetter);
+        }
+        return m_impl != nullptr;
+    }
+
+    bool FrameArenaSchema::Destroy()
+    {
+        delete m_impl;
+        m_impl = nullptr;
+        return true;
+    }
+
+    void FrameArenaSchema::AdvanceFrame()
+    {
+        m_impl->AdvanceFrame();
+    }
+
+    u64 FrameArenaSchema::GetFrameIndex() const
+    {
+        return m_impl->m_frameIndex.load(AZStd::memory_order_acquire);
+    }
+
+    bool FrameArenaSchema::IsFrameAlive(u64 frameIndex) const
+    {
+        return frameIndex + 1 >= GetFrameIndex();
+    }
+
+    FrameArenaSchema::size_type FrameArenaSchema::GetPeakAllocatedBytes() const
+    {
+        return AZ::GetMax(m_impl->m_peakAllocatedBytes.load(AZStd::memory_order_relaxed), m_impl->NumAllocatedBytes());
+    }
+
+    void FrameArenaSchema::ResetPeakAllocatedBytes()
+    {
+        m_impl->m_peakAllocatedBytes.store(0, AZStd::memory_order_relaxed);
+    }
+
+    FrameArenaSchema::pointer_type FrameArenaSchema::Allocate(size_type byteSize, size_type alignment, int flags, const char* name,
+        const char* fileName, int lineNum, unsigned int suppressStackRecord)
+    {
+        (void)flags;
+        (void)name;
+        (void)fileName;
+        (void)lineNum;
+        (void)suppressStackRecord;
+        return m_impl->Allocate(byteSize, alignment);
+    }
+
+    void FrameArenaSchema::DeAllocate(pointer_type ptr, size_type byteSize, size_type alignment)
+    {
+        // Memory is released when the frame is recycled.
+        (void)ptr;
+        (void)byteSize;
+        (void)alignment;
+    }
+
+    FrameArenaSchema::size_type FrameArenaSchema::Resize(pointer_type ptr, size_type newSize)
+    {
+        return m_impl->Resize(ptr, newSize);
+    }
+
+    FrameArenaSchema::pointer_type FrameArenaSchema::ReAllocate(pointer_type ptr, size_type newSize, size_type newAlignment)
+    {
+        (void)ptr;
+        (void)newSize;
+        (void)newAlignment;
+        AZ_Assert(false, "unsupported");
+        return nullptr;
+    }
+
+    FrameArenaSchema::size_type FrameArenaSchema::AllocationSize(pointer_type ptr)
+    {
+        // Allocation sizes aren't stored.
+        (void)ptr;
+        return 0;
+    }
+
+    void FrameArenaSchema::GarbageCollect()
+    {
+        m_impl->GarbageCollect();
+    }
+
+    FrameArenaSchema::size_type FrameArenaSchema::NumAllocatedBytes() const
+    {
+        return m_impl->NumAllocatedBytes();
+    }
+
+    FrameArenaSchema::size_type FrameArenaSchema::Capacity() const
+    {
+        return m_impl->Capacity();
+    }
+
+    FrameArenaSchema::size_type FrameArenaSchema::GetMaxAllocationSize() const
+    {
+        // Large allocations get a dedicated page, the limit is the page allocator's.
+        return m_impl->m_pageAllocator->GetMaxAllocationSize();
+    }
+
+    IAllocatorAllocate* FrameArenaSchema::GetSubAllocator()
+    {
+        return m_impl->m_pageAllocator;
+    }
+}
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Memory/SystemAllocator.h>
+
+namespace AZ
+{
+    struct FrameArenaThreadData;
+
+    /**
+     * Frame arena schema.
+     * Linear (bump pointer) allocation of transient memory that only needs to live for the current frame. Every thread
+     * allocates from its own arena so allocating never takes a lock, and individual deallocations are free (they do nothing).
+     * The arenas are double buffered: memory allocated during frame N stays valid until AdvanceFrame is called for the second
+     * time, i.e. it can be handed over to the next frame, after which it's recycled as a whole.
+     * In debug builds recycled memory is overwritten with 0xcd so reads of stale memory are easy to spot.
+     * IMPORTANT: Like the thread pool schema, the schema keeps data per thread. All threads that allocated from the arena need to
+     * be finished (or not allocate anymore) before the schema is destroyed.
+     */
+    class FrameArenaSchema
+        : public IAllocatorAllocate
+    {
+    public:
+        // Functions for getting an instance of a FrameArenaThreadData when using thread local storage
+        typedef FrameArenaThreadData* (*GetThreadData)();
+        typedef void (*SetThreadData)(FrameArenaThreadData*);
+
+        /**
+         * Frame arena descriptor.
+         */
+        struct Descriptor
+        {
+            size_t m_pageSize = 256 * 1024; ///< Size in bytes of the pages the arenas allocate from. Larger allocations get a dedicated page.
+            IAllocatorAllocate* m_pageAllocator = nullptr; ///< If you provide this interface we will use it for page allocations, otherwise SystemAllocator will be used.
+        };
+
+        FrameArenaSchema(GetThreadData getThreadData, SetThreadData setThreadData);
+        ~FrameArenaSchema();
+
+        bool Create(const Descriptor& desc);
+        bool Destroy();
+
+        /// Starts a new frame. Memory allocated two frames ago is recycled the next time the owning thread allocates.
+        void AdvanceFrame();
+        /// Returns the index of the current frame.
+        u64 GetFrameIndex() const;
+        /// Returns true if memory allocated during the provided frame is still valid.
+        bool IsFrameAlive(u64 frameIndex) const;
+        /// Returns the highest number of live bytes seen at a frame boundary since creation or the last ResetPeakAllocatedBytes.
+        size_type GetPeakAllocatedBytes() const override;
+        void ResetPeakAllocatedBytes();
+
+        pointer_type Allocate(size_type byteSize, size_type alignment, int flags, const char* name, const char* fileName, int lineNum, unsigned int suppressStackRecord) override;
+        /// Individual allocations are released together at the end of their frame, so this only validates the frame in debug builds.
+        void DeAllocate(pointer_type ptr, size_type byteSize, size_type alignment) override;
+        /// Only the most recent allocation of the calling thread can be resized.
+        size_type Resize(pointer_type ptr, size_type newSize) override;
+        pointer_type ReAllocate(pointer_type ptr, size_type newSize, size_type newAlignment) override;
+        size_type AllocationSize(pointer_type ptr) override;
+        /// Returns the recycled pages of the calling thread's arena to the page allocator.
+        void GarbageCollect() override;
+
+        size_type NumAllocatedBytes() const override;
+        size_type Capacity() const override;
+        size_type GetMaxAllocationSize() const override;
+        IAllocatorAllocate* GetSubAllocator() override;
+
+    protected:
+        FrameArenaSchema(const FrameArenaSchema&) = delete;
+        FrameArenaSchema& operator=(const FrameArenaSchema&) = delete;
+
+        class FrameArenaSchemaImpl* m_impl = nullptr;
+        GetThreadData m_threadDataGetter;
+        SetThreadData m_threadDataSetter;
+    };
+
+    /**
+     * Helper class to allow multiple instances of frame arenas that operate independently from each other.
+     * Your frame arena allocator should inherit from this class, as we need a unique thread local variable per allocator type.
+     */
+    template<class Allocator>
+    class FrameArenaSchemaHelper
+        : public FrameArenaSchema
+    {
+    public:
+        FrameArenaSchemaHelper(const Descriptor& desc = Descriptor())
+            : FrameArenaSchema(&GetThreadData, &SetThreadData)
+        {
+            // Descriptor is ignored here; Create() must be called directly on the schema
+            (void)desc;
+        }
+
+    protected:
+        static FrameArenaThreadData* GetThreadData()
+        {
+            return m_threadData;
+        }
+
+        static void SetThreadData(FrameArenaThreadData* data)
+        {
+            m_threadData = data;
+        }
+
+        static AZ_THREAD_LOCAL FrameArenaThreadData* m_threadData;
+    };
+
+    template<class Allocator>
+    AZ_THREAD_LOCAL FrameArenaThreadData* FrameArenaSchemaHelper<Allocator>::m_threadData = nullptr;
+}
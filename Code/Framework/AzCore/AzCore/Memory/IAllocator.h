@@ -14,6 +14,7 @@ namespace AZ
     namespace Debug
     {
         class AllocationRecords;
+        class AllocationSampler;
         class MemoryDriller;
     }
 
@@ -62,6 +63,8 @@ namespace AZ
         virtual size_type               Capacity() const = 0;
         /// Returns max allocation size if possible. If not returned value is 0
         virtual size_type               GetMaxAllocationSize() const { return 0; }
+        /// Returns the highest number of bytes the allocator had allocated at once, if it keeps track of it. If not returned value is 0
+        virtual size_type               GetPeakAllocatedBytes() const { return 0; }
         /**
          * Returns memory allocated by the allocator and available to the user for allocations.
          * IMPORTANT: this is not the overhead memory this is just the memory that is allocated, but not used. Example: the pool allocators
@@ -184,6 +187,9 @@ namespace AZ
         /// Returns true if profiling calls will be made.
         virtual bool IsProfilingActive() const = 0;
 
+        /// Sets the sampler profiled allocations are reported to, nullptr disables sampling.
+        virtual void SetAllocationSampler(Debug::AllocationSampler* sampler) = 0;
+
         /// All conforming allocators must call PostCreate() after their custom Create() method in order to be properly registered.
         virtual void PostCreate() = 0;
 
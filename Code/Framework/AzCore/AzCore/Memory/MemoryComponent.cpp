@@ -9,6 +9,7 @@
 #include <AzCore/Memory/MemoryComponent.h>
 #include <AzCore/Math/Crc.h>
 
+#include <AzCore/Memory/FrameArenaAllocator.h>
 #include <AzCore/Memory/PoolAllocator.h>
 
 #include <AzCore/Serialization/SerializeContext.h>
@@ -24,9 +25,11 @@ namespace AZ
     {
         m_isPoolAllocator = true;
         m_isThreadPoolAllocator = true;
+        m_isFrameArenaAllocator = true;
 
         m_createdPoolAllocator = false;
         m_createdThreadPoolAllocator = false;
+        m_createdFrameArenaAllocator = false;
     }
 
     //=========================================================================
@@ -39,6 +42,10 @@ namespace AZ
         // and create in activate. But memory component is special that
         // it must be operational after Init so all parts of the engine can be operational.
         // This is why we must check the destructor (which is symmetrical to Init() anyway)
+        if (m_createdFrameArenaAllocator && AZ::AllocatorInstance<AZ::FrameArenaAllocator>::IsReady())
+        {
+            AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Destroy();
+        }
         if (m_createdThreadPoolAllocator && AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::IsReady())
         {
             AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
@@ -68,6 +75,11 @@ namespace AZ
             AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
             m_createdThreadPoolAllocator = true;
         }
+        if (m_isFrameArenaAllocator && !AZ::AllocatorInstance<AZ::FrameArenaAllocator>::IsReady())
+        {
+            AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Create();
+            m_createdFrameArenaAllocator = true;
+        }
     }
 
     //=========================================================================
@@ -110,9 +122,10 @@ namespace AZ
         if (SerializeContext* serializeContext = azrtti_cast<SerializeContext*>(context))
         {
             serializeContext->Class<MemoryComponent, AZ::Component>()
-                ->Version(1)
+                ->Version(2)
                 ->Field("isPoolAllocator", &MemoryComponent::m_isPoolAllocator)
                 ->Field("isThreadPoolAllocator", &MemoryComponent::m_isThreadPoolAllocator)
+                ->Field("isFrameArenaAllocator", &MemoryComponent::m_isFrameArenaAllocator)
                 ;
 
             ;
@@ -124,6 +137,7 @@ namespace AZ
                         ->Attribute(AZ::Edit::Attributes::AppearsInAddComponentMenu, AZ_CRC("System", 0xc94d118b))
                     ->DataElement(AZ::Edit::UIHandlers::CheckBox, &MemoryComponent::m_isPoolAllocator, "Pool allocator", "Fast allocation pooling for small allocations < 256 bytes, use from main thread only!")
                     ->DataElement(AZ::Edit::UIHandlers::CheckBox, &MemoryComponent::m_isThreadPoolAllocator, "Thread pool allocator", "Fast allocation pool that can be used from any thread, if uses more memory! (as it keeps the pools per thread)")
+                    ->DataElement(AZ::Edit::UIHandlers::CheckBox, &MemoryComponent::m_isFrameArenaAllocator, "Frame arena allocator", "Per thread linear allocator for transient memory that is recycled every frame")
                     ;
             }
         }
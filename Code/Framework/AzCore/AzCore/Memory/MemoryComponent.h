@@ -47,10 +47,12 @@ namespace AZ
         // serialized data
         bool m_isPoolAllocator;
         bool m_isThreadPoolAllocator;
+        bool m_isFrameArenaAllocator;
 
         // non-serialized data
         bool m_createdPoolAllocator;
         bool m_createdThreadPoolAllocator;
+        bool m_createdFrameArenaAllocator;
     };
 }
 
@@ -181,6 +181,11 @@ namespace AZ
             return m_schema->GetMaxAllocationSize();
         }
 
+        size_type GetPeakAllocatedBytes() const override
+        {
+            return m_schema->GetPeakAllocatedBytes();
+        }
+
         size_type GetUnAllocatedMemory(bool isPrint = false) const override
         { 
             return m_schema->GetUnAllocatedMemory(isPrint);
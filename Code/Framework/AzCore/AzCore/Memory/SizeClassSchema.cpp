@@ -0,0 +1,1003 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Memory/SizeClassSchema.h>
+#include <AzCore/Memory/OSAllocator.h> // required for AZ_OS_MALLOC
+#include <AzCore/Math/MathUtils.h>
+
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ
+{
+    namespace SizeClassSchemaInternal
+    {
+        // Spaced 16 bytes apart up to 128 bytes and 4 classes per power of two up to 8 KB. The classes above that are the
+        // largest sizes that fit 8, 7, ... 2 times in a span, so big blocks don't leave a large unused tail in their span.
+        static constexpr u32 s_sizeClasses[] =
+        {
+            16, 32, 48, 64, 80, 96, 112, 128,
+            160, 192, 224, 256,
+            320, 384, 448, 512,
+            640, 768, 896, 1024,
+            1280, 1536, 1792, 2048,
+            2560, 3072, 3584, 4096,
+            5120, 6144, 7168,
+            8176, 9344, 10912, 13088, 16368, 21824, 32736
+        };
+        static constexpr size_t NumSizeClasses = AZ_ARRAY_SIZE(s_sizeClasses);
+        static_assert(s_sizeClasses[NumSizeClasses - 1] == SizeClassSchema::MaxSmallAllocationSize, "The last size class must match MaxSmallAllocationSize");
+        static_assert(2 * SizeClassSchema::MaxSmallAllocationSize + SizeClassSchema::SpanHeaderSize <= SizeClassSchema::SpanSize, "Two blocks of the largest class must fit in a span");
+
+        static constexpr size_t MinAlignment = 16;
+        static constexpr size_t SegmentSpanCount = 16;             ///< Number of spans we request from the sub allocator at once.
+        static constexpr size_t CacheBatchBytes = 8 * 1024;         ///< Number of bytes moved between a thread cache and the central list at once.
+        static constexpr size_t MaxCacheBatchCount = 32;
+        static constexpr u32 SpanMagic = 0x5a5c1a55;
+        static constexpr u32 LargeAllocationMagic = 0x1a5cb10c;
+
+        // Spans are tracked in a two level bitmap with one bit per span, which covers a 48 bit address space.
+        static constexpr size_t SpanShift = 16;
+        static constexpr size_t SpanMapLeafShift = 32;
+        static constexpr size_t SpanMapRootCount = size_t(1) << (48 - SpanMapLeafShift);
+        static constexpr size_t SpanMapLeafWordCount = (size_t(1) << (SpanMapLeafShift - SpanShift)) / 64;
+        static_assert((size_t(1) << SpanShift) == SizeClassSchema::SpanSize, "SpanShift doesn't match the span size");
+
+        struct FreeBlock
+        {
+            FreeBlock* m_next;
+        };
+
+        struct Segment
+        {
+            void* m_memory;
+            size_t m_memorySize;
+            char* m_firstSpan;
+            u32 m_spanCount;
+            u32 m_freeSpanCount;
+            Segment* m_next;
+        };
+
+        /// Located at the start of every span.
+        struct Span
+        {
+            u32 m_magic;
+            u32 m_sizeClass;
+            Segment* m_segment;
+            Span* m_prev;
+            Span* m_next;
+            size_t m_usedCount;     ///< Number of blocks that are allocated or in a thread cache.
+        };
+        static_assert(sizeof(Span) <= SizeClassSchema::SpanHeaderSize, "Span header doesn't fit in the reserved space");
+
+        /// Located right before every large allocation.
+        struct LargeAllocationHeader
+        {
+            void* m_block;
+            size_t m_byteSize;
+            u32 m_magic;
+        };
+        static constexpr size_t LargeAllocationHeaderSize = AZ_SIZE_ALIGN_UP(sizeof(LargeAllocationHeader), MinAlignment);
+
+        struct CentralList
+        {
+            AZStd::mutex m_mutex;
+            FreeBlock* m_freeBlocks = nullptr;
+            Span* m_spans = nullptr;            ///< All spans assigned to the size class.
+            Span* m_carveSpan = nullptr;        ///< Span we are currently carving new blocks from.
+            char* m_carveCursor = nullptr;
+            char* m_carveEnd = nullptr;
+        };
+
+        struct ThreadCache
+        {
+            struct Bin
+            {
+                FreeBlock* m_head;
+                u32 m_count;
+            };
+
+            AZStd::atomic<u32> m_schemaId;      ///< Id of the owning schema, 0 once the schema is destroyed.
+            ThreadCache* m_nextInThread;        ///< Next cache of the same thread (for other schemas).
+            ThreadCache* m_prevInSchema;
+            ThreadCache* m_nextInSchema;
+            AZStd::atomic<size_t> m_allocatedBytes; ///< Only written by the owning thread. Can "underflow" when blocks are freed on a different thread.
+            Bin m_bins[NumSizeClasses];
+        };
+
+        static AZ_THREAD_LOCAL ThreadCache* s_threadCaches = nullptr;
+        static AZStd::atomic<u32> s_nextSchemaId{ 1 };
+
+        static void* SystemAlloc(IAllocatorAllocate* subAllocator, size_t byteSize, size_t alignment)
+        {
+            if (subAllocator)
+            {
+                return subAllocator->Allocate(byteSize, alignment, 0, "SizeClassSchema sub allocation", __FILE__, __LINE__);
+            }
+            return AZ_OS_MALLOC(byteSize, alignment);
+        }
+
+        static void SystemFree(IAllocatorAllocate* subAllocator, void* ptr, size_t byteSize, size_t alignment)
+        {
+            if (subAllocator)
+            {
+                subAllocator->DeAllocate(ptr, byteSize, alignment);
+                return;
+            }
+            AZ_OS_FREE(ptr);
+        }
+    } // namespace SizeClassSchemaInternal
+
+    /**
+     * SizeClassSchema implementation... to keep the header clean.
+     */
+    class SizeClassSchemaImpl
+    {
+    public:
+        using FreeBlock = SizeClassSchemaInternal::FreeBlock;
+        using Segment = SizeClassSchemaInternal::Segment;
+        using Span = SizeClassSchemaInternal::Span;
+        using LargeAllocationHeader = SizeClassSchemaInternal::LargeAllocationHeader;
+        using CentralList = SizeClassSchemaInternal::CentralList;
+        using ThreadCache = SizeClassSchemaInternal::ThreadCache;
+        static constexpr size_t NumSizeClasses = SizeClassSchemaInternal::NumSizeClasses;
+        static constexpr u32 InvalidSizeClass = 0xffffffff;
+
+        explicit SizeClassSchemaImpl(IAllocatorAllocate* subAllocator);
+        ~SizeClassSchemaImpl();
+
+        void* Allocate(size_t byteSize, size_t alignment);
+        void DeAllocate(void* ptr);
+        size_t AllocationSize(void* ptr) const;
+        void GarbageCollect();
+
+        size_t NumAllocatedBytes() const;
+        size_t Capacity() const;
+
+    private:
+        u32 GetSizeClass(size_t byteSize, size_t alignment) const;
+        ThreadCache* GetThreadCache();
+        ThreadCache* FindOrCreateThreadCache();
+        void OrphanThreadCaches();
+        static void PruneOrphanedThreadCaches();
+
+        bool Refill(ThreadCache::Bin& bin, u32 sizeClass);
+        void Release(ThreadCache::Bin& bin, u32 sizeClass, u32 count);
+        Span* AcquireSpan(u32 sizeClass);
+
+        void* AllocateLarge(size_t byteSize, size_t alignment);
+        void DeAllocateLarge(void* ptr);
+
+        bool IsSpanAddress(const void* ptr) const;
+        void SetSpanBits(Segment* segment, bool isSet);
+        static Span* SpanFromAddress(const void* ptr)
+        {
+            return reinterpret_cast<Span*>(reinterpret_cast<size_t>(ptr) & ~(SizeClassSchema::SpanSize - 1));
+        }
+        static LargeAllocationHeader* LargeHeaderFromAddress(void* ptr)
+        {
+            return reinterpret_cast<LargeAllocationHeader*>(reinterpret_cast<char*>(ptr) - SizeClassSchemaInternal::LargeAllocationHeaderSize);
+        }
+
+        IAllocatorAllocate* m_subAllocator;
+        const u32 m_id;
+
+        u8 m_sizeClassForSize[SizeClassSchema::MaxSmallAllocationSize / SizeClassSchemaInternal::MinAlignment + 1];
+        u32 m_batchCount[NumSizeClasses];
+        CentralList m_centralLists[NumSizeClasses];
+
+        AZStd::mutex m_spanMutex;
+        Segment* m_segments = nullptr;
+        Span* m_freeSpans = nullptr;
+        AZStd::atomic<size_t> m_segmentBytes{ 0 };
+
+        AZStd::atomic<size_t> m_largeAllocatedBytes{ 0 };
+        AZStd::atomic<size_t> m_largeCapacity{ 0 };
+
+        mutable AZStd::mutex m_threadCacheMutex;
+        ThreadCache* m_threadCaches = nullptr;  ///< All thread caches of this schema, used for statistics and to orphan caches on destruction.
+
+        AZStd::atomic<AZStd::atomic<u64>*> m_spanMap[SizeClassSchemaInternal::SpanMapRootCount];
+    };
+
+    //=========================================================================
+    // SizeClassSchemaImpl
+    //=========================================================================
+    SizeClassSchemaImpl::SizeClassSchemaImpl(IAllocatorAllocate* subAllocator)
+        : m_subAllocator(subAllocator)
+        , m_id(SizeClassSchemaInternal::s_nextSchemaId.fetch_add(1))
+    {
+        using namespace SizeClassSchemaInternal;
+
+        u32 sizeClass = 0;
+        for (size_t i = 0; i < AZ_ARRAY_SIZE(m_sizeClassForSize); ++i)
+        {
+            while (s_sizeClasses[sizeClass] < i * MinAlignment)
+            {
+                ++sizeClass;
+            }
+            m_sizeClassForSize[i] = static_cast<u8>(sizeClass);
+        }
+
+        for (size_t i = 0; i < NumSizeClasses; ++i)
+        {
+            m_batchCount[i] = static_cast<u32>(AZ::GetClamp<size_t>(CacheBatchBytes / s_sizeClasses[i], 1, MaxCacheBatchCount));
+        }
+
+        for (AZStd::atomic<AZStd::atomic<u64>*>& leaf : m_spanMap)
+        {
+            leaf.store(nullptr, AZStd::memory_order_relaxed);
+        }
+    }
+
+    //=========================================================================
+    // ~SizeClassSchemaImpl
+    //=========================================================================
+    SizeClassSchemaImpl::~SizeClassSchemaImpl()
+    {
+        using namespace SizeClassSchemaInternal;
+
+        // Other threads can't be using the schema anymore. Their caches can't be released here because they're still linked
+        // from their thread local lists, so they're orphaned and released the next time the thread accesses a size class schema.
+        OrphanThreadCaches();
+        PruneOrphanedThreadCaches();
+
+        // All blocks are returned with the spans they're carved from.
+        while (m_segments)
+        {
+            Segment* segment = m_segments;
+            m_segments = segment->m_next;
+            SystemFree(m_subAllocator, segment->m_memory, segment->m_memorySize, MinAlignment);
+        }
+
+        for (AZStd::atomic<AZStd::atomic<u64>*>& leaf : m_spanMap)
+        {
+            if (AZStd::atomic<u64>* words = leaf.load(AZStd::memory_order_relaxed))
+            {
+                SystemFree(m_subAllocator, words, SpanMapLeafWordCount * sizeof(AZStd::atomic<u64>), alignof(AZStd::atomic<u64>));
+            }
+        }
+    }
+
+    //=========================================================================
+    // GetSizeClass
+    //=========================================================================
+    AZ_FORCE_INLINE u32 SizeClassSchemaImpl::GetSizeClass(size_t byteSize, size_t alignment) const
+    {
+        using namespace SizeClassSchemaInternal;
+
+        if (byteSize > SizeClassSchema::MaxSmallAllocationSize || alignment > SizeClassSchema::SpanHeaderSize)
+        {
+            return InvalidSizeClass;
+        }
+
+        u32 sizeClass = m_sizeClassForSize[(byteSize + MinAlignment - 1) / MinAlignment];
+        if (alignment > MinAlignment)
+        {
+            // Blocks start after the span header, so blocks of a class are aligned when the class size is a multiple of the alignment.
+            while (sizeClass < NumSizeClasses && (s_sizeClasses[sizeClass] & (alignment - 1)) != 0)
+            {
+                ++sizeClass;
+            }
+            if (sizeClass == NumSizeClasses)
+            {
+                return InvalidSizeClass;
+            }
+        }
+        return sizeClass;
+    }
+
+    //=========================================================================
+    // GetThreadCache
+    //=========================================================================
+    AZ_FORCE_INLINE SizeClassSchemaImpl::ThreadCache* SizeClassSchemaImpl::GetThreadCache()
+    {
+        ThreadCache* cache = SizeClassSchemaInternal::s_threadCaches;
+        if (cache && cache->m_schemaId.load(AZStd::memory_order_relaxed) == m_id)
+        {
+            return cache;
+        }
+        return FindOrCreateThreadCache();
+    }
+
+    //=========================================================================
+    // FindOrCreateThreadCache
+    //=========================================================================
+    SizeClassSchemaImpl::ThreadCache* SizeClassSchemaImpl::FindOrCreateThreadCache()
+    {
+        using namespace SizeClassSchemaInternal;
+
+        PruneOrphanedThreadCaches();
+
+        // Move the cache to the front so the next lookup only checks the first entry.
+        for (ThreadCache** link = &s_threadCaches; *link; link = &(*link)->m_nextInThread)
+        {
+            ThreadCache* cache = *link;
+            if (cache->m_schemaId.load(AZStd::memory_order_relaxed) == m_id)
+            {
+                *link = cache->m_nextInThread;
+                cache->m_nextInThread = s_threadCaches;
+                s_threadCaches = cache;
+                return cache;
+            }
+        }
+
+        // Thread caches can outlive the schema (see ~SizeClassSchemaImpl), so they're allocated from the OS directly.
+        void* memory = AZ_OS_MALLOC(sizeof(ThreadCache), alignof(ThreadCache));
+        if (!memory)
+        {
+            return nullptr;
+        }
+        ThreadCache* cache = new(memory) ThreadCache;
+        cache->m_schemaId.store(m_id, AZStd::memory_order_relaxed);
+        cache->m_allocatedBytes.store(0, AZStd::memory_order_relaxed);
+        memset(cache->m_bins, 0, sizeof(cache->m_bins));
+        cache->m_prevInSchema = nullptr;
+
+        cache->m_nextInThread = s_threadCaches;
+        s_threadCaches = cache;
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_threadCacheMutex);
+        cache->m_nextInSchema = m_threadCaches;
+        if (m_threadCaches)
+        {
+            m_threadCaches->m_prevInSchema = cache;
+        }
+        m_threadCaches = cache;
+        return cache;
+    }
+
+    //=========================================================================
+    // OrphanThreadCaches
+    //=========================================================================
+    void SizeClassSchemaImpl::OrphanThreadCaches()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_threadCacheMutex);
+        for (ThreadCache* cache = m_threadCaches; cache; cache = cache->m_nextInSchema)
+        {
+            cache->m_schemaId.store(0, AZStd::memory_order_relaxed);
+        }
+        m_threadCaches = nullptr;
+    }
+
+    //=========================================================================
+    // PruneOrphanedThreadCaches
+    //=========================================================================
+    void SizeClassSchemaImpl::PruneOrphanedThreadCaches()
+    {
+        using namespace SizeClassSchemaInternal;
+
+        ThreadCache** link = &s_threadCaches;
+        while (*link)
+        {
+            ThreadCache* cache = *link;
+            if (cache->m_schemaId.load(AZStd::memory_order_relaxed) == 0)
+            {
+                *link = cache->m_nextInThread;
+                cache->~ThreadCache();
+                AZ_OS_FREE(cache);
+            }
+            else
+            {
+                link = &cache->m_nextInThread;
+            }
+        }
+    }
+
+    //=========================================================================
+    // Allocate
+    //=========================================================================
+    void* SizeClassSchemaImpl::Allocate(size_t byteSize, size_t alignment)
+    {
+        const u32 sizeClass = GetSizeClass(byteSize, alignment);
+        if (sizeClass == InvalidSizeClass)
+        {
+            return AllocateLarge(byteSize, alignment);
+        }
+
+        ThreadCache* cache = GetThreadCache();
+        if (!cache)
+        {
+            return nullptr;
+        }
+
+        ThreadCache::Bin& bin = cache->m_bins[sizeClass];
+        if (!bin.m_head && !Refill(bin, sizeClass))
+        {
+            return nullptr;
+        }
+
+        FreeBlock* block = bin.m_head;
+        bin.m_head = block->m_next;
+        --bin.m_count;
+        cache->m_allocatedBytes.store(cache->m_allocatedBytes.load(AZStd::memory_order_relaxed) + SizeClassSchemaInternal::s_sizeClasses[sizeClass], AZStd::memory_order_relaxed);
+        return block;
+    }
+
+    //=========================================================================
+    // DeAllocate
+    //=========================================================================
+    void SizeClassSchemaImpl::DeAllocate(void* ptr)
+    {
+        if (!IsSpanAddress(ptr))
+        {
+            DeAllocateLarge(ptr);
+            return;
+        }
+
+        Span* span = SpanFromAddress(ptr);
+        AZ_Assert(span->m_magic == SizeClassSchemaInternal::SpanMagic && span->m_sizeClass < NumSizeClasses, "Address %p doesn't belong to a valid span!", ptr);
+        const u32 sizeClass = span->m_sizeClass;
+
+        ThreadCache* cache = GetThreadCache();
+        if (!cache)
+        {
+            // We can't create a cache, return the block straight to the central list.
+            ThreadCache::Bin bin{ reinterpret_cast<FreeBlock*>(ptr), 1 };
+            bin.m_head->m_next = nullptr;
+            Release(bin, sizeClass, 1);
+            return;
+        }
+
+        ThreadCache::Bin& bin = cache->m_bins[sizeClass];
+        FreeBlock* block = reinterpret_cast<FreeBlock*>(ptr);
+        block->m_next = bin.m_head;
+        bin.m_head = block;
+        ++bin.m_count;
+        cache->m_allocatedBytes.store(cache->m_allocatedBytes.load(AZStd::memory_order_relaxed) - SizeClassSchemaInternal::s_sizeClasses[sizeClass], AZStd::memory_order_relaxed);
+
+        if (bin.m_count > 2 * m_batchCount[sizeClass])
+        {
+            Release(bin, sizeClass, m_batchCount[sizeClass]);
+        }
+    }
+
+    //=========================================================================
+    // AllocationSize
+    //=========================================================================
+    size_t SizeClassSchemaImpl::AllocationSize(void* ptr) const
+    {
+        if (IsSpanAddress(ptr))
+        {
+            return SizeClassSchemaInternal::s_sizeClasses[SpanFromAddress(ptr)->m_sizeClass];
+        }
+        LargeAllocationHeader* header = LargeHeaderFromAddress(ptr);
+        AZ_Assert(header->m_magic == SizeClassSchemaInternal::LargeAllocationMagic, "Address %p wasn't allocated by this schema!", ptr);
+        return header->m_byteSize;
+    }
+
+    //=========================================================================
+    // Refill
+    //=========================================================================
+    bool SizeClassSchemaImpl::Refill(ThreadCache::Bin& bin, u32 sizeClass)
+    {
+        const size_t blockSize = SizeClassSchemaInternal::s_sizeClasses[sizeClass];
+        const u32 batchCount = m_batchCount[sizeClass];
+        CentralList& central = m_centralLists[sizeClass];
+
+        AZStd::lock_guard<AZStd::mutex> lock(central.m_mutex);
+        u32 count = 0;
+        while (count < batchCount && central.m_freeBlocks)
+        {
+            FreeBlock* block = central.m_freeBlocks;
+            central.m_freeBlocks = block->m_next;
+            ++SpanFromAddress(block)->m_usedCount;
+            block->m_next = bin.m_head;
+            bin.m_head = block;
+            ++count;
+        }
+
+        while (count < batchCount)
+        {
+            if (central.m_carveCursor == central.m_carveEnd)
+            {
+                Span* span = AcquireSpan(sizeClass);
+                if (!span)
+                {
+                    break;
+                }
+                span->m_next = central.m_spans;
+                if (central.m_spans)
+                {
+                    central.m_spans->m_prev = span;
+                }
+                central.m_spans = span;
+                central.m_carveSpan = span;
+                central.m_carveCursor = reinterpret_cast<char*>(span) + SizeClassSchema::SpanHeaderSize;
+                central.m_carveEnd = central.m_carveCursor + ((SizeClassSchema::SpanSize - SizeClassSchema::SpanHeaderSize) / blockSize) * blockSize;
+            }
+
+            FreeBlock* block = reinterpret_cast<FreeBlock*>(central.m_carveCursor);
+            central.m_carveCursor += blockSize;
+            ++central.m_carveSpan->m_usedCount;
+            block->m_next = bin.m_head;
+            bin.m_head = block;
+            ++count;
+        }
+
+        bin.m_count += count;
+        return count > 0;
+    }
+
+    //=========================================================================
+    // Release
+    //=========================================================================
+    void SizeClassSchemaImpl::Release(ThreadCache::Bin& bin, u32 sizeClass, u32 count)
+    {
+        AZ_Assert(count > 0 && count <= bin.m_count, "Invalid number of blocks to release");
+        CentralList& central = m_centralLists[sizeClass];
+
+        AZStd::lock_guard<AZStd::mutex> lock(central.m_mutex);
+        for (u32 i = 0; i < count; ++i)
+        {
+            FreeBlock* block = bin.m_head;
+            bin.m_head = block->m_next;
+            --SpanFromAddress(block)->m_usedCount;
+            block->m_next = central.m_freeBlocks;
+            central.m_freeBlocks = block;
+        }
+        bin.m_count -= count;
+    }
+
+    //=========================================================================
+    // AcquireSpan
+    //=========================================================================
+    SizeClassSchemaImpl::Span* SizeClassSchemaImpl::AcquireSpan(u32 sizeClass)
+    {
+        using namespace SizeClassSchemaInternal;
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_spanMutex);
+        if (!m_freeSpans)
+        {
+            // Allocate a segment with room for one additional span, so we can align the spans without relying on the sub allocator
+            // to support large alignments efficiently. The segment info is stored in front of the first span.
+            const size_t memorySize = (SegmentSpanCount + 1) * SizeClassSchema::SpanSize;
+            void* memory = SystemAlloc(m_subAllocator, memorySize, MinAlignment);
+            if (!memory)
+            {
+                return nullptr;
+            }
+            AZ_Assert((reinterpret_cast<size_t>(memory) >> 48) == 0, "SizeClassSchema only supports 48 bit addresses!");
+
+            Segment* segment = reinterpret_cast<Segment*>(memory);
+            segment->m_memory = memory;
+            segment->m_memorySize = memorySize;
+            segment->m_firstSpan = AZ::PointerAlignUp(reinterpret_cast<char*>(segment + 1), SizeClassSchema::SpanSize);
+            segment->m_spanCount = static_cast<u32>((reinterpret_cast<char*>(memory) + memorySize - segment->m_firstSpan) / SizeClassSchema::SpanSize);
+            segment->m_freeSpanCount = segment->m_spanCount;
+            segment->m_next = m_segments;
+            m_segments = segment;
+
+            for (u32 i = segment->m_spanCount; i > 0; --i)
+            {
+                Span* span = reinterpret_cast<Span*>(segment->m_firstSpan + (i - 1) * SizeClassSchema::SpanSize);
+                span->m_segment = segment;
+                span->m_next = m_freeSpans;
+                m_freeSpans = span;
+            }
+            SetSpanBits(segment, true);
+            m_segmentBytes.fetch_add(memorySize, AZStd::memory_order_relaxed);
+        }
+
+        Span* span = m_freeSpans;
+        m_freeSpans = span->m_next;
+        --span->m_segment->m_freeSpanCount;
+
+        span->m_magic = SpanMagic;
+        span->m_sizeClass = sizeClass;
+        span->m_prev = nullptr;
+        span->m_next = nullptr;
+        span->m_usedCount = 0;
+        return span;
+    }
+
+    //=========================================================================
+    // AllocateLarge
+    //=========================================================================
+    void* SizeClassSchemaImpl::AllocateLarge(size_t byteSize, size_t alignment)
+    {
+        using namespace SizeClassSchemaInternal;
+
+        alignment = AZStd::max(alignment, MinAlignment);
+        const size_t headerSize = AZStd::max(LargeAllocationHeaderSize, alignment);
+        const size_t blockSize = headerSize + byteSize;
+        void* block = SystemAlloc(m_subAllocator, blockSize, alignment);
+        if (!block)
+        {
+            return nullptr;
+        }
+
+        void* address = reinterpret_cast<char*>(block) + headerSize;
+        LargeAllocationHeader* header = LargeHeaderFromAddress(address);
+        header->m_block = block;
+        header->m_byteSize = byteSize;
+        header->m_magic = LargeAllocationMagic;
+
+        m_largeAllocatedBytes.fetch_add(byteSize, AZStd::memory_order_relaxed);
+        m_largeCapacity.fetch_add(blockSize, AZStd::memory_order_relaxed);
+        return address;
+    }
+
+    //=========================================================================
+    // DeAllocateLarge
+    //=========================================================================
+    void SizeClassSchemaImpl::DeAllocateLarge(void* ptr)
+    {
+        using namespace SizeClassSchemaInternal;
+
+        LargeAllocationHeader* header = LargeHeaderFromAddress(ptr);
+        AZ_Assert(header->m_magic == LargeAllocationMagic, "Address %p wasn't allocated by this schema!", ptr);
+        header->m_magic = 0;
+
+        const size_t blockSize = reinterpret_cast<char*>(ptr) - reinterpret_cast<char*>(header->m_block) + header->m_byteSize;
+        m_largeAllocatedBytes.fetch_sub(header->m_byteSize, AZStd::memory_order_relaxed);
+        m_largeCapacity.fetch_sub(blockSize, AZStd::memory_order_relaxed);
+        SystemFree(m_subAllocator, header->m_block, blockSize, 0);
+    }
+
+    //=========================================================================
+    // IsSpanAddress
+    //=========================================================================
+    AZ_FORCE_INLINE bool SizeClassSchemaImpl::IsSpanAddress(const void* ptr) const
+    {
+        using namespace SizeClassSchemaInternal;
+
+        const size_t address = reinterpret_cast<size_t>(ptr);
+        const size_t root = static_cast<size_t>(static_cast<u64>(address) >> SpanMapLeafShift);
+        if (root >= SpanMapRootCount)
+        {
+            return false;
+        }
+        const AZStd::atomic<u64>* words = m_spanMap[root].load(AZStd::memory_order_acquire);
+        if (!words)
+        {
+            return false;
+        }
+        // Callers only look up addresses of blocks they own, so the bit they read can't change concurrently.
+        const size_t spanIndex = (address >> SpanShift) & ((size_t(1) << (SpanMapLeafShift - SpanShift)) - 1);
+        return (words[spanIndex / 64].load(AZStd::memory_order_relaxed) & (u64(1) << (spanIndex % 64))) != 0;
+    }
+
+    //=========================================================================
+    // SetSpanBits
+    // The span mutex must be held.
+    //=========================================================================
+    void SizeClassSchemaImpl::SetSpanBits(Segment* segment, bool isSet)
+    {
+        using namespace SizeClassSchemaInternal;
+
+        for (u32 i = 0; i < segment->m_spanCount; ++i)
+        {
+            const size_t address = reinterpret_cast<size_t>(segment->m_firstSpan) + i * SizeClassSchema::SpanSize;
+            const size_t root = static_cast<size_t>(static_cast<u64>(address) >> SpanMapLeafShift);
+            AZStd::atomic<u64>* words = m_spanMap[root].load(AZStd::memory_order_relaxed);
+            if (!words)
+            {
+                AZ_Assert(isSet, "Clearing spans that were never registered!");
+                void* memory = SystemAlloc(m_subAllocator, SpanMapLeafWordCount * sizeof(AZStd::atomic<u64>), alignof(AZStd::atomic<u64>));
+                AZ_Assert(memory, "Failed to allocate the span map!");
+                words = reinterpret_cast<AZStd::atomic<u64>*>(memory);
+                for (size_t word = 0; word < SpanMapLeafWordCount; ++word)
+                {
+                    new(&words[word]) AZStd::atomic<u64>(0);
+                }
+                m_spanMap[root].store(words, AZStd::memory_order_release);
+            }
+            const size_t spanIndex = (address >> SpanShift) & ((size_t(1) << (SpanMapLeafShift - SpanShift)) - 1);
+            if (isSet)
+            {
+                words[spanIndex / 64].fetch_or(u64(1) << (spanIndex % 64), AZStd::memory_order_relaxed);
+            }
+            else
+            {
+                words[spanIndex / 64].fetch_and(~(u64(1) << (spanIndex % 64)), AZStd::memory_order_relaxed);
+            }
+        }
+    }
+
+    //=========================================================================
+    // GarbageCollect
+    //=========================================================================
+    void SizeClassSchemaImpl::GarbageCollect()
+    {
+        using namespace SizeClassSchemaInternal;
+
+        // Return the calling thread's cached blocks. Caches of other threads can only be accessed by their own thread.
+        ThreadCache* cache = s_threadCaches;
+        if (cache && cache->m_schemaId.load(AZStd::memory_order_relaxed) == m_id)
+        {
+            for (u32 sizeClass = 0; sizeClass < NumSizeClasses; ++sizeClass)
+            {
+                if (cache->m_bins[sizeClass].m_count > 0)
+                {
+                    Release(cache->m_bins[sizeClass], sizeClass, cache->m_bins[sizeClass].m_count);
+                }
+            }
+        }
+
+        // Unused spans have all their blocks in the central list, filter them out and return the spans.
+        Span* releasedSpans = nullptr;
+        for (CentralList& central : m_centralLists)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(central.m_mutex);
+            if (central.m_carveSpan && central.m_carveSpan->m_usedCount == 0)
+            {
+                // Nothing was carved from the span that is still in use, so it can be released as well.
+                central.m_carveSpan = nullptr;
+                central.m_carveCursor = nullptr;
+                central.m_carveEnd = nullptr;
+            }
+
+            bool hasUnusedSpans = false;
+            for (Span* span = central.m_spans; span; span = span->m_next)
+            {
+                if (span->m_usedCount == 0 && span != central.m_carveSpan)
+                {
+                    hasUnusedSpans = true;
+                    break;
+                }
+            }
+            if (!hasUnusedSpans)
+            {
+                continue;
+            }
+
+            FreeBlock** link = &central.m_freeBlocks;
+            while (*link)
+            {
+                Span* span = SpanFromAddress(*link);
+                if (span->m_usedCount == 0 && span != central.m_carveSpan)
+                {
+                    *link = (*link)->m_next;
+                }
+                else
+                {
+                    link = &(*link)->m_next;
+                }
+            }
+
+            Span* span = central.m_spans;
+            while (span)
+            {
+                Span* next = span->m_next;
+                if (span->m_usedCount == 0 && span != central.m_carveSpan)
+                {
+                    if (span->m_prev)
+                    {
+                        span->m_prev->m_next = next;
+                    }
+                    else
+                    {
+                        central.m_spans = next;
+                    }
+                    if (next)
+                    {
+                        next->m_prev = span->m_prev;
+                    }
+                    span->m_magic = 0;
+                    span->m_next = releasedSpans;
+                    releasedSpans = span;
+                }
+                span = next;
+            }
+        }
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_spanMutex);
+        while (releasedSpans)
+        {
+            Span* span = releasedSpans;
+            releasedSpans = span->m_next;
+            span->m_next = m_freeSpans;
+            m_freeSpans = span;
+            ++span->m_segment->m_freeSpanCount;
+        }
+
+        // Return the segments that are completely unused.
+        Span** spanLink = &m_freeSpans;
+        while (*spanLink)
+        {
+            Segment* segment = (*spanLink)->m_segment;
+            if (segment->m_freeSpanCount == segment->m_spanCount)
+            {
+                *spanLink = (*spanLink)->m_next;
+            }
+            else
+            {
+                spanLink = &(*spanLink)->m_next;
+            }
+        }
+        Segment** segmentLink = &m_segments;
+        while (*segmentLink)
+        {
+            Segment* segment = *segmentLink;
+            if (segment->m_freeSpanCount == segment->m_spanCount)
+            {
+                *segmentLink = segment->m_next;
+                SetSpanBits(segment, false);
+                m_segmentBytes.fetch_sub(segment->m_memorySize, AZStd::memory_order_relaxed);
+                SystemFree(m_subAllocator, segment->m_memory, segment->m_memorySize, MinAlignment);
+            }
+            else
+            {
+                segmentLink = &segment->m_next;
+            }
+        }
+    }
+
+    //=========================================================================
+    // NumAllocatedBytes
+    //=========================================================================
+    size_t SizeClassSchemaImpl::NumAllocatedBytes() const
+    {
+        // The per thread counters wrap around when memory is freed on a different thread, the sum is still correct.
+        size_t allocatedBytes = m_largeAllocatedBytes.load(AZStd::memory_order_relaxed);
+        AZStd::lock_guard<AZStd::mutex> lock(m_threadCacheMutex);
+        for (const ThreadCache* cache = m_threadCaches; cache; cache = cache->m_nextInSchema)
+        {
+            allocatedBytes += cache->m_allocatedBytes.load(AZStd::memory_order_relaxed);
+        }
+        return allocatedBytes;
+    }
+
+    //=========================================================================
+    // Capacity
+    //=========================================================================
+    size_t SizeClassSchemaImpl::Capacity() const
+    {
+        return m_segmentBytes.load(AZStd::memory_order_relaxed) + m_largeCapacity.load(AZStd::memory_order_relaxed);
+    }
+
+    //=========================================================================
+    // SizeClassSchema
+    //=========================================================================
+    SizeClassSchema::SizeClassSchema(const Descriptor& desc)
+        : m_desc(desc)
+    {
+        // We can't allocate the implementation with aznew, this schema might be the one backing the SystemAllocator.
+        void* memory = SizeClassSchemaInternal::SystemAlloc(m_desc.m_subAllocator, sizeof(SizeClassSchemaImpl), alignof(SizeClassSchemaImpl));
+        m_impl = memory ? new(memory) SizeClassSchemaImpl(m_desc.m_subAllocator) : nullptr;
+        AZ_Assert(m_impl, "Failed to allocate the SizeClassSchema implementation!");
+    }
+
+    //=========================================================================
+    // ~SizeClassSchema
+    //=========================================================================
+    SizeClassSchema::~SizeClassSchema()
+    {
+        if (m_impl)
+        {
+            m_impl->~SizeClassSchemaImpl();
+            SizeClassSchemaInternal::SystemFree(m_desc.m_subAllocator, m_impl, sizeof(SizeClassSchemaImpl), alignof(SizeClassSchemaImpl));
+            m_impl = nullptr;
+        }
+    }
+
+    //=========================================================================
+    // Allocate
+    //=========================================================================
+    SizeClassSchema::pointer_type SizeClassSchema::Allocate(size_type byteSize, size_type alignment, int flags, const char* name, const char* fileName, int lineNum, unsigned int suppressStackRecord)
+    {
+        (void)flags;
+        (void)name;
+        (void)fileName;
+        (void)lineNum;
+        (void)suppressStackRecord;
+        AZ_Assert((alignment & (alignment - 1)) == 0, "Alignment must be power of 2!");
+        return m_impl->Allocate(byteSize > 0 ? byteSize : 1, alignment);
+    }
+
+    //=========================================================================
+    // DeAllocate
+    //=========================================================================
+    void SizeClassSchema::DeAllocate(pointer_type ptr, size_type byteSize, size_type alignment)
+    {
+        (void)byteSize;
+        (void)alignment;
+        if (ptr)
+        {
+            m_impl->DeAllocate(ptr);
+        }
+    }
+
+    //=========================================================================
+    // ReAllocate
+    //=========================================================================
+    SizeClassSchema::pointer_type SizeClassSchema::ReAllocate(pointer_type ptr, size_type newSize, size_type newAlignment)
+    {
+        if (!ptr)
+        {
+            return newSize > 0 ? Allocate(newSize, newAlignment) : nullptr;
+        }
+        if (newSize == 0)
+        {
+            DeAllocate(ptr);
+            return nullptr;
+        }
+
+        const size_type oldSize = m_impl->AllocationSize(ptr);
+        const bool isAligned = (reinterpret_cast<size_t>(ptr) & (AZStd::max<size_type>(newAlignment, 1) - 1)) == 0;
+        if (isAligned && newSize <= oldSize && oldSize < newSize * 2)
+        {
+            // The block is big enough and not excessively larger than requested.
+            return ptr;
+        }
+
+        pointer_type newPtr = Allocate(newSize, newAlignment);
+        if (newPtr)
+        {
+            memcpy(newPtr, ptr, AZStd::min(oldSize, newSize));
+            DeAllocate(ptr);
+        }
+        return newPtr;
+    }
+
+    //=========================================================================
+    // Resize
+    //=========================================================================
+    SizeClassSchema::size_type SizeClassSchema::Resize(pointer_type ptr, size_type newSize)
+    {
+        (void)newSize;
+        return m_impl->AllocationSize(ptr);
+    }
+
+    //=========================================================================
+    // AllocationSize
+    //=========================================================================
+    SizeClassSchema::size_type SizeClassSchema::AllocationSize(pointer_type ptr)
+    {
+        return ptr ? m_impl->AllocationSize(ptr) : 0;
+    }
+
+    //=========================================================================
+    // NumAllocatedBytes
+    //=========================================================================
+    SizeClassSchema::size_type SizeClassSchema::NumAllocatedBytes() const
+    {
+        return m_impl->NumAllocatedBytes();
+    }
+
+    //=========================================================================
+    // Capacity
+    //=========================================================================
+    SizeClassSchema::size_type SizeClassSchema::Capacity() const
+    {
+        return m_impl->Capacity();
+    }
+
+    //=========================================================================
+    // GetMaxAllocationSize
+    //=========================================================================
+    SizeClassSchema::size_type SizeClassSchema::GetMaxAllocationSize() const
+    {
+        return m_desc.m_subAllocator ? m_desc.m_subAllocator->GetMaxAllocationSize() : AZ_CORE_MAX_ALLOCATOR_SIZE;
+    }
+
+    //=========================================================================
+    // GetUnAllocatedMemory
+    //=========================================================================
+    SizeClassSchema::size_type SizeClassSchema::GetUnAllocatedMemory(bool isPrint) const
+    {
+        const size_type capacity = Capacity();
+        const size_type allocatedBytes = NumAllocatedBytes();
+        const size_type unallocatedBytes = capacity > allocatedBytes ? capacity - allocatedBytes : 0;
+        if (isPrint)
+        {
+            AZ_TracePrintf("Memory", "SizeClassSchema: %zu bytes unallocated (cached or in free spans)\n", unallocatedBytes);
+        }
+        return unallocatedBytes;
+    }
+
+    //=========================================================================
+    // GarbageCollect
+    //=========================================================================
+    void SizeClassSchema::GarbageCollect()
+    {
+        m_impl->GarbageCollect();
+    }
+} // namespace AZ
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Memory/Memory.h>
+
+namespace AZ
+{
+    class SizeClassSchemaImpl;
+
+    /**
+     * Size class allocator schema with per thread caches.
+     * Small allocations are rounded up to one of a fixed set of size classes and carved from 64 KB spans. Every thread keeps
+     * a cache of free blocks for each size class, so the common allocate and free paths neither take a lock nor write to
+     * memory shared with other threads. Caches are refilled from, and overflow into, a central free list per size class in
+     * batches, which keeps the lock traffic proportional to the number of batches instead of the number of allocations.
+     * Allocations larger than MaxSmallAllocationSize, or with an alignment above SpanHeaderSize, go directly to the sub allocator.
+     * Memory can be freed from any thread, not just the one that allocated it. A thread cache holds at most two batches per
+     * size class, blocks cached by threads that exited are only reclaimed when the schema is destroyed.
+     * IMPORTANT: Like the thread pool schema, the schema keeps data per thread. All threads (except the calling one) need
+     * to be finished (or not use the schema anymore) before the schema is destroyed.
+     */
+    class SizeClassSchema
+        : public IAllocatorAllocate
+    {
+    public:
+        static constexpr size_t SpanSize = 64 * 1024;           ///< Size and alignment of the spans small allocations are carved from.
+        static constexpr size_t SpanHeaderSize = 64;             ///< Bytes at the start of every span reserved for bookkeeping.
+        static constexpr size_t MaxSmallAllocationSize = 32736;  ///< Largest size class, two of them fit in a span.
+
+        /**
+         * Size class schema descriptor.
+         */
+        struct Descriptor
+        {
+            Descriptor()
+                : m_subAllocator(nullptr)
+            {}
+
+            IAllocatorAllocate* m_subAllocator; ///< Allocator spans and large allocations come from, if NULL we use the OS memory allocation functions.
+        };
+
+        SizeClassSchema(const Descriptor& desc = Descriptor());
+        ~SizeClassSchema() override;
+
+        pointer_type    Allocate(size_type byteSize, size_type alignment, int flags = 0, const char* name = 0, const char* fileName = 0, int lineNum = 0, unsigned int suppressStackRecord = 0) override;
+        void            DeAllocate(pointer_type ptr, size_type byteSize = 0, size_type alignment = 0) override;
+        pointer_type    ReAllocate(pointer_type ptr, size_type newSize, size_type newAlignment) override;
+        /// Blocks are never resized in place, this returns the usable size of the block.
+        size_type       Resize(pointer_type ptr, size_type newSize) override;
+        size_type       AllocationSize(pointer_type ptr) override;
+
+        size_type       NumAllocatedBytes() const override;
+        size_type       Capacity() const override;
+        size_type       GetMaxAllocationSize() const override;
+        size_type       GetUnAllocatedMemory(bool isPrint = false) const override;
+        IAllocatorAllocate* GetSubAllocator() override          { return m_desc.m_subAllocator; }
+
+        /// Returns the calling thread's cached blocks to the central free lists and releases all unused spans.
+        void            GarbageCollect() override;
+
+    private:
+        SizeClassSchema(const SizeClassSchema&) = delete;
+        SizeClassSchema& operator=(const SizeClassSchema&) = delete;
+
+        Descriptor              m_desc;
+        SizeClassSchemaImpl*    m_impl;
+    };
+} // namespace AZ
@@ -12,7 +12,9 @@
 #include <AzCore/Memory/OSAllocator.h>
 #include <AzCore/Memory/AllocationRecords.h>
 #include <AzCore/Memory/MemoryDrillerBus.h>
+#include <AzCore/Memory/SizeClassSchema.h>
 
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/functional.h>
 
 #include <AzCore/Debug/Profiler.h>
@@ -35,12 +37,15 @@ using namespace AZ;
 // Globals - we use global storage for the first memory schema, since we can't use dynamic memory!
 static bool g_isSystemSchemaUsed = false;
 #ifdef AZCORE_SYS_ALLOCATOR_HPPA
-static AZStd::aligned_storage<sizeof(HphaSchema), AZStd::alignment_of<HphaSchema>::value>::type g_systemSchema;
+using DefaultSystemSchema = HphaSchema;
 #elif defined(AZCORE_SYS_ALLOCATOR_MALLOC)
-static AZStd::aligned_storage<sizeof(MallocSchema), AZStd::alignment_of<MallocSchema>::value>::type g_systemSchema;
+using DefaultSystemSchema = MallocSchema;
 #else
-static AZStd::aligned_storage<sizeof(HeapSchema), AZStd::alignment_of<HeapSchema>::value>::type g_systemSchema;
+using DefaultSystemSchema = HeapSchema;
 #endif
+// The storage has to fit either the default schema or the SizeClassSchema (see SystemAllocator::Descriptor::Heap::m_isSizeClassSchema)
+static AZStd::aligned_storage<AZStd::GetMax(sizeof(DefaultSystemSchema), sizeof(SizeClassSchema)),
+    AZStd::GetMax(AZStd::alignment_of<DefaultSystemSchema>::value, AZStd::alignment_of<SizeClassSchema>::value)>::type g_systemSchema;
 
 //////////////////////////////////////////////////////////////////////////
 
@@ -94,6 +99,25 @@ SystemAllocator::Create(const Descriptor& desc)
         m_allocator = desc.m_custom;
         isReady = true;
     }
+    else if (desc.m_heap.m_isSizeClassSchema)
+    {
+        m_isCustom = false;
+        AZ_Assert(desc.m_heap.m_numFixedMemoryBlocks == 0, "SizeClassSchema doesn't support fixed memory blocks!");
+        SizeClassSchema::Descriptor sizeClassDesc;
+        sizeClassDesc.m_subAllocator = desc.m_heap.m_subAllocator;
+        if (&AllocatorInstance<SystemAllocator>::Get() == this) // if we are the system allocator
+        {
+            AZ_Assert(!g_isSystemSchemaUsed, "AZ::SystemAllocator MUST be created first! It's the source of all allocations!");
+            m_allocator = new(&g_systemSchema)SizeClassSchema(sizeClassDesc);
+            g_isSystemSchemaUsed = true;
+        }
+        else
+        {
+            AZ_Assert(AllocatorInstance<SystemAllocator>::IsReady(), "System allocator must be created before any other allocator! They allocate from it.");
+            m_allocator = azcreate(SizeClassSchema, (sizeClassDesc), SystemAllocator);
+        }
+        isReady = m_allocator != nullptr;
+    }
     else
     {
         m_isCustom = false;
@@ -178,13 +202,14 @@ SystemAllocator::Destroy()
     {
         if ((void*)m_allocator == (void*)&g_systemSchema)
         {
-#ifdef AZCORE_SYS_ALLOCATOR_HPPA
-            static_cast<HphaSchema*>(m_allocator)->~HphaSchema();
-#elif defined(AZCORE_SYS_ALLOCATOR_MALLOC)
-            static_cast<MallocSchema*>(m_allocator)->~MallocSchema();
-#else
-            static_cast<HeapSchema*>(m_allocator)->~HeapSchema();
-#endif
+            if (m_desc.m_heap.m_isSizeClassSchema)
+            {
+                static_cast<SizeClassSchema*>(m_allocator)->~SizeClassSchema();
+            }
+            else
+            {
+                static_cast<DefaultSystemSchema*>(m_allocator)->~DefaultSystemSchema();
+            }
             g_isSystemSchemaUsed = false;
         }
         else
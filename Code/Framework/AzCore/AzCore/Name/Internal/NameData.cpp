@@ -13,11 +13,6 @@ namespace AZ
 {
     namespace Internal
     {
-        NameData::NameData(AZStd::string&& name, Hash hash)
-            : m_name{AZStd::move(name)}
-            , m_hash{hash}
-        {}
-
         AZStd::string_view NameData::GetName() const
         {
             return m_name;
@@ -34,6 +29,19 @@ namespace AZ
             ++m_useCount;
         }
 
+        bool NameData::TryAddRef()
+        {
+            int32_t useCount = m_useCount.load(AZStd::memory_order_acquire);
+            while (useCount >= 0)
+            {
+                if (m_useCount.compare_exchange_weak(useCount, useCount + 1, AZStd::memory_order_acq_rel, AZStd::memory_order_acquire))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
         void NameData::release()
         {
             AZ_Assert(m_useCount > 0, "m_useCount is already 0!");
@@ -20,12 +20,15 @@ namespace AZ
 
     namespace Internal
     {
+        class NameDictionaryShard;
+
+        //! Dictionary entry for a unique name. Entries are pooled by the NameDictionaryShard that holds them and are recycled
+        //! rather than freed, so lock free lookups can safely reach an entry that is being released concurrently.
         class NameData final
         {
             friend NameDictionary;
+            friend NameDictionaryShard;
         public:
-            AZ_CLASS_ALLOCATOR(NameData, AZ::SystemAllocator, 0);
-
             using Hash = uint32_t; // We use a 32 bit hash especially for efficient transport over a network.
 
             //! Returns the string part of the name data.
@@ -35,17 +38,21 @@ namespace AZ
             Hash GetHash() const;
 
         private:
-            NameData(AZStd::string&& name, Hash hash);
+            NameData() = default;
 
             void add_ref();
             void release();
 
+            //! Adds a reference unless the entry has been released from the dictionary (use count of -1).
+            //! @return true if a reference was added.
+            bool TryAddRef();
+
             template <typename T>
             friend struct AZStd::IntrusivePtrCountPolicy;
 
-            AZStd::atomic_int m_useCount = {0};
-            AZStd::string m_name;
-            Hash m_hash;
+            AZStd::atomic_int m_useCount = {-1};
+            AZStd::string_view m_name; // null terminated, the characters are held in the shard's string arena
+            Hash m_hash = 0;
 
             // TODO: We should be able to change this to a normal bool after introducing name dictionary garbage collection
             AZStd::atomic<bool> m_hashCollision = false; // Tracks whether the hash has been involved in a collision
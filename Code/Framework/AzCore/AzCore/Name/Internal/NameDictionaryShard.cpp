@@ -0,0 +1,356 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Name/Internal/NameDictionaryShard.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <cstring>
+
+namespace AZ
+{
+    namespace Internal
+    {
+        NameDictionaryShard::Table::Table(uint32_t capacity)
+            : m_capacity(capacity)
+            , m_slots(new Slot[capacity])
+        {
+            AZ_Assert((capacity & (capacity - 1)) == 0, "Table capacity must be a power of two");
+            m_shift = 32;
+            for (uint32_t size = capacity; size > 1; size >>= 1)
+            {
+                --m_shift;
+            }
+        }
+
+        uint32_t NameDictionaryShard::Table::GetHomeIndex(Hash hash) const
+        {
+            // Fibonacci hashing, the shard was picked using the low bits of the hash so the slot is taken from the high bits
+            // of the product, which depend on all bits of the hash
+            return (hash * 2654435769u) >> m_shift;
+        }
+
+        NameDictionaryShard::NameDictionaryShard()
+            : m_ownedTable(new Table(InitialCapacity))
+        {
+            m_table.store(m_ownedTable.get(), AZStd::memory_order_relaxed);
+        }
+
+        NameDictionaryShard::~NameDictionaryShard()
+        {
+            if (m_leakEntries)
+            {
+                return;
+            }
+
+            // Strings too long for the arena are allocated individually
+            ForEachEntry([this](NameData* nameData)
+            {
+                FreeString(const_cast<char*>(nameData->m_name.data()), nameData->m_name.size() + 1);
+            });
+
+            for (NameData* block : m_nameDataBlocks)
+            {
+                for (size_t index = 0; index < NameDataBlockSize; ++index)
+                {
+                    block[index].~NameData();
+                }
+                azfree(block, AZ::SystemAllocator);
+            }
+
+            for (char* block : m_stringBlocks)
+            {
+                azfree(block, AZ::SystemAllocator);
+            }
+        }
+
+        bool NameDictionaryShard::TryAcquire(Hash hash, NameData*& result)
+        {
+            result = nullptr;
+
+            // While the reader count is non zero the tables can't be freed. The entries can be removed and recycled at any
+            // time though, so a reference is only valid once it has been added and the entry has been checked again.
+            NameData* candidate = nullptr;
+            m_activeReaders.fetch_add(1);
+            const Table* table = m_table.load();
+            const uint32_t mask = table->m_capacity - 1;
+            for (uint32_t probe = 0, index = table->GetHomeIndex(hash); probe < table->m_capacity; ++probe, index = (index + 1) & mask)
+            {
+                const Slot& slot = table->m_slots[index];
+                NameData* nameData = slot.m_data.load(AZStd::memory_order_acquire);
+                if (nameData == nullptr)
+                {
+                    break;
+                }
+                if (IsEntry(nameData) && (slot.m_hash.load(AZStd::memory_order_relaxed) == hash))
+                {
+                    candidate = nameData;
+                    break;
+                }
+            }
+            m_activeReaders.fetch_sub(1, AZStd::memory_order_release);
+
+            if (candidate == nullptr)
+            {
+                return true;
+            }
+
+            if (!candidate->TryAddRef())
+            {
+                return false;
+            }
+
+            if (candidate->m_hash != hash)
+            {
+                // The entry was recycled for a different name after we found it
+                candidate->release();
+                return false;
+            }
+
+            result = candidate;
+            return true;
+        }
+
+        AZStd::mutex& NameDictionaryShard::GetMutex()
+        {
+            return m_mutex;
+        }
+
+        NameData* NameDictionaryShard::Find(Hash hash) const
+        {
+            const Table& table = *m_ownedTable;
+            const uint32_t mask = table.m_capacity - 1;
+            for (uint32_t probe = 0, index = table.GetHomeIndex(hash); probe < table.m_capacity; ++probe, index = (index + 1) & mask)
+            {
+                const Slot& slot = table.m_slots[index];
+                NameData* nameData = slot.m_data.load(AZStd::memory_order_relaxed);
+                if (nameData == nullptr)
+                {
+                    break;
+                }
+                if (IsEntry(nameData) && (slot.m_hash.load(AZStd::memory_order_relaxed) == hash))
+                {
+                    return nameData;
+                }
+            }
+            return nullptr;
+        }
+
+        NameData* NameDictionaryShard::Insert(AZStd::string_view name, Hash hash, bool hashCollision)
+        {
+            AZ_Assert(Find(hash) == nullptr, "An entry for hash 0x%08X already exists", hash);
+
+            // Keep the table at most 3/4 full, counting tombstones. The table only grows if at least half of it is taken by
+            // entries, otherwise it is rebuilt at the same size to clear out the tombstones.
+            if ((m_usedSlotCount + 1) * 4 > m_ownedTable->m_capacity * 3)
+            {
+                const uint32_t capacity = m_ownedTable->m_capacity;
+                Rebuild(((m_entryCount + 1) * 2 > capacity) ? capacity * 2 : capacity);
+            }
+
+            char* nameString = AllocateString(name.size() + 1);
+            memcpy(nameString, name.data(), name.size());
+            nameString[name.size()] = '\0';
+
+            NameData* nameData = AllocateNameData();
+            nameData->m_name = AZStd::string_view(nameString, name.size());
+            nameData->m_hash = hash;
+            nameData->m_hashCollision = hashCollision;
+            // Publishes the fields above to lock free lookups which still hold a pointer to the recycled entry
+            nameData->m_useCount.store(0, AZStd::memory_order_release);
+
+            Table& table = *m_ownedTable;
+            const uint32_t mask = table.m_capacity - 1;
+            uint32_t index = table.GetHomeIndex(hash);
+            while (IsEntry(table.m_slots[index].m_data.load(AZStd::memory_order_relaxed)))
+            {
+                index = (index + 1) & mask;
+            }
+
+            Slot& slot = table.m_slots[index];
+            if (slot.m_data.load(AZStd::memory_order_relaxed) == nullptr)
+            {
+                ++m_usedSlotCount;
+            }
+            slot.m_hash.store(hash, AZStd::memory_order_relaxed);
+            slot.m_data.store(nameData, AZStd::memory_order_release);
+            ++m_entryCount;
+
+            ReclaimRetiredTables();
+            return nameData;
+        }
+
+        void NameDictionaryShard::Erase(NameData* nameData)
+        {
+            AZ_Assert(nameData->m_useCount == -1, "Only released entries can be removed from the dictionary");
+
+            Table& table = *m_ownedTable;
+            const uint32_t mask = table.m_capacity - 1;
+            Slot* entrySlot = nullptr;
+            for (uint32_t probe = 0, index = table.GetHomeIndex(nameData->m_hash); probe < table.m_capacity; ++probe, index = (index + 1) & mask)
+            {
+                NameData* slotData = table.m_slots[index].m_data.load(AZStd::memory_order_relaxed);
+                if (slotData == nameData)
+                {
+                    entrySlot = &table.m_slots[index];
+                    break;
+                }
+                if (slotData == nullptr)
+                {
+                    break;
+                }
+            }
+
+            if (!entrySlot)
+            {
+                return;
+            }
+
+            entrySlot->m_data.store(reinterpret_cast<NameData*>(Tombstone), AZStd::memory_order_release);
+            --m_entryCount;
+
+            FreeString(const_cast<char*>(nameData->m_name.data()), nameData->m_name.size() + 1);
+            nameData->m_name = {};
+            m_freeNameData.push_back(nameData);
+
+            ReclaimRetiredTables();
+        }
+
+        void NameDictionaryShard::LeakEntries()
+        {
+            m_leakEntries = true;
+        }
+
+        size_t NameDictionaryShard::GetEntryCount() const
+        {
+            return m_entryCount;
+        }
+
+        void NameDictionaryShard::Rebuild(uint32_t capacity)
+        {
+            AZStd::unique_ptr<Table> table(new Table(capacity));
+            const uint32_t mask = capacity - 1;
+            ForEachEntry([&table, mask](NameData* nameData)
+            {
+                uint32_t index = table->GetHomeIndex(nameData->m_hash);
+                while (table->m_slots[index].m_data.load(AZStd::memory_order_relaxed) != nullptr)
+                {
+                    index = (index + 1) & mask;
+                }
+                table->m_slots[index].m_hash.store(nameData->m_hash, AZStd::memory_order_relaxed);
+                table->m_slots[index].m_data.store(nameData, AZStd::memory_order_relaxed);
+            });
+
+            // Lookups still searching the old table may miss entries added from now on, which is no different from the
+            // lookup having happened before they were added
+            m_table.store(table.get());
+            m_retiredTables.push_back(AZStd::move(m_ownedTable));
+            m_ownedTable = AZStd::move(table);
+            m_usedSlotCount = m_entryCount;
+        }
+
+        void NameDictionaryShard::ReclaimRetiredTables()
+        {
+            // A lookup registers itself as a reader before loading the table pointer, so once the count has been seen at zero
+            // after a table was replaced no lookup can still be using it
+            if (!m_retiredTables.empty() && (m_activeReaders.load() == 0))
+            {
+                m_retiredTables.clear();
+            }
+        }
+
+        NameData* NameDictionaryShard::AllocateNameData()
+        {
+            if (m_freeNameData.empty())
+            {
+                NameData* block = reinterpret_cast<NameData*>(azmalloc(sizeof(NameData) * NameDataBlockSize, alignof(NameData), AZ::SystemAllocator));
+                for (size_t index = 0; index < NameDataBlockSize; ++index)
+                {
+                    new (&block[index]) NameData();
+                }
+                m_nameDataBlocks.push_back(block);
+
+                // Hand out entries in address order
+                for (size_t index = NameDataBlockSize; index > 0; --index)
+                {
+                    m_freeNameData.push_back(&block[index - 1]);
+                }
+            }
+
+            NameData* nameData = m_freeNameData.back();
+            m_freeNameData.pop_back();
+            return nameData;
+        }
+
+        char* NameDictionaryShard::AllocateString(size_t size)
+        {
+            size_t sizeClass = 0;
+            size_t classSize = MinArenaStringSize;
+            while (classSize < size)
+            {
+                classSize <<= 1;
+                ++sizeClass;
+            }
+
+            if (sizeClass >= StringSizeClassCount)
+            {
+                return reinterpret_cast<char*>(azmalloc(size, 1, AZ::SystemAllocator));
+            }
+
+            if (char* string = m_freeStrings[sizeClass])
+            {
+                memcpy(&m_freeStrings[sizeClass], string, sizeof(char*));
+                return string;
+            }
+
+            if (m_stringBlockRemaining < classSize)
+            {
+                // The remainder of the current block is too small for this size class, but it is still large enough for
+                // smaller classes, so move it to the free lists instead of wasting it
+                while (m_stringBlockRemaining >= MinArenaStringSize)
+                {
+                    size_t remainderClassSize = MinArenaStringSize << (StringSizeClassCount - 1);
+                    while (remainderClassSize > m_stringBlockRemaining)
+                    {
+                        remainderClassSize >>= 1;
+                    }
+                    FreeString(m_stringCursor, remainderClassSize);
+                    m_stringCursor += remainderClassSize;
+                    m_stringBlockRemaining -= remainderClassSize;
+                }
+
+                m_stringCursor = reinterpret_cast<char*>(azmalloc(StringBlockSize, MinArenaStringSize, AZ::SystemAllocator));
+                m_stringBlockRemaining = StringBlockSize;
+                m_stringBlocks.push_back(m_stringCursor);
+            }
+
+            char* string = m_stringCursor;
+            m_stringCursor += classSize;
+            m_stringBlockRemaining -= classSize;
+            return string;
+        }
+
+        void NameDictionaryShard::FreeString(char* string, size_t size)
+        {
+            size_t sizeClass = 0;
+            size_t classSize = MinArenaStringSize;
+            while (classSize < size)
+            {
+                classSize <<= 1;
+                ++sizeClass;
+            }
+
+            if (sizeClass >= StringSizeClassCount)
+            {
+                azfree(string, AZ::SystemAllocator);
+                return;
+            }
+
+            memcpy(string, &m_freeStrings[sizeClass], sizeof(char*));
+            m_freeStrings[sizeClass] = string;
+        }
+    }
+}
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Name/Internal/NameData.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string_view.h>
+
+namespace AZ
+{
+    namespace Internal
+    {
+        //! One shard of the NameDictionary, holding the entries whose hashes map to it.
+        //!
+        //! Entries are kept in an open addressing hash table which can be searched without taking the shard's lock, adding and
+        //! removing entries requires the lock. Replaced tables are kept until no lock free lookup is in progress, and the
+        //! NameData headers themselves are pooled and never freed while the shard exists, so a lookup racing with the removal
+        //! of an entry only ever touches valid memory. Name strings are stored in a string arena instead of being allocated
+        //! one by one.
+        class NameDictionaryShard final
+        {
+        public:
+            using Hash = NameData::Hash;
+
+            NameDictionaryShard();
+            ~NameDictionaryShard();
+
+            //! Looks up the entry for a hash without locking and adds a reference to it.
+            //! @param hash The hash to search for.
+            //! @param result Set to the entry, with a reference added for the caller, or nullptr if there is no entry for the hash.
+            //! @return false if the lookup raced with the entry being removed and has to be repeated under the lock.
+            bool TryAcquire(Hash hash, NameData*& result);
+
+            //! The lock which has to be held to call any of the functions below.
+            AZStd::mutex& GetMutex();
+
+            //! Finds the entry for a hash.
+            NameData* Find(Hash hash) const;
+
+            //! Adds a new entry, there must not be an entry for the hash yet.
+            NameData* Insert(AZStd::string_view name, Hash hash, bool hashCollision);
+
+            //! Removes an entry which has been released (use count of -1) and recycles its memory.
+            //! Entries which aren't in this shard, leaked from a previously destroyed dictionary, are left alone.
+            void Erase(NameData* nameData);
+
+            //! Keeps the memory of all entries alive after the shard is destroyed, used when Names are still referencing
+            //! them as the dictionary is destroyed.
+            void LeakEntries();
+
+            size_t GetEntryCount() const;
+
+            template<typename Function>
+            void ForEachEntry(Function&& function) const;
+
+        private:
+            AZ_DISABLE_COPY_MOVE(NameDictionaryShard);
+
+            static constexpr uint32_t InitialCapacity = 16;
+            static constexpr size_t NameDataBlockSize = 256;
+            static constexpr size_t StringBlockSize = 16 * 1024;
+            static constexpr size_t MinArenaStringSize = 16;
+            static constexpr size_t StringSizeClassCount = 7; // 16 bytes up to 1KB, longer strings are allocated individually
+            static constexpr uintptr_t Tombstone = 1; // marks slots of removed entries
+
+            struct Slot
+            {
+                AZStd::atomic<Hash> m_hash{ 0 };
+                AZStd::atomic<NameData*> m_data{ nullptr };
+            };
+
+            struct Table
+            {
+                explicit Table(uint32_t capacity);
+
+                uint32_t GetHomeIndex(Hash hash) const;
+
+                uint32_t m_capacity;
+                uint32_t m_shift;
+                AZStd::unique_ptr<Slot[]> m_slots;
+            };
+
+            static bool IsEntry(const NameData* nameData);
+
+            void Rebuild(uint32_t capacity);
+            void ReclaimRetiredTables();
+
+            NameData* AllocateNameData();
+            char* AllocateString(size_t size);
+            void FreeString(char* string, size_t size);
+
+            AZStd::atomic<Table*> m_table{ nullptr };
+            AZStd::atomic_uint m_activeReaders{ 0 }; // lock free lookups in progress
+            mutable AZStd::mutex m_mutex;
+
+            // Everything below is guarded by m_mutex
+            AZStd::unique_ptr<Table> m_ownedTable;
+            AZStd::vector<AZStd::unique_ptr<Table>> m_retiredTables;
+            uint32_t m_entryCount = 0;
+            uint32_t m_usedSlotCount = 0; // entries and tombstones
+
+            AZStd::vector<NameData*> m_nameDataBlocks;
+            AZStd::vector<NameData*> m_freeNameData;
+
+            AZStd::vector<char*> m_stringBlocks;
+            char* m_stringCursor = nullptr;
+            size_t m_stringBlockRemaining = 0;
+            char* m_freeStrings[StringSizeClassCount] = {}; // free lists of recycled strings, linked through their first bytes
+            bool m_leakEntries = false;
+        };
+
+        inline bool NameDictionaryShard::IsEntry(const NameData* nameData)
+        {
+            return (nameData != nullptr) && (reinterpret_cast<uintptr_t>(nameData) != Tombstone);
+        }
+
+        template<typename Function>
+        void NameDictionaryShard::ForEachEntry(Function&& function) const
+        {
+            for (uint32_t index = 0; index < m_ownedTable->m_capacity; ++index)
+            {
+                NameData* nameData = m_ownedTable->m_slots[index].m_data.load(AZStd::memory_order_relaxed);
+                if (IsEntry(nameData))
+                {
+                    function(nameData);
+                }
+            }
+        }
+    }
+}
@@ -28,6 +28,22 @@ namespace AZ
         SetName(name);
     }
 
+    Name::Name(const NameLiteral& literal)
+    {
+        // Registers the literal if needed, only empty literals are left without an entry
+        literal.GetHash();
+        if (Internal::NameData* data = literal.m_data.load(AZStd::memory_order_acquire))
+        {
+            m_data = data;
+            m_view = data->GetName();
+            m_hash = data->GetHash();
+        }
+        else
+        {
+            SetEmptyString();
+        }
+    }
+
     Name::Name(Hash hash)
     {
         *this = NameDictionary::Instance().FindName(hash);
@@ -39,6 +55,12 @@ namespace AZ
         , m_hash{data->GetHash()}
     {}
 
+    Name::Name(Internal::NameData* data, bool addRef)
+        : m_data{data, addRef}
+        , m_view{data->GetName()}
+        , m_hash{data->GetHash()}
+    {}
+
     Name::Name(const Name& rhs)
     {
         *this = rhs;
@@ -139,6 +161,21 @@ namespace AZ
         return m_view.empty();
     }
 
+    NameLiteral::~NameLiteral()
+    {
+        // A registered literal implies the dictionary still exists, it releases all literals when it is destroyed
+        if (m_data.load(AZStd::memory_order_acquire))
+        {
+            NameDictionary::Instance().UnregisterLiteral(*this);
+        }
+    }
+
+    Name::Hash NameLiteral::Register() const
+    {
+        AZ_Assert(NameDictionary::IsReady(), "Attempted to use NameLiteral '%.*s' before the NameDictionary is ready.", AZ_STRING_ARG(m_name));
+        return NameDictionary::Instance().RegisterLiteral(*this);
+    }
+
     void Name::ScriptConstructor(Name* thisPtr, ScriptDataContext& dc)
     {
         int numArgs = dc.GetNumArguments();
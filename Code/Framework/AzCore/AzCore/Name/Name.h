@@ -13,6 +13,7 @@
 namespace AZ
 {
     class NameDictionary;
+    class NameLiteral;
     class ScriptDataContext;
     class ReflectContext;
 
@@ -48,6 +49,10 @@ namespace AZ
         //! internally held after the call.
         explicit Name(AZStd::string_view name);
 
+        //! Creates an instance of a name from a NameLiteral, registering the literal with the dictionary if it is used for
+        //! the first time.
+        Name(const NameLiteral& literal);
+
         //! Creates an instance of a name from a hash.
         //! The hash will be used to find an existing name in the dictionary. If there is no
         //! name with this hash, the resulting name will be empty.
@@ -89,6 +94,15 @@ namespace AZ
             return m_hash;
         }
 
+        //! Calculates the hash of a name string. This is the key the name is stored with in the NameDictionary, unless the
+        //! hash collides with the hash of another name.
+        static constexpr Hash CalcHash(AZStd::string_view name)
+        {
+            // AZStd::hash<AZStd::string_view> returns 64 bits but we want 32 bit hashes for the sake
+            // of network synchronization. So just take the low 32 bits.
+            return static_cast<Hash>(AZStd::hash<AZStd::string_view>()(name) & 0xFFFFFFFF);
+        }
+
     private:
         
         // Assigns a new name.  
@@ -102,6 +116,9 @@ namespace AZ
         // This constructor is used by NameDictionary to construct from a dictionary-held NameData instance.
         Name(Internal::NameData* nameData);
 
+        // This constructor is used by NameDictionary to take over a reference it has already added to a dictionary-held NameData instance.
+        Name(Internal::NameData* nameData, bool addRef);
+
         static void ScriptConstructor(Name* thisPtr, ScriptDataContext& dc);
 
         // Points to the string that represents the value of this name.
@@ -116,8 +133,88 @@ namespace AZ
         AZStd::intrusive_ptr<Internal::NameData> m_data;
     };
 
+    //! A name for a string literal, for names which are used repeatedly in hot code such as shader option or material
+    //! property names. The hash of the string is calculated at compile time and the string is only added to the
+    //! NameDictionary the first time the literal is used. After that, comparing the literal with a Name is as fast as
+    //! comparing two Names and converting it to a Name is as fast as copying one.
+    //!
+    //! The literal holds on to its dictionary entry until the NameDictionary is destroyed, and registers again with the
+    //! next dictionary when it is used. Literals must have static storage duration; use AZ_NAME_LITERAL in function
+    //! bodies, or declare them as static variables.
+    class NameLiteral final
+    {
+        friend Name;
+        friend NameDictionary;
+    public:
+        constexpr explicit NameLiteral(AZStd::string_view name)
+            : m_name(name)
+            , m_literalHash(Name::CalcHash(name))
+        {}
+
+        ~NameLiteral();
+
+        AZ_DISABLE_COPY_MOVE(NameLiteral);
+
+        AZStd::string_view GetStringView() const
+        {
+            return m_name;
+        }
+
+        //! Returns the hash calculated at compile time. This matches GetHash() unless the hash collides with another name.
+        Name::Hash GetLiteralHash() const
+        {
+            return m_literalHash;
+        }
+
+        //! Returns the hash of the name in the NameDictionary, registering the literal if it is used for the first time.
+        Name::Hash GetHash() const
+        {
+            return (m_data.load(AZStd::memory_order_acquire) != nullptr) ? m_hash : Register();
+        }
+
+        friend bool operator==(const Name& lhs, const NameLiteral& rhs)
+        {
+            return lhs.GetHash() == rhs.GetHash();
+        }
+
+        friend bool operator==(const NameLiteral& lhs, const Name& rhs)
+        {
+            return lhs.GetHash() == rhs.GetHash();
+        }
+
+        friend bool operator!=(const Name& lhs, const NameLiteral& rhs)
+        {
+            return lhs.GetHash() != rhs.GetHash();
+        }
+
+        friend bool operator!=(const NameLiteral& lhs, const Name& rhs)
+        {
+            return lhs.GetHash() != rhs.GetHash();
+        }
+
+    private:
+        // Adds the string to the NameDictionary and keeps a reference to its entry. Returns the hash of the entry.
+        Name::Hash Register() const;
+
+        AZStd::string_view m_name;
+        Name::Hash m_literalHash;
+
+        // Set when the literal is registered with the NameDictionary, m_hash is valid once m_data is set
+        mutable AZStd::atomic<Internal::NameData*> m_data{ nullptr };
+        mutable Name::Hash m_hash = 0;
+
+        // Registered literals are linked together so the dictionary can release them when it is destroyed
+        mutable const NameLiteral* m_previous = nullptr;
+        mutable const NameLiteral* m_next = nullptr;
+    };
+
 } // namespace AZ
 
+//! Creates a NameLiteral for a string literal in place, for example: if (name == AZ_NAME_LITERAL("o_enabled")).
+//! The hash is calculated at compile time and the string is registered with the NameDictionary on first use.
+#define AZ_NAME_LITERAL(str) \
+    ([]() -> const AZ::NameLiteral& { static const AZ::NameLiteral nameLiteral{ str }; return nameLiteral; }())
+
 namespace AZStd
 {
     template <typename T>
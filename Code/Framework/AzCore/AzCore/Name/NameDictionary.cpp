@@ -11,6 +11,7 @@
 #include <AzCore/std/hash.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/sort.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/Module/Environment.h>
 #include <cstring>
@@ -81,42 +82,71 @@ namespace AZ
 
     NameDictionary::~NameDictionary()
     {
+        // Literals register again with the next dictionary when they are used
+        while (m_literals)
+        {
+            UnregisterLiteral(*m_literals);
+        }
+
         bool leaksDetected = false;
 
-        for (const auto& keyValue : m_dictionary)
+        ForEachEntry([&leaksDetected](Internal::NameData* nameData)
         {
-            Internal::NameData* nameData = keyValue.second;
-            const int useCount = keyValue.second->m_useCount;
-            const bool hadCollision = keyValue.second->m_hashCollision;
+            const int useCount = nameData->m_useCount;
+            const bool hadCollision = nameData->m_hashCollision;
 
             if (useCount == 0)
             {
                 // Entries that had resolved hash collisions are allowed to remain in the dictionary until shutdown.
+                // Their memory is owned by the shards.
                 AZ_Assert(hadCollision, "Only colliding names are allowed to remain in the dictionary");
-                delete nameData;
             }
             else
             {
                 leaksDetected = true;
-                AZ_TracePrintf("NameDictionary", "\tLeaked Name [%3d reference(s)]: hash 0x%08X, '%.*s'\n", useCount, keyValue.first, AZ_STRING_ARG(keyValue.second->GetName()));
+                AZ_TracePrintf("NameDictionary", "\tLeaked Name [%3d reference(s)]: hash 0x%08X, '%.*s'\n", useCount, nameData->GetHash(), AZ_STRING_ARG(nameData->GetName()));
+            }
+        });
+
+        if (leaksDetected)
+        {
+            // Keep the leaked entries valid for the Names still referencing them
+            for (Internal::NameDictionaryShard& shard : m_shards)
+            {
+                shard.LeakEntries();
             }
         }
 
         AZ_Assert(!leaksDetected, "AZ::NameDictionary still has active name references. See debug output for the list of leaked names.");
     }
 
+    Internal::NameDictionaryShard& NameDictionary::GetShard(Name::Hash hash) const
+    {
+        return m_shards[hash & (ShardCount - 1)];
+    }
+
     Name NameDictionary::FindName(Name::Hash hash) const
     {
-        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
-        auto iter = m_dictionary.find(hash);
-        if (iter != m_dictionary.end())
+        Internal::NameDictionaryShard& shard = GetShard(hash);
+
+        Internal::NameData* nameData = nullptr;
+        if (shard.TryAcquire(hash, nameData))
         {
-            return Name(iter->second);
+            return nameData ? Name(nameData, false) : Name();
         }
-        return Name();
+
+        // The lookup raced with the entry being released, take the lock to get a definite answer
+        AZStd::lock_guard<AZStd::mutex> lock(shard.GetMutex());
+        nameData = shard.Find(hash);
+        return nameData ? Name(nameData) : Name();
     }
 
     Name NameDictionary::MakeName(AZStd::string_view nameString)
+    {
+        return MakeName(nameString, CalcHash(nameString));
+    }
+
+    Name NameDictionary::MakeName(AZStd::string_view nameString, Name::Hash originalHash)
     {
         // Null strings should return empty.
         if (nameString.empty())
@@ -124,44 +154,143 @@ namespace AZ
             return Name();
         }
 
-        Name::Hash hash = CalcHash(nameString);
+        Name::Hash hash = originalHash;
 
-        // If we find the same name with the same hash, just return it. 
-        // This path is faster than the loop below because FindName() takes a shared_lock whereas the
-        // loop requires a unique_lock to modify the dictionary.
-        Name name = FindName(hash);
-        if (name.GetStringView() == nameString)
+        // If we find the same name with the same hash, just return it. This path doesn't take any lock.
+        Name name;
+        if (TryFindName(nameString, hash, name))
         {
-            return AZStd::move(name);
+            return name;
         }
 
         // The name doesn't exist in the dictionary, so we have to lock and add it
-        AZStd::unique_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        return ResolveName(nameString, hash, hash != originalHash);
+    }
+
+    AZStd::vector<Name> NameDictionary::MakeNames(const AZStd::vector<AZStd::string_view>& names)
+    {
+        AZStd::vector<Name> result(names.size());
+
+        // Resolve the names which already exist without locking, and collect the others
+        struct PendingName
+        {
+            Name::Hash m_hash;
+            size_t m_index;
+            bool m_collisionDetected;
+        };
+        AZStd::vector<PendingName> pendingNames;
+        for (size_t index = 0; index < names.size(); ++index)
+        {
+            if (names[index].empty())
+            {
+                continue;
+            }
+
+            const Name::Hash originalHash = CalcHash(names[index]);
+            Name::Hash hash = originalHash;
+            if (!TryFindName(names[index], hash, result[index]))
+            {
+                pendingNames.push_back({ hash, index, hash != originalHash });
+            }
+        }
+
+        // Add the missing names, taking each shard's lock once
+        AZStd::sort(pendingNames.begin(), pendingNames.end(), [](const PendingName& lhs, const PendingName& rhs)
+        {
+            return (lhs.m_hash & (ShardCount - 1)) < (rhs.m_hash & (ShardCount - 1));
+        });
+
+        AZStd::vector<PendingName> collidingNames;
+        for (size_t first = 0; first < pendingNames.size();)
+        {
+            Internal::NameDictionaryShard& shard = GetShard(pendingNames[first].m_hash);
+            AZStd::lock_guard<AZStd::mutex> lock(shard.GetMutex());
+
+            size_t last = first;
+            for (; (last < pendingNames.size()) && (&GetShard(pendingNames[last].m_hash) == &shard); ++last)
+            {
+                const PendingName& pendingName = pendingNames[last];
+                const AZStd::string_view nameString = names[pendingName.m_index];
+
+                Internal::NameData* nameData = shard.Find(pendingName.m_hash);
+                if (!nameData)
+                {
+                    result[pendingName.m_index] = Name(shard.Insert(nameString, pendingName.m_hash, pendingName.m_collisionDetected));
+                }
+                else if (nameData->GetName() == nameString)
+                {
+                    result[pendingName.m_index] = Name(nameData);
+                }
+                else
+                {
+                    // Hash collision, the name has to be resolved in another shard
+                    nameData->m_hashCollision = true;
+                    collidingNames.push_back({ pendingName.m_hash + 1, pendingName.m_index, true });
+                }
+            }
+            first = last;
+        }
+
+        for (const PendingName& collidingName : collidingNames)
+        {
+            result[collidingName.m_index] = ResolveName(names[collidingName.m_index], collidingName.m_hash, collidingName.m_collisionDetected);
+        }
+
+        return result;
+    }
+
+    bool NameDictionary::TryFindName(AZStd::string_view nameString, Name::Hash& hash, Name& name) const
+    {
+        while (true)
+        {
+            Internal::NameData* nameData = nullptr;
+            if (!GetShard(hash).TryAcquire(hash, nameData) || !nameData)
+            {
+                return false;
+            }
+
+            name = Name(nameData, false);
+            if (name.GetStringView() == nameString)
+            {
+                return true;
+            }
+
+            // Entries which collided are never removed, so names which collided with them can be searched for at the next
+            // hash. Otherwise this is a new collision which has to be resolved under the lock.
+            const bool hashCollision = nameData->m_hashCollision;
+            name = Name();
+            if (!hashCollision)
+            {
+                return false;
+            }
+            ++hash;
+        }
+    }
 
-        auto iter = m_dictionary.find(hash);
-        bool collisionDetected = false;
+    Name NameDictionary::ResolveName(AZStd::string_view nameString, Name::Hash hash, bool collisionDetected)
+    {
         while (true)
         {
+            Internal::NameDictionaryShard& shard = GetShard(hash);
+            AZStd::lock_guard<AZStd::mutex> lock(shard.GetMutex());
+
+            Internal::NameData* nameData = shard.Find(hash);
             // No existing entry, add a new one and we're done
-            if (iter == m_dictionary.end())
+            if (!nameData)
             {
-                Internal::NameData* nameData = aznew Internal::NameData(nameString, hash);
-                nameData->m_hashCollision = collisionDetected;
-                m_dictionary.emplace(hash, nameData);
-                return Name(nameData);
+                return Name(shard.Insert(nameString, hash, collisionDetected));
             }
             // Found the desired entry, return it
-            else if (iter->second->GetName() == nameString)
+            else if (nameData->GetName() == nameString)
             {
-                return Name(iter->second);
+                return Name(nameData);
             }
             // Hash collision, try a new hash
             else
             {
                 collisionDetected = true;
-                iter->second->m_hashCollision = true; // Make sure the existing entry is flagged as colliding too
+                nameData->m_hashCollision = true; // Make sure the existing entry is flagged as colliding too
                 ++hash;
-                iter = m_dictionary.find(hash);
             }
         }
     }
@@ -185,27 +314,100 @@ namespace AZ
             return;
         }
 
-        AZStd::unique_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        {
+            Internal::NameDictionaryShard& shard = GetShard(nameData->GetHash());
+            AZStd::lock_guard<AZStd::mutex> lock(shard.GetMutex());
 
-        // Check m_hashCollision again inside the m_sharedMutex because a new collision could have happened
-        // on another thread before taking the lock.
-        if (nameData->m_hashCollision)
+            // Check m_hashCollision again inside the shard's mutex because a new collision could have happened
+            // on another thread before taking the lock.
+            if (nameData->m_hashCollision)
+            {
+                return;
+            }
+
+            // We need to check the count again in here in case
+            // someone was trying to get the name on another thread.
+            // Set it to -1 so only this thread will attempt to clean up the
+            // dictionary and recycle the name.
+            int32_t expectedRefCount = 0;
+            if (nameData->m_useCount.compare_exchange_strong(expectedRefCount, -1))
+            {
+                shard.Erase(nameData);
+            }
+        }
+
+        ReportStats();
+    }
+
+    Name::Hash NameDictionary::RegisterLiteral(const NameLiteral& literal)
+    {
+        const Name name = MakeName(literal.m_name, literal.m_literalHash);
+        if (name.IsEmpty())
         {
-            return;
+            return 0;
         }
 
-        // We need to check the count again in here in case
-        // someone was trying to get the name on another thread.
-        // Set it to -1 so only this thread will attempt to clean up the
-        // dictionary and delete the name.
-        int32_t expectedRefCount = 0;
-        if (nameData->m_useCount.compare_exchange_strong(expectedRefCount, -1))
+        AZStd::lock_guard<AZStd::mutex> lock(m_literalMutex);
+        // Another thread may have registered the literal in the meantime
+        if (!literal.m_data.load(AZStd::memory_order_relaxed))
         {
-            m_dictionary.erase(nameData->GetHash());
-            delete nameData;
+            Internal::NameData* nameData = name.m_data.get();
+            nameData->add_ref();
+
+            literal.m_previous = nullptr;
+            literal.m_next = m_literals;
+            if (m_literals)
+            {
+                m_literals->m_previous = &literal;
+            }
+            m_literals = &literal;
+
+            literal.m_hash = name.GetHash();
+            literal.m_data.store(nameData, AZStd::memory_order_release);
         }
+        return literal.m_hash;
+    }
 
-        ReportStats();
+    void NameDictionary::UnregisterLiteral(const NameLiteral& literal)
+    {
+        Internal::NameData* nameData = nullptr;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_literalMutex);
+            nameData = literal.m_data.exchange(nullptr, AZStd::memory_order_relaxed);
+            if (!nameData)
+            {
+                return;
+            }
+
+            if (literal.m_previous)
+            {
+                literal.m_previous->m_next = literal.m_next;
+            }
+            else
+            {
+                m_literals = literal.m_next;
+            }
+            if (literal.m_next)
+            {
+                literal.m_next->m_previous = literal.m_previous;
+            }
+            literal.m_previous = nullptr;
+            literal.m_next = nullptr;
+        }
+
+        // Released outside of the lock, this may remove the entry from the dictionary
+        nameData->release();
+    }
+
+    size_t NameDictionary::GetEntryCount() const
+    {
+        size_t entryCount = 0;
+        for (Internal::NameDictionaryShard& shard : m_shards)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(shard.GetMutex());
+            entryCount += shard.GetEntryCount();
+        }
+        return entryCount;
     }
 
     void NameDictionary::ReportStats() const
@@ -223,34 +425,36 @@ namespace AZ
             Internal::NameData* longestName = nullptr;
             Internal::NameData* mostRepeatedName = nullptr;
 
-            for (auto& iter : m_dictionary)
+            size_t nameCount = 0;
+            ForEachEntry([&](Internal::NameData* nameData)
             {
-                const size_t nameLength = iter.second->m_name.size();
+                const size_t nameLength = nameData->m_name.size();
+                ++nameCount;
                 actualStringMemoryUsed += nameLength;
-                potentialStringMemoryUsed += (nameLength * iter.second->m_useCount);
+                potentialStringMemoryUsed += (nameLength * nameData->m_useCount);
 
                 if (!longestName || longestName->m_name.size() < nameLength)
                 {
-                    longestName = iter.second;
+                    longestName = nameData;
                 }
 
                 if (!mostRepeatedName)
                 {
-                    mostRepeatedName = iter.second;
+                    mostRepeatedName = nameData;
                 }
                 else
                 {
                     const size_t mostIndividualSavings = mostRepeatedName->m_name.size() * (mostRepeatedName->m_useCount - 1);
-                    const size_t currentIndividualSavings = nameLength * (iter.second->m_useCount - 1);
+                    const size_t currentIndividualSavings = nameLength * (nameData->m_useCount - 1);
                     if (currentIndividualSavings > mostIndividualSavings)
                     {
-                        mostRepeatedName = iter.second;
+                        mostRepeatedName = nameData;
                     }
                 }
-            }
+            });
 
             AZ_TracePrintf("NameDictionary", "NameDictionary Stats\n");
-            AZ_TracePrintf("NameDictionary", "Names:              %d\n", m_dictionary.size());
+            AZ_TracePrintf("NameDictionary", "Names:              %d\n", nameCount);
             AZ_TracePrintf("NameDictionary", "Total chars:        %d\n", actualStringMemoryUsed);
             AZ_TracePrintf("NameDictionary", "Logical chars:      %d\n", potentialStringMemoryUsed);
             AZ_TracePrintf("NameDictionary", "Memory saved:       %d\n", potentialStringMemoryUsed - actualStringMemoryUsed);
@@ -275,9 +479,6 @@ namespace AZ
 
     Name::Hash NameDictionary::CalcHash(AZStd::string_view name)
     {
-        // AZStd::hash<AZStd::string_view> returns 64 bits but we want 32 bit hashes for the sake
-        // of network synchronization. So just take the low 32 bits.
-        const uint32_t hash = AZStd::hash<AZStd::string_view>()(name) & 0xFFFFFFFF;
-        return hash;
+        return Name::CalcHash(name);
     }
 }
@@ -8,13 +8,14 @@
 
 #pragma once
 
-#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/string/string_view.h>
-#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/parallel/lock.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/OSAllocator.h>
 #include <AzCore/Name/Name.h>
+#include <AzCore/Name/Internal/NameDictionaryShard.h>
 
 namespace MaterialEditor 
 {
@@ -43,12 +44,17 @@ namespace AZ
     //! Benchmarks have shown that creating a new Name object can be quite slow when the name doesn't 
     //! already exist in the NameDictionary, but is comparable to creating an AZStd::string for names 
     //! that already exist.
+    //!
+    //! The dictionary is split into shards by hash. Names which already exist are looked up without taking
+    //! any lock, so creating Names from many threads at once scales well. Adding a new name only locks the
+    //! shard it belongs to.
     class NameDictionary final
     {
         AZ_CLASS_ALLOCATOR(NameDictionary, AZ::OSAllocator, 0);
 
         friend Module;
         friend Name;
+        friend NameLiteral;
         friend Internal::NameData;
         friend UnitTest::NameDictionaryTester;
         
@@ -72,18 +78,55 @@ namespace AZ
         //! @return A Name instance. If the hash was not found, the Name will be empty.
         Name FindName(Name::Hash hash) const;
 
+        //! Makes Names for a batch of raw strings. This is equivalent to calling MakeName for each string, but
+        //! the strings which have to be added to the dictionary are grouped so each shard is locked only once.
+        //! 
+        //! @param names The names to resolve against the dictionary.
+        //! @return Name instances for each of the provided raw strings, in the same order.
+        AZStd::vector<Name> MakeNames(const AZStd::vector<AZStd::string_view>& names);
+
     private:
+        static constexpr uint32_t ShardCount = 32; // must be a power of two
+
+
         NameDictionary();
         ~NameDictionary();
 
         void ReportStats() const;
 
+        Internal::NameDictionaryShard& GetShard(Name::Hash hash) const;
+
+        // Looks up an existing name without locking. On failure, hash is set to the hash from which the name has to be
+        // resolved under the shard locks, skipping entries of other names it has collided with.
+        bool TryFindName(AZStd::string_view nameString, Name::Hash& hash, Name& name) const;
+
+        // Resolves a name under the shard locks, adding it to the dictionary if needed.
+        Name ResolveName(AZStd::string_view nameString, Name::Hash hash, bool collisionDetected);
+
+        // Makes a Name from a raw string whose hash has already been calculated.
+        Name MakeName(AZStd::string_view nameString, Name::Hash hash);
+
+        size_t GetEntryCount() const;
+
+        template<typename Function>
+        void ForEachEntry(Function&& function) const;
+
         //////////////////////////////////////////////////////////////////////////
         // Private API for NameData
 
         // Attempts to release the name from the dictionary, but checks to make sure
         // a reference wasn't taken by another thread.
         void TryReleaseName(Internal::NameData* data);
+
+        //////////////////////////////////////////////////////////////////////////
+        // Private API for NameLiteral
+
+        // Adds the literal's string to the dictionary and has the literal keep a reference to the entry.
+        // Returns the hash of the entry.
+        Name::Hash RegisterLiteral(const NameLiteral& literal);
+
+        // Releases the literal's reference to its entry.
+        void UnregisterLiteral(const NameLiteral& literal);
         
         //////////////////////////////////////////////////////////////////////////
 
@@ -91,7 +134,19 @@ namespace AZ
         // Does not attempt to resolve hash collisions; that is handled elsewhere.
         Name::Hash CalcHash(AZStd::string_view name);
                 
-        AZStd::unordered_map<Name::Hash, Internal::NameData*> m_dictionary;
-        mutable AZStd::shared_mutex m_sharedMutex;
+        mutable Internal::NameDictionaryShard m_shards[ShardCount];
+
+        AZStd::mutex m_literalMutex;
+        const NameLiteral* m_literals = nullptr; // registered literals, linked through NameLiteral::m_next
     };
+
+    template<typename Function>
+    void NameDictionary::ForEachEntry(Function&& function) const
+    {
+        for (Internal::NameDictionaryShard& shard : m_shards)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(shard.GetMutex());
+            shard.ForEachEntry(function);
+        }
+    }
 }
@@ -6,11 +6,39 @@
  *
  */
 
+#include <AzCore/JSON/pointer.h>
 #include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/string/conversions.h>
 
 namespace AZ
 {
+    SettingsRegistryInterface::PathHandle::PathHandle()
+        : PathHandle(AZStd::string_view{})
+    {
+    }
+
+    SettingsRegistryInterface::PathHandle::PathHandle(AZStd::string_view path)
+        : m_path(path)
+        , m_pointer(AZStd::make_shared<rapidjson::Pointer>(m_path.c_str(), m_path.length()))
+    {
+    }
+
+    bool SettingsRegistryInterface::PathHandle::IsValid() const
+    {
+        return m_pointer && m_pointer->IsValid();
+    }
+
+    AZStd::string_view SettingsRegistryInterface::PathHandle::GetPath() const
+    {
+        return m_path;
+    }
+
+    const rapidjson::Value* SettingsRegistryInterface::PathHandle::Resolve(const rapidjson::Value& root) const
+    {
+        return m_pointer ? m_pointer->Get(root) : nullptr;
+    }
+
     SettingsRegistryInterface::Specializations::Specializations(AZStd::initializer_list<AZStd::string_view> specializations)
     {
         for (AZStd::string_view specialization : specializations)
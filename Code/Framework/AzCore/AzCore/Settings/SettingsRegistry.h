@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AzCore/EBus/Event.h>
+#include <AzCore/JSON/fwd.h>
 #include <AzCore/Math/Uuid.h>
 #include <AzCore/std/functional.h>
 #include <AzCore/IO/SystemFile.h>
@@ -16,6 +17,7 @@
 #include <AzCore/RTTI/RTTI.h>
 #include <AzCore/std/containers/fixed_vector.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/string/string_view.h>
 #include <AzCore/StringFunc/StringFunc.h>
@@ -146,6 +148,38 @@ namespace AZ
             { AZ_UNUSED(path); AZ_UNUSED(valueName); AZ_UNUSED(type); AZ_UNUSED(value); }
         };
 
+        //! A path into the Settings Registry that's parsed once up front. Settings that are frequently queried can use a PathHandle
+        //! to avoid parsing the JSON pointer on every lookup. A default constructed PathHandle refers to the root of the registry.
+        class PathHandle
+        {
+        public:
+            PathHandle();
+            explicit PathHandle(AZStd::string_view path);
+
+            bool IsValid() const;
+            AZStd::string_view GetPath() const;
+            //! Finds the value this path points to, starting at the provided root. Returns null if the value doesn't exist.
+            const rapidjson::Value* Resolve(const rapidjson::Value& root) const;
+
+        private:
+            AZStd::string m_path;
+            AZStd::shared_ptr<const rapidjson::Pointer> m_pointer;
+        };
+
+        //! Immutable copy of the settings at a specific version of the Settings Registry. Snapshots can be read from any thread
+        //! without locking and remain valid for as long as they're referenced, even if the registry is updated afterwards.
+        class Snapshot
+        {
+        public:
+            virtual ~Snapshot() = default;
+
+            //! Returns the version of the Settings Registry the settings were copied from.
+            virtual u64 GetVersion() const = 0;
+            //! Returns the root of the copied settings. Use PathHandle::Resolve to look up values.
+            virtual const rapidjson::Value& GetSettings() const = 0;
+        };
+        using SnapshotPtr = AZStd::shared_ptr<const Snapshot>;
+
         SettingsRegistryInterface() = default;
         AZ_DISABLE_COPY_MOVE(SettingsRegistryInterface);
         virtual ~SettingsRegistryInterface() = default;
@@ -191,6 +225,14 @@ namespace AZ
         //! @return Whether or not the value was retrieved. An invalid path or type-mismatch will return false;
         virtual bool Get(AZStd::string& result, AZStd::string_view path) const = 0;
         virtual bool Get(FixedValueString& result, AZStd::string_view path) const = 0;
+        //! Same as the string based versions, but uses a path that was parsed up front.
+        virtual Type GetType(const PathHandle& path) const = 0;
+        virtual bool Get(bool& result, const PathHandle& path) const = 0;
+        virtual bool Get(s64& result, const PathHandle& path) const = 0;
+        virtual bool Get(u64& result, const PathHandle& path) const = 0;
+        virtual bool Get(double& result, const PathHandle& path) const = 0;
+        virtual bool Get(AZStd::string& result, const PathHandle& path) const = 0;
+        virtual bool Get(FixedValueString& result, const PathHandle& path) const = 0;
         //! Gets the object value at the provided path serialized to the target struct/class. Classes retrieved
         //! through this call needs to be registered with the Serialize Context.
         //! Prefer to use GetObject(T& result, AZStd::string_view path) over this one.
@@ -326,6 +368,11 @@ namespace AZ
         //! @param applyPatchSettings The ApplyPatchSettings which are using during JSON Merging
         virtual void SetApplyPatchSettings(const AZ::JsonApplyPatchSettings& applyPatchSettings) = 0;
         virtual void GetApplyPatchSettings(AZ::JsonApplyPatchSettings& applyPatchSettings) = 0;
+
+        //! Returns a snapshot of the current settings. Snapshots are shared until the registry is modified again.
+        virtual SnapshotPtr GetSnapshot() const = 0;
+        //! Returns the version of the settings, which is incremented every time the registry is modified.
+        virtual u64 GetVersion() const = 0;
     };
 
     inline SettingsRegistryInterface::Visitor::~Visitor() = default;
@@ -0,0 +1,428 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Math/Uuid.h>
+#include <AzCore/Settings/SettingsRegistryCache.h>
+
+namespace AZ::SettingsRegistryCache
+{
+    namespace Internal
+    {
+        // Change the version whenever the layout of the cache changes so old caches are rejected.
+        static constexpr u32 Magic = 0x43525341; // "ASRC" when read as little endian.
+        static constexpr u32 Version = 2;
+
+        struct Header
+        {
+            u32 m_magic;
+            u32 m_version;
+            u32 m_fileCount;
+            u32 m_rootKeyLength;
+        };
+
+        enum class ValueTag : u8
+        {
+            Null,
+            False,
+            True,
+            Int64,
+            Uint64,
+            Double,
+            String,
+            Array,
+            Object
+        };
+
+        template<typename T>
+        static void Append(AZStd::vector<char>& output, T value)
+        {
+            const char* bytes = reinterpret_cast<const char*>(&value);
+            output.insert(output.end(), bytes, bytes + sizeof(T));
+        }
+
+        static void AppendString(AZStd::vector<char>& output, const char* text, u32 length)
+        {
+            Append(output, length);
+            output.insert(output.end(), text, text + length);
+        }
+
+        template<typename T>
+        static bool Extract(T& value, const char*& data, const char* end)
+        {
+            if (aznumeric_cast<size_t>(end - data) < sizeof(T))
+            {
+                return false;
+            }
+            memcpy(&value, data, sizeof(T));
+            data += sizeof(T);
+            return true;
+        }
+
+        static bool ExtractString(AZStd::string_view& value, const char*& data, const char* end)
+        {
+            u32 length;
+            if (!Extract(length, data, end) || aznumeric_cast<size_t>(end - data) < length)
+            {
+                return false;
+            }
+            value = AZStd::string_view(data, length);
+            data += length;
+            return true;
+        }
+
+        static u64 HashString(u64 hash, AZStd::string_view value)
+        {
+            // FNV-1a. A zero is mixed in after every string so the separation between strings is part of the hash.
+            constexpr u64 prime = 0x100000001b3ull;
+            for (char c : value)
+            {
+                hash = (hash ^ static_cast<u8>(c)) * prime;
+            }
+            return hash * prime;
+        }
+    } // namespace Internal
+
+    u64 CalculateKey(AZStd::string_view folderPath, const SettingsRegistryInterface::Specializations& specializations,
+        AZStd::string_view platform, AZStd::string_view rootKey)
+    {
+        u64 hash = 0xcbf29ce484222325ull;
+        hash = Internal::HashString(hash, folderPath);
+        hash = Internal::HashString(hash, platform);
+        hash = Internal::HashString(hash, rootKey);
+        const size_t specializationCount = specializations.GetCount();
+        for (size_t i = 0; i < specializationCount; ++i)
+        {
+            hash = Internal::HashString(hash, specializations.GetSpecialization(i));
+        }
+        return hash;
+    }
+
+    u64 CalculateContentHash(const char* data, size_t size)
+    {
+        // FNV-1a, registry files are small enough that this is cheap compared to parsing them.
+        constexpr u64 prime = 0x100000001b3ull;
+        u64 hash = 0xcbf29ce484222325ull;
+        for (const char* end = data + size; data != end; ++data)
+        {
+            hash = (hash ^ static_cast<u8>(*data)) * prime;
+        }
+        return hash;
+    }
+
+    bool CalculateFileContentHash(u64& hash, const char* path, AZStd::vector<char>& scratchBuffer)
+    {
+        IO::SystemFile file;
+        if (!file.Open(path, IO::SystemFile::OpenMode::SF_OPEN_READ_ONLY))
+        {
+            return false;
+        }
+
+        const u64 fileSize = file.Length();
+        scratchBuffer.clear();
+        scratchBuffer.resize_no_construct(fileSize);
+        if (file.Read(fileSize, scratchBuffer.data()) != fileSize)
+        {
+            return false;
+        }
+        hash = CalculateContentHash(scratchBuffer.data(), scratchBuffer.size());
+        return true;
+    }
+
+    void StoreValue(AZStd::vector<char>& output, const rapidjson::Value& value)
+    {
+        using namespace Internal;
+
+        switch (value.GetType())
+        {
+        case rapidjson::kNullType:
+            Append(output, ValueTag::Null);
+            break;
+        case rapidjson::kFalseType:
+            Append(output, ValueTag::False);
+            break;
+        case rapidjson::kTrueType:
+            Append(output, ValueTag::True);
+            break;
+        case rapidjson::kNumberType:
+            if (value.IsDouble())
+            {
+                Append(output, ValueTag::Double);
+                Append(output, value.GetDouble());
+            }
+            else if (value.IsInt64())
+            {
+                Append(output, ValueTag::Int64);
+                Append(output, value.GetInt64());
+            }
+            else
+            {
+                Append(output, ValueTag::Uint64);
+                Append(output, value.GetUint64());
+            }
+            break;
+        case rapidjson::kStringType:
+            Append(output, ValueTag::String);
+            AppendString(output, value.GetString(), value.GetStringLength());
+            break;
+        case rapidjson::kArrayType:
+            Append(output, ValueTag::Array);
+            Append(output, aznumeric_cast<u32>(value.Size()));
+            for (const rapidjson::Value& element : value.GetArray())
+            {
+                StoreValue(output, element);
+            }
+            break;
+        case rapidjson::kObjectType:
+            Append(output, ValueTag::Object);
+            Append(output, aznumeric_cast<u32>(value.MemberCount()));
+            for (const auto& member : value.GetObject())
+            {
+                AppendString(output, member.name.GetString(), member.name.GetStringLength());
+                StoreValue(output, member.value);
+            }
+            break;
+        }
+    }
+
+    bool LoadValue(rapidjson::Value& output, rapidjson::Document::AllocatorType& allocator, const char*& data, const char* end)
+    {
+        using namespace Internal;
+
+        ValueTag tag;
+        if (!Extract(tag, data, end))
+        {
+            return false;
+        }
+
+        switch (tag)
+        {
+        case ValueTag::Null:
+            output.SetNull();
+            return true;
+        case ValueTag::False:
+            output.SetBool(false);
+            return true;
+        case ValueTag::True:
+            output.SetBool(true);
+            return true;
+        case ValueTag::Int64:
+        {
+            s64 value;
+            if (!Extract(value, data, end))
+            {
+                return false;
+            }
+            output.SetInt64(value);
+            return true;
+        }
+        case ValueTag::Uint64:
+        {
+            u64 value;
+            if (!Extract(value, data, end))
+            {
+                return false;
+            }
+            output.SetUint64(value);
+            return true;
+        }
+        case ValueTag::Double:
+        {
+            double value;
+            if (!Extract(value, data, end))
+            {
+                return false;
+            }
+            output.SetDouble(value);
+            return true;
+        }
+        case ValueTag::String:
+        {
+            AZStd::string_view value;
+            if (!ExtractString(value, data, end))
+            {
+                return false;
+            }
+            output.SetString(value.data(), aznumeric_caster(value.length()), allocator);
+            return true;
+        }
+        case ValueTag::Array:
+        {
+            u32 count;
+            // Every entry takes at least one byte, which guards against reserving huge amounts of memory for corrupted data.
+            if (!Extract(count, data, end) || count > aznumeric_cast<size_t>(end - data))
+            {
+                return false;
+            }
+            output.SetArray();
+            output.Reserve(count, allocator);
+            for (u32 i = 0; i < count; ++i)
+            {
+                rapidjson::Value element;
+                if (!LoadValue(element, allocator, data, end))
+                {
+                    return false;
+                }
+                output.PushBack(AZStd::move(element), allocator);
+            }
+            return true;
+        }
+        case ValueTag::Object:
+        {
+            u32 count;
+            // Every entry takes at least one byte, which guards against reserving huge amounts of memory for corrupted data.
+            if (!Extract(count, data, end) || count > aznumeric_cast<size_t>(end - data))
+            {
+                return false;
+            }
+            output.SetObject();
+            output.MemberReserve(count, allocator);
+            for (u32 i = 0; i < count; ++i)
+            {
+                AZStd::string_view name;
+                rapidjson::Value value;
+                if (!ExtractString(name, data, end) || !LoadValue(value, allocator, data, end))
+                {
+                    return false;
+                }
+                output.AddMember(rapidjson::Value(name.data(), aznumeric_caster(name.length()), allocator), AZStd::move(value), allocator);
+            }
+            return true;
+        }
+        default:
+            return false;
+        }
+    }
+
+    Writer::Writer(AZStd::string_view rootKey)
+        : m_rootKeyLength(aznumeric_cast<u32>(rootKey.length()))
+    {
+        // The root key is stored directly after the header, followed by the files.
+        m_buffer.insert(m_buffer.end(), rootKey.begin(), rootKey.end());
+    }
+
+    void Writer::AddFile(AZStd::string_view path, u64 fileSize, u64 modificationTime, u64 contentHash, bool isPatch,
+        const rapidjson::Value& content)
+    {
+        using namespace Internal;
+
+        AppendString(m_buffer, path.data(), aznumeric_cast<u32>(path.length()));
+        Append(m_buffer, fileSize);
+        Append(m_buffer, modificationTime);
+        Append(m_buffer, contentHash);
+        Append(m_buffer, static_cast<u8>(isPatch ? 1 : 0));
+
+        // Reserve space for the size of the content so it can be filled in after the content has been stored.
+        const size_t sizeOffset = m_buffer.size();
+        Append(m_buffer, u64{ 0 });
+        StoreValue(m_buffer, content);
+        const u64 contentSize = m_buffer.size() - sizeOffset - sizeof(u64);
+        memcpy(m_buffer.data() + sizeOffset, &contentSize, sizeof(u64));
+
+        m_fileCount++;
+    }
+
+    bool Writer::WriteToFile(const char* cachePath) const
+    {
+        using namespace AZ::IO;
+
+        AZ::IO::FixedMaxPathString tempPath = AZ::IO::FixedMaxPathString::format("%s.%s.tmp", cachePath,
+            AZ::Uuid::CreateRandom().ToString<AZStd::fixed_string<64>>(false, false).c_str());
+
+        SystemFile file;
+        if (!file.Open(tempPath.c_str(), SystemFile::SF_OPEN_CREATE | SystemFile::SF_OPEN_CREATE_PATH | SystemFile::SF_OPEN_WRITE_ONLY))
+        {
+            return false;
+        }
+
+        Internal::Header header;
+        header.m_magic = Internal::Magic;
+        header.m_version = Internal::Version;
+        header.m_fileCount = m_fileCount;
+        header.m_rootKeyLength = m_rootKeyLength;
+
+        bool result = file.Write(&header, sizeof(header)) == sizeof(header) &&
+            file.Write(m_buffer.data(), m_buffer.size()) == m_buffer.size();
+        file.Close();
+
+        result = result && SystemFile::Rename(tempPath.c_str(), cachePath, true);
+        if (!result)
+        {
+            SystemFile::Delete(tempPath.c_str());
+        }
+        return result;
+    }
+
+    bool Reader::Open(const char* cachePath, AZStd::string_view rootKey)
+    {
+        const u64 fileSize = IO::SystemFile::Length(cachePath);
+        if (fileSize < sizeof(Internal::Header))
+        {
+            return false;
+        }
+
+        m_view = IO::MappedFileView::Create(cachePath, 0, fileSize);
+        if (!m_view)
+        {
+            return false;
+        }
+
+        m_cursor = reinterpret_cast<const char*>(m_view->GetData());
+        m_end = m_cursor + m_view->GetSize();
+
+        Internal::Header header;
+        if (!Internal::Extract(header, m_cursor, m_end) ||
+            header.m_magic != Internal::Magic ||
+            header.m_version != Internal::Version ||
+            aznumeric_cast<size_t>(m_end - m_cursor) < header.m_rootKeyLength ||
+            AZStd::string_view(m_cursor, header.m_rootKeyLength) != rootKey)
+        {
+            m_view.reset();
+            return false;
+        }
+
+        m_cursor += header.m_rootKeyLength;
+        m_fileCount = header.m_fileCount;
+        m_readCount = 0;
+        return true;
+    }
+
+    u32 Reader::GetFileCount() const
+    {
+        return m_fileCount;
+    }
+
+    bool Reader::ReadEntry(Entry& entry)
+    {
+        using namespace Internal;
+
+        if (!m_view || m_readCount >= m_fileCount)
+        {
+            return false;
+        }
+
+        u8 isPatch;
+        if (!ExtractString(entry.m_path, m_cursor, m_end) ||
+            !Extract(entry.m_fileSize, m_cursor, m_end) ||
+            !Extract(entry.m_modificationTime, m_cursor, m_end) ||
+            !Extract(entry.m_contentHash, m_cursor, m_end) ||
+            !Extract(isPatch, m_cursor, m_end) ||
+            !Extract(entry.m_contentSize, m_cursor, m_end) ||
+            aznumeric_cast<u64>(m_end - m_cursor) < entry.m_contentSize)
+        {
+            return false;
+        }
+        entry.m_isPatch = isPatch != 0;
+        entry.m_content = m_cursor;
+        m_cursor += entry.m_contentSize;
+        m_readCount++;
+        return true;
+    }
+} // namespace AZ::SettingsRegistryCache
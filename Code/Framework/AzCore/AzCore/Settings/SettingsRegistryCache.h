@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/IO/MappedFileView.h>
+#include <AzCore/JSON/document.h>
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string_view.h>
+
+//! The Settings Registry merge cache stores the already parsed content of all registry files that were merged from a
+//! registry folder in a compact binary form. The next time the same folder is merged with the same specializations,
+//! the files are loaded from the memory-mapped cache instead of being read and parsed as JSON again. A cache is only
+//! used if every file it contains still has the same size, modification time and content hash and no files were added
+//! or removed.
+namespace AZ::SettingsRegistryCache
+{
+    inline constexpr char FileExtension[] = ".setregcache";
+
+    //! Calculates the key that identifies the cache for merging a registry folder. The key is used as the cache's file name.
+    u64 CalculateKey(AZStd::string_view folderPath, const SettingsRegistryInterface::Specializations& specializations,
+        AZStd::string_view platform, AZStd::string_view rootKey);
+
+    //! Calculates the hash of the raw content of a registry file, as stored in the cache to detect changed files.
+    u64 CalculateContentHash(const char* data, size_t size);
+    //! Reads the registry file at the path into the scratch buffer and calculates the hash of its content. Returns false if
+    //! the file couldn't be read.
+    bool CalculateFileContentHash(u64& hash, const char* path, AZStd::vector<char>& scratchBuffer);
+
+    //! Appends a binary encoding of the JSON value to the output.
+    void StoreValue(AZStd::vector<char>& output, const rapidjson::Value& value);
+    //! Decodes a value stored with StoreValue, starting at data and moving data to the end of the value. Returns false if the
+    //! encoded value is incomplete or corrupted.
+    bool LoadValue(rapidjson::Value& output, rapidjson::Document::AllocatorType& allocator, const char*& data, const char* end);
+
+    //! Collects the parsed registry files for a single folder merge and writes them to a cache file.
+    class Writer
+    {
+    public:
+        explicit Writer(AZStd::string_view rootKey);
+
+        //! Adds a registry file. Files need to be added in the order they're merged.
+        void AddFile(AZStd::string_view path, u64 fileSize, u64 modificationTime, u64 contentHash, bool isPatch,
+            const rapidjson::Value& content);
+        //! Writes the cache to disk. The cache is first written to a temporary file and then moved into place, so other
+        //! processes that are merging the same folder never see a partially written cache.
+        bool WriteToFile(const char* cachePath) const;
+
+    private:
+        AZStd::vector<char> m_buffer;
+        u32 m_rootKeyLength{ 0 };
+        u32 m_fileCount{ 0 };
+    };
+
+    //! Provides access to a memory-mapped cache file.
+    class Reader
+    {
+    public:
+        struct Entry
+        {
+            AZStd::string_view m_path;
+            u64 m_fileSize{ 0 };
+            u64 m_modificationTime{ 0 };
+            u64 m_contentHash{ 0 };
+            const char* m_content{ nullptr };
+            u64 m_contentSize{ 0 };
+            bool m_isPatch{ false };
+        };
+
+        //! Maps the cache file. Returns false if the file doesn't exist, is corrupted or was created with a different root key.
+        bool Open(const char* cachePath, AZStd::string_view rootKey);
+
+        u32 GetFileCount() const;
+        //! Reads the next entry in the cache. Entries are returned in the order they were added. Returns false if there are
+        //! no more entries or if the cache is corrupted.
+        bool ReadEntry(Entry& entry);
+
+    private:
+        IO::MappedFileViewPtr m_view;
+        const char* m_cursor{ nullptr };
+        const char* m_end{ nullptr };
+        u32 m_fileCount{ 0 };
+        u32 m_readCount{ 0 };
+    };
+} // namespace AZ::SettingsRegistryCache
@@ -10,15 +10,46 @@
 #include <cerrno>
 #include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/JSON/error/en.h>
+#include <AzCore/Memory/OSAllocator.h>
 #include <AzCore/NativeUI//NativeUIRequests.h>
 #include <AzCore/Serialization/Json/JsonSerialization.h>
 #include <AzCore/Serialization/Json/StackedString.h>
+#include <AzCore/Settings/SettingsRegistryCache.h>
 #include <AzCore/Settings/SettingsRegistryImpl.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/parallel/thread.h>
 
 namespace AZ
 {
+    namespace
+    {
+        class RegistrySnapshot final
+            : public SettingsRegistryInterface::Snapshot
+        {
+        public:
+            RegistrySnapshot(u64 version, const rapidjson::Value& settings)
+                : m_version(version)
+            {
+                m_settings.CopyFrom(settings, m_settings.GetAllocator(), true);
+            }
+
+            u64 GetVersion() const override
+            {
+                return m_version;
+            }
+
+            const rapidjson::Value& GetSettings() const override
+            {
+                return m_settings;
+            }
+
+        private:
+            rapidjson::Document m_settings;
+            u64 m_version;
+        };
+    } // namespace
+
     template<typename T>
     bool SettingsRegistryImpl::SetValueInternal(AZStd::string_view path, T value, SettingsRegistryInterface::Type type)
     {
@@ -32,6 +63,7 @@ namespace AZ
         rapidjson::Pointer pointer(path.data(), path.length());
         if (pointer.IsValid())
         {
+            ScopedWrite write(*this, false);
             if constexpr (AZStd::is_same_v<T, bool> || AZStd::is_same_v<T, double>)
             {
                 pointer.Set(m_settings, value);
@@ -63,65 +95,115 @@ namespace AZ
     }
 
     template<typename T>
-    bool SettingsRegistryImpl::GetValueInternal(T& result, AZStd::string_view path) const
+    bool SettingsRegistryImpl::ExtractValue(T& result, const rapidjson::Value* value)
     {
-        if (path.empty())
+        if constexpr (AZStd::is_same_v<T, bool>)
         {
-            // rapidjson::Pointer assets that the supplied string
-            // is not nullptr even if the supplied size is 0
-            // Setting to empty string to prevent assert
-            path = "";
-        }
-        rapidjson::Pointer pointer(path.data(), path.length());
-        if (pointer.IsValid())
-        {
-            const rapidjson::Value* value = pointer.Get(m_settings);
-            if constexpr (AZStd::is_same_v<T, bool>)
+            if (value && value->IsBool())
             {
-                if (value && value->IsBool())
-                {
-                    result = value->GetBool();
-                    return true;
-                }
+                result = value->GetBool();
+                return true;
             }
-            else if constexpr (AZStd::is_same_v<T, s64>)
+        }
+        else if constexpr (AZStd::is_same_v<T, s64>)
+        {
+            if (value && value->IsInt64())
             {
-                if (value && value->IsInt64())
-                {
-                    result = value->GetInt64();
-                    return true;
-                }
+                result = value->GetInt64();
+                return true;
             }
-            else if constexpr (AZStd::is_same_v<T, u64>)
+        }
+        else if constexpr (AZStd::is_same_v<T, u64>)
+        {
+            if (value && value->IsUint64())
             {
-                if (value && value->IsUint64())
-                {
-                    result = value->GetUint64();
-                    return true;
-                }
+                result = value->GetUint64();
+                return true;
             }
-            else if constexpr (AZStd::is_same_v<T, double>)
+        }
+        else if constexpr (AZStd::is_same_v<T, double>)
+        {
+            if (value && value->IsDouble())
             {
-                if (value && value->IsDouble())
-                {
-                    result = value->GetDouble();
-                    return true;
-                }
+                result = value->GetDouble();
+                return true;
             }
-            else if constexpr (AZStd::is_same_v<T, AZStd::string> || AZStd::is_same_v<T, SettingsRegistryInterface::FixedValueString>)
+        }
+        else if constexpr (AZStd::is_same_v<T, AZStd::string> || AZStd::is_same_v<T, SettingsRegistryInterface::FixedValueString>)
+        {
+            if (value && value->IsString())
             {
-                if (value && value->IsString())
-                {
-                    result.append(value->GetString(), value->GetStringLength());
-                    return true;
-                }
+                result.append(value->GetString(), value->GetStringLength());
+                return true;
             }
-            else
+        }
+        else
+        {
+            static_assert(!AZStd::is_same_v<T,T>, "SettingsRegistryImpl::ExtractValue called with unsupported type.");
+        }
+        return false;
+    }
+
+    template<typename T>
+    bool SettingsRegistryImpl::GetValueInternal(T& result, AZStd::string_view path) const
+    {
+        if (path.empty())
+        {
+            // rapidjson::Pointer assets that the supplied string
+            // is not nullptr even if the supplied size is 0
+            // Setting to empty string to prevent assert
+            path = "";
+        }
+        rapidjson::Pointer pointer(path.data(), path.length());
+        if (pointer.IsValid())
+        {
+            return ExtractValue(result, pointer.Get(m_settings));
+        }
+        return false;
+    }
+
+    template<typename T>
+    bool SettingsRegistryImpl::GetValueInternal(T& result, const PathHandle& path) const
+    {
+        if (!path.IsValid())
+        {
+            return false;
+        }
+
+        if (SnapshotPtr snapshot = GetPublishedSnapshot(); snapshot)
+        {
+            return ExtractValue(result, path.Resolve(snapshot->GetSettings()));
+        }
+
+        AZStd::scoped_lock lock(m_settingMutex);
+        return ExtractValue(result, path.Resolve(m_settings));
+    }
+
+    SettingsRegistryInterface::Type SettingsRegistryImpl::GetValueType(const rapidjson::Value* value)
+    {
+        if (value)
+        {
+            switch (value->GetType())
             {
-                static_assert(!AZStd::is_same_v<T,T>, "SettingsRegistryImpl::GetValueInternal called with unsupported type.");
+            case rapidjson::Type::kNullType:
+                return Type::Null;
+            case rapidjson::Type::kFalseType:
+                return Type::Boolean;
+            case rapidjson::Type::kTrueType:
+                return Type::Boolean;
+            case rapidjson::Type::kObjectType:
+                return Type::Object;
+            case rapidjson::Type::kArrayType:
+                return Type::Array;
+            case rapidjson::Type::kStringType:
+                return Type::String;
+            case rapidjson::Type::kNumberType:
+                return
+                    value->IsDouble() ? Type::FloatingPoint :
+                    Type::Integer;
             }
         }
-        return false;
+        return Type::NoType;
     }
 
     SettingsRegistryImpl::SettingsRegistryImpl()
@@ -244,29 +326,7 @@ namespace AZ
         rapidjson::Pointer pointer(path.data(), path.length());
         if (pointer.IsValid())
         {
-            const rapidjson::Value* value = pointer.Get(m_settings);
-            if (value)
-            {
-                switch (value->GetType())
-                {
-                case rapidjson::Type::kNullType:
-                    return Type::Null;
-                case rapidjson::Type::kFalseType:
-                    return Type::Boolean;
-                case rapidjson::Type::kTrueType:
-                    return Type::Boolean;
-                case rapidjson::Type::kObjectType:
-                    return Type::Object;
-                case rapidjson::Type::kArrayType:
-                    return Type::Array;
-                case rapidjson::Type::kStringType:
-                    return Type::String;
-                case rapidjson::Type::kNumberType:
-                    return 
-                        value->IsDouble() ? Type::FloatingPoint :
-                        Type::Integer;
-                }
-            }
+            return GetValueType(pointer.Get(m_settings));
         }
         return Type::NoType;
     }
@@ -307,6 +367,148 @@ namespace AZ
         return GetValueInternal(result, path);
     }
 
+    SettingsRegistryInterface::Type SettingsRegistryImpl::GetType(const PathHandle& path) const
+    {
+        if (!path.IsValid())
+        {
+            return Type::NoType;
+        }
+
+        if (SnapshotPtr snapshot = GetPublishedSnapshot(); snapshot)
+        {
+            return GetValueType(path.Resolve(snapshot->GetSettings()));
+        }
+
+        AZStd::scoped_lock lock(m_settingMutex);
+        return GetValueType(path.Resolve(m_settings));
+    }
+
+    bool SettingsRegistryImpl::Get(bool& result, const PathHandle& path) const
+    {
+        return GetValueInternal(result, path);
+    }
+
+    bool SettingsRegistryImpl::Get(s64& result, const PathHandle& path) const
+    {
+        return GetValueInternal(result, path);
+    }
+
+    bool SettingsRegistryImpl::Get(u64& result, const PathHandle& path) const
+    {
+        return GetValueInternal(result, path);
+    }
+
+    bool SettingsRegistryImpl::Get(double& result, const PathHandle& path) const
+    {
+        return GetValueInternal(result, path);
+    }
+
+    bool SettingsRegistryImpl::Get(AZStd::string& result, const PathHandle& path) const
+    {
+        return GetValueInternal(result, path);
+    }
+
+    bool SettingsRegistryImpl::Get(FixedValueString& result, const PathHandle& path) const
+    {
+        return GetValueInternal(result, path);
+    }
+
+    auto SettingsRegistryImpl::GetSnapshot() const -> SnapshotPtr
+    {
+        AZStd::scoped_lock lock(m_settingMutex);
+
+        if (SnapshotPtr snapshot = GetPublishedSnapshot(); snapshot)
+        {
+            return snapshot;
+        }
+
+        // Only the thread doing a write can get here while it's in progress, for instance from a notifier. The copy reflects what
+        // that thread can see, but the write isn't finished so it can't be shared with other readers.
+        SnapshotPtr snapshot = CreateSnapshot();
+        if (m_activeWrites.load(AZStd::memory_order_acquire) == 0)
+        {
+            PublishSnapshot(snapshot);
+        }
+        return snapshot;
+    }
+
+    u64 SettingsRegistryImpl::GetVersion() const
+    {
+        return m_version.load(AZStd::memory_order_acquire);
+    }
+
+    auto SettingsRegistryImpl::GetPublishedSnapshot() const -> SnapshotPtr
+    {
+        // The slot index is checked again after the slot has been pinned. If it changed in between, the writer may already be
+        // replacing the snapshot in the slot, so try again with the newly published slot.
+        SnapshotPtr snapshot;
+        for (;;)
+        {
+            const u32 slotIndex = m_publishedSnapshotSlot.load();
+            SnapshotSlot& slot = m_snapshotSlots[slotIndex];
+            slot.m_readers.fetch_add(1);
+            const bool isPublished = m_publishedSnapshotSlot.load() == slotIndex;
+            if (isPublished)
+            {
+                snapshot = slot.m_snapshot;
+            }
+            slot.m_readers.fetch_sub(1);
+            if (isPublished)
+            {
+                break;
+            }
+        }
+
+        // Writers increment the version before they start modifying the settings and again once they're done, so a snapshot
+        // with a matching version can't be missing any completed updates or contain a partial one.
+        return snapshot && snapshot->GetVersion() == m_version.load(AZStd::memory_order_acquire) ? snapshot : nullptr;
+    }
+
+    auto SettingsRegistryImpl::CreateSnapshot() const -> SnapshotPtr
+    {
+        return AZStd::allocate_shared<RegistrySnapshot>(AZ::OSStdAllocator(), m_version.load(AZStd::memory_order_acquire), m_settings);
+    }
+
+    void SettingsRegistryImpl::PublishSnapshot(SnapshotPtr snapshot) const
+    {
+        // Publishing is serialized by m_settingMutex, so only readers can touch the slots concurrently. Readers that pinned the
+        // slot before it was retired by the previous publish are still copying the snapshot out of it, which takes very little time.
+        const u32 slotIndex = (m_publishedSnapshotSlot.load() + 1) % SnapshotSlotCount;
+        SnapshotSlot& slot = m_snapshotSlots[slotIndex];
+        while (slot.m_readers.load() != 0)
+        {
+            AZStd::this_thread::yield();
+        }
+        slot.m_snapshot = AZStd::move(snapshot);
+        m_publishedSnapshotSlot.store(slotIndex);
+    }
+
+    void SettingsRegistryImpl::SetMergeCacheFolder(AZStd::string_view cacheFolder)
+    {
+        AZStd::scoped_lock lock(m_settingMutex);
+        m_mergeCacheFolder = cacheFolder;
+    }
+
+    SettingsRegistryImpl::ScopedWrite::ScopedWrite(SettingsRegistryImpl& registry, bool publishSnapshot)
+        : m_registry(registry)
+    {
+        m_registry.m_activeWrites.fetch_add(1, AZStd::memory_order_acq_rel);
+        m_registry.m_version.fetch_add(1, AZStd::memory_order_acq_rel);
+        m_registry.m_publishPending = m_registry.m_publishPending || publishSnapshot;
+    }
+
+    SettingsRegistryImpl::ScopedWrite::~ScopedWrite()
+    {
+        m_registry.m_version.fetch_add(1, AZStd::memory_order_acq_rel);
+        if (m_registry.m_activeWrites.fetch_sub(1, AZStd::memory_order_acq_rel) == 1 && m_registry.m_publishPending)
+        {
+            // Merges typically touch many settings and happen in bulk during startup, when lookups are also the most frequent, so
+            // publish right away instead of making the first reader after the merge take the lock and do the copy.
+            m_registry.m_publishPending = false;
+            m_registry.PublishSnapshot(m_registry.CreateSnapshot());
+        }
+    }
+
     bool SettingsRegistryImpl::GetObject(void* result, Uuid resultTypeID, AZStd::string_view path) const
     {
         if (path.empty())
@@ -386,6 +588,7 @@ namespace AZ
                 value, nullptr, valueTypeID, m_serializationSettings);
             if (jsonResult.GetProcessing() != JsonSerializationResult::Processing::Halted)
             {
+                ScopedWrite write(*this, false);
                 rapidjson::Value& setting = pointer.Create(m_settings, m_settings.GetAllocator());
                 setting = AZStd::move(store);
                 m_notifiers.Signal(path, Type::Object);
@@ -411,6 +614,7 @@ namespace AZ
             return false;
         }
 
+        ScopedWrite write(*this, false);
         return pointerPath.Erase(m_settings);
     }
 
@@ -531,6 +735,7 @@ namespace AZ
         }
 
         AZStd::scoped_lock lock(m_settingMutex);
+        ScopedWrite write(*this, true);
 
         JsonSerializationResult::ResultCode mergeResult =
             JsonSerialization::ApplyPatch(m_settings, m_settings.GetAllocator(), jsonPatch, mergeApproach);
@@ -563,6 +768,7 @@ namespace AZ
         }
 
         AZStd::scoped_lock lock(m_settingMutex);
+        ScopedWrite write(*this, true);
 
         bool result = false;
         if (path[path.length()] == 0)
@@ -612,6 +818,9 @@ namespace AZ
 
         Pointer pointer(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/-");
 
+        AZStd::scoped_lock lock(m_settingMutex);
+        ScopedWrite write(*this, true);
+
         size_t additionalSpaceRequired = 3; // 3 is for the '/', '*' and 0
         if (!platform.empty())
         {
@@ -677,8 +886,6 @@ namespace AZ
         };
         SystemFile::FindFiles(folderPath.c_str(), callback);
 
-
-        AZStd::scoped_lock lock(m_settingMutex);
         if (!platform.empty())
         {
             // Move the folderPath prefix back to the supplied path before the wildcard
@@ -735,34 +942,110 @@ namespace AZ
                 return false;
             }
 
-            // Load the registry files in the sorted order.
-            for (RegistryFile& registryFile : fileList)
+            AZ::IO::FixedMaxPathString cachePath;
+            if (!m_mergeCacheFolder.empty())
             {
-                folderPath.erase(platformKeyOffset); // Erase all characters after the platformKeyOffset
-                if (registryFile.m_isPlatformFile)
+                cachePath = AZ::IO::FixedMaxPathString::format("%s%c%016llx%s", m_mergeCacheFolder.c_str(), AZ_CORRECT_DATABASE_SEPARATOR,
+                    static_cast<unsigned long long>(SettingsRegistryCache::CalculateKey(path, specializations, platform, rootKey)),
+                    SettingsRegistryCache::FileExtension);
+                if (MergeSettingsFolderFromCache(cachePath.c_str(), fileList, folderPath, platformKeyOffset, platform, rootKey,
+                    *scratchBuffer))
                 {
-                    folderPath += PlatformFolder;
-                    folderPath.push_back(AZ_CORRECT_DATABASE_SEPARATOR);
-                    folderPath += platform;
-                    folderPath.push_back(AZ_CORRECT_DATABASE_SEPARATOR);
+                    return true;
                 }
+            }
 
-                folderPath += registryFile.m_relativePath;
-
-                if (!registryFile.m_isPatch)
-                {
-                    MergeSettingsFileInternal(folderPath.c_str(), Format::JsonMergePatch, rootKey, *scratchBuffer);
-                }
-                else
-                {
-                    MergeSettingsFileInternal(folderPath.c_str(), Format::JsonPatch, rootKey, *scratchBuffer);
-                }
+            // Load the registry files in the sorted order.
+            SettingsRegistryCache::Writer cacheWriter(rootKey);
+            bool updateCache = !cachePath.empty();
+            for (RegistryFile& registryFile : fileList)
+            {
+                BuildRegistryFilePath(folderPath, platformKeyOffset, platform, registryFile);
+                const Format format = registryFile.m_isPatch ? Format::JsonPatch : Format::JsonMergePatch;
+                // A folder that has files which can't be merged isn't cached, so the errors are reported again on the next merge.
+                updateCache = MergeSettingsFileInternal(folderPath.c_str(), format, rootKey, *scratchBuffer,
+                    updateCache ? &cacheWriter : nullptr) && updateCache;
                 scratchBuffer->clear();
             }
+
+            if (updateCache)
+            {
+                cacheWriter.WriteToFile(cachePath.c_str());
+            }
         }
         return true;
     }
 
+    bool SettingsRegistryImpl::MergeSettingsFolderFromCache(const char* cachePath, const RegistryFileList& fileList,
+        AZ::IO::FixedMaxPathString& folderPath, size_t folderPathLength, AZStd::string_view platform, AZStd::string_view rootKey,
+        AZStd::vector<char>& scratchBuffer)
+    {
+        SettingsRegistryCache::Reader reader;
+        if (!reader.Open(cachePath, rootKey) || reader.GetFileCount() != fileList.size())
+        {
+            return false;
+        }
+
+        // Validate and load all files before merging any of them so an outdated or corrupted cache never results in a partial merge.
+        rapidjson::Document patches;
+        patches.SetArray();
+        patches.Reserve(aznumeric_cast<rapidjson::SizeType>(fileList.size()), patches.GetAllocator());
+        for (const RegistryFile& registryFile : fileList)
+        {
+            BuildRegistryFilePath(folderPath, folderPathLength, platform, registryFile);
+
+            SettingsRegistryCache::Reader::Entry entry;
+            if (!reader.ReadEntry(entry) ||
+                entry.m_path != folderPath ||
+                entry.m_isPatch != registryFile.m_isPatch ||
+                entry.m_fileSize != AZ::IO::SystemFile::Length(folderPath.c_str()) ||
+                entry.m_modificationTime != AZ::IO::SystemFile::ModificationTime(folderPath.c_str()))
+            {
+                return false;
+            }
+
+            // Size and modification time reject most changes without reading the file. The content hash catches edits that keep
+            // the size within the resolution of the modification time, and older files that were restored with their original time.
+            u64 contentHash = 0;
+            const bool hashCalculated = SettingsRegistryCache::CalculateFileContentHash(contentHash, folderPath.c_str(), scratchBuffer);
+            scratchBuffer.clear();
+            if (!hashCalculated || entry.m_contentHash != contentHash)
+            {
+                return false;
+            }
+
+            rapidjson::Value patch;
+            const char* content = entry.m_content;
+            if (!SettingsRegistryCache::LoadValue(patch, patches.GetAllocator(), content, content + entry.m_contentSize))
+            {
+                return false;
+            }
+            patches.PushBack(AZStd::move(patch), patches.GetAllocator());
+        }
+
+        for (size_t i = 0; i < fileList.size(); ++i)
+        {
+            BuildRegistryFilePath(folderPath, folderPathLength, platform, fileList[i]);
+            const Format format = fileList[i].m_isPatch ? Format::JsonPatch : Format::JsonMergePatch;
+            MergeParsedSettings(folderPath.c_str(), format, rootKey, patches[aznumeric_cast<rapidjson::SizeType>(i)]);
+        }
+        return true;
+    }
+
+    void SettingsRegistryImpl::BuildRegistryFilePath(AZ::IO::FixedMaxPathString& folderPath, size_t folderPathLength,
+        AZStd::string_view platform, const RegistryFile& registryFile)
+    {
+        folderPath.erase(folderPathLength); // Erase all characters after the folder path.
+        if (registryFile.m_isPlatformFile)
+        {
+            folderPath += PlatformFolder;
+            folderPath.push_back(AZ_CORRECT_DATABASE_SEPARATOR);
+            folderPath += platform;
+            folderPath.push_back(AZ_CORRECT_DATABASE_SEPARATOR);
+        }
+        folderPath += registryFile.m_relativePath;
+    }
+
     SettingsRegistryInterface::VisitResponse SettingsRegistryImpl::Visit(Visitor& visitor, StackedString& path, AZStd::string_view valueName,
         const rapidjson::Value& value) const
     {
@@ -1014,7 +1297,7 @@ namespace AZ
     }
 
     bool SettingsRegistryImpl::MergeSettingsFileInternal(const char* path, Format format, AZStd::string_view rootKey,
-        AZStd::vector<char>& scratchBuffer)
+        AZStd::vector<char>& scratchBuffer, SettingsRegistryCache::Writer* cacheWriter)
     {
         using namespace AZ::IO;
         using namespace rapidjson;
@@ -1041,6 +1324,8 @@ namespace AZ
                 .AddMember(StringRef("Path"), Value(path, m_settings.GetAllocator()), m_settings.GetAllocator());
             return false;
         }
+        // Retrieve the modification time before reading so a cache never records a newer time than the content it stores.
+        const u64 modificationTime = cacheWriter ? file.ModificationTime() : 0;
         scratchBuffer.clear();
         scratchBuffer.resize_no_construct(fileSize + 1);
         if (file.Read(fileSize, scratchBuffer.data()) != fileSize)
@@ -1052,6 +1337,8 @@ namespace AZ
             return false;
         }
         scratchBuffer[fileSize] = 0;
+        // The buffer is parsed in place, so the hash has to be taken before parsing.
+        const u64 contentHash = cacheWriter ? SettingsRegistryCache::CalculateContentHash(scratchBuffer.data(), fileSize) : 0;
 
         rapidjson::Document jsonPatch;
         constexpr int flags = rapidjson::kParseStopWhenDoneFlag | rapidjson::kParseCommentsFlag | rapidjson::kParseTrailingCommasFlag;
@@ -1085,6 +1372,25 @@ namespace AZ
             return false;
         }
 
+        if (!MergeParsedSettings(path, format, rootKey, jsonPatch))
+        {
+            return false;
+        }
+
+        if (cacheWriter)
+        {
+            cacheWriter->AddFile(path, fileSize, modificationTime, contentHash, format == Format::JsonPatch, jsonPatch);
+        }
+        return true;
+    }
+
+    bool SettingsRegistryImpl::MergeParsedSettings(const char* path, Format format, AZStd::string_view rootKey,
+        const rapidjson::Value& jsonPatch)
+    {
+        using namespace rapidjson;
+
+        Pointer pointer(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/-");
+
         JsonMergeApproach mergeApproach;
         switch (format)
         {
@@ -16,7 +16,10 @@
 #include <AzCore/Settings/SettingsRegistry.h>
 #include <AzCore/std/containers/fixed_vector.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzCore/std/string/string.h>
 
 // Using a define instead of a static string to avoid the need for temporary buffers to composite the full paths.
 #define AZ_SETTINGS_REGISTRY_HISTORY_KEY "/Amazon/AzCore/Runtime/Registry/FileHistory"
@@ -25,6 +28,11 @@ namespace AZ
 {
     class StackedString;
 
+    namespace SettingsRegistryCache
+    {
+        class Writer;
+    }
+
     class SettingsRegistryImpl final
         : public SettingsRegistryInterface
     {
@@ -33,7 +41,7 @@ namespace AZ
         AZ_RTTI(AZ::SettingsRegistryImpl, "{E9C34190-F888-48CA-83C9-9F24B4E21D72}", AZ::SettingsRegistryInterface);
 
         static constexpr size_t MaxRegistryFolderEntries = 128;
-        
+
         SettingsRegistryImpl();
         AZ_DISABLE_COPY_MOVE(SettingsRegistryImpl);
         ~SettingsRegistryImpl() override = default;
@@ -77,6 +85,28 @@ namespace AZ
         void SetApplyPatchSettings(const AZ::JsonApplyPatchSettings& applyPatchSettings) override;
         void GetApplyPatchSettings(AZ::JsonApplyPatchSettings& applyPatchSettings) override;
 
+        //! Lookups through a PathHandle read from the published snapshot without locking the registry as long as the snapshot is up
+        //! to date. A new snapshot is published at the end of every merge. Individual calls to Set or Remove don't publish one, as
+        //! copying the settings after every small update would cost more than the lock it saves, so until the next merge or call to
+        //! GetSnapshot these lookups lock the registry instead.
+        Type GetType(const PathHandle& path) const override;
+        bool Get(bool& result, const PathHandle& path) const override;
+        bool Get(s64& result, const PathHandle& path) const override;
+        bool Get(u64& result, const PathHandle& path) const override;
+        bool Get(double& result, const PathHandle& path) const override;
+        bool Get(AZStd::string& result, const PathHandle& path) const override;
+        bool Get(SettingsRegistryInterface::FixedValueString& result, const PathHandle& path) const override;
+
+        //! Returns a snapshot of the current settings. If the registry hasn't been modified since the last snapshot was published
+        //! the published snapshot is shared, otherwise a new snapshot is created and published.
+        SnapshotPtr GetSnapshot() const override;
+        u64 GetVersion() const override;
+
+        //! Sets the folder where merges of registry folders are cached. The parsed content of the files merged by
+        //! MergeSettingsFolder is stored in a binary cache and reused on the next merge of the same folder, as long as none of the
+        //! files have been added, removed or modified. An empty folder disables the cache, which is the default.
+        void SetMergeCacheFolder(AZStd::string_view cacheFolder);
+
     private:
         using TagList = AZStd::fixed_vector<size_t, Specializations::MaxCount + 1>;
         struct RegistryFile
@@ -92,6 +122,11 @@ namespace AZ
         bool SetValueInternal(AZStd::string_view path, T value, SettingsRegistryInterface::Type type);
         template<typename T>
         bool GetValueInternal(T& result, AZStd::string_view path) const;
+        template<typename T>
+        bool GetValueInternal(T& result, const PathHandle& path) const;
+        template<typename T>
+        static bool ExtractValue(T& result, const rapidjson::Value* value);
+        static Type GetValueType(const rapidjson::Value* value);
         VisitResponse Visit(Visitor& visitor, StackedString& path, AZStd::string_view valueName,
             const rapidjson::Value& value) const;
 
@@ -99,13 +134,59 @@ namespace AZ
         bool IsLessThan(bool& collisionFound, const RegistryFile& lhs, const RegistryFile& rhs, const Specializations& specializations,
             const rapidjson::Pointer& historyPointer, AZStd::string_view folderPath);
         bool ExtractFileDescription(RegistryFile& output, const char* filename, const Specializations& specializations);
-        bool MergeSettingsFileInternal(const char* path, Format format, AZStd::string_view rootKey, AZStd::vector<char>& scratchBuffer);
-        
+        bool MergeSettingsFileInternal(const char* path, Format format, AZStd::string_view rootKey, AZStd::vector<char>& scratchBuffer,
+            SettingsRegistryCache::Writer* cacheWriter = nullptr);
+        bool MergeParsedSettings(const char* path, Format format, AZStd::string_view rootKey, const rapidjson::Value& jsonPatch);
+        // Merges all files in the file list from the cache. Nothing is merged if the cache is missing or out of date.
+        bool MergeSettingsFolderFromCache(const char* cachePath, const RegistryFileList& fileList, AZ::IO::FixedMaxPathString& folderPath,
+            size_t folderPathLength, AZStd::string_view platform, AZStd::string_view rootKey, AZStd::vector<char>& scratchBuffer);
+        // Replaces everything in the folder path after folderPathLength with the relative path to the registry file.
+        static void BuildRegistryFilePath(AZ::IO::FixedMaxPathString& folderPath, size_t folderPathLength, AZStd::string_view platform,
+            const RegistryFile& registryFile);
+
+        // Returns the published snapshot if it's still up to date, otherwise null in which case the caller needs to lock the registry.
+        SnapshotPtr GetPublishedSnapshot() const;
+        // Copies the settings into a new snapshot. Needs to be called while holding m_settingMutex.
+        SnapshotPtr CreateSnapshot() const;
+        // Makes the snapshot available to readers on all threads. Needs to be called while holding m_settingMutex.
+        void PublishSnapshot(SnapshotPtr snapshot) const;
+
+        // Marks m_settings as being modified while in scope. Needs to be created while holding m_settingMutex and before m_settings is
+        // modified. The version is incremented when the scope opens and again when it ends, so a snapshot taken by a notifier halfway
+        // through a multi-file merge is never mistaken for the merged settings. No snapshots are published while a write is in
+        // progress. Once the outermost write ends a new snapshot is published if any of the writes was a merge.
+        class ScopedWrite
+        {
+        public:
+            ScopedWrite(SettingsRegistryImpl& registry, bool publishSnapshot);
+            ~ScopedWrite();
+            AZ_DISABLE_COPY_MOVE(ScopedWrite);
+
+        private:
+            SettingsRegistryImpl& m_registry;
+        };
+
+        // Published snapshots are stored in a small ring of slots. Readers pin the published slot by incrementing its reader count
+        // and checking that it's still the published slot afterwards, so reading the snapshot never needs a lock. Writers only ever
+        // replace the snapshot in a slot that isn't published and isn't pinned by a reader.
+        struct SnapshotSlot
+        {
+            SnapshotPtr m_snapshot;
+            AZStd::atomic<u32> m_readers{ 0 };
+        };
+        static constexpr u32 SnapshotSlotCount = 2;
+
         mutable AZStd::recursive_mutex m_settingMutex;
+        mutable SnapshotSlot m_snapshotSlots[SnapshotSlotCount];
+        mutable AZStd::atomic<u32> m_publishedSnapshotSlot{ 0 };
+        AZStd::atomic<u64> m_version{ 0 };
+        AZStd::atomic<u32> m_activeWrites{ 0 };
+        bool m_publishPending{ false };
         NotifyEvent m_notifiers;
         rapidjson::Document m_settings;
         JsonSerializerSettings m_serializationSettings;
         JsonDeserializerSettings m_deserializationSettings;
         JsonApplyPatchSettings m_applyPatchSettings;
+        AZ::IO::FixedMaxPathString m_mergeCacheFolder;
     };
 } // namespace AZ
@@ -14,6 +14,7 @@
 #include <AzCore/JSON/prettywriter.h>
 #include <AzCore/JSON/writer.h>
 #include <AzCore/PlatformId/PlatformDefaults.h>
+#include <AzCore/Settings/SettingsRegistryImpl.h>
 #include <AzCore/Settings/SettingsRegistryMergeUtils.h>
 #include <AzCore/Settings/CommandLine.h>
 #include <AzCore/std/string/conversions.h>
@@ -402,6 +403,28 @@ namespace AZ::SettingsRegistryMergeUtils
         registry.Set(targetSpecialization, true);
     }
 
+    bool ConfigureMergeCache(SettingsRegistryInterface& registry, bool enableByDefault)
+    {
+        bool enabled = enableByDefault;
+        registry.Get(enabled, MergeCacheEnabledKey);
+
+        auto settingsRegistryImpl = azrtti_cast<SettingsRegistryImpl*>(&registry);
+        if (!enabled || settingsRegistryImpl == nullptr)
+        {
+            return false;
+        }
+
+        AZ::IO::FixedMaxPath mergeCacheFolder = AZ::Utils::GetO3deManifestDirectory();
+        if (mergeCacheFolder.empty())
+        {
+            return false;
+        }
+        mergeCacheFolder /= "Cache";
+        mergeCacheFolder /= SettingsRegistryInterface::RegistryFolder;
+        settingsRegistryImpl->SetMergeCacheFolder(mergeCacheFolder.Native());
+        return true;
+    }
+
     bool MergeSettingsToRegistry_ConfigFile(SettingsRegistryInterface& registry, AZStd::string_view filePath,
         const ConfigParserSettings& configParserSettings)
     {
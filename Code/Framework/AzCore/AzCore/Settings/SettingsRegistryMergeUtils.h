@@ -108,6 +108,17 @@ namespace AZ::SettingsRegistryMergeUtils
     //! A build system target is the name used by the build system to build a particular executable or library
     void MergeSettingsToRegistry_AddBuildSystemTargetSpecialization(SettingsRegistryInterface& registry, AZStd::string_view targetName);
 
+    //! Key that turns the cache of parsed registry folders on or off, for instance with
+    //! --regset="/Amazon/AzCore/Settings/RegistryMergeCache/Enabled=true" on the command line
+    inline static constexpr char MergeCacheEnabledKey[] = "/Amazon/AzCore/Settings/RegistryMergeCache/Enabled";
+
+    //! Stores the parsed registry folders that are merged from now on in <o3de manifest directory>/Cache/Registry, so later
+    //! launches don't need to parse the same registry files again. The value at MergeCacheEnabledKey takes precedence,
+    //! enableByDefault is used if it isn't set. The cache is shared by every process of the user, so it should only be
+    //! enabled by default for applications that are launched often, such as the AssetBuilder and the launchers.
+    //! @return true if the merge cache is used
+    bool ConfigureMergeCache(SettingsRegistryInterface& registry, bool enableByDefault);
+
     //! Settings structure which is used to determine how to parse Windows INI style config file(.cfg, .ini, etc...)
     //! It supports being able to supply a custom comment filter and section header filter
     //! The names of section headers are appended to the root Json pointer path member to form new root paths
@@ -169,6 +169,8 @@ set(FILES
     IO/FileIOEventBus.h
     IO/IOUtils.h
     IO/IOUtils.cpp
+    IO/MappedFileView.cpp
+    IO/MappedFileView.h
     IO/IStreamer.h
     IO/IStreamerTypes.h
     IO/IStreamerTypes.inl
@@ -235,6 +237,7 @@ set(FILES
     Jobs/JobManagerComponent.cpp
     Jobs/JobManagerComponent.h
     Jobs/JobManagerDesc.h
+    Jobs/JobPriorityClass.h
     Jobs/LegacyJobExecutor.h
     Jobs/MultipleDependentJob.h
     Jobs/task_group.h
@@ -359,6 +362,8 @@ set(FILES
     Math/ToString.cpp
     Memory/AllocationRecords.cpp
     Memory/AllocationRecords.h
+    Memory/AllocationSampler.cpp
+    Memory/AllocationSampler.h
     Memory/AllocatorBase.cpp
     Memory/AllocatorBase.h
     Memory/AllocatorManager.cpp
@@ -373,6 +378,9 @@ set(FILES
     Memory/BestFitExternalMapSchema.h
     Memory/Config.h
     Memory/dlmalloc.inl
+    Memory/FrameArenaAllocator.h
+    Memory/FrameArenaSchema.cpp
+    Memory/FrameArenaSchema.h
     Memory/HeapSchema.h
     Memory/HphaSchema.cpp
     Memory/HphaSchema.h
@@ -398,6 +406,8 @@ set(FILES
     Memory/PoolSchema.cpp
     Memory/PoolSchema.h
     Memory/SimpleSchemaAllocator.h
+    Memory/SizeClassSchema.cpp
+    Memory/SizeClassSchema.h
     Memory/SystemAllocator.cpp
     Memory/SystemAllocator.h
     Module/DynamicModuleHandle.cpp
@@ -424,6 +434,8 @@ set(FILES
     Name/NameSerializer.cpp
     Name/Internal/NameData.h
     Name/Internal/NameData.cpp
+    Name/Internal/NameDictionaryShard.h
+    Name/Internal/NameDictionaryShard.cpp
     Outcome/Outcome.h
     Outcome/Internal/OutcomeStorage.h
     Outcome/Internal/OutcomeImpl.h
@@ -548,6 +560,8 @@ set(FILES
     Settings/CommandLine.h
     Settings/SettingsRegistry.cpp
     Settings/SettingsRegistry.h
+    Settings/SettingsRegistryCache.cpp
+    Settings/SettingsRegistryCache.h
     Settings/SettingsRegistryConsoleUtils.cpp
     Settings/SettingsRegistryConsoleUtils.h
     Settings/SettingsRegistryImpl.cpp
@@ -95,6 +95,16 @@ namespace AZStd
             }
         }
 
+        //! Constructs without adding a reference when addRef is false, taking over a reference the caller already holds.
+        intrusive_ptr(T* p, bool addRef)
+            : px(p)
+        {
+            if (px != 0 && addRef)
+            {
+                CountPolicy::add_ref(px);
+            }
+        }
+
         template<class U>
         intrusive_ptr(intrusive_ptr<U> const& rhs, enable_if_t<is_convertible<U*, T*>::value, int> = 0)
             : px(rhs.get())
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/MappedFileView.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace AZ::IO::Platform
+{
+    u64 GetMappingGranularity()
+    {
+        static const u64 pageSize = aznumeric_cast<u64>(::sysconf(_SC_PAGESIZE));
+        return pageSize;
+    }
+
+    void* MapFileRange(const char* absolutePath, u64 alignedOffset, u64 size)
+    {
+        int file = ::open(absolutePath, O_RDONLY | O_CLOEXEC);
+        if (file < 0)
+        {
+            return nullptr;
+        }
+
+        // Accessing pages past the end of the file raises SIGBUS, so don't map anything that isn't backed by the file.
+        struct stat attributes;
+        if (::fstat(file, &attributes) != 0 || !S_ISREG(attributes.st_mode) ||
+            alignedOffset + size > aznumeric_cast<u64>(attributes.st_size))
+        {
+            ::close(file);
+            return nullptr;
+        }
+
+        void* mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, aznumeric_cast<off_t>(alignedOffset));
+        // The mapping keeps its own reference to the file so the descriptor isn't needed anymore.
+        ::close(file);
+        if (mapping == MAP_FAILED)
+        {
+            return nullptr;
+        }
+
+        // Views are typically requested for data that's about to be consumed in full, so ask the kernel to start reading ahead.
+        ::posix_madvise(mapping, size, POSIX_MADV_WILLNEED);
+        return mapping;
+    }
+
+    void UnmapFileRange(void* mapping, u64 size)
+    {
+        ::munmap(mapping, size);
+    }
+} // namespace AZ::IO::Platform
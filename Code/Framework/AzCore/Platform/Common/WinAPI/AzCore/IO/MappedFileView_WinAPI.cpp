@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/PlatformIncl.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/MappedFileView.h>
+#include <AzCore/std/string/conversions.h>
+
+namespace AZ::IO::Platform
+{
+    u64 GetMappingGranularity()
+    {
+        SYSTEM_INFO systemInfo;
+        ::GetSystemInfo(&systemInfo);
+        return systemInfo.dwAllocationGranularity;
+    }
+
+    void* MapFileRange(const char* absolutePath, u64 alignedOffset, u64 size)
+    {
+        AZStd::wstring fileNameW;
+        AZStd::to_wstring(fileNameW, absolutePath);
+        HANDLE file = ::CreateFileW(fileNameW.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+            FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return nullptr;
+        }
+
+        LARGE_INTEGER fileSize;
+        if (!::GetFileSizeEx(file, &fileSize) || alignedOffset + size > aznumeric_cast<u64>(fileSize.QuadPart))
+        {
+            ::CloseHandle(file);
+            return nullptr;
+        }
+
+        // The view keeps its own references to the mapping and file, so both handles can be closed immediately.
+        HANDLE mapping = ::CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        ::CloseHandle(file);
+        if (mapping == nullptr)
+        {
+            return nullptr;
+        }
+
+        void* view = ::MapViewOfFile(mapping, FILE_MAP_READ, static_cast<DWORD>(alignedOffset >> 32),
+            static_cast<DWORD>(alignedOffset & 0xFFFFFFFF), aznumeric_cast<SIZE_T>(size));
+        ::CloseHandle(mapping);
+        return view;
+    }
+
+    void UnmapFileRange(void* mapping, [[maybe_unused]] u64 size)
+    {
+        ::UnmapViewOfFile(mapping);
+    }
+} // namespace AZ::IO::Platform
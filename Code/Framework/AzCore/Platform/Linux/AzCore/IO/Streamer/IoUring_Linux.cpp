@@ -0,0 +1,347 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/Streamer/IoUring_Linux.h>
+#include <AzCore/std/algorithm.h>
+
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#endif
+
+// IORING_FEAT_NODROP was introduced in the same kernel version (5.5) as asynchronous cancellation, which is the newest feature
+// used, so it's used to detect whether the available kernel headers are recent enough.
+#if defined(IORING_FEAT_NODROP) && defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter) && defined(__NR_io_uring_register)
+#define AZ_IO_URING_AVAILABLE 1
+#else
+#define AZ_IO_URING_AVAILABLE 0
+#endif
+
+namespace AZ::IO
+{
+    IoUring::~IoUring()
+    {
+        Shutdown();
+    }
+
+#if AZ_IO_URING_AVAILABLE
+    namespace IoUringInternal
+    {
+        // The ring buffers are shared with the kernel, so the indices that the kernel writes need to be read with acquire
+        // semantics and the indices that are written for the kernel need to be published with release semantics.
+        static u32 LoadAcquire(const u32* value)
+        {
+            return __atomic_load_n(value, __ATOMIC_ACQUIRE);
+        }
+
+        static void StoreRelease(u32* value, u32 newValue)
+        {
+            __atomic_store_n(value, newValue, __ATOMIC_RELEASE);
+        }
+
+        template<typename T>
+        static T* Offset(void* base, u32 offset)
+        {
+            return reinterpret_cast<T*>(reinterpret_cast<u8*>(base) + offset);
+        }
+    }
+
+    bool IoUring::Initialize(u32 queueDepth)
+    {
+        using namespace IoUringInternal;
+
+        AZ_Assert(m_ringFd < 0, "IoUring has already been initialized.");
+
+        io_uring_params params;
+        ::memset(&params, 0, sizeof(params));
+        // Size the completion queue to twice the submission queue so there's always room for the completions of cancel
+        // operations on top of a full queue of reads.
+        params.flags = IORING_SETUP_CQSIZE;
+        params.cq_entries = queueDepth * 2;
+        m_ringFd = aznumeric_cast<int>(::syscall(__NR_io_uring_setup, queueDepth, &params));
+        if (m_ringFd < 0)
+        {
+            return false;
+        }
+
+        m_submissionRingSize = params.sq_off.array + params.sq_entries * sizeof(u32);
+        m_completionRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        const bool singleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (singleMap)
+        {
+            m_submissionRingSize = AZStd::max(m_submissionRingSize, m_completionRingSize);
+            m_completionRingSize = m_submissionRingSize;
+        }
+
+        m_submissionRing = ::mmap(nullptr, m_submissionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFd, IORING_OFF_SQ_RING);
+        if (m_submissionRing == MAP_FAILED)
+        {
+            m_submissionRing = nullptr;
+            Shutdown();
+            return false;
+        }
+
+        if (singleMap)
+        {
+            m_completionRing = m_submissionRing;
+        }
+        else
+        {
+            m_completionRing = ::mmap(nullptr, m_completionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFd, IORING_OFF_CQ_RING);
+            if (m_completionRing == MAP_FAILED)
+            {
+                m_completionRing = nullptr;
+                Shutdown();
+                return false;
+            }
+        }
+
+        m_submissionEntriesSize = params.sq_entries * sizeof(io_uring_sqe);
+        m_submissionEntries = ::mmap(nullptr, m_submissionEntriesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFd, IORING_OFF_SQES);
+        if (m_submissionEntries == MAP_FAILED)
+        {
+            m_submissionEntries = nullptr;
+            Shutdown();
+            return false;
+        }
+
+        m_submissionHead = Offset<u32>(m_submissionRing, params.sq_off.head);
+        m_submissionTail = Offset<u32>(m_submissionRing, params.sq_off.tail);
+        m_submissionArray = Offset<u32>(m_submissionRing, params.sq_off.array);
+        m_submissionMask = *Offset<u32>(m_submissionRing, params.sq_off.ring_mask);
+        m_submissionEntryCount = params.sq_entries;
+
+        m_completionHead = Offset<u32>(m_completionRing, params.cq_off.head);
+        m_completionTail = Offset<u32>(m_completionRing, params.cq_off.tail);
+        m_completionEntries = Offset<void>(m_completionRing, params.cq_off.cqes);
+        m_completionMask = *Offset<u32>(m_completionRing, params.cq_off.ring_mask);
+        m_completionEntryCount = params.cq_entries;
+
+        m_completionEvent = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (m_completionEvent < 0 ||
+            ::syscall(__NR_io_uring_register, m_ringFd, IORING_REGISTER_EVENTFD, &m_completionEvent, 1) < 0)
+        {
+            Shutdown();
+            return false;
+        }
+
+        return true;
+    }
+
+    void* IoUring::ClaimSubmissionEntry()
+    {
+        using namespace IoUringInternal;
+
+        // Completions are never dropped as long as there are no more operations in flight than there are completion entries.
+        if (m_inFlightCount >= m_completionEntryCount)
+        {
+            return nullptr;
+        }
+
+        const u32 tail = *m_submissionTail;
+        if (tail - LoadAcquire(m_submissionHead) >= m_submissionEntryCount)
+        {
+            return nullptr;
+        }
+
+        const u32 index = tail & m_submissionMask;
+        io_uring_sqe* entry = reinterpret_cast<io_uring_sqe*>(m_submissionEntries) + index;
+        ::memset(entry, 0, sizeof(io_uring_sqe));
+        m_submissionArray[index] = index;
+        return entry;
+    }
+
+    void IoUring::PublishSubmissionEntry()
+    {
+        using namespace IoUringInternal;
+
+        StoreRelease(m_submissionTail, *m_submissionTail + 1);
+        m_pendingSubmissionCount++;
+        m_inFlightCount++;
+    }
+
+    bool IoUring::QueueRead(int fileDescriptor, const iovec* buffer, u64 offset, u64 userData)
+    {
+        // IORING_OP_READV is used instead of IORING_OP_READ as the latter is only available starting with kernel 5.6.
+        io_uring_sqe* entry = reinterpret_cast<io_uring_sqe*>(ClaimSubmissionEntry());
+        if (entry)
+        {
+            entry->opcode = IORING_OP_READV;
+            entry->fd = fileDescriptor;
+            entry->addr = reinterpret_cast<u64>(buffer);
+            entry->len = 1;
+            entry->off = offset;
+            entry->user_data = userData;
+            PublishSubmissionEntry();
+            return true;
+        }
+        return false;
+    }
+
+    bool IoUring::QueueCancel(u64 targetUserData, u64 userData)
+    {
+        io_uring_sqe* entry = reinterpret_cast<io_uring_sqe*>(ClaimSubmissionEntry());
+        if (entry)
+        {
+            entry->opcode = IORING_OP_ASYNC_CANCEL;
+            entry->fd = -1;
+            entry->addr = targetUserData;
+            entry->user_data = userData;
+            PublishSubmissionEntry();
+            return true;
+        }
+        return false;
+    }
+
+    s32 IoUring::Submit()
+    {
+        while (m_pendingSubmissionCount > 0)
+        {
+            long result = ::syscall(__NR_io_uring_enter, m_ringFd, m_pendingSubmissionCount, 0, 0, nullptr, 0);
+            if (result >= 0)
+            {
+                u32 submitted = aznumeric_cast<u32>(result);
+                m_pendingSubmissionCount -= submitted;
+                return aznumeric_cast<s32>(submitted);
+            }
+            if (errno != EINTR)
+            {
+                return -errno;
+            }
+        }
+        return 0;
+    }
+
+    bool IoUring::PopCompletion(Completion& completion)
+    {
+        using namespace IoUringInternal;
+
+        if (m_completionHead == nullptr)
+        {
+            return false;
+        }
+
+        const u32 head = *m_completionHead;
+        if (head == LoadAcquire(m_completionTail))
+        {
+            return false;
+        }
+
+        const io_uring_cqe& entry = reinterpret_cast<const io_uring_cqe*>(m_completionEntries)[head & m_completionMask];
+        completion.m_userData = entry.user_data;
+        completion.m_result = entry.res;
+        StoreRelease(m_completionHead, head + 1);
+
+        AZ_Assert(m_inFlightCount > 0, "IoUring received more completions than operations were queued.");
+        m_inFlightCount--;
+        return true;
+    }
+#else
+    bool IoUring::Initialize([[maybe_unused]] u32 queueDepth)
+    {
+        // The kernel headers are too old to provide the required io_uring functionality.
+        return false;
+    }
+
+    void* IoUring::ClaimSubmissionEntry()
+    {
+        return nullptr;
+    }
+
+    void IoUring::PublishSubmissionEntry()
+    {
+    }
+
+    bool IoUring::QueueRead(
+        [[maybe_unused]] int fileDescriptor, [[maybe_unused]] const iovec* buffer, [[maybe_unused]] u64 offset,
+        [[maybe_unused]] u64 userData)
+    {
+        return false;
+    }
+
+    bool IoUring::QueueCancel([[maybe_unused]] u64 targetUserData, [[maybe_unused]] u64 userData)
+    {
+        return false;
+    }
+
+    s32 IoUring::Submit()
+    {
+        return -ENOSYS;
+    }
+
+    bool IoUring::PopCompletion([[maybe_unused]] Completion& completion)
+    {
+        return false;
+    }
+#endif // AZ_IO_URING_AVAILABLE
+
+    void IoUring::Shutdown()
+    {
+        // Closing the ring waits for, or cancels, any operations that are still in flight.
+        if (m_submissionEntries)
+        {
+            ::munmap(m_submissionEntries, m_submissionEntriesSize);
+        }
+        if (m_completionRing && m_completionRing != m_submissionRing)
+        {
+            ::munmap(m_completionRing, m_completionRingSize);
+        }
+        if (m_submissionRing)
+        {
+            ::munmap(m_submissionRing, m_submissionRingSize);
+        }
+        if (m_ringFd >= 0)
+        {
+            ::close(m_ringFd);
+        }
+        if (m_completionEvent >= 0)
+        {
+            ::close(m_completionEvent);
+        }
+
+        m_submissionRing = nullptr;
+        m_completionRing = nullptr;
+        m_submissionEntries = nullptr;
+        m_submissionHead = nullptr;
+        m_submissionTail = nullptr;
+        m_submissionArray = nullptr;
+        m_completionHead = nullptr;
+        m_completionTail = nullptr;
+        m_completionEntries = nullptr;
+        m_pendingSubmissionCount = 0;
+        m_inFlightCount = 0;
+        m_ringFd = -1;
+        m_completionEvent = -1;
+    }
+
+    bool IoUring::IsInitialized() const
+    {
+        return m_ringFd >= 0;
+    }
+
+    int IoUring::GetCompletionEvent() const
+    {
+        return m_completionEvent;
+    }
+
+    u32 IoUring::GetInFlightCount() const
+    {
+        return m_inFlightCount;
+    }
+
+    u32 IoUring::GetPendingSubmissionCount() const
+    {
+        return m_pendingSubmissionCount;
+    }
+} // namespace AZ::IO
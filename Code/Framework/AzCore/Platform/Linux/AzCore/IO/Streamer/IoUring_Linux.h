@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <sys/uio.h>
+#include <AzCore/base.h>
+
+namespace AZ::IO
+{
+    //! Minimal wrapper around a Linux io_uring instance that only supports the operations needed by StorageDriveLinux.
+    //! The ring is set up through the raw system calls so no additional libraries are required. Submission and completion
+    //! queues are not thread safe and are expected to only be used from the Streamer thread.
+    class IoUring final
+    {
+    public:
+        struct Completion
+        {
+            u64 m_userData{ 0 };
+            //! The number of bytes read or a negative errno value if the operation failed.
+            s32 m_result{ 0 };
+        };
+
+        IoUring() = default;
+        ~IoUring();
+
+        //! Creates the ring and an event that's signaled whenever an operation completes.
+        //! @param queueDepth The maximum number of operations that can be in flight at the same time. The completion queue is
+        //!     created with twice this number of entries.
+        //! @return False if io_uring isn't available, for instance because the kernel is too old or because its use has been
+        //!     blocked by a security policy.
+        bool Initialize(u32 queueDepth);
+        void Shutdown();
+        bool IsInitialized() const;
+
+        //! The event file descriptor that's signaled when operations complete. Waiting on this event is optional as completions
+        //! can be polled for with PopCompletion.
+        int GetCompletionEvent() const;
+        //! The number of operations that have been queued but of which the completion hasn't been retrieved yet.
+        u32 GetInFlightCount() const;
+        //! The number of operations that have been queued but not yet submitted to the kernel.
+        u32 GetPendingSubmissionCount() const;
+
+        //! Queues a read into a single buffer. The buffer description has to remain valid until the read completes.
+        bool QueueRead(int fileDescriptor, const iovec* buffer, u64 offset, u64 userData);
+        //! Queues a request to cancel a previously queued operation. Cancellation is best effort and the targeted operation
+        //! will still report a completion, with -ECANCELED if it was canceled.
+        bool QueueCancel(u64 targetUserData, u64 userData);
+        //! Submits all queued operations to the kernel with a single system call.
+        //! @return The number of operations submitted or a negative errno value on failure.
+        s32 Submit();
+        //! Retrieves the next completed operation, if any.
+        bool PopCompletion(Completion& completion);
+
+    private:
+        AZ_DISABLE_COPY_MOVE(IoUring);
+
+        //! Returns the next free io_uring_sqe, cleared, or nullptr if the submission queue is full.
+        void* ClaimSubmissionEntry();
+        //! Makes the entry returned by the last call to ClaimSubmissionEntry visible to the kernel.
+        void PublishSubmissionEntry();
+
+        void* m_submissionRing{ nullptr };
+        void* m_completionRing{ nullptr };
+        void* m_submissionEntries{ nullptr };
+        size_t m_submissionRingSize{ 0 };
+        size_t m_completionRingSize{ 0 };
+        size_t m_submissionEntriesSize{ 0 };
+
+        u32* m_submissionHead{ nullptr };
+        u32* m_submissionTail{ nullptr };
+        u32* m_submissionArray{ nullptr };
+        u32 m_submissionMask{ 0 };
+        u32 m_submissionEntryCount{ 0 };
+
+        u32* m_completionHead{ nullptr };
+        u32* m_completionTail{ nullptr };
+        void* m_completionEntries{ nullptr };
+        u32 m_completionMask{ 0 };
+        u32 m_completionEntryCount{ 0 };
+
+        u32 m_pendingSubmissionCount{ 0 };
+        u32 m_inFlightCount{ 0 };
+        int m_ringFd{ -1 };
+        int m_completionEvent{ -1 };
+    };
+} // namespace AZ::IO
@@ -0,0 +1,1063 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/std/typetraits/decay.h>
+
+namespace AZ::IO
+{
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+    static constexpr char FileSwitchesName[] = "File switches";
+    static constexpr char SeeksName[] = "Seeks";
+    static constexpr char DirectReadsName[] = "Direct reads (no internal alloc)";
+#endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+
+    const AZStd::chrono::microseconds StorageDriveLinux::s_averageSeekTime =
+        AZStd::chrono::milliseconds(9) + // Common average seek time for desktop hdd drives.
+        AZStd::chrono::milliseconds(3); // Rotational latency for a 7200RPM disk
+
+    //
+    // ConstructionOptions
+    //
+
+    StorageDriveLinux::ConstructionOptions::ConstructionOptions()
+        : m_hasSeekPenalty(true)
+        , m_enableUnbufferedReads(true)
+        , m_minimalReporting(false)
+    {}
+
+    //
+    // FileReadInformation
+    //
+
+    void StorageDriveLinux::FileReadInformation::AllocateAlignedBuffer(size_t size, size_t sectorSize)
+    {
+        AZ_Assert(m_sectorAlignedOutput == nullptr, "Assign a sector aligned buffer when one is already assigned.");
+        m_sectorAlignedOutput = azmalloc(size, sectorSize, AZ::SystemAllocator);
+    }
+
+    void StorageDriveLinux::FileReadInformation::Clear()
+    {
+        if (m_sectorAlignedOutput)
+        {
+            azfree(m_sectorAlignedOutput, AZ::SystemAllocator);
+        }
+        *this = FileReadInformation{};
+    }
+
+    //
+    // StorageDriveLinux
+    //
+
+    StorageDriveLinux::StorageDriveLinux(u32 maxFileHandles, u32 maxMetaDataCacheEntries, size_t physicalSectorSize,
+        size_t logicalSectorSize, u32 queueDepth, s32 overCommit, ConstructionOptions options)
+        : m_physicalSectorSize(physicalSectorSize)
+        , m_logicalSectorSize(logicalSectorSize)
+        , m_maxFileHandles(maxFileHandles)
+        , m_queueDepth(queueDepth)
+        , m_overCommit(overCommit)
+        , m_constructionOptions(options)
+    {
+        m_name = "Storage drive (io_uring)";
+
+        if (m_physicalSectorSize == 0)
+        {
+            m_physicalSectorSize = 4_kib;
+            AZ_Error("StorageDriveLinux", false,
+                "Received physical sector size of 0 for %s. Picking a sector size of %zu instead.\n", m_name.c_str(), m_physicalSectorSize);
+        }
+        if (m_logicalSectorSize == 0)
+        {
+            m_logicalSectorSize = 512;
+            AZ_Error("StorageDriveLinux", false,
+                "Received logical sector size of 0 for %s. Picking a sector size of %zu instead.\n", m_name.c_str(), m_logicalSectorSize);
+        }
+        AZ_Error("StorageDriveLinux", IStreamerTypes::IsPowerOf2(m_physicalSectorSize) && IStreamerTypes::IsPowerOf2(m_logicalSectorSize),
+            "StorageDriveLinux requires power-of-2 sector sizes. Received physical: %zu and logical: %zu",
+            m_physicalSectorSize, m_logicalSectorSize);
+
+        // Older kernels limit the number of io_uring submission entries to 4096.
+        constexpr u32 MaxQueueDepth = 4096;
+        if (m_queueDepth == 0)
+        {
+            m_queueDepth = 32;
+            AZ_Warning("StorageDriveLinux", false,
+                "Received queue depth of 0 for %s. Picking a depth of %u instead.\n", m_name.c_str(), m_queueDepth);
+        }
+        else
+        {
+            m_queueDepth = AZStd::min(m_queueDepth, MaxQueueDepth);
+        }
+        // Make sure that the overCommit isn't so small that no slots are ever reported.
+        if (aznumeric_cast<s32>(m_queueDepth) + m_overCommit <= 0)
+        {
+            AZ_Error("StorageDriveLinux", false,
+                "Received overcommit (%i) for %s that subtracts more than the queue depth (%u). Setting combined count to 1.\n",
+                m_overCommit, m_name.c_str(), m_queueDepth);
+            m_overCommit = 1 - aznumeric_cast<s32>(m_queueDepth);
+        }
+
+        if (!m_ioUring.Initialize(m_queueDepth))
+        {
+            AZ_Warning("StorageDriveLinux", false,
+                "io_uring is not available (Error: %i). %s will forward all requests.\n", errno, m_name.c_str());
+        }
+        else if (!m_constructionOptions.m_minimalReporting)
+        {
+            AZ_Printf("Streamer", "%s created.\n", m_name.c_str());
+        }
+
+        // Add initial dummy values to the stats to avoid division by zero later on and avoid needing branches.
+        m_readSizeAverage.PushEntry(1);
+        m_readTimeAverage.PushEntry(AZStd::chrono::microseconds(1));
+
+        AZ_Assert(IStreamerTypes::IsPowerOf2(maxMetaDataCacheEntries),
+            "StorageDriveLinux requires a power-of-2 for maxMetaDataCacheEntries. Received %u", maxMetaDataCacheEntries);
+        m_metaDataCache_paths.resize(maxMetaDataCacheEntries);
+        m_metaDataCache_fileSize.resize(maxMetaDataCacheEntries);
+    }
+
+    StorageDriveLinux::~StorageDriveLinux()
+    {
+        AZ_Assert(m_activeReads_Count == 0, "%s is destroyed while there are still %u reads in flight.", m_name.c_str(), m_activeReads_Count);
+        for (int file : m_fileCache_handles)
+        {
+            if (file >= 0)
+            {
+                ::close(file);
+            }
+        }
+        if (m_ioUring.IsInitialized() && !m_constructionOptions.m_minimalReporting)
+        {
+            AZ_Printf("Streamer", "%s destroyed.\n", m_name.c_str());
+        }
+    }
+
+    bool StorageDriveLinux::IsAvailable() const
+    {
+        return m_ioUring.IsInitialized();
+    }
+
+    void StorageDriveLinux::PrepareRequest(FileRequest* request)
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+        AZ_Assert(request, "PrepareRequest was provided a null request.");
+
+        if (IsAvailable() && AZStd::holds_alternative<FileRequest::ReadRequestData>(request->GetCommand()))
+        {
+            auto& readRequest = AZStd::get<FileRequest::ReadRequestData>(request->GetCommand());
+            FileRequest* read = m_context->GetNewInternalRequest();
+            read->CreateRead(request, readRequest.m_output, readRequest.m_outputSize, readRequest.m_path,
+                readRequest.m_offset, readRequest.m_size);
+            m_context->PushPreparedRequest(read);
+            return;
+        }
+        StreamStackEntry::PrepareRequest(request);
+    }
+
+    void StorageDriveLinux::QueueRequest(FileRequest* request)
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+        AZ_Assert(request, "QueueRequest was provided a null request.");
+
+        if (!IsAvailable())
+        {
+            StreamStackEntry::QueueRequest(request);
+            return;
+        }
+
+        AZStd::visit([this, request](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData>)
+            {
+                m_pendingReadRequests.push_back(request);
+                return;
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::FileExistsCheckData> ||
+                AZStd::is_same_v<Command, FileRequest::FileMetaDataRetrievalData>)
+            {
+                m_pendingRequests.push_back(request);
+                return;
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::CancelData>)
+            {
+                if (CancelRequest(request, args.m_target))
+                {
+                    // Only forward if this isn't part of the request chain, otherwise the storage device should
+                    // be the last step as it doesn't forward any (sub)requests.
+                    return;
+                }
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::FlushData>)
+            {
+                FlushCache(args.m_path);
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::FlushAllData>)
+            {
+                FlushEntireCache();
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::ReportData>)
+            {
+                Report(args);
+            }
+            StreamStackEntry::QueueRequest(request);
+        }, request->GetCommand());
+    }
+
+    bool StorageDriveLinux::ExecuteRequests()
+    {
+        if (!IsAvailable())
+        {
+            return StreamStackEntry::ExecuteRequests();
+        }
+
+        bool hasFinalizedReads = FinalizeReads();
+        bool hasWorked = ResubmitReads();
+
+        // Fill up the queue as far as possible before submitting so all new reads are handed to the kernel with a single
+        // system call.
+        while (!m_pendingReadRequests.empty())
+        {
+            FileRequest* request = m_pendingReadRequests.front();
+            if (!ReadRequest(request))
+            {
+                break;
+            }
+            m_pendingReadRequests.pop_front();
+            hasWorked = true;
+        }
+        bool hasSubmitted = SubmitReads();
+
+        if (!m_pendingRequests.empty())
+        {
+            FileRequest* request = m_pendingRequests.front();
+            AZStd::visit([this, request](auto&& args)
+            {
+                using Command = AZStd::decay_t<decltype(args)>;
+                if constexpr (AZStd::is_same_v<Command, FileRequest::FileExistsCheckData>)
+                {
+                    FileExistsRequest(request);
+                }
+                else if constexpr (AZStd::is_same_v<Command, FileRequest::FileMetaDataRetrievalData>)
+                {
+                    FileMetaDataRetrievalRequest(request);
+                }
+                else
+                {
+                    AZ_Assert(false, "A request was added to StorageDriveLinux's pending queue that isn't supported.");
+                }
+            }, request->GetCommand());
+            m_pendingRequests.pop_front();
+            hasWorked = true;
+        }
+
+        // Reads that couldn't be submitted, for instance because the kernel temporarily ran out of resources, don't trigger
+        // the completion event, so keep the Streamer thread awake until they're submitted.
+        bool hasUnsubmittedReads = m_ioUring.GetPendingSubmissionCount() > 0 || !m_pendingResubmits.empty();
+
+        return StreamStackEntry::ExecuteRequests() || hasFinalizedReads || hasWorked || hasSubmitted || hasUnsubmittedReads;
+    }
+
+    void StorageDriveLinux::UpdateStatus(Status& status) const
+    {
+        StreamStackEntry::UpdateStatus(status);
+        if (IsAvailable())
+        {
+            status.m_numAvailableSlots = AZStd::min(status.m_numAvailableSlots, CalculateNumAvailableSlots());
+            status.m_isIdle = status.m_isIdle && m_pendingReadRequests.empty() && m_pendingRequests.empty() && (m_activeReads_Count == 0);
+        }
+    }
+
+    void StorageDriveLinux::UpdateCompletionEstimates(AZStd::chrono::system_clock::time_point now, AZStd::vector<FileRequest*>& internalPending,
+        StreamerContext::PreparedQueue::iterator pendingBegin, StreamerContext::PreparedQueue::iterator pendingEnd)
+    {
+        StreamStackEntry::UpdateCompletionEstimates(now, internalPending, pendingBegin, pendingEnd);
+
+        if (!IsAvailable())
+        {
+            return;
+        }
+
+        const RequestPath* activeFile = nullptr;
+        if (m_activeCacheSlot != InvalidFileCacheIndex)
+        {
+            activeFile = &m_fileCache_paths[m_activeCacheSlot];
+        }
+        u64 activeOffset = m_activeOffset;
+
+        // Determine the time of the first available slot. Reads in flight are processed in parallel by the device, so
+        // their completion is estimated from the moment they were started.
+        AZStd::chrono::system_clock::time_point earliestSlot = AZStd::chrono::system_clock::time_point::max();
+        for (size_t i = 0; i < m_readSlots_readInfo.size(); ++i)
+        {
+            if (m_readSlots_active[i])
+            {
+                const FileReadInformation& read = m_readSlots_readInfo[i];
+                u64 totalBytesRead = m_readSizeAverage.GetTotal();
+                double totalReadTimeUSec = aznumeric_caster(m_readTimeAverage.GetTotal().count());
+                auto readCommand = AZStd::get_if<FileRequest::ReadData>(&read.m_request->GetCommand());
+                AZ_Assert(readCommand, "Request currently reading doesn't contain a read command.");
+                auto endTime = read.m_startTime + AZStd::chrono::microseconds(aznumeric_cast<u64>((readCommand->m_size * totalReadTimeUSec) / totalBytesRead));
+                earliestSlot = AZStd::min(earliestSlot, endTime);
+                read.m_request->SetEstimatedCompletion(endTime);
+            }
+        }
+        if (earliestSlot != AZStd::chrono::system_clock::time_point::max())
+        {
+            now = earliestSlot;
+        }
+
+        // Estimate requests in this stack entry.
+        for (FileRequest* request : m_pendingReadRequests)
+        {
+            EstimateCompletionTimeForRequest(request, now, activeFile, activeOffset);
+        }
+        for (FileRequest* request : m_pendingRequests)
+        {
+            EstimateCompletionTimeForRequest(request, now, activeFile, activeOffset);
+        }
+
+        // Estimate internally pending requests. Because this call will go from the top of the stack to the bottom,
+        // but estimation is calculated from the bottom to the top, this list should be processed in reverse order.
+        for (auto requestIt = internalPending.rbegin(); requestIt != internalPending.rend(); ++requestIt)
+        {
+            EstimateCompletionTimeForRequest(*requestIt, now, activeFile, activeOffset);
+        }
+
+        // Estimate pending requests that have not been queued yet.
+        for (auto requestIt = pendingBegin; requestIt != pendingEnd; ++requestIt)
+        {
+            EstimateCompletionTimeForRequest(*requestIt, now, activeFile, activeOffset);
+        }
+    }
+
+    void StorageDriveLinux::EstimateCompletionTimeForRequest(FileRequest* request, AZStd::chrono::system_clock::time_point& startTime,
+        const RequestPath*& activeFile, u64& activeOffset) const
+    {
+        u64 readSize = 0;
+        u64 offset = 0;
+        const RequestPath* targetFile = nullptr;
+
+        AZStd::visit([&](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData>)
+            {
+                targetFile = &args.m_path;
+                readSize = args.m_size;
+                offset = args.m_offset;
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::CompressedReadData>)
+            {
+                targetFile = &args.m_compressionInfo.m_archiveFilename;
+                readSize = args.m_compressionInfo.m_compressedSize;
+                offset = args.m_compressionInfo.m_offset;
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::FileExistsCheckData>)
+            {
+                readSize = 0;
+                AZStd::chrono::microseconds getFileExistsTimeAverage = m_getFileExistsTimeAverage.CalculateAverage();
+                startTime += getFileExistsTimeAverage;
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::FileMetaDataRetrievalData>)
+            {
+                readSize = 0;
+                AZStd::chrono::microseconds getFileMetaDataTimeAverage = m_getFileMetaDataRetrievalTimeAverage.CalculateAverage();
+                startTime += getFileMetaDataTimeAverage;
+            }
+        }, request->GetCommand());
+
+        if (readSize > 0)
+        {
+            if (activeFile && activeFile != targetFile)
+            {
+                if (FindInFileHandleCache(*targetFile) == InvalidFileCacheIndex)
+                {
+                    AZStd::chrono::microseconds fileOpenCloseTimeAverage = m_fileOpenCloseTimeAverage.CalculateAverage();
+                    startTime += fileOpenCloseTimeAverage;
+                }
+                activeOffset = std::numeric_limits<u64>::max();
+            }
+
+            if (activeOffset != offset && m_constructionOptions.m_hasSeekPenalty)
+            {
+                startTime += s_averageSeekTime;
+            }
+
+            u64 totalBytesRead = m_readSizeAverage.GetTotal();
+            double totalReadTimeUSec = aznumeric_caster(m_readTimeAverage.GetTotal().count());
+            startTime += AZStd::chrono::microseconds(aznumeric_cast<u64>((readSize * totalReadTimeUSec) / totalBytesRead));
+            activeOffset = offset + readSize;
+        }
+        request->SetEstimatedCompletion(startTime);
+    }
+
+    s32 StorageDriveLinux::CalculateNumAvailableSlots() const
+    {
+        return (m_overCommit + aznumeric_cast<s32>(m_queueDepth)) - aznumeric_cast<s32>(m_pendingReadRequests.size()) -
+            aznumeric_cast<s32>(m_pendingRequests.size()) - m_activeReads_Count;
+    }
+
+    auto StorageDriveLinux::OpenFile(int& fileHandle, size_t& cacheSlot, FileRequest* request, const FileRequest::ReadData& data) -> OpenFileResult
+    {
+        int file = -1;
+
+        // If the file is already opened for use, use that file handle and update it's last touched time.
+        size_t cacheIndex = FindInFileHandleCache(data.m_path);
+        if (cacheIndex != InvalidFileCacheIndex)
+        {
+            file = m_fileCache_handles[cacheIndex];
+            AZ_Assert(file >= 0, "Found the file '%s' in cache, but file handle is invalid.\n", data.m_path.GetRelativePath());
+        }
+        else
+        {
+            // If the file is not already found in the cache, attempt to claim an available cache entry.
+            cacheIndex = FindAvailableFileHandleCacheIndex();
+            if (cacheIndex == InvalidFileCacheIndex)
+            {
+                // No files ready to be evicted.
+                return OpenFileResult::CacheFull;
+            }
+
+            bool isDirect = false;
+            // Adding explicit scope here for profiling file Open & Close
+            {
+                AZ_PROFILE_SCOPE_DYNAMIC(AZ::Debug::ProfileCategory::AzCore, "StorageDriveLinux::ReadRequest OpenFile %s", m_name.c_str());
+                TIMED_AVERAGE_WINDOW_SCOPE(m_fileOpenCloseTimeAverage);
+
+                if (m_constructionOptions.m_enableUnbufferedReads)
+                {
+                    file = ::open(data.m_path.GetAbsolutePath(), O_RDONLY | O_CLOEXEC | O_DIRECT);
+                    isDirect = file >= 0;
+                }
+                // Not all file systems support direct reads, in which case fall back to reading through the page cache.
+                if (file < 0)
+                {
+                    file = ::open(data.m_path.GetAbsolutePath(), O_RDONLY | O_CLOEXEC);
+                }
+
+                if (file < 0)
+                {
+                    // Failed to open the file, so let the next entry in the stack try.
+                    StreamStackEntry::QueueRequest(request);
+                    return OpenFileResult::RequestForwarded;
+                }
+
+                CloseFileHandle(cacheIndex);
+            }
+
+            // Fill the cache entry with data about the new file.
+            m_fileCache_handles[cacheIndex] = file;
+            m_fileCache_activeReads[cacheIndex] = 0;
+            m_fileCache_isDirect[cacheIndex] = isDirect;
+            m_fileCache_paths[cacheIndex] = data.m_path;
+        }
+
+        // Set the current request and update timestamp, regardless of cache hit or miss.
+        m_fileCache_lastTimeUsed[cacheIndex] = AZStd::chrono::system_clock::now();
+        fileHandle = file;
+        cacheSlot = cacheIndex;
+        return OpenFileResult::FileOpened;
+    }
+
+    bool StorageDriveLinux::ReadRequest(FileRequest* request)
+    {
+        AZ_PROFILE_SCOPE_DYNAMIC(AZ::Debug::ProfileCategory::AzCore, "StorageDriveLinux::ReadRequest %s", m_name.c_str());
+
+        if (!m_cachesInitialized)
+        {
+            m_fileCache_lastTimeUsed.resize(m_maxFileHandles, AZStd::chrono::system_clock::time_point::min());
+            m_fileCache_paths.resize(m_maxFileHandles);
+            m_fileCache_handles.resize(m_maxFileHandles, -1);
+            m_fileCache_activeReads.resize(m_maxFileHandles, 0);
+            m_fileCache_isDirect.resize(m_maxFileHandles, false);
+
+            m_readSlots_readInfo.resize(m_queueDepth);
+            m_readSlots_active.resize(m_queueDepth);
+
+            m_cachesInitialized = true;
+        }
+
+        if (m_activeReads_Count >= m_queueDepth)
+        {
+            return false;
+        }
+
+        if (m_activeReads_Count == 0 && !m_context->GetStreamerThreadSynchronizer().AreIoEventsAvailable())
+        {
+            // There's no room to register the completion event so delay executing this request until there is.
+            return false;
+        }
+
+        auto data = AZStd::get_if<FileRequest::ReadData>(&request->GetCommand());
+        AZ_Assert(data, "Read request in StorageDriveLinux doesn't contain read data.");
+
+        int file = -1;
+        size_t fileCacheSlot = InvalidFileCacheIndex;
+        switch (OpenFile(file, fileCacheSlot, request, *data))
+        {
+        case OpenFileResult::FileOpened:
+            break;
+        case OpenFileResult::RequestForwarded:
+            return true;
+        case OpenFileResult::CacheFull:
+            return false;
+        default:
+            AZ_Assert(false, "Unsupported OpenFileRequest returned.");
+        }
+
+        size_t readSlot = FindAvailableReadSlot();
+        AZ_Assert(readSlot != InvalidReadSlotIndex, "Active read count indicates there's a read slot available, but no read slot was found.");
+
+        u64 readSize = data->m_size;
+        u64 readOffs = data->m_offset;
+        void* output = data->m_output;
+
+        FileReadInformation& readInfo = m_readSlots_readInfo[readSlot];
+        readInfo.m_request = request;
+        readInfo.m_fileHandleIndex = fileCacheSlot;
+
+        if (m_fileCache_isDirect[fileCacheSlot])
+        {
+            // Direct reads require the offset, size and address to be aligned to the sector sizes. If any of them are not,
+            // read the aligned range that covers the requested data into an internal buffer and copy the requested part
+            // out of it once the read completes. See StorageDriveWin::ReadRequest for a more detailed description.
+            const bool alignedAddr = IStreamerTypes::IsAlignedTo(data->m_output, aznumeric_caster(m_physicalSectorSize));
+            const bool alignedOffs = IStreamerTypes::IsAlignedTo(data->m_offset, aznumeric_caster(m_logicalSectorSize));
+
+            if (!alignedOffs)
+            {
+                readOffs = AZ_SIZE_ALIGN_DOWN(readOffs, m_logicalSectorSize);
+                u64 offsetCorrection = data->m_offset - readOffs;
+                readInfo.m_copyBackOffset = offsetCorrection;
+                readSize = data->m_size + offsetCorrection;
+            }
+
+            bool alignedSize = IStreamerTypes::IsAlignedTo(readSize, aznumeric_caster(m_logicalSectorSize));
+            if (!alignedSize)
+            {
+                u64 alignedReadSize = AZ_SIZE_ALIGN_UP(readSize, m_logicalSectorSize);
+                if (alignedReadSize <= data->m_outputSize)
+                {
+                    alignedSize = true;
+                    readSize = alignedReadSize;
+                }
+            }
+
+            const bool isAligned = (alignedAddr && alignedSize && alignedOffs);
+            if (!isAligned)
+            {
+                readSize = AZ_SIZE_ALIGN_UP(readSize, m_logicalSectorSize);
+                readInfo.AllocateAlignedBuffer(readSize, m_physicalSectorSize);
+                output = readInfo.m_sectorAlignedOutput;
+            }
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+            m_directReadsPercentageStat.PushSample(isAligned ? 1.0 : 0.0);
+            Statistic::PlotImmediate(m_name, DirectReadsName, m_directReadsPercentageStat.GetMostRecentSample());
+#endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+        }
+
+        readInfo.m_buffer.iov_base = output;
+        readInfo.m_buffer.iov_len = readSize;
+        readInfo.m_readOffset = readOffs;
+        if (!m_ioUring.QueueRead(file, &readInfo.m_buffer, readOffs, readSlot))
+        {
+            // The ring is full, which can happen if there are still cancel operations in flight. Try again later.
+            readInfo.Clear();
+            return false;
+        }
+
+        auto now = AZStd::chrono::system_clock::now();
+        if (m_activeReads_Count++ == 0)
+        {
+            m_activeReads_startTime = now;
+            [[maybe_unused]] bool eventAdded = m_context->GetStreamerThreadSynchronizer().AddIoEvent(m_ioUring.GetCompletionEvent());
+            AZ_Assert(eventAdded, "Unable to register the io_uring completion event with the Streamer thread.");
+        }
+        readInfo.m_startTime = now;
+        m_readSlots_active[readSlot] = true;
+
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+        if (m_activeCacheSlot == fileCacheSlot)
+        {
+            m_fileSwitchPercentageStat.PushSample(0.0);
+            m_seekPercentageStat.PushSample(m_activeOffset == data->m_offset ? 0.0 : 1.0);
+        }
+        else
+        {
+            m_fileSwitchPercentageStat.PushSample(1.0);
+            m_seekPercentageStat.PushSample(0.0);
+        }
+
+        Statistic::PlotImmediate(m_name, FileSwitchesName, m_fileSwitchPercentageStat.GetMostRecentSample());
+        Statistic::PlotImmediate(m_name, SeeksName, m_seekPercentageStat.GetMostRecentSample());
+#endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+
+        m_fileCache_activeReads[fileCacheSlot]++;
+        m_activeCacheSlot = fileCacheSlot;
+        m_activeOffset = readOffs + readSize;
+
+        return true;
+    }
+
+    bool StorageDriveLinux::SubmitReads()
+    {
+        u32 pendingCount = m_ioUring.GetPendingSubmissionCount();
+        if (pendingCount == 0)
+        {
+            return false;
+        }
+
+        AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzCore, "StorageDriveLinux::SubmitReads io_uring_enter");
+        s32 result = m_ioUring.Submit();
+        if (result > 0)
+        {
+            m_submissionBatchSizeAverage.PushEntry(aznumeric_cast<u64>(result));
+            return true;
+        }
+
+        // EAGAIN and EBUSY mean the kernel is temporarily out of resources, the reads will be submitted on the next call.
+        AZ_Error("StorageDriveLinux", result == -EAGAIN || result == -EBUSY,
+            "Failed to submit %u reads to io_uring (Error: %i).\n", pendingCount, -result);
+        return false;
+    }
+
+    bool StorageDriveLinux::ResubmitReads()
+    {
+        bool hasWorked = false;
+        while (!m_pendingResubmits.empty())
+        {
+            size_t readSlot = m_pendingResubmits.front();
+            if (m_readSlots_readInfo[readSlot].m_cancelRequested)
+            {
+                // The remainder was never queued, so there's no completion coming for it.
+                m_pendingResubmits.pop_front();
+                FinalizeSingleRequest(readSlot, -ECANCELED);
+            }
+            else if (QueueRemainingRead(readSlot))
+            {
+                m_pendingResubmits.pop_front();
+            }
+            else
+            {
+                break;
+            }
+            hasWorked = true;
+        }
+        return hasWorked;
+    }
+
+    bool StorageDriveLinux::QueueRemainingRead(size_t readSlot)
+    {
+        FileReadInformation& readInfo = m_readSlots_readInfo[readSlot];
+        return m_ioUring.QueueRead(m_fileCache_handles[readInfo.m_fileHandleIndex], &readInfo.m_buffer, readInfo.m_readOffset, readSlot);
+    }
+
+    bool StorageDriveLinux::CancelRequest(FileRequest* cancelRequest, FileRequestPtr& target)
+    {
+        bool ownsRequestChain = false;
+        for (auto it = m_pendingReadRequests.begin(); it != m_pendingReadRequests.end();)
+        {
+            if ((*it)->WorksOn(target))
+            {
+                (*it)->SetStatus(IStreamerTypes::RequestStatus::Canceled);
+                m_context->MarkRequestAsCompleted(*it);
+                it = m_pendingReadRequests.erase(it);
+                ownsRequestChain = true;
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        // Pending requests have been accounted for, now address any active reads and ask the kernel to cancel them. Reads
+        // that can't be canceled anymore will complete as usual.
+        bool hasQueuedCancels = false;
+        for (size_t readSlot = 0; readSlot < m_readSlots_active.size(); ++readSlot)
+        {
+            if (m_readSlots_active[readSlot] && m_readSlots_readInfo[readSlot].m_request->WorksOn(target))
+            {
+                ownsRequestChain = true;
+                m_readSlots_readInfo[readSlot].m_cancelRequested = true;
+                if (m_ioUring.QueueCancel(readSlot, CancelUserData))
+                {
+                    hasQueuedCancels = true;
+                }
+            }
+        }
+        if (hasQueuedCancels)
+        {
+            SubmitReads();
+        }
+
+        if (ownsRequestChain)
+        {
+            cancelRequest->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(cancelRequest);
+        }
+
+        return ownsRequestChain;
+    }
+
+    void StorageDriveLinux::FileExistsRequest(FileRequest* request)
+    {
+        auto& fileExists = AZStd::get<FileRequest::FileExistsCheckData>(request->GetCommand());
+
+        AZ_PROFILE_SCOPE_DYNAMIC(AZ::Debug::ProfileCategory::AzCore, "StorageDriveLinux::FileExistsRequest %s : %s",
+            m_name.c_str(), fileExists.m_path.GetRelativePath());
+        TIMED_AVERAGE_WINDOW_SCOPE(m_getFileExistsTimeAverage);
+
+        size_t cacheIndex = FindInFileHandleCache(fileExists.m_path);
+        if (cacheIndex != InvalidFileCacheIndex)
+        {
+            fileExists.m_found = true;
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        cacheIndex = FindInMetaDataCache(fileExists.m_path);
+        if (cacheIndex != InvalidMetaDataCacheIndex)
+        {
+            fileExists.m_found = true;
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        struct stat attributes;
+        if (::stat(fileExists.m_path.GetAbsolutePath(), &attributes) == 0 && S_ISREG(attributes.st_mode))
+        {
+            cacheIndex = GetNextMetaDataCacheSlot();
+            m_metaDataCache_paths[cacheIndex] = fileExists.m_path;
+            m_metaDataCache_fileSize[cacheIndex] = aznumeric_caster(attributes.st_size);
+            fileExists.m_found = true;
+
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        StreamStackEntry::QueueRequest(request);
+    }
+
+    void StorageDriveLinux::FileMetaDataRetrievalRequest(FileRequest* request)
+    {
+        auto& command = AZStd::get<FileRequest::FileMetaDataRetrievalData>(request->GetCommand());
+
+        AZ_PROFILE_SCOPE_DYNAMIC(AZ::Debug::ProfileCategory::AzCore, "StorageDriveLinux::FileMetaDataRetrievalRequest %s : %s",
+            m_name.c_str(), command.m_path.GetRelativePath());
+        TIMED_AVERAGE_WINDOW_SCOPE(m_getFileMetaDataRetrievalTimeAverage);
+
+        size_t cacheIndex = FindInMetaDataCache(command.m_path);
+        if (cacheIndex != InvalidMetaDataCacheIndex)
+        {
+            command.m_fileSize = m_metaDataCache_fileSize[cacheIndex];
+            command.m_found = true;
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        struct stat attributes;
+        cacheIndex = FindInFileHandleCache(command.m_path);
+        if (cacheIndex != InvalidFileCacheIndex)
+        {
+            AZ_Assert(m_fileCache_handles[cacheIndex] >= 0,
+                "File path '%s' doesn't have an associated file handle.", m_fileCache_paths[cacheIndex].GetRelativePath());
+            if (::fstat(m_fileCache_handles[cacheIndex], &attributes) != 0)
+            {
+                StreamStackEntry::QueueRequest(request);
+                return;
+            }
+        }
+        else if (::stat(command.m_path.GetAbsolutePath(), &attributes) != 0 || !S_ISREG(attributes.st_mode))
+        {
+            StreamStackEntry::QueueRequest(request);
+            return;
+        }
+
+        command.m_fileSize = aznumeric_caster(attributes.st_size);
+        command.m_found = true;
+
+        cacheIndex = GetNextMetaDataCacheSlot();
+        m_metaDataCache_paths[cacheIndex] = command.m_path;
+        m_metaDataCache_fileSize[cacheIndex] = aznumeric_caster(attributes.st_size);
+
+        request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+        m_context->MarkRequestAsCompleted(request);
+    }
+
+    void StorageDriveLinux::CloseFileHandle(size_t cacheIndex)
+    {
+        if (m_fileCache_handles[cacheIndex] >= 0)
+        {
+            AZ_Assert(m_fileCache_activeReads[cacheIndex] == 0, "Closing '%s' but it has %u active reads\n",
+                m_fileCache_paths[cacheIndex].GetRelativePath(), m_fileCache_activeReads[cacheIndex]);
+            ::close(m_fileCache_handles[cacheIndex]);
+            m_fileCache_handles[cacheIndex] = -1;
+        }
+    }
+
+    void StorageDriveLinux::FlushCache(const RequestPath& filePath)
+    {
+        if (m_cachesInitialized)
+        {
+            size_t cacheIndex = FindInFileHandleCache(filePath);
+            if (cacheIndex != InvalidFileCacheIndex)
+            {
+                CloseFileHandle(cacheIndex);
+                m_fileCache_activeReads[cacheIndex] = 0;
+                m_fileCache_lastTimeUsed[cacheIndex] = AZStd::chrono::system_clock::time_point();
+                m_fileCache_paths[cacheIndex].Clear();
+            }
+
+            cacheIndex = FindInMetaDataCache(filePath);
+            if (cacheIndex != InvalidMetaDataCacheIndex)
+            {
+                m_metaDataCache_paths[cacheIndex].Clear();
+                m_metaDataCache_fileSize[cacheIndex] = 0;
+            }
+        }
+    }
+
+    void StorageDriveLinux::FlushEntireCache()
+    {
+        if (m_cachesInitialized)
+        {
+            // Clear file handle cache
+            for (size_t cacheIndex = 0; cacheIndex < m_maxFileHandles; ++cacheIndex)
+            {
+                CloseFileHandle(cacheIndex);
+                m_fileCache_activeReads[cacheIndex] = 0;
+                m_fileCache_lastTimeUsed[cacheIndex] = AZStd::chrono::system_clock::time_point();
+                m_fileCache_paths[cacheIndex].Clear();
+            }
+
+            // Clear meta data cache
+            auto metaDataCacheSize = m_metaDataCache_paths.size();
+            m_metaDataCache_paths.clear();
+            m_metaDataCache_fileSize.clear();
+            m_metaDataCache_front = 0;
+            m_metaDataCache_paths.resize(metaDataCacheSize);
+            m_metaDataCache_fileSize.resize(metaDataCacheSize);
+        }
+    }
+
+    bool StorageDriveLinux::FinalizeReads()
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+
+        bool hasWorked = false;
+        IoUring::Completion completion;
+        while (m_ioUring.PopCompletion(completion))
+        {
+            // The results of cancel operations don't need processing as the canceled read reports its own completion.
+            if (completion.m_userData != CancelUserData)
+            {
+                FinalizeSingleRequest(aznumeric_caster(completion.m_userData), completion.m_result);
+                hasWorked = true;
+            }
+        }
+        return hasWorked;
+    }
+
+    void StorageDriveLinux::FinalizeSingleRequest(size_t readSlot, s32 result)
+    {
+        AZ_Assert(readSlot < m_readSlots_active.size() && m_readSlots_active[readSlot],
+            "io_uring reported a completion for read slot %zu which isn't active.", readSlot);
+
+        FileReadInformation& fileReadInfo = m_readSlots_readInfo[readSlot];
+
+        auto readCommand = AZStd::get_if<FileRequest::ReadData>(&fileReadInfo.m_request->GetCommand());
+        AZ_Assert(readCommand != nullptr, "Request stored with the io_uring read did not contain a read request.");
+
+        const u64 numBytesTransferred = result > 0 ? aznumeric_cast<u64>(result) : 0;
+        fileReadInfo.m_bytesRead += numBytesTransferred;
+        m_activeReads_ByteCount += numBytesTransferred;
+
+        // The request could be reading more due to alignment requirements. It should however never read less that the amount of
+        // requested data. A read that was interrupted by a signal or that returned fewer bytes than needed continues from where it
+        // stopped, unless it was canceled in the meantime. A read of 0 bytes means the end of the file was reached.
+        const u64 requiredBytes = fileReadInfo.m_copyBackOffset + readCommand->m_size;
+        const bool isIncomplete = (result == -EINTR) || (result > 0 && fileReadInfo.m_bytesRead < requiredBytes);
+        if (isIncomplete && !fileReadInfo.m_cancelRequested)
+        {
+            fileReadInfo.m_buffer.iov_base = reinterpret_cast<u8*>(fileReadInfo.m_buffer.iov_base) + numBytesTransferred;
+            fileReadInfo.m_buffer.iov_len -= numBytesTransferred;
+            fileReadInfo.m_readOffset += numBytesTransferred;
+            if (!QueueRemainingRead(readSlot))
+            {
+                m_pendingResubmits.push_back(readSlot);
+            }
+            return;
+        }
+
+        const bool isCanceled = (result == -ECANCELED) || isIncomplete;
+        const bool encounteredError = !isCanceled && result < 0;
+        AZ_Error("StorageDriveLinux", !encounteredError, "Async file read operation completed with error code %i\n", -result);
+
+        if (--m_activeReads_Count == 0)
+        {
+            // Update read stats now that the operation is done.
+            m_readSizeAverage.PushEntry(m_activeReads_ByteCount);
+            m_readTimeAverage.PushEntry(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
+                AZStd::chrono::system_clock::now() - m_activeReads_startTime));
+
+            m_activeReads_ByteCount = 0;
+            m_context->GetStreamerThreadSynchronizer().RemoveIoEvent(m_ioUring.GetCompletionEvent());
+        }
+
+        bool isSuccess = !isCanceled && !encounteredError && (requiredBytes <= fileReadInfo.m_bytesRead);
+
+        if (fileReadInfo.m_sectorAlignedOutput && isSuccess)
+        {
+            auto offsetAddress = reinterpret_cast<u8*>(fileReadInfo.m_sectorAlignedOutput) + fileReadInfo.m_copyBackOffset;
+            ::memcpy(readCommand->m_output, offsetAddress, readCommand->m_size);
+        }
+
+        fileReadInfo.m_request->SetStatus(
+            isCanceled
+                ? IStreamerTypes::RequestStatus::Canceled
+                : isSuccess
+                    ? IStreamerTypes::RequestStatus::Completed
+                    : IStreamerTypes::RequestStatus::Failed
+        );
+        m_context->MarkRequestAsCompleted(fileReadInfo.m_request);
+
+        m_fileCache_activeReads[fileReadInfo.m_fileHandleIndex]--;
+        m_readSlots_active[readSlot] = false;
+        fileReadInfo.Clear();
+    }
+
+    size_t StorageDriveLinux::FindInFileHandleCache(const RequestPath& filePath) const
+    {
+        size_t numFiles = m_fileCache_paths.size();
+        for (size_t i = 0; i < numFiles; ++i)
+        {
+            if (m_fileCache_paths[i] == filePath)
+            {
+                return i;
+            }
+        }
+        return InvalidFileCacheIndex;
+    }
+
+    size_t StorageDriveLinux::FindAvailableFileHandleCacheIndex() const
+    {
+        AZ_Assert(m_cachesInitialized, "Using file cache before it has been (lazily) initialized\n");
+
+        // This needs to look for files with no active reads, and the oldest file among those.
+        size_t cacheIndex = InvalidFileCacheIndex;
+        AZStd::chrono::system_clock::time_point oldest = AZStd::chrono::system_clock::time_point::max();
+        for (size_t index = 0; index < m_maxFileHandles; ++index)
+        {
+            if (m_fileCache_activeReads[index] == 0 && m_fileCache_lastTimeUsed[index] < oldest)
+            {
+                oldest = m_fileCache_lastTimeUsed[index];
+                cacheIndex = index;
+            }
+        }
+
+        return cacheIndex;
+    }
+
+    size_t StorageDriveLinux::FindAvailableReadSlot()
+    {
+        for (size_t i = 0; i < m_readSlots_active.size(); ++i)
+        {
+            if (!m_readSlots_active[i])
+            {
+                return i;
+            }
+        }
+        return InvalidReadSlotIndex;
+    }
+
+    size_t StorageDriveLinux::FindInMetaDataCache(const RequestPath& filePath) const
+    {
+        size_t numFiles = m_metaDataCache_paths.size();
+        for (size_t i = 0; i < numFiles; ++i)
+        {
+            if (m_metaDataCache_paths[i] == filePath)
+            {
+                return i;
+            }
+        }
+        return InvalidMetaDataCacheIndex;
+    }
+
+    size_t StorageDriveLinux::GetNextMetaDataCacheSlot()
+    {
+        m_metaDataCache_front = (m_metaDataCache_front + 1) & (m_metaDataCache_paths.size() - 1);
+        return m_metaDataCache_front;
+    }
+
+    void StorageDriveLinux::CollectStatistics(AZStd::vector<Statistic>& statistics) const
+    {
+        if (m_cachesInitialized)
+        {
+            constexpr double bytesToMB = aznumeric_cast<double>(1_mib);
+            using DoubleSeconds = AZStd::chrono::duration<double>;
+
+            double totalBytesReadMB = m_readSizeAverage.GetTotal() / bytesToMB;
+            double totalReadTimeSec = AZStd::chrono::duration_cast<DoubleSeconds>(m_readTimeAverage.GetTotal()).count();
+            statistics.push_back(Statistic::CreateFloat(m_name, "Read Speed (avg. mbps)", totalBytesReadMB / totalReadTimeSec));
+            statistics.push_back(Statistic::CreateInteger(m_name, "File Open & Close (avg. us)", m_fileOpenCloseTimeAverage.CalculateAverage().count()));
+            statistics.push_back(Statistic::CreateInteger(m_name, "Get file exists (avg. us)", m_getFileExistsTimeAverage.CalculateAverage().count()));
+            statistics.push_back(Statistic::CreateInteger(m_name, "Get file meta data (avg. us)", m_getFileMetaDataRetrievalTimeAverage.CalculateAverage().count()));
+            statistics.push_back(Statistic::CreateFloat(m_name, "Reads per submission (avg.)", m_submissionBatchSizeAverage.CalculateAverage()));
+
+            statistics.push_back(Statistic::CreateInteger(m_name, "Available slots", CalculateNumAvailableSlots()));
+
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+            statistics.push_back(Statistic::CreatePercentage(m_name, FileSwitchesName, m_fileSwitchPercentageStat.GetAverage()));
+            statistics.push_back(Statistic::CreatePercentage(m_name, SeeksName, m_seekPercentageStat.GetAverage()));
+            statistics.push_back(Statistic::CreatePercentage(m_name, DirectReadsName, m_directReadsPercentageStat.GetAverage()));
+#endif
+        }
+        StreamStackEntry::CollectStatistics(statistics);
+    }
+
+    void StorageDriveLinux::Report(const FileRequest::ReportData& data) const
+    {
+        switch (data.m_reportType)
+        {
+        case FileRequest::ReportData::ReportType::FileLocks:
+            if (m_cachesInitialized)
+            {
+                for (u32 i = 0; i < m_maxFileHandles; ++i)
+                {
+                    if (m_fileCache_handles[i] >= 0)
+                    {
+                        AZ_Printf("Streamer", "File lock in %s : '%s'.\n", m_name.c_str(), m_fileCache_paths[i].GetRelativePath());
+                    }
+                }
+            }
+            else
+            {
+                AZ_Printf("Streamer", "File lock in %s : No files have been streamed.\n", m_name.c_str());
+            }
+            break;
+        default:
+            break;
+        }
+    }
+} // namespace AZ::IO
@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <limits>
+#include <AzCore/IO/Streamer/IoUring_Linux.h>
+#include <AzCore/IO/Streamer/Statistics.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/chrono/clocks.h>
+#include <AzCore/Statistics/RunningStatistic.h>
+
+namespace AZ::IO
+{
+    //! Storage drive that uses io_uring to keep a deep queue of asynchronous reads in flight. Reads are issued in batches with a
+    //! single system call and completions are collected without blocking the Streamer thread. If io_uring isn't available on
+    //! the running kernel all requests are forwarded to the next entry in the stack, which is expected to be the generic
+    //! StorageDrive.
+    class StorageDriveLinux
+        : public StreamStackEntry
+    {
+    public:
+        struct ConstructionOptions
+        {
+            ConstructionOptions();
+
+            //! Whether or not the device has a cost for seeking, such as happens on platter disks. This
+            //! will be accounted for when predicting file reads.
+            u8 m_hasSeekPenalty : 1;
+            //! Use direct reads (O_DIRECT) for the fastest possible read speeds by bypassing the Linux page cache. This results
+            //! in a faster read the first time a file is read, but subsequent reads will possibly be slower as those could have
+            //! been serviced from the faster page cache. Direct reads have alignment restrictions, the drive will use an internal
+            //! buffer for reads that don't meet them. If the file system doesn't support direct reads, such as tmpfs, the file
+            //! will be read through the page cache instead.
+            u8 m_enableUnbufferedReads : 1;
+            //! If true, only information that's explicitly requested or issues are reported. If false, status information
+            //! such as when drives are created and destroyed is reported as well.
+            u8 m_minimalReporting : 1;
+        };
+
+        //! Creates an instance of a storage device that's optimized for use on Linux.
+        //! @param maxFileHandles The maximum number of file handles that are cached. Only a small number are needed when
+        //!     running from archives, but it's recommended that a larger number are kept open when reading from loose files.
+        //! @param maxMetaDataCacheEntries The maximum number of files to keep meta data, such as the file size, to cache. Only
+        //!     a small number are needed when running from archives, but it's recommended that a larger number are kept open
+        //!     when reading from loose files. This needs to be a power of 2.
+        //! @param physicalSectorSize The minimal sector size as instructed by the device. When unbuffered reads are used the output
+        //!     buffer needs to be aligned to this value.
+        //! @param logicalSectorSize The minimal sector size as instructed by the device. When unbuffered reads are used the
+        //!     file size and read offset need to be aligned to this value.
+        //! @param queueDepth The maximum number of reads that are kept in flight at the same time.
+        //! @param overCommit The number of additional slots that will be reported as available. This makes sure that there are
+        //!     always a few requests pending to avoid starvation. An over-commit that is too large can negatively impact the
+        //!     scheduler's ability to re-order requests for optimal read order. A negative value will under-commit and will
+        //!     avoid saturating the IO controller which can be needed if the drive is used by other applications.
+        //! @param options Additional configuration options. See ConstructionOptions for more details.
+        StorageDriveLinux(u32 maxFileHandles, u32 maxMetaDataCacheEntries, size_t physicalSectorSize, size_t logicalSectorSize,
+            u32 queueDepth, s32 overCommit, ConstructionOptions options);
+        ~StorageDriveLinux() override;
+
+        //! Whether or not io_uring could be initialized. If not, all requests are forwarded to the next entry in the stack.
+        bool IsAvailable() const;
+
+        void PrepareRequest(FileRequest* request) override;
+        void QueueRequest(FileRequest* request) override;
+        bool ExecuteRequests() override;
+
+        void UpdateStatus(Status& status) const override;
+        void UpdateCompletionEstimates(AZStd::chrono::system_clock::time_point now, AZStd::vector<FileRequest*>& internalPending,
+            StreamerContext::PreparedQueue::iterator pendingBegin, StreamerContext::PreparedQueue::iterator pendingEnd) override;
+
+        void CollectStatistics(AZStd::vector<Statistic>& statistics) const override;
+
+    protected:
+        static const AZStd::chrono::microseconds s_averageSeekTime;
+
+        inline static constexpr size_t InvalidFileCacheIndex = std::numeric_limits<size_t>::max();
+        inline static constexpr size_t InvalidReadSlotIndex = std::numeric_limits<size_t>::max();
+        inline static constexpr size_t InvalidMetaDataCacheIndex = std::numeric_limits<size_t>::max();
+        //! User data for cancel operations, as opposed to reads which use the index of their read slot.
+        inline static constexpr u64 CancelUserData = std::numeric_limits<u64>::max();
+
+        struct FileReadInformation
+        {
+            AZStd::chrono::system_clock::time_point m_startTime;
+            FileRequest* m_request{ nullptr };
+            void* m_sectorAlignedOutput{ nullptr };    // Internally allocated buffer that is sector aligned.
+            iovec m_buffer{};                           // The buffer the kernel reads into. Needs to stay alive during the read.
+            size_t m_copyBackOffset{ 0 };
+            size_t m_fileHandleIndex{ InvalidFileCacheIndex };
+            u64 m_readOffset{ 0 };                      // File offset the next (partial) read of m_buffer starts at.
+            u64 m_bytesRead{ 0 };                       // Total bytes read so far, across all partial reads.
+            bool m_cancelRequested{ false };
+
+            void AllocateAlignedBuffer(size_t size, size_t sectorSize);
+            void Clear();
+        };
+
+        enum class OpenFileResult
+        {
+            FileOpened,
+            RequestForwarded,
+            CacheFull
+        };
+
+        OpenFileResult OpenFile(int& fileHandle, size_t& cacheSlot, FileRequest* request, const FileRequest::ReadData& data);
+        bool ReadRequest(FileRequest* request);
+        bool CancelRequest(FileRequest* cancelRequest, FileRequestPtr& target);
+        void FileExistsRequest(FileRequest* request);
+        void FileMetaDataRetrievalRequest(FileRequest* request);
+        size_t FindInFileHandleCache(const RequestPath& filePath) const;
+        size_t FindAvailableFileHandleCacheIndex() const;
+        size_t FindAvailableReadSlot();
+        size_t FindInMetaDataCache(const RequestPath& filePath) const;
+        size_t GetNextMetaDataCacheSlot();
+
+        void EstimateCompletionTimeForRequest(FileRequest* request, AZStd::chrono::system_clock::time_point& startTime,
+            const RequestPath*& activeFile, u64& activeOffset) const;
+        s32 CalculateNumAvailableSlots() const;
+
+        void CloseFileHandle(size_t cacheIndex);
+        void FlushCache(const RequestPath& filePath);
+        void FlushEntireCache();
+
+        bool SubmitReads();
+        bool ResubmitReads();
+        bool QueueRemainingRead(size_t readSlot);
+        bool FinalizeReads();
+        void FinalizeSingleRequest(size_t readSlot, s32 result);
+
+        void Report(const FileRequest::ReportData& data) const;
+
+        IoUring m_ioUring;
+
+        TimedAverageWindow<s_statisticsWindowSize> m_fileOpenCloseTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_getFileExistsTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_getFileMetaDataRetrievalTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_readTimeAverage;
+        AverageWindow<u64, float, s_statisticsWindowSize> m_readSizeAverage;
+        AverageWindow<u64, float, s_statisticsWindowSize> m_submissionBatchSizeAverage;
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+        AZ::Statistics::RunningStatistic m_fileSwitchPercentageStat;
+        AZ::Statistics::RunningStatistic m_seekPercentageStat;
+        AZ::Statistics::RunningStatistic m_directReadsPercentageStat;
+#endif
+        AZStd::chrono::system_clock::time_point m_activeReads_startTime;
+
+        AZStd::deque<FileRequest*> m_pendingReadRequests;
+        AZStd::deque<FileRequest*> m_pendingRequests;
+        //! Read slots of short or interrupted reads for which the remainder couldn't be queued because the ring was full.
+        AZStd::deque<size_t> m_pendingResubmits;
+
+        AZStd::vector<FileReadInformation> m_readSlots_readInfo;
+        AZStd::vector<bool> m_readSlots_active;
+
+        AZStd::vector<AZStd::chrono::system_clock::time_point> m_fileCache_lastTimeUsed;
+        AZStd::vector<RequestPath> m_fileCache_paths;
+        AZStd::vector<int> m_fileCache_handles;
+        AZStd::vector<u16> m_fileCache_activeReads;
+        AZStd::vector<bool> m_fileCache_isDirect;
+
+        AZStd::vector<RequestPath> m_metaDataCache_paths;
+        AZStd::vector<u64> m_metaDataCache_fileSize;
+
+        size_t m_activeReads_ByteCount{ 0 };
+
+        size_t m_physicalSectorSize{ 0 };
+        size_t m_logicalSectorSize{ 0 };
+        size_t m_activeCacheSlot{ InvalidFileCacheIndex };
+        size_t m_metaDataCache_front{ 0 };
+        u64 m_activeOffset{ 0 };
+        u32 m_maxFileHandles{ 1 };
+        u32 m_queueDepth{ 1 };
+        s32 m_overCommit{ 0 };
+
+        u16 m_activeReads_Count{ 0 };
+
+        ConstructionOptions m_constructionOptions;
+        bool m_cachesInitialized{ false };
+    };
+} // namespace AZ::IO
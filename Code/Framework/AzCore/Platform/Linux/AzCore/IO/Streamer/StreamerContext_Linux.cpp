@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <errno.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <AzCore/IO/Streamer/StreamerContext_Linux.h>
+#include <AzCore/std/utils.h>
+
+namespace AZ::Platform
+{
+    StreamerContextThreadSync::StreamerContextThreadSync()
+    {
+        m_events[0].fd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        m_events[0].events = POLLIN;
+        AZ_Assert(m_events[0].fd >= 0, "Failed to create a required event for IO Scheduler (Error: %i).", errno);
+    }
+
+    StreamerContextThreadSync::~StreamerContextThreadSync()
+    {
+        AZ_Assert(m_eventCount == 1, "There are still %u IO events registered with the IO Scheduler.", m_eventCount - 1);
+        if (m_events[0].fd >= 0)
+        {
+            ::close(m_events[0].fd);
+        }
+    }
+
+    void StreamerContextThreadSync::Suspend()
+    {
+        AZ_Assert(m_events[0].fd >= 0, "There is no synchronization event created for the main streamer thread to use to suspend.");
+
+        int result = 0;
+        do
+        {
+            result = ::poll(m_events, m_eventCount, -1);
+        } while (result < 0 && errno == EINTR);
+        AZ_Assert(result > 0, "Unexpected poll result: %i (Error: %i).", result, errno);
+
+        // Reset all signaled events. The owners of the IO events check for completed work themselves, so the only purpose of
+        // the event is to wake up this thread.
+        for (nfds_t i = 0; i < m_eventCount; ++i)
+        {
+            if (m_events[i].revents & POLLIN)
+            {
+                eventfd_t value;
+                ::eventfd_read(m_events[i].fd, &value);
+            }
+        }
+    }
+
+    void StreamerContextThreadSync::Resume()
+    {
+        AZ_Assert(m_events[0].fd >= 0, "There is no synchronization event created for the main streamer thread to use to resume.");
+        ::eventfd_write(m_events[0].fd, 1);
+    }
+
+    bool StreamerContextThreadSync::AddIoEvent(int eventFd)
+    {
+        if (!AreIoEventsAvailable())
+        {
+            return false;
+        }
+        m_events[m_eventCount].fd = eventFd;
+        m_events[m_eventCount].events = POLLIN;
+        m_events[m_eventCount].revents = 0;
+        m_eventCount++;
+        return true;
+    }
+
+    void StreamerContextThreadSync::RemoveIoEvent(int eventFd)
+    {
+        for (nfds_t i = 1; i < m_eventCount; ++i)
+        {
+            if (m_events[i].fd == eventFd)
+            {
+                m_eventCount--;
+                AZStd::swap(m_events[i], m_events[m_eventCount]);
+                return;
+            }
+        }
+
+        AZ_Assert(false, "IO event couldn't be removed as it wasn't found.");
+    }
+
+    bool StreamerContextThreadSync::AreIoEventsAvailable() const
+    {
+        return m_eventCount < AZ_ARRAY_SIZE(m_events);
+    }
+} // namespace AZ::Platform
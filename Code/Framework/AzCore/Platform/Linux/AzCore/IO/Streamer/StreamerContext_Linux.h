@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <poll.h>
+#include <AzCore/base.h>
+
+namespace AZ::Platform
+{
+    class StreamerContextThreadSync
+    {
+    public:
+        static constexpr size_t MaxIoEvents = 15;
+
+        StreamerContextThreadSync();
+        ~StreamerContextThreadSync();
+
+        void Suspend();
+        void Resume();
+
+        //! Adds a non-blocking event file descriptor, such as the completion event of an io_uring, that wakes up the
+        //! Streamer thread when it's signaled. Returns false if there are no more slots available for IO events.
+        bool AddIoEvent(int eventFd);
+        void RemoveIoEvent(int eventFd);
+        bool AreIoEventsAvailable() const;
+
+    private:
+        // Note: The first event is reserved for the synchronization of the scheduler thread with the rest of the engine.
+        // The remaining events can be freely used by Streamer's internals.
+        pollfd m_events[MaxIoEvents + 1]{};
+        nfds_t m_eventCount{ 1 }; // The first event is for external wake up calls.
+    };
+
+} // namespace AZ::Platform
@@ -10,6 +10,7 @@
 
 #include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/MappedFileView.h>
 #include <AzCore/IO/Streamer/FileRequest.h>
 #include <AzCore/IO/Streamer/StreamerContext.h>
 #include <AzCore/IO/Streamer/StorageDrive_Windows.h>
@@ -183,6 +184,17 @@ namespace AZ::IO
                 return;
             }
         }
+        else if (AZStd::holds_alternative<FileRequest::MapRequestData>(request->GetCommand()))
+        {
+            auto& mapRequest = AZStd::get<FileRequest::MapRequestData>(request->GetCommand());
+            if (IsServicedByThisDrive(mapRequest.m_path.GetAbsolutePath()))
+            {
+                FileRequest* map = m_context->GetNewInternalRequest();
+                map->CreateMap(request, mapRequest.m_path, mapRequest.m_offset, mapRequest.m_size);
+                m_context->PushPreparedRequest(map);
+                return;
+            }
+        }
         StreamStackEntry::PrepareRequest(request);
     }
 
@@ -203,7 +215,8 @@ namespace AZ::IO
                 }
             }
             else if constexpr (AZStd::is_same_v<Command, FileRequest::FileExistsCheckData> ||
-                AZStd::is_same_v<Command, FileRequest::FileMetaDataRetrievalData>)
+                AZStd::is_same_v<Command, FileRequest::FileMetaDataRetrievalData> ||
+                AZStd::is_same_v<Command, FileRequest::MapData>)
             {
                 if (IsServicedByThisDrive(args.m_path.GetAbsolutePath()))
                 {
@@ -268,6 +281,12 @@ namespace AZ::IO
                     m_pendingRequests.pop_front();
                     return true;
                 }
+                else if constexpr (AZStd::is_same_v<Command, FileRequest::MapData>)
+                {
+                    MapFileRequest(request);
+                    m_pendingRequests.pop_front();
+                    return true;
+                }
                 else
                 {
                     AZ_Assert(false, "A request was added to StorageDriveWin's pending queue that isn't supported.");
@@ -377,6 +396,12 @@ namespace AZ::IO
                 AZStd::chrono::microseconds getFileExistsTimeAverage = m_getFileMetaDataRetrievalTimeAverage.CalculateAverage();
                 startTime += getFileExistsTimeAverage;
             }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::MapData>)
+            {
+                readSize = 0;
+                AZStd::chrono::microseconds mapTimeAverage = m_mapTimeAverage.CalculateAverage();
+                startTime += mapTimeAverage;
+            }
         }, request->GetCommand());
 
         if (readSize > 0)
@@ -411,7 +436,8 @@ namespace AZ::IO
         {
             using Command = AZStd::decay_t<decltype(args)>;
             if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData> ||
-                          AZStd::is_same_v<Command, FileRequest::FileExistsCheckData>)
+                          AZStd::is_same_v<Command, FileRequest::FileExistsCheckData> ||
+                          AZStd::is_same_v<Command, FileRequest::MapData>)
             {
                 if (IsServicedByThisDrive(args.m_path.GetAbsolutePath()))
                 {
@@ -888,6 +914,23 @@ namespace AZ::IO
         m_context->MarkRequestAsCompleted(request);
     }
 
+    void StorageDriveWin::MapFileRequest(FileRequest* request)
+    {
+        auto& data = AZStd::get<FileRequest::MapData>(request->GetCommand());
+
+        AZ_PROFILE_SCOPE_DYNAMIC(AZ::Debug::ProfileCategory::AzCore, "StorageDriveWin::MapFileRequest %s : %s",
+            m_name.c_str(), data.m_path.GetRelativePath());
+        TIMED_AVERAGE_WINDOW_SCOPE(m_mapTimeAverage);
+
+        auto mapRequest = request->GetCommandFromChain<FileRequest::MapRequestData>();
+        AZ_Assert(mapRequest, "Map command for '%s' isn't part of a map request.", data.m_path.GetRelativePath());
+
+        // Mapping is done through a separate file handle as the cached handles may have been opened for unbuffered reads.
+        mapRequest->m_view = MappedFileView::Create(data.m_path.GetAbsolutePath(), data.m_offset, data.m_size);
+        request->SetStatus(mapRequest->m_view ? IStreamerTypes::RequestStatus::Completed : IStreamerTypes::RequestStatus::Failed);
+        m_context->MarkRequestAsCompleted(request);
+    }
+
     void StorageDriveWin::FlushCache(const RequestPath& filePath)
     {
         if (m_cachesInitialized)
@@ -1128,6 +1171,7 @@ namespace AZ::IO
             statistics.push_back(Statistic::CreateInteger(m_name, "File Open & Close (avg. us)", m_fileOpenCloseTimeAverage.CalculateAverage().count()));
             statistics.push_back(Statistic::CreateInteger(m_name, "Get file exists (avg. us)", m_getFileExistsTimeAverage.CalculateAverage().count()));
             statistics.push_back(Statistic::CreateInteger(m_name, "Get file meta data (avg. us)", m_getFileMetaDataRetrievalTimeAverage.CalculateAverage().count()));
+            statistics.push_back(Statistic::CreateInteger(m_name, "Map file (avg. us)", m_mapTimeAverage.CalculateAverage().count()));
 
             statistics.push_back(Statistic::CreateInteger(m_name, "Available slots", CalculateNumAvailableSlots()));
 
@@ -117,6 +117,7 @@ namespace AZ::IO
         bool CancelRequest(FileRequest* cancelRequest, FileRequestPtr& target);
         void FileExistsRequest(FileRequest* request);
         void FileMetaDataRetrievalRequest(FileRequest* request);
+        void MapFileRequest(FileRequest* request);
         size_t FindInFileHandleCache(const RequestPath& filePath) const;
         size_t FindAvailableFileHandleCacheIndex() const;
         size_t FindAvailableReadSlot();
@@ -143,6 +144,7 @@ namespace AZ::IO
         TimedAverageWindow<s_statisticsWindowSize> m_getFileExistsTimeAverage;
         TimedAverageWindow<s_statisticsWindowSize> m_getFileMetaDataRetrievalTimeAverage;
         TimedAverageWindow<s_statisticsWindowSize> m_readTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_mapTimeAverage;
         AverageWindow<u64, float, s_statisticsWindowSize> m_readSizeAverage;
 #if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
         AZ::Statistics::RunningStatistic m_fileSwitchPercentageStat;
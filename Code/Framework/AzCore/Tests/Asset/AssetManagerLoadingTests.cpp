@@ -27,6 +27,7 @@
 #include <AZTestShared/Utils/Utils.h>
 #include <Streamer/IStreamerMock.h>
 #include <Tests/Asset/BaseAssetManagerTest.h>
+#include <Tests/Asset/MockLoadAssetCatalogAndHandler.h>
 #include <Tests/Asset/TestAssetTypes.h>
 #include <Tests/SerializeContextFixture.h>
 #include <Tests/TestCatalog.h>
@@ -1036,6 +1037,376 @@ namespace UnitTest
         m_assetHandlerAndCatalog->AssetCatalogRequestBus::Handler::BusDisconnect();
     }
 
+    struct ContainerDebugListener : AZ::Interface<IDebugAssetEvent>::Registrar
+    {
+        void AssetStatusUpdate([[maybe_unused]] AZ::Data::AssetId id, [[maybe_unused]] AZ::Data::AssetData::AssetStatus status) override {}
+        void ReleaseAsset([[maybe_unused]] AZ::Data::AssetId id) override {}
+        void AssetContainerReady(AZ::Data::AssetId id, AZStd::chrono::milliseconds timeToReady) override
+        {
+            m_readyContainers.push_back(id);
+            m_timeToReady = timeToReady;
+        }
+
+        AZStd::vector<AZ::Data::AssetId> m_readyContainers;
+        AZStd::chrono::milliseconds m_timeToReady{ -1 };
+    };
+
+    // Forwards everything to a real streamer and records the deadline each file was first read with.
+    class DeadlineRecordingStreamer
+        : public IO::IStreamer
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(DeadlineRecordingStreamer, AZ::SystemAllocator, 0);
+
+        DeadlineRecordingStreamer()
+            : m_streamer(AZStd::thread_desc{}, StreamerComponent::CreateStreamerStack())
+        {
+        }
+
+        // Returns the deadline the file was read with, or no deadline if it wasn't read.
+        AZStd::chrono::microseconds GetReadDeadline(AZStd::string_view relativePath) const
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_deadlineMutex);
+            auto deadlineIt = m_readDeadlines.find(AZStd::string(relativePath));
+            return deadlineIt != m_readDeadlines.end() ? deadlineIt->second : IO::IStreamerTypes::s_noDeadline;
+        }
+
+        FileRequestPtr Read(AZStd::string_view relativePath, void* outputBuffer, size_t outputBufferSize, size_t readSize,
+            AZStd::chrono::microseconds deadline, IO::IStreamerTypes::Priority priority, size_t offset) override
+        {
+            RecordDeadline(relativePath, deadline);
+            return m_streamer.Read(relativePath, outputBuffer, outputBufferSize, readSize, deadline, priority, offset);
+        }
+        FileRequestPtr& Read(FileRequestPtr& request, AZStd::string_view relativePath, void* outputBuffer, size_t outputBufferSize,
+            size_t readSize, AZStd::chrono::microseconds deadline, IO::IStreamerTypes::Priority priority, size_t offset) override
+        {
+            RecordDeadline(relativePath, deadline);
+            return m_streamer.Read(request, relativePath, outputBuffer, outputBufferSize, readSize, deadline, priority, offset);
+        }
+        FileRequestPtr Read(AZStd::string_view relativePath, IO::IStreamerTypes::RequestMemoryAllocator& allocator, size_t size,
+            AZStd::chrono::microseconds deadline, IO::IStreamerTypes::Priority priority, size_t offset) override
+        {
+            RecordDeadline(relativePath, deadline);
+            return m_streamer.Read(relativePath, allocator, size, deadline, priority, offset);
+        }
+        FileRequestPtr& Read(FileRequestPtr& request, AZStd::string_view relativePath, IO::IStreamerTypes::RequestMemoryAllocator& allocator,
+            size_t size, AZStd::chrono::microseconds deadline, IO::IStreamerTypes::Priority priority, size_t offset) override
+        {
+            RecordDeadline(relativePath, deadline);
+            return m_streamer.Read(request, relativePath, allocator, size, deadline, priority, offset);
+        }
+
+        FileRequestPtr Map(AZStd::string_view relativePath, size_t size, size_t offset) override
+        {
+            return m_streamer.Map(relativePath, size, offset);
+        }
+        FileRequestPtr& Map(FileRequestPtr& request, AZStd::string_view relativePath, size_t size, size_t offset) override
+        {
+            return m_streamer.Map(request, relativePath, size, offset);
+        }
+        FileRequestPtr Cancel(FileRequestPtr target) override { return m_streamer.Cancel(target); }
+        FileRequestPtr& Cancel(FileRequestPtr& request, FileRequestPtr target) override { return m_streamer.Cancel(request, target); }
+        FileRequestPtr RescheduleRequest(
+            FileRequestPtr target, AZStd::chrono::microseconds newDeadline, IO::IStreamerTypes::Priority newPriority) override
+        {
+            return m_streamer.RescheduleRequest(target, newDeadline, newPriority);
+        }
+        FileRequestPtr& RescheduleRequest(FileRequestPtr& request, FileRequestPtr target, AZStd::chrono::microseconds newDeadline,
+            IO::IStreamerTypes::Priority newPriority) override
+        {
+            return m_streamer.RescheduleRequest(request, target, newDeadline, newPriority);
+        }
+        FileRequestPtr CreateDedicatedCache(AZStd::string_view relativePath) override { return m_streamer.CreateDedicatedCache(relativePath); }
+        FileRequestPtr& CreateDedicatedCache(FileRequestPtr& request, AZStd::string_view relativePath) override
+        {
+            return m_streamer.CreateDedicatedCache(request, relativePath);
+        }
+        FileRequestPtr DestroyDedicatedCache(AZStd::string_view relativePath) override { return m_streamer.DestroyDedicatedCache(relativePath); }
+        FileRequestPtr& DestroyDedicatedCache(FileRequestPtr& request, AZStd::string_view relativePath) override
+        {
+            return m_streamer.DestroyDedicatedCache(request, relativePath);
+        }
+        FileRequestPtr FlushCache(AZStd::string_view relativePath) override { return m_streamer.FlushCache(relativePath); }
+        FileRequestPtr& FlushCache(FileRequestPtr& request, AZStd::string_view relativePath) override
+        {
+            return m_streamer.FlushCache(request, relativePath);
+        }
+        FileRequestPtr FlushCaches() override { return m_streamer.FlushCaches(); }
+        FileRequestPtr& FlushCaches(FileRequestPtr& request) override { return m_streamer.FlushCaches(request); }
+        FileRequestPtr Custom(AZStd::any data) override { return m_streamer.Custom(AZStd::move(data)); }
+        FileRequestPtr& Custom(FileRequestPtr& request, AZStd::any data) override { return m_streamer.Custom(request, AZStd::move(data)); }
+        FileRequestPtr& SetRequestCompleteCallback(FileRequestPtr& request, OnCompleteCallback callback) override
+        {
+            return m_streamer.SetRequestCompleteCallback(request, AZStd::move(callback));
+        }
+        FileRequestPtr CreateRequest() override { return m_streamer.CreateRequest(); }
+        void CreateRequestBatch(AZStd::vector<FileRequestPtr>& requests, size_t count) override { m_streamer.CreateRequestBatch(requests, count); }
+        void QueueRequest(const FileRequestPtr& request) override { m_streamer.QueueRequest(request); }
+        void QueueRequestBatch(const AZStd::vector<FileRequestPtr>& requests) override { m_streamer.QueueRequestBatch(requests); }
+        void QueueRequestBatch(AZStd::vector<FileRequestPtr>&& requests) override { m_streamer.QueueRequestBatch(AZStd::move(requests)); }
+        bool HasRequestCompleted(FileRequestHandle request) const override { return m_streamer.HasRequestCompleted(request); }
+        IO::IStreamerTypes::RequestStatus GetRequestStatus(FileRequestHandle request) const override
+        {
+            return m_streamer.GetRequestStatus(request);
+        }
+        AZStd::chrono::system_clock::time_point GetEstimatedRequestCompletionTime(FileRequestHandle request) const override
+        {
+            return m_streamer.GetEstimatedRequestCompletionTime(request);
+        }
+        bool GetReadRequestResult(FileRequestHandle request, void*& buffer, AZ::u64& numBytesRead,
+            IO::IStreamerTypes::ClaimMemory claimMemory) const override
+        {
+            return m_streamer.GetReadRequestResult(request, buffer, numBytesRead, claimMemory);
+        }
+        bool GetMapRequestResult(FileRequestHandle request, MappedFileViewPtr& view) const override
+        {
+            return m_streamer.GetMapRequestResult(request, view);
+        }
+        void CollectStatistics(AZStd::vector<Statistic>& statistics) override { m_streamer.CollectStatistics(statistics); }
+        const IO::IStreamerTypes::Recommendations& GetRecommendations() const override { return m_streamer.GetRecommendations(); }
+        void SuspendProcessing() override { m_streamer.SuspendProcessing(); }
+        void ResumeProcessing() override { m_streamer.ResumeProcessing(); }
+
+    private:
+        void RecordDeadline(AZStd::string_view relativePath, AZStd::chrono::microseconds deadline)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_deadlineMutex);
+            m_readDeadlines.emplace(AZStd::string(relativePath), deadline);
+        }
+
+        IO::Streamer m_streamer;
+        mutable AZStd::mutex m_deadlineMutex;
+        AZStd::unordered_map<AZStd::string, AZStd::chrono::microseconds> m_readDeadlines;
+    };
+
+    // Loads containers through a streamer that records the deadline of every read, with a console to toggle the deadline grading.
+    class AssetContainerDeadlineTest
+        : public AssetJobsFloodTest
+    {
+    public:
+        static constexpr AZStd::chrono::milliseconds ContainerDeadline{ 1200 };
+
+        void SetUp() override
+        {
+            AssetJobsFloodTest::SetUp();
+
+            m_console = AZStd::make_unique<AZ::Console>();
+            AZ::Interface<AZ::IConsole>::Register(m_console.get());
+            m_console->LinkDeferredFunctors(AZ::ConsoleFunctorBase::GetDeferredHead());
+        }
+
+        void TearDown() override
+        {
+            // The cvar is global, restore it for the tests that follow
+            m_console->PerformCommand("cl_assetContainerGradedDeadlines true");
+            AZ::Interface<AZ::IConsole>::Unregister(m_console.get());
+            m_console = nullptr;
+
+            AssetJobsFloodTest::TearDown();
+        }
+
+        IO::IStreamer* CreateStreamer() override
+        {
+            m_recordingStreamer = aznew DeadlineRecordingStreamer();
+            return m_recordingStreamer;
+        }
+
+        void DestroyStreamer(IO::IStreamer* streamer) override
+        {
+            delete streamer;
+            m_recordingStreamer = nullptr;
+        }
+
+        AZStd::chrono::milliseconds GetReadDeadline(const char* fileName) const
+        {
+            return AZStd::chrono::duration_cast<AZStd::chrono::milliseconds>(m_recordingStreamer->GetReadDeadline(fileName));
+        }
+
+        void LoadContainerWithDeadline(const AssetId& rootId, AZStd::function<void(AssetContainer&)> verify)
+        {
+            ContainerReadyListener readyListener(rootId);
+
+            AssetLoadParameters loadParams;
+            loadParams.m_deadline = ContainerDeadline;
+
+            auto asset = m_testAssetManager->FindOrCreateAsset(
+                rootId, azrtti_typeid<AssetWithQueueAndPreLoadReferences>(), AZ::Data::AssetLoadBehavior::Default);
+            auto containerReady = m_testAssetManager->GetAssetContainer(asset, loadParams);
+
+            auto maxTimeout = AZStd::chrono::system_clock::now() + DefaultTimeoutSeconds;
+
+            while (!readyListener.m_ready)
+            {
+                m_testAssetManager->DispatchEvents();
+                if (AZStd::chrono::system_clock::now() > maxTimeout)
+                {
+                    break;
+                }
+                AZStd::this_thread::yield();
+            }
+            EXPECT_EQ(containerReady->IsReady(), true);
+            verify(*containerReady);
+        }
+
+        DeadlineRecordingStreamer* m_recordingStreamer{ nullptr };
+        AZStd::unique_ptr<AZ::Console> m_console;
+    };
+
+#if AZ_TRAIT_DISABLE_FAILED_ASSET_MANAGER_TESTS
+    TEST_F(AssetContainerDeadlineTest, DISABLED_ContainerLoadTest_PreloadChainWithDeadline_ReportsTimeToReady)
+#else
+    TEST_F(AssetContainerDeadlineTest, ContainerLoadTest_PreloadChainWithDeadline_ReportsTimeToReady)
+#endif // !AZ_TRAIT_DISABLE_FAILED_ASSET_MANAGER_TESTS
+    {
+        m_assetHandlerAndCatalog->AssetCatalogRequestBus::Handler::BusConnect();
+        // Setup has already created/destroyed assets
+        m_assetHandlerAndCatalog->m_numCreations = 0;
+        m_assetHandlerAndCatalog->m_numDestructions = 0;
+        {
+            // The preload dependencies get graded deadlines, this shouldn't change the order in which they signal ready
+            ContainerDebugListener debugListener;
+            OnAssetReadyListener preLoadRootListener(PreloadAssetRootId, azrtti_typeid<AssetWithQueueAndPreLoadReferences>());
+            OnAssetReadyListener preLoadAListener(PreloadAssetAId, azrtti_typeid<AssetWithQueueAndPreLoadReferences>());
+            OnAssetReadyListener preLoadBListener(PreloadAssetBId, azrtti_typeid<AssetWithQueueAndPreLoadReferences>());
+            preLoadRootListener.m_readyCheck = [&]([[maybe_unused]] const OnAssetReadyListener& thisListener)
+            {
+                return (preLoadAListener.m_ready && preLoadBListener.m_ready);
+            };
+            preLoadAListener.m_readyCheck = [&]([[maybe_unused]] const OnAssetReadyListener& thisListener)
+            {
+                return (preLoadBListener.m_ready > 0);
+            };
+
+            LoadContainerWithDeadline(PreloadAssetRootId, [&](AssetContainer& container)
+            {
+                EXPECT_EQ(preLoadRootListener.m_ready, 1);
+                EXPECT_EQ(preLoadAListener.m_ready, 1);
+                EXPECT_EQ(preLoadBListener.m_ready, 1);
+
+                ASSERT_EQ(debugListener.m_readyContainers.size(), 1);
+                EXPECT_EQ(debugListener.m_readyContainers[0], PreloadAssetRootId);
+                EXPECT_EQ(debugListener.m_timeToReady, container.GetTimeToReady());
+                EXPECT_GE(debugListener.m_timeToReady.count(), 0);
+            });
+
+            // Root -> PreLoadA -> PreLoadB, the deeper an asset is in the preload chain the earlier it has to be read
+            EXPECT_EQ(GetReadDeadline("PreLoadRoot.txt"), ContainerDeadline);
+            EXPECT_LT(GetReadDeadline("PreLoadA.txt"), GetReadDeadline("PreLoadRoot.txt"));
+            EXPECT_LT(GetReadDeadline("PreLoadB.txt"), GetReadDeadline("PreLoadA.txt"));
+            EXPECT_GT(GetReadDeadline("PreLoadB.txt").count(), 0);
+            // QueueLoadA isn't a preload of anything so it keeps the deadline of the container, its own preload is graded
+            EXPECT_EQ(GetReadDeadline("QueueLoadA.txt"), ContainerDeadline);
+            EXPECT_LT(GetReadDeadline("PreLoadC.txt"), GetReadDeadline("QueueLoadA.txt"));
+        }
+
+        CheckFinishedCreationsAndDestructions();
+        m_assetHandlerAndCatalog->AssetCatalogRequestBus::Handler::BusDisconnect();
+    }
+
+#if AZ_TRAIT_DISABLE_FAILED_ASSET_MANAGER_TESTS
+    TEST_F(AssetContainerDeadlineTest, DISABLED_ContainerLoadTest_GradedDeadlinesDisabled_DependenciesUseContainerDeadline)
+#else
+    TEST_F(AssetContainerDeadlineTest, ContainerLoadTest_GradedDeadlinesDisabled_DependenciesUseContainerDeadline)
+#endif // !AZ_TRAIT_DISABLE_FAILED_ASSET_MANAGER_TESTS
+    {
+        m_console->PerformCommand("cl_assetContainerGradedDeadlines false");
+        bool gradedDeadlines = true;
+        EXPECT_EQ(m_console->GetCvarValue("cl_assetContainerGradedDeadlines", gradedDeadlines), GetValueResult::Success);
+        EXPECT_FALSE(gradedDeadlines);
+
+        m_assetHandlerAndCatalog->AssetCatalogRequestBus::Handler::BusConnect();
+        // Setup has already created/destroyed assets
+        m_assetHandlerAndCatalog->m_numCreations = 0;
+        m_assetHandlerAndCatalog->m_numDestructions = 0;
+        {
+            LoadContainerWithDeadline(PreloadAssetRootId, [](AssetContainer& container)
+            {
+                EXPECT_EQ(container.GetInvalidDependencies(), 0);
+            });
+
+            for (const char* fileName : { "PreLoadRoot.txt", "PreLoadA.txt", "PreLoadB.txt", "QueueLoadA.txt", "PreLoadC.txt" })
+            {
+                EXPECT_EQ(GetReadDeadline(fileName), ContainerDeadline) << fileName;
+            }
+        }
+
+        CheckFinishedCreationsAndDestructions();
+        m_assetHandlerAndCatalog->AssetCatalogRequestBus::Handler::BusDisconnect();
+    }
+
+    // Exposes the preload depth calculation so it can be run on preload lists the container setup would have rejected.
+    class PreloadDepthTestContainer
+        : public AssetContainer
+    {
+    public:
+        using AssetContainer::CalculatePreloadDepth;
+        using AssetContainer::m_preloadList;
+    };
+
+    TEST_F(AssetContainerDeadlineTest, CalculatePreloadDepth_CircularPreloadChain_Terminates)
+    {
+        const AssetId loopAId(AZ::Uuid("{0C5E9D5A-1E3B-4C47-9B53-7D2E3A1F6B01}"));
+        const AssetId loopBId(AZ::Uuid("{0C5E9D5A-1E3B-4C47-9B53-7D2E3A1F6B02}"));
+        const AssetId loopCId(AZ::Uuid("{0C5E9D5A-1E3B-4C47-9B53-7D2E3A1F6B03}"));
+        const AssetId leafId(AZ::Uuid("{0C5E9D5A-1E3B-4C47-9B53-7D2E3A1F6B04}"));
+
+        // A -> B -> C -> A, with C also preloading a leaf.  Longer loops like this one aren't caught by SetupPreloadLists.
+        PreloadDepthTestContainer container;
+        container.m_preloadList[loopAId] = { loopBId };
+        container.m_preloadList[loopBId] = { loopCId };
+        container.m_preloadList[loopCId] = { loopAId, leafId };
+
+        AZStd::unordered_map<AssetId, int> depths;
+        const int depthA = container.CalculatePreloadDepth(loopAId, depths);
+
+        EXPECT_EQ(depths[leafId], 0);
+        EXPECT_EQ(depths[loopCId], 1);
+        EXPECT_EQ(depths[loopBId], 2);
+        EXPECT_EQ(depthA, 3);
+
+        // Entering the loop anywhere else uses the cached depths
+        EXPECT_EQ(container.CalculatePreloadDepth(loopCId, depths), 1);
+    }
+
+    // The catalog has D -> B <-> C, the loop is broken during the container setup and the remaining chain is still graded
+#if AZ_TRAIT_DISABLE_FAILED_ASSET_MANAGER_TESTS
+    TEST_F(AssetContainerDeadlineTest, DISABLED_ContainerLoadTest_CircularPreloadWithDeadline_LoadCompletes)
+#else
+    TEST_F(AssetContainerDeadlineTest, ContainerLoadTest_CircularPreloadWithDeadline_LoadCompletes)
+#endif // !AZ_TRAIT_DISABLE_FAILED_ASSET_MANAGER_TESTS
+    {
+        m_assetHandlerAndCatalog->AssetCatalogRequestBus::Handler::BusConnect();
+        // Setup has already created/destroyed assets
+        m_assetHandlerAndCatalog->m_numCreations = 0;
+        m_assetHandlerAndCatalog->m_numDestructions = 0;
+        {
+            AZ_TEST_START_TRACE_SUPPRESSION;
+            LoadContainerWithDeadline(CircularDId, [](AssetContainer& container)
+            {
+                EXPECT_EQ(container.GetDependencies().size(), 2);
+
+                // Break the circular reference so that the test can clean up correctly without leaking memory.
+                auto assetDataD = container.GetRootAsset().GetAs<AssetWithQueueAndPreLoadReferences>();
+                auto assetDataB = assetDataD->m_preLoad.GetAs<AssetWithQueueAndPreLoadReferences>();
+                assetDataB->m_preLoad.Reset();
+            });
+            // One error in SetupPreloads - Two of the assets create a dependency loop
+            AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+
+            // B is always a preload of the root.  Depending on which direction of the loop was kept C is either below B and
+            // gets an even earlier deadline, or only waits on B and keeps the deadline of the container.
+            const AZStd::chrono::milliseconds deadlineB = GetReadDeadline("CircularB.txt");
+            const AZStd::chrono::milliseconds deadlineC = GetReadDeadline("CircularC.txt");
+            EXPECT_EQ(GetReadDeadline("CircularD.txt"), ContainerDeadline);
+            EXPECT_LT(deadlineB, ContainerDeadline);
+            EXPECT_LE(deadlineC, ContainerDeadline);
+            EXPECT_NE(deadlineB, deadlineC);
+        }
+
+        CheckFinishedCreationsAndDestructions();
+        m_assetHandlerAndCatalog->AssetCatalogRequestBus::Handler::BusDisconnect();
+    }
+
 
 
     TEST_F(AssetJobsFloodTest, DISABLED_ContainerCoreTest_BasicDependencyManagement_Success)
@@ -3167,3 +3538,178 @@ namespace UnitTest
         }
     }
 }
+
+#if defined(HAVE_BENCHMARK)
+//-------------------------------------------------------------------------
+// PERF TESTS
+//-------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    using namespace AZ::Data;
+
+    //! Catalog and handler for assets without any data, so loading them only exercises the AssetManager bookkeeping.
+    class EmptyAssetCatalogAndHandler
+        : public UnitTest::MockLoadAssetCatalogAndHandler
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(EmptyAssetCatalogAndHandler, AZ::SystemAllocator, 0);
+
+        explicit EmptyAssetCatalogAndHandler(AZStd::unordered_set<AssetId> ids)
+            : MockLoadAssetCatalogAndHandler(
+                AZStd::move(ids), azrtti_typeid<UnitTest::EmptyAsset>(),
+                []() { return AssetPtr(aznew UnitTest::EmptyAsset()); },
+                [](AssetPtr asset) { delete asset; })
+        {
+        }
+
+        AssetStreamInfo GetStreamInfoForLoad([[maybe_unused]] const AssetId& id, [[maybe_unused]] const AssetType& type) override
+        {
+            // A stream without any data completes right away without going through the streamer.
+            AssetStreamInfo info;
+            info.m_streamName = "EmptyAsset";
+            return info;
+        }
+    };
+
+    class AssetManagerBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+
+            AZ::JobManagerDesc jobDesc;
+            AZ::JobManagerThreadDesc threadDesc;
+            for (AZ::u32 threadIndex = 0; threadIndex < AZStd::thread::hardware_concurrency(); ++threadIndex)
+            {
+                jobDesc.m_workerThreads.push_back(threadDesc);
+            }
+            m_jobManager = aznew AZ::JobManager(jobDesc);
+            m_jobContext = aznew AZ::JobContext(*m_jobManager);
+            AZ::JobContext::SetGlobalContext(m_jobContext);
+
+            AssetManager::Descriptor desc;
+            AssetManager::Create(desc);
+            // Load the assets directly instead of through asset containers, there are no dependencies to load.
+            AssetManager::Instance().SetParallelDependentLoadingEnabled(false);
+
+            AZStd::unordered_set<AssetId> ids;
+            m_assetIds.reserve(AssetCount);
+            for (int assetIndex = 0; assetIndex < AssetCount; ++assetIndex)
+            {
+                m_assetIds.emplace_back(AZ::Uuid::CreateName(AZStd::string::format("AssetManagerBenchmark/%d", assetIndex).c_str()));
+                ids.insert(m_assetIds.back());
+            }
+            m_catalogAndHandler = aznew EmptyAssetCatalogAndHandler(AZStd::move(ids));
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            delete m_catalogAndHandler;
+            m_assetIds = {};
+            AssetManager::Destroy();
+
+            AZ::JobContext::SetGlobalContext(nullptr);
+            delete m_jobContext;
+            delete m_jobManager;
+
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        static constexpr int AssetCount = 50000;
+
+        //! Each of state.range(0) threads requests the assets picked by assetsForThread(threadIndex) at once, then waits
+        //! until all of them are loaded and releases them again.
+        template<typename AssetsForThread>
+        void LoadOnThreads(::benchmark::State& state, const AssetsForThread& assetsForThread)
+        {
+            const int threadCount = static_cast<int>(state.range(0));
+            AZStd::vector<AZStd::vector<Asset<UnitTest::EmptyAsset>>> threadAssets(threadCount);
+            int64_t requestCount = 0;
+            for ([[maybe_unused]] auto _ : state)
+            {
+                AZStd::vector<AZStd::thread> threads;
+                for (int threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+                {
+                    threads.emplace_back([this, &assetsForThread, &threadAssets, threadIndex, threadCount]()
+                    {
+                        AZStd::vector<Asset<UnitTest::EmptyAsset>>& assets = threadAssets[threadIndex];
+                        assetsForThread(threadIndex, threadCount, [this, &assets](int assetIndex)
+                        {
+                            assets.push_back(AssetManager::Instance().GetAsset<UnitTest::EmptyAsset>(
+                                m_assetIds[assetIndex], AssetLoadBehavior::Default));
+                        });
+                    });
+                }
+                for (AZStd::thread& thread : threads)
+                {
+                    thread.join();
+                }
+
+                for (const AZStd::vector<Asset<UnitTest::EmptyAsset>>& assets : threadAssets)
+                {
+                    for (const Asset<UnitTest::EmptyAsset>& asset : assets)
+                    {
+                        while (!asset.IsReady() && !asset.IsError())
+                        {
+                            AZStd::this_thread::yield();
+                        }
+                    }
+                }
+
+                state.PauseTiming();
+                for (AZStd::vector<Asset<UnitTest::EmptyAsset>>& assets : threadAssets)
+                {
+                    requestCount += assets.size();
+                    assets.clear();
+                }
+                // Release the references held by the queued ready notifications so the assets get destroyed.
+                AssetManager::Instance().DispatchEvents();
+                state.ResumeTiming();
+            }
+            state.SetItemsProcessed(requestCount);
+        }
+
+        AZ::JobManager* m_jobManager = nullptr;
+        AZ::JobContext* m_jobContext = nullptr;
+        EmptyAssetCatalogAndHandler* m_catalogAndHandler = nullptr;
+        AZStd::vector<AssetId> m_assetIds;
+    };
+
+    BENCHMARK_DEFINE_F(AssetManagerBenchmarkFixture, GetAsset_DistinctAssetsPerThread)(benchmark::State& state)
+    {
+        LoadOnThreads(state, [](int threadIndex, int threadCount, const auto& getAsset)
+        {
+            for (int assetIndex = threadIndex; assetIndex < AssetCount; assetIndex += threadCount)
+            {
+                getAsset(assetIndex);
+            }
+        });
+    }
+    BENCHMARK_REGISTER_F(AssetManagerBenchmarkFixture, GetAsset_DistinctAssetsPerThread)->Arg(1)->Arg(4)->Arg(16)->UseRealTime();
+
+    BENCHMARK_DEFINE_F(AssetManagerBenchmarkFixture, GetAsset_SameAssetsOnAllThreads)(benchmark::State& state)
+    {
+        // Every thread requests every asset, starting at a different offset, so most requests find an already registered asset.
+        LoadOnThreads(state, [](int threadIndex, int threadCount, const auto& getAsset)
+        {
+            const int offset = threadIndex * (AssetCount / threadCount);
+            for (int assetCounter = 0; assetCounter < AssetCount; ++assetCounter)
+            {
+                getAsset((offset + assetCounter) % AssetCount);
+            }
+        });
+    }
+    BENCHMARK_REGISTER_F(AssetManagerBenchmarkFixture, GetAsset_SameAssetsOnAllThreads)->Arg(1)->Arg(4)->Arg(16)->UseRealTime();
+} // namespace Benchmark
+
+#endif // HAVE_BENCHMARK
@@ -39,7 +39,8 @@ namespace UnitTest
 
         const AZ::Data::AssetManager::OwnedAssetContainerMap& GetAssetContainers() const;
 
-        const AssetMap& GetAssets() const;
+        // Returns a snapshot of the registered assets of all shards.
+        AssetMap GetAssets();
 
         // Expose these methods so that they can be queried by the unit tests.
         using AssetManager::GetAssetInternal;
@@ -45,7 +45,7 @@ namespace BusImplementation
     };
 
     // Traits for the benchmark bus
-    template <AZ::EBusAddressPolicy addressPolicy, AZ::EBusHandlerPolicy handlerPolicy, bool locklessDispatch = false>
+    template <AZ::EBusAddressPolicy addressPolicy, AZ::EBusHandlerPolicy handlerPolicy, bool locklessDispatch = false, typename mutexType = AZStd::recursive_mutex>
     class Traits
         : public AZ::EBusTraits
     {
@@ -57,8 +57,8 @@ namespace BusImplementation
         // Allow queuing
         static const bool EnableEventQueue = true;
 
-        // Force locking
-        using MutexType = AZStd::recursive_mutex;
+        // Force locking unless a single threaded bus is requested
+        using MutexType = mutexType;
 
         // Only specialize BusIdType if not single address
         using BusIdType = AZStd::conditional_t<AddressPolicy == AZ::EBusAddressPolicy::Single, AZ::NullBusId, int>;
@@ -193,8 +193,8 @@ private:
 };
 
 // Definition of the benchmark bus, depending on supplied policies
-template <AZ::EBusAddressPolicy addressPolicy, AZ::EBusHandlerPolicy handlerPolicy, bool locklessDispatch = false>
-using TestBus = AZ::EBus<BusImplementation::Interface, BusImplementation::Traits<addressPolicy, handlerPolicy, locklessDispatch>>;
+template <AZ::EBusAddressPolicy addressPolicy, AZ::EBusHandlerPolicy handlerPolicy, bool locklessDispatch = false, typename mutexType = AZStd::recursive_mutex>
+using TestBus = AZ::EBus<BusImplementation::Interface, BusImplementation::Traits<addressPolicy, handlerPolicy, locklessDispatch, mutexType>>;
 
 #define EBUS_TEST_ALIAS(BusType, AddressPolicy, HandlerPolicy)                                              \
     using BusType = TestBus<AZ::EBusAddressPolicy::AddressPolicy, AZ::EBusHandlerPolicy::HandlerPolicy>;    \
@@ -3023,6 +3023,57 @@ namespace UnitTest
         ThrashLocklessDispatchNullMutex();
     }
 
+    static_assert(!LocklessNullMutexBus::Context::SingleThreadedDispatch, "Lockless buses can be dispatched on from multiple threads");
+    static_assert(!TestBus<AZ::EBusAddressPolicy::Single, AZ::EBusHandlerPolicy::Multiple>::Context::SingleThreadedDispatch,
+        "Buses with a MutexType can be dispatched on from multiple threads");
+
+    struct SingleThreadedEvents
+        : public AZ::EBusTraits
+    {
+        static const AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::ById;
+        using BusIdType = int;
+
+        virtual ~SingleThreadedEvents() = default;
+        virtual void OnEvent(int depth) = 0;
+    };
+
+    using SingleThreadedBus = AZ::EBus<SingleThreadedEvents>;
+    static_assert(SingleThreadedBus::Context::SingleThreadedDispatch, "Buses without a MutexType are single threaded");
+
+    struct SingleThreadedImpl
+        : public SingleThreadedBus::Handler
+    {
+        void OnEvent(int depth) override
+        {
+            m_wasInDispatch = SingleThreadedBus::IsInDispatch();
+            const int* busId = SingleThreadedBus::GetCurrentBusId();
+            m_currentBusId = busId ? *busId : -1;
+            ++m_calls;
+            if (depth > 0)
+            {
+                SingleThreadedBus::Event(m_currentBusId, &SingleThreadedBus::Events::OnEvent, depth - 1);
+            }
+        }
+
+        int m_calls = 0;
+        int m_currentBusId = -1;
+        bool m_wasInDispatch = false;
+    };
+
+    TEST_F(EBus, SingleThreadedDispatch_NestedEvents_TracksDispatches)
+    {
+        SingleThreadedImpl handler;
+        handler.BusConnect(5);
+
+        SingleThreadedBus::Event(5, &SingleThreadedBus::Events::OnEvent, 3);
+        EXPECT_EQ(4, handler.m_calls);
+        EXPECT_TRUE(handler.m_wasInDispatch);
+        EXPECT_EQ(5, handler.m_currentBusId);
+        EXPECT_FALSE(SingleThreadedBus::IsInDispatch());
+
+        handler.BusDisconnect();
+    }
+
     namespace EBusResultsTest
     {
         class ResultClass
@@ -4448,6 +4499,22 @@ namespace Benchmark
     }
     BUS_BENCHMARK_REGISTER_ID(BM_EBus_ExecuteQueueCached);
 
+    //////////////////////////////////////////////////////////////////////////
+    // Dispatch cost per thread safety policy
+    //////////////////////////////////////////////////////////////////////////
+
+    // Buses with a mutex lock it for every dispatch, lockless buses still count their dispatches atomically
+    // and single threaded buses (no MutexType, e.g. TickBus) dispatch without any synchronization
+    using OneToManyLockless = TestBus<AZ::EBusAddressPolicy::Single, AZ::EBusHandlerPolicy::Multiple, true>;
+    using OneToManySingleThreaded = TestBus<AZ::EBusAddressPolicy::Single, AZ::EBusHandlerPolicy::Multiple, false, AZ::NullMutex>;
+    using ManyToManyLockless = TestBus<AZ::EBusAddressPolicy::ById, AZ::EBusHandlerPolicy::Multiple, true>;
+    using ManyToManySingleThreaded = TestBus<AZ::EBusAddressPolicy::ById, AZ::EBusHandlerPolicy::Multiple, false, AZ::NullMutex>;
+
+    BENCHMARK_TEMPLATE(BM_EBus_Broadcast, OneToManyLockless)->Apply(&BenchmarkSettings::OneToMany);
+    BENCHMARK_TEMPLATE(BM_EBus_Broadcast, OneToManySingleThreaded)->Apply(&BenchmarkSettings::OneToMany);
+    BENCHMARK_TEMPLATE(BM_EBus_Event, ManyToManyLockless)->Apply(&BenchmarkSettings::ManyToMany);
+    BENCHMARK_TEMPLATE(BM_EBus_Event, ManyToManySingleThreaded)->Apply(&BenchmarkSettings::ManyToMany);
+
     //////////////////////////////////////////////////////////////////////////
     // Multithreaded Broadcasts
     //////////////////////////////////////////////////////////////////////////
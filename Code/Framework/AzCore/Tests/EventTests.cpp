@@ -8,6 +8,7 @@
 
 #include <AzCore/EBus/Event.h>
 #include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 
 namespace UnitTest
 {
@@ -300,6 +301,178 @@ namespace UnitTest
         testEvent.Signal();
         EXPECT_TRUE(invokedCounter == 2);
     }
+
+    TEST_F(EventTests, TestDisconnectHandlerConnectedDuringEvent)
+    {
+        AZ::Event<int32_t> testEvent;
+
+        int32_t testHandler2Data = 0;
+        AZ::Event<int32_t>::Handler testHandler2([&testHandler2Data](int32_t value) { testHandler2Data = value; });
+        AZ::Event<int32_t>::Handler testHandler([&testHandler2, &testEvent]([[maybe_unused]] int32_t value)
+        {
+            testHandler2.Connect(testEvent);
+            testHandler2.Disconnect();
+        });
+        testHandler.Connect(testEvent);
+
+        testEvent.Signal(1);
+        EXPECT_FALSE(testHandler2.IsConnected());
+
+        testHandler.Disconnect();
+        EXPECT_FALSE(testEvent.HasHandlerConnected());
+
+        testEvent.Signal(2);
+        EXPECT_EQ(0, testHandler2Data);
+    }
+
+    TEST_F(EventTests, TestDisconnectFromMiddle_RemainingHandlersAreInvoked)
+    {
+        AZ::Event<> testEvent;
+
+        int32_t invokedCounter[3] = {};
+        AZ::Event<>::Handler testHandlers[3] = {
+            AZ::Event<>::Handler([&invokedCounter]() { invokedCounter[0]++; }),
+            AZ::Event<>::Handler([&invokedCounter]() { invokedCounter[1]++; }),
+            AZ::Event<>::Handler([&invokedCounter]() { invokedCounter[2]++; })
+        };
+
+        for (AZ::Event<>::Handler& handler : testHandlers)
+        {
+            handler.Connect(testEvent);
+        }
+
+        testHandlers[0].Disconnect();
+        testEvent.Signal();
+        EXPECT_EQ(0, invokedCounter[0]);
+        EXPECT_EQ(1, invokedCounter[1]);
+        EXPECT_EQ(1, invokedCounter[2]);
+
+        testHandlers[2].Disconnect();
+        testHandlers[1].Disconnect();
+        EXPECT_FALSE(testEvent.HasHandlerConnected());
+    }
+
+    TEST_F(EventTests, TestNestedSignal)
+    {
+        AZ::Event<int32_t> testEvent;
+
+        int32_t testHandler2Data = 0;
+        AZ::Event<int32_t>::Handler testHandler2([&testHandler2Data](int32_t value) { testHandler2Data += value; });
+        AZ::Event<int32_t>::Handler testHandler([&testHandler2, &testEvent](int32_t value)
+        {
+            if (value == 1)
+            {
+                testEvent.Signal(2);
+                testHandler2.Disconnect();
+                EXPECT_TRUE(testEvent.HasHandlerConnected());
+            }
+        });
+
+        testHandler.Connect(testEvent);
+        testHandler2.Connect(testEvent);
+
+        // The nested signal reaches the second handler, the outer signal skips it after it has been disconnected
+        testEvent.Signal(1);
+        EXPECT_EQ(2, testHandler2Data);
+        EXPECT_FALSE(testHandler2.IsConnected());
+
+        testHandler2.Connect(testEvent);
+        testEvent.Signal(4);
+        EXPECT_EQ(6, testHandler2Data);
+    }
+
+    TEST_F(EventTests, TestDisconnectAllHandlersDuringEvent)
+    {
+        AZ::Event<> testEvent;
+
+        int32_t invokedCounter = 0;
+        AZ::Event<>::Handler testHandler([&testEvent, &invokedCounter]() { invokedCounter++; testEvent.DisconnectAllHandlers(); });
+        AZ::Event<>::Handler testHandler2([&invokedCounter]() { invokedCounter++; });
+
+        testHandler.Connect(testEvent);
+        testHandler2.Connect(testEvent);
+
+        testEvent.Signal();
+        EXPECT_EQ(1, invokedCounter);
+        EXPECT_FALSE(testHandler.IsConnected());
+        EXPECT_FALSE(testHandler2.IsConnected());
+        EXPECT_FALSE(testEvent.HasHandlerConnected());
+
+        testHandler2.Connect(testEvent);
+        testEvent.Signal();
+        EXPECT_EQ(2, invokedCounter);
+    }
+
+    TEST_F(EventTests, TestSmallCallback_IsStoredInline)
+    {
+        int32_t invokedValue = 0;
+        auto smallCallback = [&invokedValue](int32_t value) { invokedValue = value; };
+        static_assert(AZ::Event<int32_t>::Handler::IsCallbackStoredInline<decltype(smallCallback)>, "Lambdas capturing a reference should be stored inline");
+        static_assert(AZ::Event<int32_t>::Handler::IsCallbackStoredInline<AZ::Event<int32_t>::Callback>, "AZStd::function should be stored inline");
+
+        AZ::Event<int32_t> testEvent;
+        AZ::Event<int32_t>::Handler testHandler(smallCallback);
+        testHandler.Connect(testEvent);
+
+        // Moving, copying and signaling don't allocate once the event has room for the handlers
+        AZ::Event<int32_t>::Handler reserveHandler(testHandler);
+        reserveHandler.Disconnect();
+
+        const size_t allocatedBytes = AZ::AllocatorInstance<AZ::SystemAllocator>::Get().NumAllocatedBytes();
+        {
+            AZ::Event<int32_t>::Handler movedHandler(AZStd::move(testHandler));
+            AZ::Event<int32_t>::Handler copiedHandler(movedHandler);
+            testEvent.Signal(1);
+            EXPECT_EQ(1, invokedValue);
+            copiedHandler.Disconnect();
+            testHandler = AZStd::move(movedHandler);
+        }
+        EXPECT_EQ(allocatedBytes, AZ::AllocatorInstance<AZ::SystemAllocator>::Get().NumAllocatedBytes());
+        EXPECT_TRUE(testHandler.IsConnected());
+    }
+
+    TEST_F(EventTests, TestLargeCallback_IsStoredOnHeap)
+    {
+        struct LargeCapture
+        {
+            int32_t m_values[64] = {};
+        };
+        LargeCapture capture;
+        capture.m_values[63] = 5;
+
+        int32_t invokedValue = 0;
+        auto largeCallback = [capture, &invokedValue](int32_t value) { invokedValue = value + capture.m_values[63]; };
+        static_assert(!AZ::Event<int32_t>::Handler::IsCallbackStoredInline<decltype(largeCallback)>, "Large lambdas should be stored on the heap");
+
+        AZ::Event<int32_t> testEvent;
+        AZ::Event<int32_t>::Handler testHandler(largeCallback);
+        testHandler.Connect(testEvent);
+
+        AZ::Event<int32_t>::Handler copiedHandler(testHandler);
+        AZ::Event<int32_t>::Handler movedHandler(AZStd::move(testHandler));
+        EXPECT_FALSE(testHandler.IsConnected());
+
+        testEvent.Signal(1);
+        EXPECT_EQ(6, invokedValue);
+
+        copiedHandler.Disconnect();
+        movedHandler.Disconnect();
+        EXPECT_FALSE(testEvent.HasHandlerConnected());
+    }
+
+    TEST_F(EventTests, TestMoveOnlyCallback)
+    {
+        auto value = AZStd::make_unique<int32_t>(3);
+        int32_t invokedValue = 0;
+
+        AZ::Event<> testEvent;
+        AZ::Event<>::Handler testHandler([value = AZStd::move(value), &invokedValue]() { invokedValue = *value; });
+        AZ::Event<>::Handler movedHandler(AZStd::move(testHandler));
+        movedHandler.Connect(testEvent);
+
+        testEvent.Signal();
+        EXPECT_EQ(3, invokedValue);
+    }
 }
 
 #if defined(HAVE_BENCHMARK)
@@ -351,6 +524,65 @@ namespace Benchmark
     }
     BENCHMARK(BM_EventPerf_EventIncrement);
 
+    static void BM_EventPerf_EventConnectDisconnect(benchmark::State& state)
+    {
+        AZ::Event<int32_t> testEvent;
+        AZStd::vector<AZ::Event<int32_t>::Handler> testHandlers;
+        testHandlers.reserve(NumHandlers);
+
+        int32_t incrementCounter = 0;
+        for (int32_t i = 0; i < NumHandlers; ++i)
+        {
+            testHandlers.emplace_back([&incrementCounter]([[maybe_unused]] int32_t value) { ++incrementCounter; });
+        }
+
+        for (auto _ : state)
+        {
+            for (AZ::Event<int32_t>::Handler& handler : testHandlers)
+            {
+                handler.Connect(testEvent);
+            }
+
+            // Disconnect every other handler first to churn through the middle of the handler array
+            for (size_t i = 0; i < testHandlers.size(); i += 2)
+            {
+                testHandlers[i].Disconnect();
+            }
+            for (size_t i = 1; i < testHandlers.size(); i += 2)
+            {
+                testHandlers[i].Disconnect();
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * NumHandlers);
+    }
+    BENCHMARK(BM_EventPerf_EventConnectDisconnect);
+
+    static void BM_EventPerf_EventReconnectDuringSignal(benchmark::State& state)
+    {
+        AZ::Event<int32_t> testEvent;
+        AZStd::vector<AZ::Event<int32_t>::Handler> testHandlers;
+        testHandlers.reserve(NumHandlers);
+
+        // Every handler disconnects and reconnects itself when it's invoked, which is the worst case for the book-keeping
+        for (int32_t i = 0; i < NumHandlers; ++i)
+        {
+            AZ::Event<int32_t>::Handler* handler = testHandlers.data() + i;
+            testHandlers.emplace_back([handler, &testEvent]([[maybe_unused]] int32_t value)
+            {
+                handler->Disconnect();
+                handler->Connect(testEvent);
+            });
+            testHandlers.back().Connect(testEvent);
+        }
+
+        for (auto _ : state)
+        {
+            testEvent.Signal(1);
+        }
+        state.SetItemsProcessed(state.iterations() * NumHandlers);
+    }
+    BENCHMARK(BM_EventPerf_EventReconnectDuringSignal);
+
     class EBusPerfBaseline
         : public AZ::EBusTraits
     {
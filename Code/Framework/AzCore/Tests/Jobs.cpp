@@ -28,6 +28,7 @@
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Memory/PoolAllocator.h>
 
+#include <AzCore/std/sort.h>
 #include <AzCore/std/time.h>
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/UnitTest/TestTypes.h>
@@ -1652,6 +1653,174 @@ namespace UnitTest
     {
         RunTest();
     }
+
+    class JobPriorityClassTestFixture : public DefaultJobManagerSetupFixture
+    {
+    public:
+        JobPriorityClassTestFixture() : DefaultJobManagerSetupFixture(1) // Only 1 worker to serialize job execution
+        {
+        }
+
+        void StartJob(JobPriorityClass priorityClass, AZStd::sys_time_t deadline, const char* name)
+        {
+            Job* job = aznew TestJobWithPriority(0, name, m_jobContext, m_binarySemaphore, m_namesOfProcessedJobs);
+            job->SetPriorityClass(priorityClass);
+            job->SetDeadline(deadline);
+            job->Start();
+        }
+
+        void RunTest()
+        {
+            // As in JobPriorityTestFixture, the first job blocks the lone worker until all the other jobs are queued
+            Job* firstJob = aznew TestJobWithPriority(127, "FirstJobQueued", m_jobContext, m_binarySemaphore, m_namesOfProcessedJobs);
+            firstJob->SetPriorityClass(JobPriorityClass::Critical);
+            firstJob->Start();
+
+            const AZStd::sys_time_t now = AZStd::GetTimeNowTicks();
+            const AZStd::sys_time_t oneMinute = AZStd::GetTimeTicksPerSecond() * 60;
+            StartJob(JobPriorityClass::Background, 0, "Background");
+            StartJob(JobPriorityClass::Normal, 0, "Normal");
+            StartJob(JobPriorityClass::Normal, now + 2 * oneMinute, "NormalLateDeadline");
+            StartJob(JobPriorityClass::Normal, now + oneMinute, "NormalEarlyDeadline");
+            StartJob(JobPriorityClass::Critical, 0, "Critical");
+            StartJob(JobPriorityClass::Background, 1, "BackgroundMissedDeadline"); // already late, so promoted to the critical class
+
+            EXPECT_EQ(m_jobManager->GetQueueDepth(JobPriorityClass::Normal), 3u);
+            EXPECT_EQ(m_jobManager->GetQueueDepth(JobPriorityClass::Background), 1u);
+
+            m_binarySemaphore.release();
+            while (TestJobWithPriority::s_numIncompleteJobs > 0) {}
+
+            for (size_t classIndex = 0; classIndex < static_cast<size_t>(JobPriorityClass::Count); ++classIndex)
+            {
+                EXPECT_EQ(m_jobManager->GetQueueDepth(static_cast<JobPriorityClass>(classIndex)), 0u);
+            }
+
+            // Higher classes run first, within a class jobs with a deadline run first, earliest deadline first
+            ASSERT_EQ(m_namesOfProcessedJobs.size(), 7u);
+            EXPECT_EQ(m_namesOfProcessedJobs[0], "FirstJobQueued");
+            EXPECT_EQ(m_namesOfProcessedJobs[1], "BackgroundMissedDeadline");
+            EXPECT_EQ(m_namesOfProcessedJobs[2], "Critical");
+            EXPECT_EQ(m_namesOfProcessedJobs[3], "NormalEarlyDeadline");
+            EXPECT_EQ(m_namesOfProcessedJobs[4], "NormalLateDeadline");
+            EXPECT_EQ(m_namesOfProcessedJobs[5], "Normal");
+            EXPECT_EQ(m_namesOfProcessedJobs[6], "Background");
+
+            // The class stats are tracked without JOBMANAGER_ENABLE_STATS, the promoted job counts towards the critical class
+            const JobPriorityClassStats criticalStats = m_jobManager->GetPriorityClassStats(JobPriorityClass::Critical);
+            EXPECT_EQ(criticalStats.m_jobsRun, 3u);
+            EXPECT_EQ(criticalStats.m_deadlinesMissed, 1u);
+            EXPECT_GE(criticalStats.m_totalWaitTime, criticalStats.m_maxWaitTime);
+            const JobPriorityClassStats normalStats = m_jobManager->GetPriorityClassStats(JobPriorityClass::Normal);
+            EXPECT_EQ(normalStats.m_jobsRun, 3u);
+            EXPECT_EQ(normalStats.m_deadlinesMissed, 0u);
+            EXPECT_GT(normalStats.m_maxWaitTime, 0);
+            EXPECT_EQ(m_jobManager->GetPriorityClassStats(JobPriorityClass::Background).m_jobsRun, 1u);
+
+            m_jobManager->ClearStats();
+            EXPECT_EQ(m_jobManager->GetPriorityClassStats(JobPriorityClass::Critical).m_jobsRun, 0u);
+        }
+
+    private:
+        AZStd::binary_semaphore m_binarySemaphore;
+        AZStd::vector<AZStd::string> m_namesOfProcessedJobs;
+    };
+
+    TEST_F(JobPriorityClassTestFixture, HigherClassesAndEarlierDeadlinesRunFirst)
+    {
+        RunTest();
+    }
+
+    class WorkStealingDequeTest
+        : public AllocatorsFixture
+    {
+    };
+
+    TEST_F(WorkStealingDequeTest, OwnerPopsMostRecentThiefStealsOldest)
+    {
+        // The deque never dereferences the jobs, so fake job addresses are used as markers
+        auto fakeJob = [](uintptr_t index) { return reinterpret_cast<Job*>((index + 1) * 16); };
+
+        AZ::Internal::WorkStealingDeque deque;
+        EXPECT_TRUE(deque.IsEmpty());
+        EXPECT_EQ(deque.Pop(), nullptr);
+        EXPECT_EQ(deque.Steal(), nullptr);
+
+        // Push enough jobs to force the ring to grow
+        const uintptr_t numJobs = 1000;
+        for (uintptr_t i = 0; i < numJobs; ++i)
+        {
+            deque.Push(fakeJob(i));
+        }
+        EXPECT_FALSE(deque.IsEmpty());
+        EXPECT_EQ(deque.Steal(), fakeJob(0));
+        EXPECT_EQ(deque.Pop(), fakeJob(numJobs - 1));
+
+        for (uintptr_t i = 1; i < numJobs - 1; ++i)
+        {
+            EXPECT_EQ(deque.Steal(), fakeJob(i));
+        }
+        EXPECT_TRUE(deque.IsEmpty());
+        EXPECT_EQ(deque.Pop(), nullptr);
+    }
+
+    TEST_F(WorkStealingDequeTest, ConcurrentStealsTakeEveryJobExactlyOnce)
+    {
+        const uintptr_t numJobs = 100000;
+        const unsigned int numThieves = 4;
+
+        AZStd::unique_ptr<AZStd::atomic<int>[]> timesTaken(new AZStd::atomic<int>[numJobs]);
+        for (uintptr_t i = 0; i < numJobs; ++i)
+        {
+            timesTaken[i] = 0;
+        }
+        auto take = [&timesTaken](Job* job)
+        {
+            timesTaken[reinterpret_cast<uintptr_t>(job) / 16 - 1].fetch_add(1);
+        };
+
+        AZ::Internal::WorkStealingDeque deque;
+        AZStd::atomic<bool> ownerDone{ false };
+
+        AZStd::vector<AZStd::thread> thieves;
+        for (unsigned int i = 0; i < numThieves; ++i)
+        {
+            thieves.emplace_back([&deque, &ownerDone, &take]()
+            {
+                while (!ownerDone.load() || !deque.IsEmpty())
+                {
+                    if (Job* job = deque.Steal())
+                    {
+                        take(job);
+                    }
+                }
+            });
+        }
+
+        // The owner interleaves pushes and pops so pops regularly race thieves for the last job
+        for (uintptr_t i = 0; i < numJobs; ++i)
+        {
+            deque.Push(reinterpret_cast<Job*>((i + 1) * 16));
+            if ((i % 3) == 0)
+            {
+                if (Job* job = deque.Pop())
+                {
+                    take(job);
+                }
+            }
+        }
+        ownerDone = true;
+
+        for (AZStd::thread& thief : thieves)
+        {
+            thief.join();
+        }
+
+        for (uintptr_t i = 0; i < numJobs; ++i)
+        {
+            EXPECT_EQ(timesTaken[i].load(), 1);
+        }
+    }
 } // UnitTest
 
 #if defined(HAVE_BENCHMARK)
@@ -2012,6 +2181,119 @@ namespace Benchmark
             RunMultipleCalculatePiJobsWithRandomDepthAndRandomPriority(LARGE_NUMBER_OF_JOBS);
         }
     }
+
+    //! Measures the scheduler itself rather than the work: a single job forks many tiny jobs from within a worker, so they are
+    //! pushed to that worker's local queue and every other worker has to steal to take part. Run with a fixed worker count
+    //! (the benchmark argument) independent of the host's core count.
+    class FineGrainedJobBenchmarkFixture : public ::benchmark::Fixture
+    {
+    public:
+        static const AZ::u32 FINE_GRAINED_JOB_COUNT = 16384;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            AllocatorInstance<PoolAllocator>::Create();
+            AllocatorInstance<ThreadPoolAllocator>::Create();
+
+            JobManagerDesc desc;
+            const AZ::s64 numWorkerThreads = state.range(0);
+            for (AZ::s64 i = 0; i < numWorkerThreads; ++i)
+            {
+                desc.m_workerThreads.push_back(JobManagerThreadDesc());
+            }
+
+            m_jobManager = aznew JobManager(desc);
+            m_jobContext = aznew JobContext(*m_jobManager);
+            JobContext::SetGlobalContext(m_jobContext);
+
+            m_latencyTicks.resize(FINE_GRAINED_JOB_COUNT);
+        }
+
+        void TearDown([[maybe_unused]] ::benchmark::State& state) override
+        {
+            JobContext::SetGlobalContext(nullptr);
+
+            m_latencyTicks = {};
+            delete m_jobContext;
+            delete m_jobManager;
+
+            AllocatorInstance<ThreadPoolAllocator>::Destroy();
+            AllocatorInstance<PoolAllocator>::Destroy();
+        }
+
+    protected:
+        void RunFineGrainedJobs()
+        {
+            JobCompletion completion(m_jobContext);
+            Job* forkingJob = CreateJobFunction([this, &completion]()
+                {
+                    for (AZ::u32 i = 0; i < FINE_GRAINED_JOB_COUNT; ++i)
+                    {
+                        const AZStd::sys_time_t queuedTime = AZStd::GetTimeNowTicks();
+                        Job* job = CreateJobFunction([this, i, queuedTime]()
+                            {
+                                // Time from being queued until starting to run, which is what the scheduler adds to each job
+                                m_latencyTicks[i] = AZStd::GetTimeNowTicks() - queuedTime;
+                                benchmark::DoNotOptimize(CalculatePi(JobBenchmarkFixture::LIGHT_WEIGHT_JOB_CALCULATE_PI_DEPTH));
+                            }, true, m_jobContext);
+                        job->SetDependent(&completion);
+                        job->Start();
+                    }
+                }, true, m_jobContext);
+            forkingJob->SetDependent(&completion);
+            forkingJob->Start();
+            completion.StartAndWaitForCompletion();
+        }
+
+        //! Accumulates queue latency percentiles of the last run, reported as the average over all iterations.
+        void AccumulateLatencies()
+        {
+            AZStd::sort(m_latencyTicks.begin(), m_latencyTicks.end());
+            const double microsecondsPerTick = 1000000.0 / static_cast<double>(AZStd::GetTimeTicksPerSecond());
+            m_latencyP50 += static_cast<double>(m_latencyTicks[m_latencyTicks.size() / 2]) * microsecondsPerTick;
+            m_latencyP99 += static_cast<double>(m_latencyTicks[(m_latencyTicks.size() * 99) / 100]) * microsecondsPerTick;
+            m_latencyMax += static_cast<double>(m_latencyTicks.back()) * microsecondsPerTick;
+        }
+
+        void ReportLatencies(::benchmark::State& state)
+        {
+            state.counters["LatencyP50_us"] = ::benchmark::Counter(m_latencyP50, ::benchmark::Counter::kAvgIterations);
+            state.counters["LatencyP99_us"] = ::benchmark::Counter(m_latencyP99, ::benchmark::Counter::kAvgIterations);
+            state.counters["LatencyMax_us"] = ::benchmark::Counter(m_latencyMax, ::benchmark::Counter::kAvgIterations);
+            m_latencyP50 = m_latencyP99 = m_latencyMax = 0.0;
+        }
+
+        JobManager* m_jobManager = nullptr;
+        JobContext* m_jobContext = nullptr;
+        AZStd::vector<AZStd::sys_time_t> m_latencyTicks;
+        double m_latencyP50 = 0.0;
+        double m_latencyP99 = 0.0;
+        double m_latencyMax = 0.0;
+    };
+
+    BENCHMARK_DEFINE_F(FineGrainedJobBenchmarkFixture, ForkedJobThroughput)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            RunFineGrainedJobs();
+        }
+        state.SetItemsProcessed(state.iterations() * FINE_GRAINED_JOB_COUNT);
+    }
+    BENCHMARK_REGISTER_F(FineGrainedJobBenchmarkFixture, ForkedJobThroughput)->Arg(4)->Arg(16)->Arg(64)->UseRealTime();
+
+    BENCHMARK_DEFINE_F(FineGrainedJobBenchmarkFixture, ForkedJobLatency)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            RunFineGrainedJobs();
+
+            state.PauseTiming();
+            AccumulateLatencies();
+            state.ResumeTiming();
+        }
+        ReportLatencies(state);
+    }
+    BENCHMARK_REGISTER_F(FineGrainedJobBenchmarkFixture, ForkedJobLatency)->Arg(4)->Arg(16)->Arg(64)->UseRealTime();
 } // Benchmark
 
 #endif // HAVE_BENCHMARK
@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Memory/AllocationSampler.h>
+#include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace UnitTest
+{
+    class AllocationSamplerTest
+        : public AllocatorsFixture
+    {
+    protected:
+        static size_t GetTotalSampleCount(const AZStd::vector<AZ::Debug::AllocationSampler::ReportEntry>& report)
+        {
+            size_t sampleCount = 0;
+            for (const AZ::Debug::AllocationSampler::ReportEntry& entry : report)
+            {
+                sampleCount += entry.m_sampleCount;
+            }
+            return sampleCount;
+        }
+
+        AZ::Debug::AllocationSampler m_sampler;
+    };
+
+    TEST_F(AllocationSamplerTest, RecordAllocation_Disabled_NothingIsSampled)
+    {
+        for (int i = 0; i < 100; ++i)
+        {
+            m_sampler.RecordAllocation("Test", 1024);
+        }
+
+        AZStd::vector<AZ::Debug::AllocationSampler::ReportEntry> report;
+        m_sampler.GetReport(report);
+        EXPECT_FALSE(m_sampler.IsEnabled());
+        EXPECT_EQ(0, m_sampler.GetNumSamples());
+        EXPECT_TRUE(report.empty());
+    }
+
+    TEST_F(AllocationSamplerTest, GetReport_AggregatesByAllocator)
+    {
+        // Allocators are told apart by their name pointer
+        const char* firstName = "First";
+        const char* secondName = "Second";
+
+        // With an interval of a single byte every allocation is sampled
+        m_sampler.SetSampleInterval(1);
+        for (int i = 0; i < 10; ++i)
+        {
+            m_sampler.RecordAllocation(firstName, 16);
+            m_sampler.RecordAllocation(secondName, 64);
+        }
+        m_sampler.RecordAllocation(secondName, 256);
+
+        AZStd::vector<AZ::Debug::AllocationSampler::ReportEntry> report;
+        m_sampler.GetReport(report, 0);
+        ASSERT_EQ(2, report.size());
+
+        // Sorted by estimated bytes
+        EXPECT_STREQ("Second", report[0].m_allocatorName);
+        EXPECT_EQ(11, report[0].m_sampleCount);
+        EXPECT_EQ(10 * 64 + 256, report[0].m_estimatedBytes);
+        EXPECT_EQ(256, report[0].m_largestAllocation);
+        EXPECT_STREQ("First", report[1].m_allocatorName);
+        EXPECT_EQ(10, report[1].m_sampleCount);
+        EXPECT_EQ(10 * 16, report[1].m_estimatedBytes);
+    }
+
+    TEST_F(AllocationSamplerTest, GetReport_EstimatesAllocatedBytes)
+    {
+        constexpr size_t SampleInterval = 1024;
+        constexpr size_t AllocationSize = 48;
+        constexpr size_t AllocationCount = 20000;
+        m_sampler.SetSampleInterval(SampleInterval);
+        for (size_t i = 0; i < AllocationCount; ++i)
+        {
+            m_sampler.RecordAllocation("Test", AllocationSize);
+        }
+
+        AZStd::vector<AZ::Debug::AllocationSampler::ReportEntry> report;
+        m_sampler.GetReport(report, 0);
+        ASSERT_EQ(1, report.size());
+        const float allocatedBytes = static_cast<float>(AllocationSize * AllocationCount);
+        EXPECT_NEAR(allocatedBytes, static_cast<float>(report[0].m_estimatedBytes), allocatedBytes * 0.1f);
+    }
+
+    TEST_F(AllocationSamplerTest, RecordAllocation_BufferFull_OldestSamplesAreOverwritten)
+    {
+        constexpr size_t SampleCapacity = AZ::Debug::AllocationSampler::SampleCapacity;
+        m_sampler.SetSampleInterval(1);
+        for (size_t i = 0; i < SampleCapacity * 2; ++i)
+        {
+            m_sampler.RecordAllocation(i < SampleCapacity ? "Old" : "New", 8);
+        }
+
+        AZStd::vector<AZ::Debug::AllocationSampler::ReportEntry> report;
+        m_sampler.GetReport(report, 0);
+        EXPECT_EQ(SampleCapacity * 2, m_sampler.GetNumSamples());
+        ASSERT_EQ(1, report.size());
+        EXPECT_STREQ("New", report[0].m_allocatorName);
+        EXPECT_EQ(SampleCapacity, report[0].m_sampleCount);
+    }
+
+    TEST_F(AllocationSamplerTest, Reset_DiscardsSamples)
+    {
+        m_sampler.SetSampleInterval(1);
+        for (int i = 0; i < 10; ++i)
+        {
+            m_sampler.RecordAllocation("Test", 8);
+        }
+        m_sampler.Reset();
+        m_sampler.RecordAllocation("Test", 8);
+
+        AZStd::vector<AZ::Debug::AllocationSampler::ReportEntry> report;
+        m_sampler.GetReport(report, 0);
+        EXPECT_EQ(1, m_sampler.GetNumSamples());
+        ASSERT_EQ(1, report.size());
+        EXPECT_EQ(1, report[0].m_sampleCount);
+    }
+
+    TEST_F(AllocationSamplerTest, RecordAllocation_FromMultipleThreads_AllSamplesAreRecorded)
+    {
+        constexpr size_t ThreadCount = 4;
+        constexpr size_t AllocationCount = 512;
+        m_sampler.SetSampleInterval(1);
+
+        AZStd::thread threads[ThreadCount];
+        for (AZStd::thread& thread : threads)
+        {
+            thread = AZStd::thread([this]()
+            {
+                for (size_t i = 0; i < AllocationCount; ++i)
+                {
+                    m_sampler.RecordAllocation("Test", 32);
+                }
+            });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        AZStd::vector<AZ::Debug::AllocationSampler::ReportEntry> report;
+        m_sampler.GetReport(report);
+        EXPECT_EQ(ThreadCount * AllocationCount, m_sampler.GetNumSamples());
+        EXPECT_EQ(ThreadCount * AllocationCount, GetTotalSampleCount(report));
+    }
+
+    TEST_F(AllocationSamplerTest, ExportReport_WritesCsv)
+    {
+        m_sampler.SetSampleInterval(1);
+        m_sampler.RecordAllocation("Test", 8);
+
+        AZ::Test::ScopedAutoTempDirectory tempDir;
+        const AZStd::string filePath = tempDir.Resolve("AllocationSamples.csv");
+        ASSERT_TRUE(m_sampler.ExportReport(filePath.c_str()));
+
+        char buffer[64] = {};
+        AZ::IO::SystemFile::Read(filePath.c_str(), buffer, sizeof(buffer) - 1);
+        EXPECT_EQ(0, strncmp(buffer, "Allocator,Samples,EstimatedBytes", 32));
+        EXPECT_NE(nullptr, strstr(buffer, "\nTest,1,8,8,"));
+    }
+
+#if !defined(_RELEASE)
+    TEST_F(AllocationSamplerTest, AllocatorManager_SampleInterval_SamplesSystemAllocator)
+    {
+        AZ::AllocatorManager& manager = AZ::AllocatorManager::Instance();
+        manager.GetAllocationSampler().Reset();
+        manager.SetAllocationSampleInterval(1);
+
+        void* address = azmalloc(128, 16);
+        azfree(address);
+        manager.SetAllocationSampleInterval(0);
+        // Disabled again, so this one isn't sampled
+        address = azmalloc(128, 16);
+        azfree(address);
+
+        AZStd::vector<AZ::Debug::AllocationSampler::ReportEntry> report;
+        manager.GetAllocationSampler().GetReport(report, 0);
+        const char* systemAllocatorName = AZ::AllocatorInstance<AZ::SystemAllocator>::GetAllocator().GetName();
+        auto systemAllocatorEntry = AZStd::find_if(report.begin(), report.end(),
+            [systemAllocatorName](const AZ::Debug::AllocationSampler::ReportEntry& entry) { return entry.m_allocatorName == systemAllocatorName; });
+        ASSERT_NE(report.end(), systemAllocatorEntry);
+        EXPECT_EQ(1, systemAllocatorEntry->m_sampleCount);
+        EXPECT_EQ(128, systemAllocatorEntry->m_largestAllocation);
+        manager.GetAllocationSampler().Reset();
+    }
+
+    TEST_F(AllocationSamplerTest, AllocatorManager_ToggleSamplingWhileAllocating_AllocationsFinishWithTheSampler)
+    {
+        AZ::AllocatorManager& manager = AZ::AllocatorManager::Instance();
+        AZStd::atomic_bool stop{ false };
+
+        AZStd::vector<AZStd::thread> threads;
+        for (int threadIndex = 0; threadIndex < 4; ++threadIndex)
+        {
+            threads.emplace_back([&stop]()
+            {
+                while (!stop.load())
+                {
+                    void* address = azmalloc(64, 16);
+                    azfree(address);
+                }
+            });
+        }
+
+        // Switching the sampler off waits for the allocations that are still recording into it
+        for (int i = 0; i < 200; ++i)
+        {
+            manager.SetAllocationSampleInterval(i % 2 ? 0 : 1);
+        }
+        manager.SetAllocationSampleInterval(0);
+
+        stop = true;
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        const size_t numSamples = manager.GetAllocationSampler().GetNumSamples();
+        void* address = azmalloc(64, 16);
+        azfree(address);
+        EXPECT_EQ(numSamples, manager.GetAllocationSampler().GetNumSamples());
+        manager.GetAllocationSampler().Reset();
+    }
+#endif // !_RELEASE
+}
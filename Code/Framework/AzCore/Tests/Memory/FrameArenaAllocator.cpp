@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/Memory/FrameArenaAllocator.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace UnitTest
+{
+    class FrameArenaAllocatorTest
+        : public AllocatorsFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AllocatorsFixture::SetUp();
+
+            AZ::FrameArenaAllocator::Descriptor descriptor;
+            descriptor.m_pageSize = PageSize;
+            AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Create(descriptor);
+        }
+
+        void TearDown() override
+        {
+            AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Destroy();
+
+            AllocatorsFixture::TearDown();
+        }
+
+    protected:
+        static constexpr size_t PageSize = 4096;
+
+        AZ::FrameArenaAllocator& GetArena()
+        {
+            return static_cast<AZ::FrameArenaAllocator&>(AZ::AllocatorInstance<AZ::FrameArenaAllocator>::GetAllocator());
+        }
+    };
+
+    TEST_F(FrameArenaAllocatorTest, Allocate_RespectsAlignment)
+    {
+        for (size_t alignment = 1; alignment <= 256; alignment *= 2)
+        {
+            void* address = GetArena().Allocate(3, alignment);
+            ASSERT_NE(nullptr, address);
+            EXPECT_EQ(0, reinterpret_cast<size_t>(address) % alignment);
+        }
+    }
+
+    TEST_F(FrameArenaAllocatorTest, Allocate_ConsecutiveAllocationsDontOverlap)
+    {
+        char* first = reinterpret_cast<char*>(GetArena().Allocate(64, 8));
+        char* second = reinterpret_cast<char*>(GetArena().Allocate(64, 8));
+        memset(first, 1, 64);
+        memset(second, 2, 64);
+        EXPECT_EQ(1, first[63]);
+        EXPECT_EQ(2, second[0]);
+        EXPECT_EQ(128, GetArena().NumAllocatedBytes());
+    }
+
+    TEST_F(FrameArenaAllocatorTest, Allocate_LargerThanPage_UsesDedicatedPage)
+    {
+        char* address = reinterpret_cast<char*>(GetArena().Allocate(PageSize * 3, 16));
+        ASSERT_NE(nullptr, address);
+        memset(address, 1, PageSize * 3);
+        EXPECT_GE(GetArena().Capacity(), PageSize * 3);
+    }
+
+    TEST_F(FrameArenaAllocatorTest, AdvanceFrame_MemoryIsRecycledAfterTwoFrames)
+    {
+        for (int i = 0; i < 4; ++i)
+        {
+            GetArena().Allocate(1024, 8);
+        }
+        const size_t capacity = GetArena().Capacity();
+        EXPECT_EQ(4 * 1024, GetArena().NumAllocatedBytes());
+
+        // Memory from the previous frame is still alive
+        GetArena().AdvanceFrame();
+        EXPECT_EQ(4 * 1024, GetArena().NumAllocatedBytes());
+        EXPECT_TRUE(GetArena().IsFrameAlive(GetArena().GetFrameIndex() - 1));
+
+        // Now it's recycled and the pages are reused instead of allocating new ones
+        GetArena().AdvanceFrame();
+        EXPECT_EQ(0, GetArena().NumAllocatedBytes());
+        EXPECT_FALSE(GetArena().IsFrameAlive(GetArena().GetFrameIndex() - 2));
+
+        for (int i = 0; i < 4; ++i)
+        {
+            GetArena().Allocate(1024, 8);
+        }
+        EXPECT_EQ(capacity, GetArena().Capacity());
+    }
+
+    TEST_F(FrameArenaAllocatorTest, Resize_LastAllocation_GrowsInPlace)
+    {
+        void* first = GetArena().Allocate(32, 8);
+        void* second = GetArena().Allocate(32, 8);
+        EXPECT_EQ(0, GetArena().Resize(first, 64));
+        EXPECT_EQ(64, GetArena().Resize(second, 64));
+        EXPECT_EQ(96, GetArena().NumAllocatedBytes());
+    }
+
+    TEST_F(FrameArenaAllocatorTest, PeakAllocatedBytes_IsTrackedAcrossFrames)
+    {
+        GetArena().Allocate(2048, 8);
+        GetArena().AdvanceFrame();
+        GetArena().AdvanceFrame();
+        GetArena().Allocate(512, 8);
+
+        EXPECT_EQ(2048, GetArena().GetPeakAllocatedBytes());
+
+        size_t allocatedBytes = 0;
+        size_t capacityBytes = 0;
+        AZStd::vector<AZ::AllocatorManager::AllocatorStats> stats;
+        AZ::AllocatorManager::Instance().GetAllocatorStats(allocatedBytes, capacityBytes, &stats);
+        auto arenaStats = AZStd::find_if(stats.begin(), stats.end(),
+            [this](const AZ::AllocatorManager::AllocatorStats& entry) { return entry.m_name == GetArena().GetName(); });
+        ASSERT_NE(stats.end(), arenaStats);
+        EXPECT_EQ(2048, arenaStats->m_peakAllocatedBytes);
+
+        GetArena().ResetPeakAllocatedBytes();
+        EXPECT_EQ(512, GetArena().GetPeakAllocatedBytes());
+    }
+
+    TEST_F(FrameArenaAllocatorTest, Threads_AllocateFromSeparateArenas)
+    {
+        constexpr size_t ThreadCount = 4;
+        constexpr size_t AllocationCount = 256;
+        AZStd::thread threads[ThreadCount];
+        bool results[ThreadCount] = {};
+        for (size_t threadIndex = 0; threadIndex < ThreadCount; ++threadIndex)
+        {
+            threads[threadIndex] = AZStd::thread([this, threadIndex, &results]()
+            {
+                bool success = true;
+                for (size_t i = 0; i < AllocationCount; ++i)
+                {
+                    AZ::u8* value = reinterpret_cast<AZ::u8*>(GetArena().Allocate(sizeof(AZ::u8) * 16, 16));
+                    memset(value, static_cast<int>(threadIndex), 16);
+                    success = success && value[15] == threadIndex;
+                }
+                results[threadIndex] = success;
+            });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        for (bool result : results)
+        {
+            EXPECT_TRUE(result);
+        }
+        EXPECT_EQ(ThreadCount * AllocationCount * 16, GetArena().NumAllocatedBytes());
+    }
+
+    TEST_F(FrameArenaAllocatorTest, StdAllocator_BacksContainers)
+    {
+        AZStd::vector<int, AZ::FrameArenaStdAllocator> values;
+        for (int i = 0; i < 1000; ++i)
+        {
+            values.push_back(i);
+        }
+        EXPECT_EQ(999, values.back());
+        EXPECT_GE(GetArena().NumAllocatedBytes(), 1000 * sizeof(int));
+
+        // Still valid in the next frame
+        GetArena().AdvanceFrame();
+        values.push_back(1000);
+        EXPECT_EQ(1000, values.size() - 1);
+    }
+
+    TEST_F(FrameArenaAllocatorTest, StdAllocator_UsedAfterFrameRecycled_Asserts)
+    {
+        auto values = AZStd::make_unique<AZStd::vector<int, AZ::FrameArenaStdAllocator>>();
+        values->push_back(1);
+
+        GetArena().AdvanceFrame();
+        GetArena().AdvanceFrame();
+
+        // Growing allocates a new block and frees the old one, destroying the vector frees the new block
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        values->push_back(2);
+        values.reset();
+        AZ_TEST_STOP_TRACE_SUPPRESSION(3);
+    }
+}
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    class FrameArenaAllocatorBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Create();
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Destroy();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+    };
+
+    template<typename Allocator>
+    static void RunTransientVectors(::benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            for (int list = 0; list < 64; ++list)
+            {
+                AZStd::vector<AZ::u32, Allocator> values;
+                for (AZ::u32 i = 0; i < 256; ++i)
+                {
+                    values.push_back(i);
+                }
+                benchmark::DoNotOptimize(values.data());
+            }
+
+            if constexpr (AZStd::is_same_v<Allocator, AZ::FrameArenaStdAllocator>)
+            {
+                static_cast<AZ::FrameArenaAllocator&>(AZ::AllocatorInstance<AZ::FrameArenaAllocator>::GetAllocator()).AdvanceFrame();
+            }
+        }
+    }
+
+    BENCHMARK_F(FrameArenaAllocatorBenchmarkFixture, TransientVectors_SystemAllocator)(benchmark::State& state)
+    {
+        RunTransientVectors<AZStd::allocator>(state);
+    }
+
+    BENCHMARK_F(FrameArenaAllocatorBenchmarkFixture, TransientVectors_FrameArena)(benchmark::State& state)
+    {
+        RunTransientVectors<AZ::FrameArenaStdAllocator>(state);
+    }
+}
+#endif // HAVE_BENCHMARK
@@ -8,7 +8,9 @@
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/PlatformIncl.h>
 #include <AzCore/Memory/HphaSchema.h>
+#include <AzCore/Memory/SizeClassSchema.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
 
 #if defined(HAVE_BENCHMARK)
 #include <benchmark/benchmark.h>
@@ -28,6 +30,20 @@ public:
     {}
 };
 
+class SizeClassSchema_TestAllocator
+    : public AZ::SimpleSchemaAllocator<AZ::SizeClassSchema>
+{
+public:
+    AZ_TYPE_INFO(SizeClassSchema_TestAllocator, "{5E3B0B8A-0D7C-4C26-9B0F-3D5E2E9C7A14}");
+
+    using Base = AZ::SimpleSchemaAllocator<AZ::SizeClassSchema>;
+    using Descriptor = Base::Descriptor;
+
+    SizeClassSchema_TestAllocator()
+        : Base("SizeClassSchema_TestAllocator", "Allocator for Test")
+    {}
+};
+
 static const size_t s_kiloByte = 1024;
 static const size_t s_megaByte = s_kiloByte * s_kiloByte;
 using AllocationSizeArray = AZStd::array<size_t, 10>;
@@ -66,25 +82,66 @@ namespace UnitTest
         }
     };
 
-    TEST_P(HphaSchemaTestFixture, Allocate)
+    template<class Allocator>
+    static void TestAllocations(const HphaSchemaTestParameters& testParameters)
     {
         AZStd::vector<void*, AZ::AZStdAlloc<AZ::OSAllocator>> allocations;
-        const HphaSchemaTestParameters& testParameters = GetParam();
         const size_t totalNumberOfAllocations = testParameters.m_allocationSizes.size() * testParameters.m_numberOfAllocationsPerSize;
         for (size_t i = 0; i < totalNumberOfAllocations; ++i)
         {
             const size_t allocationIndex = allocations.size();
             const size_t allocationSize = testParameters.m_allocationSizes[allocationIndex % testParameters.m_allocationSizes.size()];
-            void* allocation = AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get().Allocate(allocationSize, 0);
+            void* allocation = AZ::AllocatorInstance<Allocator>::Get().Allocate(allocationSize, 0);
             EXPECT_NE(nullptr, allocation);
-            EXPECT_LE(allocationSize, AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get().AllocationSize(allocation));
+            EXPECT_LE(allocationSize, AZ::AllocatorInstance<Allocator>::Get().AllocationSize(allocation));
             allocations.emplace_back(allocation);
         }
 
         const size_t numberOfAllocations = allocations.size();
         for (size_t i = 0; i < numberOfAllocations; ++i)
         {
-            AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get().DeAllocate(allocations[i], testParameters.m_allocationSizes[i % testParameters.m_allocationSizes.size()]);
+            AZ::AllocatorInstance<Allocator>::Get().DeAllocate(allocations[i], testParameters.m_allocationSizes[i % testParameters.m_allocationSizes.size()]);
+        }
+    }
+
+    TEST_P(HphaSchemaTestFixture, Allocate)
+    {
+        TestAllocations<HphaSchema_TestAllocator>(GetParam());
+    }
+
+    class SizeClassSchemaTestFixture
+        : public AllocatorsTestFixture
+        , public ::testing::WithParamInterface<HphaSchemaTestParameters>
+    {
+    public:
+        void SetUp() override
+        {
+            AZ::AllocatorInstance<SizeClassSchema_TestAllocator>::Create();
+        }
+
+        void TearDown() override
+        {
+            AZ::AllocatorInstance<SizeClassSchema_TestAllocator>::Destroy();
+        }
+    };
+
+    TEST_P(SizeClassSchemaTestFixture, Allocate)
+    {
+        TestAllocations<SizeClassSchema_TestAllocator>(GetParam());
+    }
+
+    TEST_P(SizeClassSchemaTestFixture, Allocate_RespectsAlignment)
+    {
+        const HphaSchemaTestParameters& testParameters = GetParam();
+        for (size_t allocationSize : testParameters.m_allocationSizes)
+        {
+            for (size_t alignment = 1; alignment <= 256; alignment *= 2)
+            {
+                void* allocation = AZ::AllocatorInstance<SizeClassSchema_TestAllocator>::Get().Allocate(allocationSize, alignment);
+                ASSERT_NE(nullptr, allocation);
+                EXPECT_EQ(0, reinterpret_cast<size_t>(allocation) % alignment);
+                AZ::AllocatorInstance<SizeClassSchema_TestAllocator>::Get().DeAllocate(allocation);
+            }
         }
     }
 
@@ -111,6 +168,102 @@ namespace UnitTest
     INSTANTIATE_TEST_CASE_P(Mixed,
         HphaSchemaTestFixture,
         ::testing::ValuesIn(s_mixedInstancesParameters));
+
+    INSTANTIATE_TEST_CASE_P(Small,
+        SizeClassSchemaTestFixture,
+        ::testing::ValuesIn(s_smallInstancesParameters));
+    INSTANTIATE_TEST_CASE_P(Big,
+        SizeClassSchemaTestFixture,
+        ::testing::ValuesIn(s_bigInstancesParameters));
+    INSTANTIATE_TEST_CASE_P(Mixed,
+        SizeClassSchemaTestFixture,
+        ::testing::ValuesIn(s_mixedInstancesParameters));
+
+    class SizeClassSchemaTest
+        : public AllocatorsTestFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AZ::AllocatorInstance<SizeClassSchema_TestAllocator>::Create();
+        }
+
+        void TearDown() override
+        {
+            AZ::AllocatorInstance<SizeClassSchema_TestAllocator>::Destroy();
+        }
+    };
+
+    TEST_F(SizeClassSchemaTest, DeAllocate_FromOtherThread_MemoryIsReused)
+    {
+        constexpr size_t AllocationCount = 1000;
+        constexpr size_t AllocationSize = 48;
+        AZStd::vector<void*, AZ::AZStdAlloc<AZ::OSAllocator>> allocations;
+        AZStd::thread producer([&allocations]()
+        {
+            for (size_t i = 0; i < AllocationCount; ++i)
+            {
+                void* allocation = AZ::AllocatorInstance<SizeClassSchema_TestAllocator>::Get().Allocate(AllocationSize, 8);
+                memset(allocation, 1, AllocationSize);
+                allocations.push_back(allocation);
+            }
+        });
+        producer.join();
+        EXPECT_EQ(AllocationCount * AllocationSize, AZ::AllocatorInstance<SizeClassSchema_TestAllocator>::Get().NumAllocatedBytes());
+
+        for (void* allocation : allocations)
+        {
+            AZ::AllocatorInstance<SizeClassSchema_TestAllocator>::Get().DeAllocate(allocation);
+        }
+        EXPECT_EQ(0, AZ::AllocatorInstance<SizeClassSchema_TestAllocator>::Get().NumAllocatedBytes());
+
+        // The freed blocks are in this thread's cache and the central free list, so no new spans are needed
+        const size_t capacity = AZ::AllocatorInstance<SizeClassSchema_TestAllocator>::Get().Capacity();
+        for (void*& allocation : allocations)
+        {
+            allocation = AZ::AllocatorInstance<SizeClassSchema_TestAllocator>::Get().Allocate(AllocationSize, 8);
+        }
+        EXPECT_EQ(capacity, AZ::AllocatorInstance<SizeClassSchema_TestAllocator>::Get().Capacity());
+
+        for (void* allocation : allocations)
+        {
+            AZ::AllocatorInstance<SizeClassSchema_TestAllocator>::Get().DeAllocate(allocation);
+        }
+    }
+
+    TEST_F(SizeClassSchemaTest, GarbageCollect_ReleasesUnusedSpans)
+    {
+        AZStd::vector<void*, AZ::AZStdAlloc<AZ::OSAllocator>> allocations;
+        for (size_t i = 0; i < 10000; ++i)
+        {
+            allocations.push_back(AZ::AllocatorInstance<SizeClassSchema_TestAllocator>::Get().Allocate(128, 16));
+        }
+        EXPECT_GE(AZ::AllocatorInstance<SizeClassSchema_TestAllocator>::Get().Capacity(), 10000 * 128);
+
+        for (void* allocation : allocations)
+        {
+            AZ::AllocatorInstance<SizeClassSchema_TestAllocator>::Get().DeAllocate(allocation);
+        }
+        AZ::AllocatorInstance<SizeClassSchema_TestAllocator>::Get().GarbageCollect();
+        EXPECT_EQ(0, AZ::AllocatorInstance<SizeClassSchema_TestAllocator>::Get().Capacity());
+    }
+
+    TEST_F(SizeClassSchemaTest, ReAllocate_PreservesContent)
+    {
+        char* allocation = reinterpret_cast<char*>(AZ::AllocatorInstance<SizeClassSchema_TestAllocator>::Get().Allocate(100, 8));
+        memset(allocation, 7, 100);
+
+        // Grow from a size class to a large allocation and back
+        allocation = reinterpret_cast<char*>(AZ::AllocatorInstance<SizeClassSchema_TestAllocator>::Get().ReAllocate(allocation, 2 * AZ::SizeClassSchema::MaxSmallAllocationSize, 8));
+        ASSERT_NE(nullptr, allocation);
+        EXPECT_EQ(7, allocation[99]);
+        allocation = reinterpret_cast<char*>(AZ::AllocatorInstance<SizeClassSchema_TestAllocator>::Get().ReAllocate(allocation, 10, 8));
+        ASSERT_NE(nullptr, allocation);
+        EXPECT_EQ(7, allocation[9]);
+        EXPECT_EQ(16, AZ::AllocatorInstance<SizeClassSchema_TestAllocator>::Get().AllocationSize(allocation));
+
+        AZ::AllocatorInstance<SizeClassSchema_TestAllocator>::Get().DeAllocate(allocation);
+    }
 }
 
 
@@ -178,6 +331,60 @@ namespace Benchmark
         BM_Allocations(state, s_mixedAllocationSizes);
     }
 
+    // Every thread allocates a batch of blocks and frees them again, which is where a global lock shows up as contention
+    template<class Allocator>
+    static void BM_MultithreadedAllocations(benchmark::State& state, const AllocationSizeArray& allocationArray)
+    {
+        if (state.thread_index == 0)
+        {
+            AZ::AllocatorInstance<Allocator>::Create();
+        }
+
+        constexpr size_t BatchSize = 64;
+        void* allocations[BatchSize];
+        while (state.KeepRunning())
+        {
+            for (size_t allocationIndex = 0; allocationIndex < BatchSize; ++allocationIndex)
+            {
+                allocations[allocationIndex] = AZ::AllocatorInstance<Allocator>::Get().Allocate(allocationArray[allocationIndex % allocationArray.size()], 0);
+            }
+            for (size_t allocationIndex = 0; allocationIndex < BatchSize; ++allocationIndex)
+            {
+                AZ::AllocatorInstance<Allocator>::Get().DeAllocate(allocations[allocationIndex], allocationArray[allocationIndex % allocationArray.size()]);
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * BatchSize);
+
+        if (state.thread_index == 0)
+        {
+            AZ::AllocatorInstance<Allocator>::Destroy();
+        }
+    }
+
+    static void BM_HphaSchema_MultithreadedSmallAllocations(benchmark::State& state)
+    {
+        BM_MultithreadedAllocations<HphaSchema_TestAllocator>(state, s_smallAllocationSizes);
+    }
+    BENCHMARK(BM_HphaSchema_MultithreadedSmallAllocations)->ThreadRange(1, 8)->UseRealTime();
+
+    static void BM_SizeClassSchema_MultithreadedSmallAllocations(benchmark::State& state)
+    {
+        BM_MultithreadedAllocations<SizeClassSchema_TestAllocator>(state, s_smallAllocationSizes);
+    }
+    BENCHMARK(BM_SizeClassSchema_MultithreadedSmallAllocations)->ThreadRange(1, 8)->UseRealTime();
+
+    static void BM_HphaSchema_MultithreadedMixedAllocations(benchmark::State& state)
+    {
+        BM_MultithreadedAllocations<HphaSchema_TestAllocator>(state, s_mixedAllocationSizes);
+    }
+    BENCHMARK(BM_HphaSchema_MultithreadedMixedAllocations)->ThreadRange(1, 8)->UseRealTime();
+
+    static void BM_SizeClassSchema_MultithreadedMixedAllocations(benchmark::State& state)
+    {
+        BM_MultithreadedAllocations<SizeClassSchema_TestAllocator>(state, s_mixedAllocationSizes);
+    }
+    BENCHMARK(BM_SizeClassSchema_MultithreadedMixedAllocations)->ThreadRange(1, 8)->UseRealTime();
+
 
 } // Benchmark
 #endif // HAVE_BENCHMARK
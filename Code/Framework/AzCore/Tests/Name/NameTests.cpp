@@ -48,14 +48,20 @@ namespace UnitTest
             AZ::NameDictionary::Destroy();
         }
 
-        static const AZStd::unordered_map<AZ::Name::Hash, AZ::Internal::NameData*>& GetDictionary()
+        static size_t GetEntryCount()
         {
-            return AZ::NameDictionary::Instance().m_dictionary;
+            return AZ::NameDictionary::Instance().GetEntryCount();
         }
-        
-        static size_t GetEntryCount()
+
+        //! Returns true if the dictionary has an entry for the string, under whichever hash it ended up with
+        static bool ContainsName(AZStd::string_view nameString)
         {
-            return GetDictionary().size();
+            bool found = false;
+            AZ::NameDictionary::Instance().ForEachEntry([&found, nameString](AZ::Internal::NameData* nameData)
+            {
+                found = found || (nameData->GetName() == nameString);
+            });
+            return found;
         }
 
         //! Directly calculate the hash value for a string without collision resolution
@@ -270,11 +276,7 @@ namespace UnitTest
         // Make sure all entries in the localDictionary got copied into the globalDictionary
         for (const AZStd::string& nameString : localDictionary)
         {
-            auto& globalDictionary = NameDictionaryTester::GetDictionary();
-            auto it = AZStd::find_if(globalDictionary.begin(), globalDictionary.end(), [&nameString](AZStd::pair<AZ::Name::Hash, AZ::Internal::NameData*> entry) {
-                return entry.second->GetName() == nameString;
-            });
-            EXPECT_TRUE(it != globalDictionary.end()) << "Can't find '" << nameString.data() << "' in local dictionary.";
+            EXPECT_TRUE(NameDictionaryTester::ContainsName(nameString)) << "Can't find '" << nameString.data() << "' in local dictionary.";
         }
 
         // Make sure all the threads got an accurate Name object
@@ -831,5 +833,299 @@ namespace UnitTest
 
         EXPECT_LT(nameTime, stringTime);
     }
+
+    TEST_F(NameTest, MakeNames_MatchesMakeName)
+    {
+        AZ::Name existing{ "existing" };
+
+        const AZStd::vector<AZStd::string_view> names = { "first", "", "existing", "second", "first" };
+        AZStd::vector<AZ::Name> batch = AZ::NameDictionary::Instance().MakeNames(names);
+
+        ASSERT_EQ(batch.size(), names.size());
+        EXPECT_TRUE(batch[1].IsEmpty());
+        EXPECT_EQ(batch[2], existing);
+        EXPECT_EQ(batch[0], batch[4]);
+        for (size_t index = 0; index < names.size(); ++index)
+        {
+            EXPECT_EQ(batch[index].GetStringView(), names[index]);
+            EXPECT_EQ(batch[index], AZ::Name(names[index]));
+        }
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), 3);
+
+        batch.clear();
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), 1);
+    }
+
+    TEST_F(NameTest, ReleasedEntriesAreRecycled)
+    {
+        // Enough names to grow every shard's table several times, and some long names which don't fit in the string arena
+        const AZStd::string longSuffix(2048, 'x');
+        AZStd::vector<AZStd::string> nameStrings;
+        for (int i = 0; i < 5000; ++i)
+        {
+            nameStrings.push_back((i % 100) ? AZStd::string::format("name%d", i) : AZStd::string::format("name%d_%s", i, longSuffix.c_str()));
+        }
+
+        for (int pass = 0; pass < 3; ++pass)
+        {
+            AZStd::vector<AZ::Name> names;
+            for (const AZStd::string& nameString : nameStrings)
+            {
+                names.emplace_back(nameString);
+            }
+            EXPECT_EQ(NameDictionaryTester::GetEntryCount(), nameStrings.size());
+
+            for (size_t index = 0; index < names.size(); ++index)
+            {
+                EXPECT_EQ(names[index].GetStringView(), nameStrings[index]);
+                EXPECT_EQ(strlen(names[index].GetCStr()), nameStrings[index].size());
+                EXPECT_EQ(AZ::NameDictionary::Instance().FindName(names[index].GetHash()), names[index]);
+            }
+
+            // Release every other name, the rest must still be found after their neighbors were removed
+            for (size_t index = 0; index < names.size(); index += 2)
+            {
+                names[index] = AZ::Name();
+            }
+            for (size_t index = 1; index < names.size(); index += 2)
+            {
+                EXPECT_EQ(AZ::Name(nameStrings[index]), names[index]);
+            }
+            EXPECT_EQ(NameDictionaryTester::GetEntryCount(), nameStrings.size() / 2);
+        }
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), 0);
+    }
+
+    TEST_F(NameTest, NameLiteral_MatchesName)
+    {
+        static const AZ::NameLiteral literal{ "literal" };
+        constexpr AZ::Name::Hash literalHash = AZ::Name::CalcHash("literal");
+        EXPECT_EQ(literal.GetLiteralHash(), literalHash);
+
+        // Literals only add their string to the dictionary when they are used
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), 0);
+
+        AZ::Name name{ "literal" };
+        EXPECT_EQ(name, literal);
+        EXPECT_EQ(literal, name);
+        EXPECT_NE(AZ::Name("other"), literal);
+        EXPECT_EQ(literal.GetHash(), name.GetHash());
+        EXPECT_EQ(literalHash, name.GetHash());
+
+        AZ::Name fromLiteral = literal;
+        EXPECT_EQ(fromLiteral, name);
+        EXPECT_EQ(fromLiteral.GetStringView(), "literal");
+        EXPECT_EQ(fromLiteral.GetCStr(), name.GetCStr());
+
+        // The literal keeps its entry alive
+        name = AZ::Name();
+        fromLiteral = AZ::Name();
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), 1);
+        EXPECT_TRUE(NameDictionaryTester::ContainsName("literal"));
+
+        EXPECT_EQ(AZ::Name(AZ_NAME_LITERAL("inline")), AZ::Name("inline"));
+        EXPECT_TRUE(AZ::Name(AZ_NAME_LITERAL("")).IsEmpty());
+    }
+
+    TEST_F(NameTest, NameLiteral_ReleasedWithDictionary)
+    {
+        static const AZ::NameLiteral literal{ "literal" };
+        EXPECT_EQ(AZ::Name(literal).GetStringView(), "literal");
+
+        // The dictionary releases the literal instead of reporting it as a leak
+        AZ::NameDictionary::Destroy();
+        AZ::NameDictionary::Create();
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), 0);
+
+        // The literal registers again with the new dictionary
+        EXPECT_EQ(AZ::Name("literal"), literal);
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), 1);
+    }
 }
 
+#if defined(HAVE_BENCHMARK)
+//-------------------------------------------------------------------------
+// PERF TESTS
+//-------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    class NameDictionaryBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            AZ::NameDictionary::Create();
+
+            for (int i = 0; i < NameCount; ++i)
+            {
+                m_nameStrings.push_back(AZStd::string::format("Benchmark/Name/%d", i));
+            }
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_existingNames = {};
+            m_nameStrings = {};
+            AZ::NameDictionary::Destroy();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        static constexpr int NameCount = 4096;
+        static constexpr int OperationsPerThread = 16384;
+
+        void MakeExistingNames()
+        {
+            for (const AZStd::string& nameString : m_nameStrings)
+            {
+                m_existingNames.emplace_back(nameString);
+            }
+        }
+
+        //! Runs the function OperationsPerThread times on each of state.range(0) threads at once
+        template<typename Function>
+        void RunOnThreads(::benchmark::State& state, const Function& function)
+        {
+            const int threadCount = static_cast<int>(state.range(0));
+            for ([[maybe_unused]] auto _ : state)
+            {
+                AZStd::vector<AZStd::thread> threads;
+                for (int threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+                {
+                    threads.emplace_back([&function, threadIndex]()
+                    {
+                        for (int operation = 0; operation < OperationsPerThread; ++operation)
+                        {
+                            function(threadIndex, operation);
+                        }
+                    });
+                }
+                for (AZStd::thread& thread : threads)
+                {
+                    thread.join();
+                }
+            }
+            state.SetItemsProcessed(state.iterations() * threadCount * OperationsPerThread);
+        }
+
+        AZStd::vector<AZStd::string> m_nameStrings;
+        AZStd::vector<AZ::Name> m_existingNames;
+    };
+
+    BENCHMARK_DEFINE_F(NameDictionaryBenchmarkFixture, MakeName_Existing)(benchmark::State& state)
+    {
+        MakeExistingNames();
+        RunOnThreads(state, [this](int threadIndex, int operation)
+        {
+            AZ::Name name(m_nameStrings[(operation * 7 + threadIndex * 13) % NameCount]);
+            benchmark::DoNotOptimize(name);
+        });
+    }
+    BENCHMARK_REGISTER_F(NameDictionaryBenchmarkFixture, MakeName_Existing)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
+
+    BENCHMARK_DEFINE_F(NameDictionaryBenchmarkFixture, FindName_Existing)(benchmark::State& state)
+    {
+        MakeExistingNames();
+        RunOnThreads(state, [this](int threadIndex, int operation)
+        {
+            const AZ::Name::Hash hash = m_existingNames[(operation * 7 + threadIndex * 13) % NameCount].GetHash();
+            AZ::Name name = AZ::NameDictionary::Instance().FindName(hash);
+            benchmark::DoNotOptimize(name);
+        });
+    }
+    BENCHMARK_REGISTER_F(NameDictionaryBenchmarkFixture, FindName_Existing)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
+
+    BENCHMARK_DEFINE_F(NameDictionaryBenchmarkFixture, MakeName_AddAndRemove)(benchmark::State& state)
+    {
+        // Each thread uses its own names and releases them right away, so every call adds and removes a dictionary entry
+        const int threadCount = static_cast<int>(state.range(0));
+        RunOnThreads(state, [this, threadCount](int threadIndex, int operation)
+        {
+            AZ::Name name(m_nameStrings[(operation * threadCount + threadIndex) % NameCount]);
+            benchmark::DoNotOptimize(name);
+        });
+    }
+    BENCHMARK_REGISTER_F(NameDictionaryBenchmarkFixture, MakeName_AddAndRemove)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
+
+    BENCHMARK_F(NameDictionaryBenchmarkFixture, MakeName_NewNames)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZStd::vector<AZ::Name> names;
+            names.reserve(NameCount);
+            for (const AZStd::string& nameString : m_nameStrings)
+            {
+                names.emplace_back(nameString);
+            }
+            benchmark::DoNotOptimize(names.data());
+        }
+        state.SetItemsProcessed(state.iterations() * NameCount);
+    }
+
+    BENCHMARK_F(NameDictionaryBenchmarkFixture, MakeNames_NewNames)(benchmark::State& state)
+    {
+        const AZStd::vector<AZStd::string_view> nameViews(m_nameStrings.begin(), m_nameStrings.end());
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZStd::vector<AZ::Name> names = AZ::NameDictionary::Instance().MakeNames(nameViews);
+            benchmark::DoNotOptimize(names.data());
+        }
+        state.SetItemsProcessed(state.iterations() * NameCount);
+    }
+
+    BENCHMARK_F(NameDictionaryBenchmarkFixture, CompareWithName_Runtime)(benchmark::State& state)
+    {
+        MakeExistingNames();
+        size_t matchCount = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (const AZ::Name& name : m_existingNames)
+            {
+                matchCount += (name == AZ::Name("Benchmark/Name/42")) ? 1 : 0;
+            }
+        }
+        benchmark::DoNotOptimize(matchCount);
+        state.SetItemsProcessed(state.iterations() * NameCount);
+    }
+
+    BENCHMARK_F(NameDictionaryBenchmarkFixture, CompareWithName_Literal)(benchmark::State& state)
+    {
+        MakeExistingNames();
+        size_t matchCount = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (const AZ::Name& name : m_existingNames)
+            {
+                matchCount += (name == AZ_NAME_LITERAL("Benchmark/Name/42")) ? 1 : 0;
+            }
+        }
+        benchmark::DoNotOptimize(matchCount);
+        state.SetItemsProcessed(state.iterations() * NameCount);
+    }
+
+    BENCHMARK_F(NameDictionaryBenchmarkFixture, ConstructName_Runtime)(benchmark::State& state)
+    {
+        MakeExistingNames();
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::Name name("Benchmark/Name/42");
+            benchmark::DoNotOptimize(name);
+        }
+    }
+
+    BENCHMARK_F(NameDictionaryBenchmarkFixture, ConstructName_Literal)(benchmark::State& state)
+    {
+        MakeExistingNames();
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::Name name = AZ_NAME_LITERAL("Benchmark/Name/42");
+            benchmark::DoNotOptimize(name);
+        }
+    }
+}
+#endif // HAVE_BENCHMARK
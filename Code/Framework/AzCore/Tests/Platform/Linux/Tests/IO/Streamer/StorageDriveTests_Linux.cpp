@@ -0,0 +1,658 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <AzCore/IO/Streamer/Scheduler.h>
+#include <AzCore/IO/Streamer/StorageDrive.h>
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/IO/Streamer/Streamer.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/StringFunc/StringFunc.h>
+#include <AzCore/Utils/Utils.h>
+
+#include <Tests/FileIOBaseTestTypes.h>
+#include <Tests/Streamer/StreamStackEntryConformityTests.h>
+#include <Tests/Streamer/StreamStackEntryMock.h>
+
+namespace AZ::IO
+{
+    constexpr AZ::u32 TestMaxFileHandles = 1;
+    constexpr AZ::u32 TestMaxMetaDataEntries = 16;
+    constexpr size_t TestPhysicalSectorSize = 4_kib;
+    constexpr size_t TestLogicalSectorSize = 512;
+    constexpr AZ::u32 TestQueueDepth = 8;
+    constexpr AZ::s32 TestOverCommit = 0;
+    constexpr bool TestEnableUnbufferReads = true;
+    constexpr bool HasSeekPenalty = false;
+
+    //
+    // StreamStackEntry API Conformity
+    //
+    class StorageDriveLinuxTestDescription :
+        public StreamStackEntryConformityTestsDescriptor<StorageDriveLinux>
+    {
+    public:
+        StorageDriveLinux CreateInstance() override
+        {
+            StorageDriveLinux::ConstructionOptions options;
+            options.m_hasSeekPenalty = HasSeekPenalty;
+            options.m_enableUnbufferedReads = TestEnableUnbufferReads;
+            options.m_minimalReporting = true;
+
+            return StorageDriveLinux(TestMaxFileHandles, TestMaxMetaDataEntries, TestPhysicalSectorSize,
+                TestLogicalSectorSize, TestQueueDepth, TestOverCommit, options);
+        }
+    };
+
+    INSTANTIATE_TYPED_TEST_CASE_P(
+        Streamer_StorageDriveLinuxConformityTests, StreamStackEntryConformityTests, StorageDriveLinuxTestDescription);
+
+    //
+    // StorageDriveLinux Tests
+    //
+
+    class Streamer_StorageDriveLinuxTestFixture
+        : public UnitTest::ScopedAllocatorSetupFixture
+        , public UnitTest::SetRestoreFileIOBaseRAII
+    {
+    public:
+        // Data...
+        static constexpr char s_dummyFilename[] = "DummyLinux.bin";
+        static constexpr char s_fileCharacter = 'F';
+        static constexpr char s_beginCharacter = 'B';
+        static constexpr char s_endCharacter = 'E';
+        static constexpr char s_chunkCharacter = 'C';
+
+        UnitTest::TestFileIOBase m_fileIO{};
+        AZStd::string m_dummyFilepath;
+        AZ::IO::RequestPath m_dummyRequestPath;
+        AZStd::shared_ptr<StorageDriveLinux> m_storageDriveLinux{};
+        AZ::IO::StreamerContext* m_context = nullptr;
+        AZStd::vector<AZStd::string> m_dummyFiles;
+        StorageDriveLinux::ConstructionOptions m_configurationOptions;
+
+        // Methods...
+        Streamer_StorageDriveLinuxTestFixture()
+            : UnitTest::SetRestoreFileIOBaseRAII(m_fileIO)
+        {
+            PrepareTestFilepath();
+        }
+
+        void SetupStorageDrive(s32 overCommit)
+        {
+            if (m_context == nullptr)
+            {
+                m_context = new AZ::IO::StreamerContext();
+            }
+
+            m_configurationOptions.m_hasSeekPenalty = HasSeekPenalty;
+            m_configurationOptions.m_enableUnbufferedReads = TestEnableUnbufferReads;
+            m_configurationOptions.m_minimalReporting = true;
+
+            m_storageDriveLinux = AZStd::make_shared<AZ::IO::StorageDriveLinux>(TestMaxFileHandles, TestMaxMetaDataEntries,
+                TestPhysicalSectorSize, TestLogicalSectorSize, TestQueueDepth, overCommit, m_configurationOptions);
+            m_storageDriveLinux->SetContext(*m_context);
+        }
+
+        //! io_uring can be missing on older kernels or be blocked in containers. The drive forwards everything in that case, so
+        //! the tests that verify the drive's own behavior can't run.
+        bool IsDriveAvailable() const
+        {
+            return m_storageDriveLinux && m_storageDriveLinux->IsAvailable();
+        }
+
+        void SetUp() override
+        {
+            ASSERT_FALSE(m_dummyFilepath.empty());
+            m_dummyRequestPath.InitFromAbsolutePath(m_dummyFilepath);
+
+            SetupStorageDrive(TestOverCommit);
+        }
+
+        void TearDown() override
+        {
+            m_storageDriveLinux.reset();
+            delete m_context;
+            m_context = nullptr;
+
+            RemoveDummyFiles();
+        }
+
+        // Create a file filled with a single character.
+        // If chunkOffset is non-zero, it will write in a specific character every chunkOffset bytes till the end of file.
+        // If beginEndMarkers is true, it will write in specific bytes to mark the begin and end of the file.
+        void CreateDummyFile(size_t fileSize, size_t chunkOffset = 0, bool beginEndMarkers = false)
+        {
+            SystemFile file;
+            bool fileCreated = file.Open(m_dummyFilepath.c_str(),
+                SystemFile::OpenMode::SF_OPEN_CREATE | SystemFile::OpenMode::SF_OPEN_READ_WRITE);
+            ASSERT_TRUE(fileCreated);
+            m_dummyFiles.push_back(m_dummyFilepath);
+
+            AZStd::unique_ptr<char[]> buffer(new char[fileSize]);
+            ::memset(buffer.get(), s_fileCharacter, fileSize);
+            if (chunkOffset != 0)
+            {
+                for (size_t offset = 0; offset < fileSize; offset += chunkOffset)
+                {
+                    buffer[offset] = s_chunkCharacter;
+                }
+            }
+            if (beginEndMarkers)
+            {
+                buffer[0] = s_beginCharacter;
+                buffer[fileSize - 1] = s_endCharacter;
+            }
+
+            auto bytesWritten = file.Write(buffer.get(), fileSize);
+            file.Close();
+            ASSERT_EQ(bytesWritten, fileSize);
+        }
+
+        void RemoveDummyFiles()
+        {
+            for (auto& dummyFile : m_dummyFiles)
+            {
+                AZ::IO::SystemFile::Delete(dummyFile.c_str());
+            }
+            m_dummyFiles.clear();
+        }
+
+        void WaitTillCompleted()
+        {
+            StreamStackEntry::Status status;
+            auto startTime = AZStd::chrono::system_clock::now();
+            do
+            {
+                m_storageDriveLinux->ExecuteRequests();
+                m_context->FinalizeCompletedRequests();
+
+                status.m_isIdle = true;
+                m_storageDriveLinux->UpdateStatus(status);
+
+                if (AZStd::chrono::system_clock::now() - startTime > AZStd::chrono::seconds(5))
+                {
+                    FAIL();
+                }
+            } while (!status.m_isIdle);
+        }
+
+        FileRequest* QueueRead(void* output, size_t outputSize, u64 offset, u64 size, IStreamerTypes::RequestStatus expectedStatus)
+        {
+            AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateRead(nullptr, output, outputSize, m_dummyRequestPath, offset, size);
+            request->SetCompletionCallback([expectedStatus](const FileRequest& request)
+                {
+                    EXPECT_EQ(expectedStatus, request.GetStatus());
+                });
+            m_storageDriveLinux->QueueRequest(request);
+            return request;
+        }
+
+    private:
+        void PrepareTestFilepath()
+        {
+            char exePath[AZ_MAX_PATH_LEN] = { 0 };
+            auto result = AZ::Utils::GetExecutablePath(exePath, AZ_MAX_PATH_LEN);
+            if (result.m_pathStored != AZ::Utils::ExecutablePathResult::Success)
+            {
+                return;
+            }
+
+            AZStd::string filePath(exePath);
+            if (result.m_pathIncludesFilename)
+            {
+                AZ::StringFunc::Path::StripFullName(filePath);
+            }
+
+            AZ::StringFunc::Path::Join(filePath.c_str(), "TestFiles", filePath);
+            if (!AZ::IO::SystemFile::Exists(filePath.c_str()))
+            {
+                if (!AZ::IO::SystemFile::CreateDir(filePath.c_str()))
+                {
+                    return;
+                }
+            }
+
+            AZ::StringFunc::Path::Join(filePath.c_str(), s_dummyFilename, m_dummyFilepath);
+        }
+    };
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, Constructor_InvalidSizes_ErrorsAreReported)
+    {
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        m_storageDriveLinux = AZStd::make_shared<AZ::IO::StorageDriveLinux>(TestMaxFileHandles, TestMaxMetaDataEntries, 0, 0,
+            TestQueueDepth, TestOverCommit, m_configurationOptions);
+        AZ_TEST_STOP_TRACE_SUPPRESSION(2);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, Constructor_InvalidOvercommit_ErrorIsReportedAndSizeAdjusted)
+    {
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        m_storageDriveLinux = AZStd::make_shared<AZ::IO::StorageDriveLinux>(TestMaxFileHandles, TestMaxMetaDataEntries,
+            TestPhysicalSectorSize, TestLogicalSectorSize, TestQueueDepth, -(aznumeric_cast<s32>(TestQueueDepth) + 2),
+            m_configurationOptions);
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+
+        if (IsDriveAvailable())
+        {
+            AZ::IO::StreamStackEntry::Status status{};
+            m_storageDriveLinux->UpdateStatus(status);
+            EXPECT_EQ(1, status.m_numAvailableSlots);
+        }
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, FileMetaDataRetrievalRequest_FileExists_ReportsAccurateFileSize)
+    {
+        if (!IsDriveAvailable())
+        {
+            return;
+        }
+
+        CreateDummyFile(4_kib);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateFileMetaDataRetrieval(m_dummyRequestPath);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                auto& fileMetaData = AZStd::get<FileRequest::FileMetaDataRetrievalData>(request.GetCommand());
+                EXPECT_TRUE(fileMetaData.m_found);
+                EXPECT_EQ(4_kib, fileMetaData.m_fileSize);
+            });
+
+        m_storageDriveLinux->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, FileExistsRequest_FileDoesNotExist_RequestIsForwarded)
+    {
+        if (!IsDriveAvailable())
+        {
+            return;
+        }
+
+        auto mock = AZStd::make_shared<::testing::NiceMock<StreamStackEntryMock>>();
+        m_storageDriveLinux->SetNext(mock);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateFileExistsCheck(m_dummyRequestPath);
+        EXPECT_CALL(*mock, QueueRequest(request)).
+            WillOnce([this](AZ::IO::FileRequest* request)
+                {
+                    m_context->MarkRequestAsCompleted(request);
+                });
+
+        m_storageDriveLinux->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_QueueAndExecuteRequest_ReturnsCorrectData)
+    {
+        if (!IsDriveAvailable())
+        {
+            return;
+        }
+
+        constexpr size_t fileSize = 16_kib;
+        CreateDummyFile(fileSize, 0, true);
+
+        void* buffer = azmalloc(fileSize, TestPhysicalSectorSize);
+        QueueRead(buffer, fileSize, 0, fileSize, IStreamerTypes::RequestStatus::Completed);
+        WaitTillCompleted();
+
+        const char* data = reinterpret_cast<const char*>(buffer);
+        EXPECT_EQ(data[0], s_beginCharacter);
+        EXPECT_EQ(data[1], s_fileCharacter);
+        EXPECT_EQ(data[fileSize - 2], s_fileCharacter);
+        EXPECT_EQ(data[fileSize - 1], s_endCharacter);
+        azfree(buffer);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_UnalignedOffsetSizeAndMemory_ReturnsCorrectDataAndDoesNotWriteMore)
+    {
+        if (!IsDriveAvailable())
+        {
+            return;
+        }
+
+        constexpr size_t fileSize = 16_kib;
+        constexpr size_t readOffset = TestLogicalSectorSize + 3;
+        constexpr size_t readSize = TestLogicalSectorSize + 7;
+        constexpr char guardCharacter = 'G';
+        CreateDummyFile(fileSize, readOffset);
+
+        AZStd::unique_ptr<char[]> buffer(new char[readSize + 2]);
+        ::memset(buffer.get(), guardCharacter, readSize + 2);
+        QueueRead(buffer.get() + 1, readSize, readOffset, readSize, IStreamerTypes::RequestStatus::Completed);
+        WaitTillCompleted();
+
+        EXPECT_EQ(buffer[0], guardCharacter);
+        EXPECT_EQ(buffer[1], s_chunkCharacter);
+        EXPECT_EQ(buffer[readSize], s_fileCharacter);
+        EXPECT_EQ(buffer[readSize + 1], guardCharacter);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_MoreReadsThanQueueDepth_AllReadsAreBatchedAndDataIsCorrect)
+    {
+        if (!IsDriveAvailable())
+        {
+            return;
+        }
+
+        constexpr size_t chunkSize = TestPhysicalSectorSize;
+        constexpr size_t numChunks = TestQueueDepth * 4;
+        CreateDummyFile(chunkSize * numChunks, chunkSize);
+
+        void* buffer = azmalloc(chunkSize * numChunks, TestPhysicalSectorSize);
+        char* chunks = reinterpret_cast<char*>(buffer);
+        for (size_t i = 0; i < numChunks; ++i)
+        {
+            QueueRead(chunks + i * chunkSize, chunkSize, i * chunkSize, chunkSize, IStreamerTypes::RequestStatus::Completed);
+        }
+        WaitTillCompleted();
+
+        for (size_t i = 0; i < numChunks; ++i)
+        {
+            EXPECT_EQ(chunks[i * chunkSize], s_chunkCharacter);
+            EXPECT_EQ(chunks[i * chunkSize + chunkSize - 1], s_fileCharacter);
+        }
+        azfree(buffer);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_ReadPastEndOfFile_ReportsFailure)
+    {
+        if (!IsDriveAvailable())
+        {
+            return;
+        }
+
+        constexpr size_t fileSize = 4_kib;
+        CreateDummyFile(fileSize);
+
+        void* buffer = azmalloc(fileSize * 2, TestPhysicalSectorSize);
+        QueueRead(buffer, fileSize * 2, 0, fileSize * 2, IStreamerTypes::RequestStatus::Failed);
+        WaitTillCompleted();
+        azfree(buffer);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_InvalidFilePath_RequestIsForwarded)
+    {
+        if (!IsDriveAvailable())
+        {
+            return;
+        }
+
+        constexpr AZ::u64 readSize = TestPhysicalSectorSize;
+        char buffer[readSize];
+
+        auto mock = AZStd::make_shared<::testing::NiceMock<StreamStackEntryMock>>();
+        m_storageDriveLinux->SetNext(mock);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        AZ::IO::RequestPath path;
+        path.InitFromAbsolutePath(m_dummyFilepath + "/Broken/Path.txt");
+        request->CreateRead(nullptr, buffer, readSize, path, 0, readSize);
+        EXPECT_CALL(*mock, QueueRequest(request)).
+            WillOnce([this](AZ::IO::FileRequest* request)
+                {
+                    m_context->MarkRequestAsCompleted(request);
+                });
+
+        m_storageDriveLinux->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, CancelRequest_CancelPendingRead_ReadIsCanceled)
+    {
+        if (!IsDriveAvailable())
+        {
+            return;
+        }
+
+        constexpr size_t fileSize = 4_kib;
+        CreateDummyFile(fileSize);
+
+        void* buffer = azmalloc(fileSize, TestPhysicalSectorSize);
+        // The read is only issued when the requests are executed, so it's still pending when the cancel arrives.
+        FileRequestPtr target = m_context->GetNewExternalRequest();
+        AZ::IO::FileRequest* link = m_context->GetNewInternalRequest();
+        link->CreateRequestLink(FileRequestPtr(target));
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(link, buffer, fileSize, m_dummyRequestPath, 0, fileSize);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                EXPECT_EQ(IStreamerTypes::RequestStatus::Canceled, request.GetStatus());
+            });
+        m_storageDriveLinux->QueueRequest(request);
+
+        AZ::IO::FileRequest* cancel = m_context->GetNewInternalRequest();
+        cancel->CreateCancel(target);
+        cancel->SetCompletionCallback([](const FileRequest& request)
+            {
+                EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, request.GetStatus());
+            });
+        m_storageDriveLinux->QueueRequest(cancel);
+
+        WaitTillCompleted();
+        azfree(buffer);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, CollectStatistics_ReadDone_MoreThanZeroStatisticsReturned)
+    {
+        if (!IsDriveAvailable())
+        {
+            return;
+        }
+
+        constexpr size_t fileSize = 4_kib;
+        CreateDummyFile(fileSize);
+
+        void* buffer = azmalloc(fileSize, TestPhysicalSectorSize);
+        QueueRead(buffer, fileSize, 0, fileSize, IStreamerTypes::RequestStatus::Completed);
+        WaitTillCompleted();
+
+        AZStd::vector<Statistic> statistics;
+        m_storageDriveLinux->CollectStatistics(statistics);
+        EXPECT_FALSE(statistics.empty());
+        azfree(buffer);
+    }
+} // namespace AZ::IO
+
+#if defined(HAVE_BENCHMARK)
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    //! Compares the io_uring based drive against the generic, synchronous, storage drive by reading a file with a number of
+    //! reads in flight at the same time. The page cache is dropped for the file between iterations so both drives read
+    //! from the device.
+    class StorageDriveLinuxFixture : public benchmark::Fixture
+    {
+    public:
+        constexpr static const char* TestFileName = "StreamerBenchmarkLinux.bin";
+        constexpr static size_t FileSize = 64_mib;
+        constexpr static size_t ChunkSize = 256_kib;
+        constexpr static size_t ChunkCount = FileSize / ChunkSize;
+
+        void SetupStreamer(bool useIoUring, AZ::u32 queueDepth)
+        {
+            using namespace AZ::IO;
+
+            m_fileIO = new UnitTest::TestFileIOBase();
+            m_previousFileIO = AZ::IO::FileIOBase::GetInstance();
+            AZ::IO::FileIOBase::SetInstance(nullptr);
+            AZ::IO::FileIOBase::SetInstance(m_fileIO);
+
+            SystemFile file;
+            file.Open(TestFileName, SystemFile::OpenMode::SF_OPEN_CREATE | SystemFile::OpenMode::SF_OPEN_READ_WRITE);
+            AZStd::unique_ptr<char[]> buffer(new char[FileSize]);
+            ::memset(buffer.get(), 'c', FileSize);
+            file.Write(buffer.get(), FileSize);
+            file.Close();
+
+            AZStd::optional<AZ::IO::FixedMaxPathString> absolutePath = AZ::Utils::ConvertToAbsolutePath(TestFileName);
+            if (absolutePath.has_value())
+            {
+                m_absolutePath = *absolutePath;
+
+                AZStd::shared_ptr<StreamStackEntry> stack = AZStd::make_shared<StorageDrive>(32);
+                if (useIoUring)
+                {
+                    StorageDriveLinux::ConstructionOptions options;
+                    options.m_hasSeekPenalty = false;
+                    options.m_minimalReporting = true;
+                    auto storageDriveLinux = AZStd::make_shared<StorageDriveLinux>(32, 32, 4_kib, 512, queueDepth, 0, options);
+                    m_isAvailable = storageDriveLinux->IsAvailable();
+                    storageDriveLinux->SetNext(AZStd::move(stack));
+                    stack = AZStd::move(storageDriveLinux);
+                }
+
+                AZStd::unique_ptr<Scheduler> scheduler = AZStd::make_unique<Scheduler>(AZStd::move(stack));
+                m_streamer = aznew Streamer(AZStd::thread_desc{}, AZStd::move(scheduler));
+            }
+        }
+
+        void TearDown([[maybe_unused]] const ::benchmark::State& state) override
+        {
+            using namespace AZ::IO;
+
+            AZStd::string temp;
+            m_absolutePath.swap(temp);
+
+            delete m_streamer;
+            m_streamer = nullptr;
+
+            SystemFile::Delete(TestFileName);
+
+            AZ::IO::FileIOBase::SetInstance(nullptr);
+            AZ::IO::FileIOBase::SetInstance(m_previousFileIO);
+            delete m_fileIO;
+        }
+
+        void DropPageCache()
+        {
+            int file = ::open(m_absolutePath.c_str(), O_RDONLY | O_CLOEXEC);
+            if (file >= 0)
+            {
+                ::posix_fadvise(file, 0, 0, POSIX_FADV_DONTNEED);
+                ::close(file);
+            }
+        }
+
+        void RepeatedlyReadFile(benchmark::State& state)
+        {
+            using namespace AZ::IO;
+            using namespace AZStd::chrono;
+
+            if (!m_streamer || !m_isAvailable)
+            {
+                state.SkipWithError("Streamer or io_uring isn't available.");
+                return;
+            }
+
+            // The number of reads that are queued with the Streamer at the same time.
+            const size_t readsInFlight = aznumeric_cast<size_t>(state.range(0));
+            void* buffer = azmalloc(FileSize, 4_kib);
+            AZStd::vector<system_clock::time_point> queueTimes(ChunkCount);
+            double totalLatencyUs = 0;
+
+            for (auto _ : state)
+            {
+                state.PauseTiming();
+                m_streamer->QueueRequest(m_streamer->FlushCaches());
+                DropPageCache();
+                state.ResumeTiming();
+
+                AZStd::atomic_size_t completed{ 0 };
+                AZStd::atomic<double> latencyUs{ 0 };
+                auto start = high_resolution_clock::now();
+
+                // Queue the reads in batches of the requested size and wait for each batch to complete before queuing the
+                // next, so the number of reads in flight is controlled by the benchmark argument.
+                size_t nextChunk = 0;
+                while (nextChunk < ChunkCount)
+                {
+                    size_t batchEnd = AZStd::min(nextChunk + readsInFlight, ChunkCount);
+                    AZStd::vector<FileRequestPtr> requests;
+                    requests.reserve(batchEnd - nextChunk);
+                    for (; nextChunk < batchEnd; ++nextChunk)
+                    {
+                        char* output = reinterpret_cast<char*>(buffer) + nextChunk * ChunkSize;
+                        FileRequestPtr request = m_streamer->Read(m_absolutePath, output, ChunkSize, ChunkSize,
+                            IStreamerTypes::s_noDeadline, IStreamerTypes::s_priorityMedium, nextChunk * ChunkSize);
+                        queueTimes[nextChunk] = high_resolution_clock::now();
+                        m_streamer->SetRequestCompleteCallback(request,
+                            [&queueTimes, &latencyUs, &completed, chunk = nextChunk](FileRequestHandle)
+                            {
+                                double latency = aznumeric_cast<double>(
+                                    duration_cast<microseconds>(high_resolution_clock::now() - queueTimes[chunk]).count());
+                                double current = latencyUs.load();
+                                while (!latencyUs.compare_exchange_weak(current, current + latency))
+                                {
+                                }
+                                completed++;
+                            });
+                        requests.push_back(AZStd::move(request));
+                    }
+                    m_streamer->QueueRequestBatch(AZStd::move(requests));
+
+                    auto batchStart = high_resolution_clock::now();
+                    while (completed.load() < batchEnd && (high_resolution_clock::now() - batchStart) < AZStd::chrono::seconds(30))
+                    {
+                        AZStd::this_thread::yield();
+                    }
+                }
+
+                auto durationInSeconds = duration_cast<duration<double>>(high_resolution_clock::now() - start);
+                state.SetIterationTime(durationInSeconds.count());
+                totalLatencyUs += latencyUs.load() / ChunkCount;
+            }
+
+            state.SetBytesProcessed(aznumeric_cast<int64_t>(state.iterations() * FileSize));
+            state.counters["AvgLatency_us"] = ::benchmark::Counter(totalLatencyUs, ::benchmark::Counter::kAvgIterations);
+            azfree(buffer);
+        }
+
+        AZStd::string m_absolutePath;
+        AZ::IO::Streamer* m_streamer{};
+        AZ::IO::FileIOBase* m_previousFileIO{};
+        UnitTest::TestFileIOBase* m_fileIO{};
+        bool m_isAvailable{ true };
+    };
+
+    BENCHMARK_DEFINE_F(StorageDriveLinuxFixture, ReadsGenericStorageDrive)(benchmark::State& state)
+    {
+        constexpr bool UseIoUring = false;
+        SetupStreamer(UseIoUring, aznumeric_cast<AZ::u32>(state.range(0)));
+        RepeatedlyReadFile(state);
+    }
+
+    BENCHMARK_DEFINE_F(StorageDriveLinuxFixture, ReadsIoUring)(benchmark::State& state)
+    {
+        constexpr bool UseIoUring = true;
+        SetupStreamer(UseIoUring, aznumeric_cast<AZ::u32>(state.range(0)));
+        RepeatedlyReadFile(state);
+    }
+
+    BENCHMARK_REGISTER_F(StorageDriveLinuxFixture, ReadsGenericStorageDrive)
+        ->Arg(1)->Arg(8)->Arg(64)
+        ->UseManualTime()
+        ->Unit(benchmark::kMillisecond);
+
+    BENCHMARK_REGISTER_F(StorageDriveLinuxFixture, ReadsIoUring)
+        ->Arg(1)->Arg(8)->Arg(64)
+        ->UseManualTime()
+        ->Unit(benchmark::kMillisecond);
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
@@ -8,5 +8,6 @@
 
 set(FILES
     Tests/UtilsTests_Linux.cpp
+    Tests/IO/Streamer/StorageDriveTests_Linux.cpp
     ../Common/UnixLike/Tests/UtilsTests_UnixLike.cpp
 )
@@ -12,8 +12,12 @@
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/Json/RegistrationContext.h>
 #include <AzCore/Serialization/Json/JsonSystemComponent.h>
+#include <AzCore/Settings/SettingsRegistryCache.h>
 #include <AzCore/Settings/SettingsRegistryImpl.h>
+#include <AzCore/Settings/SettingsRegistryMergeUtils.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/UnitTest/TestTypes.h>
@@ -1056,6 +1060,258 @@ namespace SettingsRegistryTests
         EXPECT_TRUE(m_registry->Visit(callback, {}));
     }
 
+    //
+    // PathHandle
+    //
+
+    TEST_F(SettingsRegistryTest, GetWithPathHandle_ValuesSetThroughStringPath_ValuesMatch)
+    {
+        m_registry->Set("/Test/Bool", true);
+        m_registry->Set("/Test/Int", aznumeric_cast<AZ::s64>(-42));
+        m_registry->Set("/Test/Uint", aznumeric_cast<AZ::u64>(42));
+        m_registry->Set("/Test/Double", 42.0);
+        m_registry->Set("/Test/String", "hello");
+
+        bool boolValue = false;
+        AZ::s64 intValue = 0;
+        AZ::u64 uintValue = 0;
+        double doubleValue = 0.0;
+        AZStd::string stringValue;
+        AZ::SettingsRegistryInterface::FixedValueString fixedStringValue;
+        EXPECT_TRUE(m_registry->Get(boolValue, AZ::SettingsRegistryInterface::PathHandle("/Test/Bool")));
+        EXPECT_TRUE(m_registry->Get(intValue, AZ::SettingsRegistryInterface::PathHandle("/Test/Int")));
+        EXPECT_TRUE(m_registry->Get(uintValue, AZ::SettingsRegistryInterface::PathHandle("/Test/Uint")));
+        EXPECT_TRUE(m_registry->Get(doubleValue, AZ::SettingsRegistryInterface::PathHandle("/Test/Double")));
+        EXPECT_TRUE(m_registry->Get(stringValue, AZ::SettingsRegistryInterface::PathHandle("/Test/String")));
+        EXPECT_TRUE(m_registry->Get(fixedStringValue, AZ::SettingsRegistryInterface::PathHandle("/Test/String")));
+
+        EXPECT_TRUE(boolValue);
+        EXPECT_EQ(-42, intValue);
+        EXPECT_EQ(42u, uintValue);
+        EXPECT_DOUBLE_EQ(42.0, doubleValue);
+        EXPECT_STREQ("hello", stringValue.c_str());
+        EXPECT_STREQ("hello", fixedStringValue.c_str());
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::Object, m_registry->GetType(AZ::SettingsRegistryInterface::PathHandle("/Test")));
+    }
+
+    TEST_F(SettingsRegistryTest, GetWithPathHandle_InvalidPath_ReturnsFalse)
+    {
+        AZ::SettingsRegistryInterface::PathHandle handle("#$%");
+        EXPECT_FALSE(handle.IsValid());
+
+        AZ::s64 value = 0;
+        EXPECT_FALSE(m_registry->Get(value, handle));
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::NoType, m_registry->GetType(handle));
+    }
+
+    TEST_F(SettingsRegistryTest, GetWithPathHandle_UnknownPath_ReturnsFalse)
+    {
+        AZ::s64 value = 0;
+        EXPECT_FALSE(m_registry->Get(value, AZ::SettingsRegistryInterface::PathHandle("/Unknown/Path")));
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::NoType, m_registry->GetType(AZ::SettingsRegistryInterface::PathHandle("/Unknown/Path")));
+    }
+
+    TEST_F(SettingsRegistryTest, GetWithPathHandle_ValueChangedAfterMerge_ReturnsLatestValue)
+    {
+        const AZ::SettingsRegistryInterface::PathHandle handle("/Test");
+        ASSERT_TRUE(m_registry->MergeSettings(R"({ "Test": 1 })", AZ::SettingsRegistryInterface::Format::JsonMergePatch));
+
+        AZ::s64 value = 0;
+        EXPECT_TRUE(m_registry->Get(value, handle));
+        EXPECT_EQ(1, value);
+
+        m_registry->Set("/Test", aznumeric_cast<AZ::s64>(2));
+        EXPECT_TRUE(m_registry->Get(value, handle));
+        EXPECT_EQ(2, value);
+
+        ASSERT_TRUE(m_registry->MergeSettings(R"({ "Test": 3 })", AZ::SettingsRegistryInterface::Format::JsonMergePatch));
+        EXPECT_TRUE(m_registry->Get(value, handle));
+        EXPECT_EQ(3, value);
+
+        m_registry->Remove("/Test");
+        EXPECT_FALSE(m_registry->Get(value, handle));
+    }
+
+    TEST_F(SettingsRegistryTest, GetWithPathHandle_CalledFromNotifier_ReturnsNewValue)
+    {
+        const AZ::SettingsRegistryInterface::PathHandle handle("/Test");
+        ASSERT_TRUE(m_registry->MergeSettings(R"({ "Test": 1 })", AZ::SettingsRegistryInterface::Format::JsonMergePatch));
+        // Publish a snapshot so the notifier has a chance of seeing a stale version.
+        AZ::s64 value = 0;
+        EXPECT_TRUE(m_registry->Get(value, handle));
+
+        AZ::s64 notifiedValue = 0;
+        auto callback = [this, &handle, &notifiedValue](AZStd::string_view, AZ::SettingsRegistryInterface::Type)
+        {
+            m_registry->Get(notifiedValue, handle);
+        };
+        auto testNotifier = m_registry->RegisterNotifier(callback);
+
+        ASSERT_TRUE(m_registry->MergeSettings(R"({ "Test": 2 })", AZ::SettingsRegistryInterface::Format::JsonMergePatch));
+        EXPECT_EQ(2, notifiedValue);
+        m_registry->Set("/Test", aznumeric_cast<AZ::s64>(3));
+        EXPECT_EQ(3, notifiedValue);
+    }
+
+    TEST_F(SettingsRegistryTest, GetWithPathHandle_ReadFromNotifierDuringFolderMerge_LaterReadsSeeMergedFolder)
+    {
+        CreateTestFile("Memory.setreg",         R"({ "Memory": 0 })");
+        CreateTestFile("Memory.editor.setreg",  R"({ "Memory": 1 })");
+        CreateTestFile("Memory.test.setreg",    R"({ "Memory": 2 })");
+
+        const AZ::SettingsRegistryInterface::PathHandle handle("/Memory");
+        ASSERT_TRUE(m_registry->MergeSettings(R"({ "Memory": -1 })", AZ::SettingsRegistryInterface::Format::JsonMergePatch));
+        AZ::s64 value = 0;
+        EXPECT_TRUE(m_registry->Get(value, handle));
+
+        // Read through both the handle and a snapshot after every file, while the rest of the folder is still to be merged.
+        AZStd::vector<AZ::s64> notifiedValues;
+        auto callback = [this, &handle, &notifiedValues](AZStd::string_view, AZ::SettingsRegistryInterface::Type)
+        {
+            AZ::s64 notifiedValue = -1;
+            EXPECT_TRUE(m_registry->Get(notifiedValue, handle));
+            notifiedValues.push_back(notifiedValue);
+
+            AZ::SettingsRegistryInterface::SnapshotPtr snapshot = m_registry->GetSnapshot();
+            const rapidjson::Value* snapshotValue = handle.Resolve(snapshot->GetSettings());
+            ASSERT_NE(nullptr, snapshotValue);
+            EXPECT_EQ(notifiedValue, snapshotValue->GetInt64());
+        };
+        auto testNotifier = m_registry->RegisterNotifier(callback);
+
+        m_testFolder->push_back(AZ_CORRECT_DATABASE_SEPARATOR);
+        *m_testFolder += AZ::SettingsRegistryInterface::RegistryFolder;
+        EXPECT_TRUE(m_registry->MergeSettingsFolder(*m_testFolder, { "editor", "test" }, {}, nullptr));
+        testNotifier.Disconnect();
+
+        ASSERT_EQ(3, notifiedValues.size());
+        EXPECT_EQ(0, notifiedValues[0]);
+        EXPECT_EQ(1, notifiedValues[1]);
+        EXPECT_EQ(2, notifiedValues[2]);
+
+        // A reader on another thread can't lock the registry while the merge is running, so it has to see the merged folder.
+        AZ::s64 threadValue = -1;
+        AZ::s64 threadSnapshotValue = -1;
+        AZStd::thread reader([this, &handle, &threadValue, &threadSnapshotValue]()
+        {
+            m_registry->Get(threadValue, handle);
+            AZ::SettingsRegistryInterface::SnapshotPtr snapshot = m_registry->GetSnapshot();
+            if (const rapidjson::Value* snapshotValue = handle.Resolve(snapshot->GetSettings()); snapshotValue)
+            {
+                threadSnapshotValue = snapshotValue->GetInt64();
+            }
+        });
+        reader.join();
+        EXPECT_EQ(2, threadValue);
+        EXPECT_EQ(2, threadSnapshotValue);
+    }
+
+    TEST_F(SettingsRegistryTest, GetWithPathHandle_ConcurrentReadsDuringMerges_ReadsAreConsistent)
+    {
+        constexpr AZ::s64 MergeCount = 64;
+        constexpr size_t ReaderCount = 4;
+
+        ASSERT_TRUE(m_registry->MergeSettings(R"({ "Test": { "A": 0, "B": 0 } })", AZ::SettingsRegistryInterface::Format::JsonMergePatch));
+
+        AZStd::atomic_bool done{ false };
+        AZStd::atomic<size_t> failures{ 0 };
+        auto reader = [this, &done, &failures]()
+        {
+            const AZ::SettingsRegistryInterface::PathHandle handleA("/Test/A");
+            while (!done.load())
+            {
+                AZ::SettingsRegistryInterface::SnapshotPtr snapshot = m_registry->GetSnapshot();
+                const rapidjson::Value* a = handleA.Resolve(snapshot->GetSettings());
+                const rapidjson::Value* b = AZ::SettingsRegistryInterface::PathHandle("/Test/B").Resolve(snapshot->GetSettings());
+                // Both values are always updated in the same merge, so a snapshot can never see them out of sync.
+                if (!a || !b || a->GetInt64() != b->GetInt64())
+                {
+                    failures++;
+                }
+
+                AZ::s64 value = -1;
+                if (!m_registry->Get(value, handleA) || value < 0 || value > MergeCount)
+                {
+                    failures++;
+                }
+            }
+        };
+
+        AZStd::vector<AZStd::thread> threads;
+        for (size_t i = 0; i < ReaderCount; ++i)
+        {
+            threads.emplace_back(reader);
+        }
+        for (AZ::s64 i = 1; i <= MergeCount; ++i)
+        {
+            AZStd::string patch = AZStd::string::format(R"({ "Test": { "A": %lld, "B": %lld } })",
+                static_cast<long long>(i), static_cast<long long>(i));
+            EXPECT_TRUE(m_registry->MergeSettings(patch, AZ::SettingsRegistryInterface::Format::JsonMergePatch));
+        }
+        done = true;
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ(0u, failures.load());
+        AZ::s64 value = 0;
+        EXPECT_TRUE(m_registry->Get(value, AZ::SettingsRegistryInterface::PathHandle("/Test/A")));
+        EXPECT_EQ(MergeCount, value);
+    }
+
+    //
+    // Snapshot
+    //
+
+    TEST_F(SettingsRegistryTest, GetSnapshot_NoChanges_SameSnapshotReturned)
+    {
+        m_registry->Set("/Test", true);
+        AZ::SettingsRegistryInterface::SnapshotPtr snapshot1 = m_registry->GetSnapshot();
+        AZ::SettingsRegistryInterface::SnapshotPtr snapshot2 = m_registry->GetSnapshot();
+        EXPECT_EQ(snapshot1.get(), snapshot2.get());
+        EXPECT_EQ(m_registry->GetVersion(), snapshot1->GetVersion());
+    }
+
+    TEST_F(SettingsRegistryTest, GetSnapshot_RegistryChangedAfterSnapshot_SnapshotUnchanged)
+    {
+        m_registry->Set("/Test", aznumeric_cast<AZ::s64>(1));
+        AZ::SettingsRegistryInterface::SnapshotPtr snapshot = m_registry->GetSnapshot();
+        const AZ::u64 version = m_registry->GetVersion();
+
+        m_registry->Set("/Test", aznumeric_cast<AZ::s64>(2));
+        EXPECT_LT(version, m_registry->GetVersion());
+
+        const rapidjson::Value* value = AZ::SettingsRegistryInterface::PathHandle("/Test").Resolve(snapshot->GetSettings());
+        ASSERT_NE(nullptr, value);
+        EXPECT_EQ(1, value->GetInt64());
+
+        AZ::SettingsRegistryInterface::SnapshotPtr newSnapshot = m_registry->GetSnapshot();
+        EXPECT_NE(snapshot.get(), newSnapshot.get());
+        value = AZ::SettingsRegistryInterface::PathHandle("/Test").Resolve(newSnapshot->GetSettings());
+        ASSERT_NE(nullptr, value);
+        EXPECT_EQ(2, value->GetInt64());
+    }
+
+    TEST_F(SettingsRegistryTest, GetSnapshot_ThroughInterfaceAfterMerge_SnapshotMatchesMergedSettings)
+    {
+        AZ::SettingsRegistryInterface& registry = *m_registry;
+        ASSERT_TRUE(registry.MergeSettings(R"({ "Test": 1 })", AZ::SettingsRegistryInterface::Format::JsonMergePatch));
+
+        AZ::SettingsRegistryInterface::SnapshotPtr snapshot = registry.GetSnapshot();
+        ASSERT_NE(nullptr, snapshot);
+        EXPECT_EQ(registry.GetVersion(), snapshot->GetVersion());
+        const AZ::SettingsRegistryInterface::PathHandle handle("/Test");
+        const rapidjson::Value* value = handle.Resolve(snapshot->GetSettings());
+        ASSERT_NE(nullptr, value);
+        EXPECT_EQ(1, value->GetInt64());
+
+        AZ::s64 handleValue = 0;
+        EXPECT_TRUE(registry.Get(handleValue, handle));
+        EXPECT_EQ(1, handleValue);
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::Integer, registry.GetType(handle));
+    }
+
     //
     // MergeCommandLineArgument
     //
@@ -1756,4 +2012,363 @@ namespace SettingsRegistryTests
         EXPECT_EQ(AZ::SettingsRegistryInterface::Type::String, m_registry->GetType(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/1/File1"));
         EXPECT_EQ(AZ::SettingsRegistryInterface::Type::String, m_registry->GetType(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/1/File2"));
     }
+
+    //
+    // Merge cache
+    //
+
+    class SettingsRegistryMergeCacheTest
+        : public SettingsRegistryTest
+    {
+    public:
+        void SetUp() override
+        {
+            SettingsRegistryTest::SetUp();
+
+            m_registryFolder = AZStd::string::format("%s/%s", m_testFolder->c_str(), AZ::SettingsRegistryInterface::RegistryFolder);
+            m_cacheFolder = AZStd::string::format("%s/Cache", m_testFolder->c_str());
+            m_registry->SetMergeCacheFolder(m_cacheFolder);
+        }
+
+        void TearDown() override
+        {
+            m_registryFolder = {};
+            m_cacheFolder = {};
+            SettingsRegistryTest::TearDown();
+        }
+
+        size_t CountCacheFiles() const
+        {
+            size_t count = 0;
+            AZStd::string filter = AZStd::string::format("%s/*%s", m_cacheFolder.c_str(), AZ::SettingsRegistryCache::FileExtension);
+            AZ::IO::SystemFile::FindFiles(filter.c_str(), [&count](const char*, bool isFile)
+            {
+                if (isFile)
+                {
+                    count++;
+                }
+                return true;
+            });
+            return count;
+        }
+
+        // Merges the registry folder into a new registry that uses the same cache folder.
+        AZStd::unique_ptr<AZ::SettingsRegistryImpl> MergeIntoNewRegistry(size_t* notifyCount = nullptr)
+        {
+            auto registry = AZStd::make_unique<AZ::SettingsRegistryImpl>();
+            registry->SetMergeCacheFolder(m_cacheFolder);
+            auto notifier = registry->RegisterNotifier([notifyCount](AZStd::string_view, AZ::SettingsRegistryInterface::Type)
+            {
+                if (notifyCount)
+                {
+                    (*notifyCount)++;
+                }
+            });
+            EXPECT_TRUE(registry->MergeSettingsFolder(m_registryFolder, { "editor", "test" }, "Special", "/Root"));
+            return registry;
+        }
+
+    protected:
+        AZStd::string m_registryFolder;
+        AZStd::string m_cacheFolder;
+    };
+
+    TEST_F(SettingsRegistryMergeCacheTest, MergeSettingsFolder_MergeTwice_CacheCreatedAndSameResultReturned)
+    {
+        CreateTestFile("Memory.setreg", R"({ "Memory": 0, "Name": "Root", "Values": [ 1, -2, 3.5, true, null ] })");
+        CreateTestFile("Memory.editor.setreg", R"({ "Memory": 1, "Large": 18446744073709551615 })");
+        CreateTestFile("Patch.setregpatch", R"([ { "op": "add", "path": "/Patched", "value": "yes" } ])");
+        CreateTestFile("Platform/Special/Platform.setreg", R"({ "PlatformValue": 2 })");
+
+        size_t firstNotifyCount = 0;
+        auto firstRegistry = MergeIntoNewRegistry(&firstNotifyCount);
+        EXPECT_EQ(1, CountCacheFiles());
+
+        size_t secondNotifyCount = 0;
+        auto secondRegistry = MergeIntoNewRegistry(&secondNotifyCount);
+        EXPECT_EQ(1, CountCacheFiles());
+        EXPECT_EQ(firstNotifyCount, secondNotifyCount);
+
+        AZ::s64 memory = 0;
+        EXPECT_TRUE(secondRegistry->Get(memory, "/Root/Memory"));
+        EXPECT_EQ(1, memory);
+        AZ::s64 platformValue = 0;
+        EXPECT_TRUE(secondRegistry->Get(platformValue, "/Root/PlatformValue"));
+        EXPECT_EQ(2, platformValue);
+        AZ::u64 large = 0;
+        EXPECT_TRUE(secondRegistry->Get(large, "/Root/Large"));
+        EXPECT_EQ((std::numeric_limits<AZ::u64>::max)(), large);
+        AZStd::string patched;
+        EXPECT_TRUE(secondRegistry->Get(patched, "/Root/Patched"));
+        EXPECT_STREQ("yes", patched.c_str());
+        double value = 0.0;
+        EXPECT_TRUE(secondRegistry->Get(value, "/Root/Values/2"));
+        EXPECT_DOUBLE_EQ(3.5, value);
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::Null, secondRegistry->GetType("/Root/Values/4"));
+
+        // The merge history needs to be the same regardless of whether or not the cache was used.
+        for (size_t i = 0; i < 6; ++i)
+        {
+            AZStd::string historyKey = AZStd::string::format(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/%zu", i);
+            EXPECT_EQ(firstRegistry->GetType(historyKey), secondRegistry->GetType(historyKey));
+            AZStd::string firstHistory;
+            AZStd::string secondHistory;
+            EXPECT_EQ(firstRegistry->Get(firstHistory, historyKey), secondRegistry->Get(secondHistory, historyKey));
+            EXPECT_STREQ(firstHistory.c_str(), secondHistory.c_str());
+        }
+    }
+
+    TEST_F(SettingsRegistryMergeCacheTest, MergeSettingsFolder_FileModified_CacheIsUpdated)
+    {
+        CreateTestFile("Memory.setreg", R"({ "Memory": 0 })");
+        MergeIntoNewRegistry();
+
+        CreateTestFile("Memory.setreg", R"({ "Memory": 42, "Added": true })");
+        auto registry = MergeIntoNewRegistry();
+
+        AZ::s64 memory = 0;
+        EXPECT_TRUE(registry->Get(memory, "/Root/Memory"));
+        EXPECT_EQ(42, memory);
+        EXPECT_EQ(1, CountCacheFiles());
+    }
+
+    TEST_F(SettingsRegistryMergeCacheTest, MergeSettingsFolder_ContentChangedWithSameSizeAndTime_CacheIsIgnored)
+    {
+        CreateTestFile("Memory.setreg", R"({ "Memory": 1 })");
+        MergeIntoNewRegistry();
+
+        AZStd::string cachePath;
+        AZStd::string filter = AZStd::string::format("%s/*%s", m_cacheFolder.c_str(), AZ::SettingsRegistryCache::FileExtension);
+        AZ::IO::SystemFile::FindFiles(filter.c_str(), [this, &cachePath](const char* fileName, bool isFile)
+        {
+            if (isFile)
+            {
+                cachePath = AZStd::string::format("%s/%s", m_cacheFolder.c_str(), fileName);
+            }
+            return true;
+        });
+        ASSERT_FALSE(cachePath.empty());
+
+        // Replace the cache with one that matches the size and modification time of the file on disk, but holds an earlier edit
+        // of the same size. This is what an edit within the resolution of the modification time or a restored file looks like.
+        AZStd::string filePath;
+        AZ::u64 fileSize = 0;
+        AZ::u64 modificationTime = 0;
+        {
+            AZ::SettingsRegistryCache::Reader reader;
+            ASSERT_TRUE(reader.Open(cachePath.c_str(), "/Root"));
+            AZ::SettingsRegistryCache::Reader::Entry entry;
+            ASSERT_TRUE(reader.ReadEntry(entry));
+            filePath = entry.m_path;
+            fileSize = entry.m_fileSize;
+            modificationTime = entry.m_modificationTime;
+        }
+
+        constexpr AZStd::string_view staleContent = R"({ "Memory": 7 })";
+        rapidjson::Document staleDocument;
+        staleDocument.Parse(staleContent.data(), staleContent.size());
+        ASSERT_FALSE(staleDocument.HasParseError());
+        AZ::SettingsRegistryCache::Writer writer("/Root");
+        writer.AddFile(filePath, fileSize, modificationTime,
+            AZ::SettingsRegistryCache::CalculateContentHash(staleContent.data(), staleContent.size()), false, staleDocument);
+        ASSERT_TRUE(writer.WriteToFile(cachePath.c_str()));
+
+        auto registry = MergeIntoNewRegistry();
+        AZ::s64 memory = 0;
+        EXPECT_TRUE(registry->Get(memory, "/Root/Memory"));
+        EXPECT_EQ(1, memory);
+    }
+
+    TEST_F(SettingsRegistryMergeCacheTest, MergeSettingsFolder_FileAdded_CacheIsUpdated)
+    {
+        CreateTestFile("Memory.setreg", R"({ "Memory": 0 })");
+        MergeIntoNewRegistry();
+
+        CreateTestFile("Memory.test.setreg", R"({ "Memory": 1 })");
+        auto registry = MergeIntoNewRegistry();
+
+        AZ::s64 memory = 0;
+        EXPECT_TRUE(registry->Get(memory, "/Root/Memory"));
+        EXPECT_EQ(1, memory);
+    }
+
+    TEST_F(SettingsRegistryMergeCacheTest, MergeSettingsFolder_InvalidFile_CacheNotCreated)
+    {
+        CreateTestFile("Memory.setreg", R"({ "Memory": 0 })");
+        CreateTestFile("Memory.editor.setreg", R"({ "Memory": )");
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        MergeIntoNewRegistry();
+        AZ_TEST_STOP_TRACE_SUPPRESSION_NO_COUNT;
+
+        EXPECT_EQ(0, CountCacheFiles());
+    }
+
+    TEST_F(SettingsRegistryMergeCacheTest, ConfigureMergeCache_NotEnabled_CacheNotUsed)
+    {
+        // The cache folder is shared by all processes of the user, so applications need to opt in.
+        AZ::SettingsRegistryImpl registry;
+        EXPECT_FALSE(AZ::SettingsRegistryMergeUtils::ConfigureMergeCache(registry, false));
+
+        // An explicit setting, for instance from the command line, overrides the application's default.
+        registry.Set(AZ::SettingsRegistryMergeUtils::MergeCacheEnabledKey, false);
+        EXPECT_FALSE(AZ::SettingsRegistryMergeUtils::ConfigureMergeCache(registry, true));
+    }
+
+    TEST_F(SettingsRegistryMergeCacheTest, StoreAndLoadValue_AllTypes_ValuesAreEqual)
+    {
+        rapidjson::Document document;
+        document.Parse(R"({ "Null": null, "True": true, "False": false, "Int": -42, "Uint": 18446744073709551615,
+            "Double": 4.5, "String": "Hello", "Array": [ 1, "Two", [ 3 ] ], "Object": { "Nested": {} } })");
+        ASSERT_FALSE(document.HasParseError());
+
+        AZStd::vector<char> buffer;
+        AZ::SettingsRegistryCache::StoreValue(buffer, document);
+
+        rapidjson::Document loaded;
+        const char* data = buffer.data();
+        ASSERT_TRUE(AZ::SettingsRegistryCache::LoadValue(loaded, loaded.GetAllocator(), data, buffer.data() + buffer.size()));
+        EXPECT_EQ(buffer.data() + buffer.size(), data);
+        EXPECT_TRUE(document == loaded);
+    }
+
+    TEST_F(SettingsRegistryMergeCacheTest, LoadValue_TruncatedData_ReturnsFalse)
+    {
+        rapidjson::Document document;
+        document.Parse(R"({ "Array": [ 1, "Two", [ 3 ] ] })");
+        ASSERT_FALSE(document.HasParseError());
+
+        AZStd::vector<char> buffer;
+        AZ::SettingsRegistryCache::StoreValue(buffer, document);
+
+        rapidjson::Document loaded;
+        const char* data = buffer.data();
+        EXPECT_FALSE(AZ::SettingsRegistryCache::LoadValue(loaded, loaded.GetAllocator(), data, buffer.data() + buffer.size() - 1));
+    }
 } // namespace SettingsRegistryTests
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    class SettingsRegistryBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        // Roughly matches the number of files and settings in the engine's Registry folder.
+        static constexpr size_t FileCount = 48;
+        static constexpr size_t PlatformFileCount = 16;
+        static constexpr size_t SettingsPerFile = 64;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            m_testFolder = AZStd::make_unique<AZStd::string>(AZStd::string::format("%sSettingsRegistryBenchmark_%s",
+                UnitTest::GetTestFolderPath().c_str(), AZ::Uuid::CreateRandom().ToString<AZStd::string>(false, false).c_str()));
+            m_registryFolder = AZStd::make_unique<AZStd::string>(AZStd::string::format("%s/%s",
+                m_testFolder->c_str(), AZ::SettingsRegistryInterface::RegistryFolder));
+
+            for (size_t i = 0; i < FileCount; ++i)
+            {
+                // Every third file has a specialized version to match how the engine's Registry folder is laid out.
+                CreateRegistryFile(AZStd::string::format("File%zu.setreg", i), i);
+                if (i % 3 == 0)
+                {
+                    CreateRegistryFile(AZStd::string::format("File%zu.editor.setreg", i), i);
+                }
+            }
+            for (size_t i = 0; i < PlatformFileCount; ++i)
+            {
+                CreateRegistryFile(AZStd::string::format("%s/Linux/Platform%zu.setreg", AZ::SettingsRegistryInterface::PlatformFolder, i), i);
+            }
+
+            m_registry = AZStd::make_unique<AZ::SettingsRegistryImpl>();
+            m_registry->MergeSettingsFolder(*m_registryFolder, { "editor" }, "Linux");
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_registry.reset();
+            SettingsRegistryTests::SettingsRegistryTest::DeleteFolderRecursive(*m_testFolder);
+            m_registryFolder.reset();
+            m_testFolder.reset();
+
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        void CreateRegistryFile(AZStd::string_view name, size_t fileIndex)
+        {
+            using namespace AZ::IO;
+
+            AZStd::string content = AZStd::string::format(R"({ "Benchmark": { "File%zu": {)", fileIndex);
+            for (size_t i = 0; i < SettingsPerFile; ++i)
+            {
+                content += AZStd::string::format(R"(%s "Value%zu": %zu)", i == 0 ? "" : ",", i, i);
+            }
+            content += "} } }";
+
+            AZStd::string path = AZStd::string::format("%s/%.*s", m_registryFolder->c_str(), static_cast<int>(name.length()), name.data());
+            SystemFile file;
+            if (file.Open(path.c_str(), SystemFile::SF_OPEN_CREATE | SystemFile::SF_OPEN_CREATE_PATH | SystemFile::SF_OPEN_WRITE_ONLY))
+            {
+                file.Write(content.data(), content.size());
+            }
+        }
+
+        AZStd::unique_ptr<AZStd::string> m_testFolder;
+        AZStd::unique_ptr<AZStd::string> m_registryFolder;
+        AZStd::unique_ptr<AZ::SettingsRegistryImpl> m_registry;
+    };
+
+    BENCHMARK_F(SettingsRegistryBenchmarkFixture, MergeSettingsFolder_RegistryFolder)(benchmark::State& state)
+    {
+        AZStd::vector<char> scratchBuffer;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::SettingsRegistryImpl registry;
+            registry.MergeSettingsFolder(*m_registryFolder, { "editor" }, "Linux", "", &scratchBuffer);
+        }
+    }
+
+    BENCHMARK_F(SettingsRegistryBenchmarkFixture, MergeSettingsFolder_RegistryFolderFromCache)(benchmark::State& state)
+    {
+        AZStd::string cacheFolder = AZStd::string::format("%s/Cache", m_testFolder->c_str());
+        {
+            // Prime the cache.
+            AZ::SettingsRegistryImpl registry;
+            registry.SetMergeCacheFolder(cacheFolder);
+            registry.MergeSettingsFolder(*m_registryFolder, { "editor" }, "Linux");
+        }
+
+        AZStd::vector<char> scratchBuffer;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::SettingsRegistryImpl registry;
+            registry.SetMergeCacheFolder(cacheFolder);
+            registry.MergeSettingsFolder(*m_registryFolder, { "editor" }, "Linux", "", &scratchBuffer);
+        }
+    }
+
+    BENCHMARK_F(SettingsRegistryBenchmarkFixture, Get_StringPath)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::s64 value = 0;
+            m_registry->Get(value, "/Benchmark/File17/Value42");
+            benchmark::DoNotOptimize(value);
+        }
+    }
+
+    BENCHMARK_F(SettingsRegistryBenchmarkFixture, Get_PathHandle)(benchmark::State& state)
+    {
+        const AZ::SettingsRegistryInterface::PathHandle handle("/Benchmark/File17/Value42");
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::s64 value = 0;
+            m_registry->Get(value, handle);
+            benchmark::DoNotOptimize(value);
+        }
+    }
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
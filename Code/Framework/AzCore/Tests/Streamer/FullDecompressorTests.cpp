@@ -94,13 +94,13 @@ namespace AZ::IO
             UnitTest::AllocatorsFixture::TearDown();
         }
 
-        void SetupEnvironment(u32 maxNumReads, u32 maxNumJobs)
+        void SetupEnvironment(u32 maxNumReads, u32 maxNumJobs, size_t maxMemoryUsage = 0)
         {
             m_buffer = new u32[m_fakeFileLength >> 2];
 
             m_mock = AZStd::make_shared<StreamStackEntryMock>();
             m_decompressor = AZStd::make_shared<FullFileDecompressor>(maxNumReads, maxNumJobs,
-                FullFileDecompressorTestDescription::m_arbitrarilyLargeAlignment);
+                FullFileDecompressorTestDescription::m_arbitrarilyLargeAlignment, maxMemoryUsage);
 
             m_context = new StreamerContext();
             m_decompressor->SetContext(*m_context);
@@ -147,6 +147,8 @@ namespace AZ::IO
         {
             auto data = AZStd::get_if<FileRequest::ReadData>(&request->GetCommand());
             ASSERT_NE(nullptr, data);
+            m_lastReadOffset = data->m_offset;
+            m_lastReadSize = data->m_size;
 
             u64 size = data->m_size >> 2;
             u32* buffer = reinterpret_cast<u32*>(data->m_output);
@@ -186,9 +188,12 @@ namespace AZ::IO
             return false;
         }
 
-        void ProcessCompressedRead(u64 offset, u64 size, CompressionState compressionState, IStreamerTypes::RequestStatus expectedResult)
+        void ProcessCompressedRead(u64 offset, u64 size, CompressionState compressionState, IStreamerTypes::RequestStatus expectedResult,
+            AZStd::shared_ptr<const CompressionSeekTable> seekTable = {}, CompressionSeekTableLoader seekTableLoader = {})
         {
             CompressionInfo compressionInfo;
+            compressionInfo.m_seekTable = AZStd::move(seekTable);
+            compressionInfo.m_seekTableLoader = AZStd::move(seekTableLoader);
             compressionInfo.m_compressedSize = m_fakeFileLength;
             compressionInfo.m_isCompressed = (compressionState == CompressionState::Compressed || compressionState == CompressionState::Corrupted);
             compressionInfo.m_offset = 0;
@@ -233,7 +238,7 @@ namespace AZ::IO
             EXPECT_TRUE(result);
         }
 
-        void ProcessMultipleCompressedReads()
+        void ProcessMultipleCompressedReads(CompressionTag tag = CompressionTag{ 0 })
         {
             using ::testing::_;
             using ::testing::AnyNumber;
@@ -253,6 +258,7 @@ namespace AZ::IO
             CompressionInfo compressionInfo;
             compressionInfo.m_compressedSize = m_fakeFileLength;
             compressionInfo.m_isCompressed = true;
+            compressionInfo.m_compressionTag = tag;
             compressionInfo.m_offset = 0;
             compressionInfo.m_uncompressedSize = m_fakeFileLength;
             compressionInfo.m_decompressor = [](const CompressionInfo&, const void* compressed,
@@ -290,6 +296,16 @@ namespace AZ::IO
                 }
 
                 m_context->FinalizeCompletedRequests();
+
+                AZStd::vector<Statistic> statistics;
+                m_decompressor->CollectStatistics(statistics);
+                for (const Statistic& statistic : statistics)
+                {
+                    if (statistic.GetName() == "Buffer memory (MB)")
+                    {
+                        m_peakMemoryUsageMB = AZStd::max(m_peakMemoryUsageMB, statistic.GetFloatValue());
+                    }
+                }
             }
 
             EXPECT_TRUE(allCompleted);
@@ -311,11 +327,26 @@ namespace AZ::IO
             VerifyReadBuffer(m_buffer, offset, size);
         }
 
+        //! Creates a seek table for the fake compression, which doesn't change the data so compressed and uncompressed offsets match.
+        AZStd::shared_ptr<const CompressionSeekTable> CreateSeekTable(u64 blockSize) const
+        {
+            auto seekTable = AZStd::make_shared<CompressionSeekTable>();
+            for (u64 offset = 0; offset < m_fakeFileLength; offset += blockSize)
+            {
+                seekTable->push_back(CompressionSeekPoint{ offset, offset });
+            }
+            seekTable->push_back(CompressionSeekPoint{ m_fakeFileLength, m_fakeFileLength });
+            return seekTable;
+        }
+
         u32* m_buffer;
         StreamerContext* m_context;
         AZStd::shared_ptr<FullFileDecompressor> m_decompressor;
         AZStd::shared_ptr<StreamStackEntryMock> m_mock;
         u64 m_fakeFileLength{ 1 * 1024 * 1024 };
+        u64 m_lastReadOffset{ 0 };
+        u64 m_lastReadSize{ 0 };
+        double m_peakMemoryUsageMB{ 0.0 };
     };
 
     TEST_F(Streamer_FullDecompressorTest, DecompressedRead_FullReadAndDecompressData_SuccessfullyReadData)
@@ -334,6 +365,72 @@ namespace AZ::IO
         VerifyReadBuffer(256, m_fakeFileLength-512);
     }
 
+    TEST_F(Streamer_FullDecompressorTest, DecompressedRead_PartialReadWithSeekTable_OnlyOverlappingBlocksAreRead)
+    {
+        constexpr u64 blockSize = 64 * 1024;
+        // Read 4kb that starts 1kb before the end of the third block so the read overlaps with the third and fourth block.
+        constexpr u64 readOffset = 3 * blockSize - 1024;
+        constexpr u64 readSize = 4 * 1024;
+
+        SetupEnvironment();
+        MockReadCalls(ReadResult::Success);
+        ProcessCompressedRead(readOffset, readSize, CompressionState::Compressed, IStreamerTypes::RequestStatus::Completed,
+            CreateSeekTable(blockSize));
+        VerifyReadBuffer(readOffset, readSize);
+        EXPECT_EQ(2 * blockSize, m_lastReadOffset);
+        EXPECT_EQ(2 * blockSize, m_lastReadSize);
+    }
+
+    TEST_F(Streamer_FullDecompressorTest, DecompressedRead_BlockAlignedReadWithSeekTable_OnlyOverlappingBlocksAreRead)
+    {
+        constexpr u64 blockSize = 64 * 1024;
+
+        SetupEnvironment();
+        MockReadCalls(ReadResult::Success);
+        ProcessCompressedRead(blockSize, 2 * blockSize, CompressionState::Compressed, IStreamerTypes::RequestStatus::Completed,
+            CreateSeekTable(blockSize));
+        VerifyReadBuffer(blockSize, 2 * blockSize);
+        EXPECT_EQ(blockSize, m_lastReadOffset);
+        EXPECT_EQ(2 * blockSize, m_lastReadSize);
+    }
+
+    TEST_F(Streamer_FullDecompressorTest, DecompressedRead_PartialReadWithDeferredSeekTable_TableIsLoadedAndUsed)
+    {
+        constexpr u64 blockSize = 64 * 1024;
+        int numLoads = 0;
+        auto loader = [this, &numLoads]()
+        {
+            ++numLoads;
+            return CreateSeekTable(blockSize);
+        };
+
+        SetupEnvironment();
+        MockReadCalls(ReadResult::Success);
+        ProcessCompressedRead(blockSize, blockSize, CompressionState::Compressed, IStreamerTypes::RequestStatus::Completed,
+            {}, loader);
+        VerifyReadBuffer(blockSize, blockSize);
+        EXPECT_EQ(1, numLoads);
+        EXPECT_EQ(blockSize, m_lastReadOffset);
+        EXPECT_EQ(blockSize, m_lastReadSize);
+    }
+
+    TEST_F(Streamer_FullDecompressorTest, DecompressedRead_FullReadWithDeferredSeekTable_TableIsNotLoaded)
+    {
+        int numLoads = 0;
+        auto loader = [this, &numLoads]()
+        {
+            ++numLoads;
+            return CreateSeekTable(64 * 1024);
+        };
+
+        SetupEnvironment();
+        MockReadCalls(ReadResult::Success);
+        ProcessCompressedRead(0, m_fakeFileLength, CompressionState::Compressed, IStreamerTypes::RequestStatus::Completed,
+            {}, loader);
+        VerifyReadBuffer(0, m_fakeFileLength);
+        EXPECT_EQ(0, numLoads);
+    }
+
     TEST_F(Streamer_FullDecompressorTest, DecompressedRead_FullReadFromArchive_SuccessfullyReadData)
     {
         SetupEnvironment();
@@ -394,4 +491,35 @@ namespace AZ::IO
         SetupEnvironment(4, 4);
         ProcessMultipleCompressedReads();
     }
+
+    TEST_F(Streamer_FullDecompressorTest, DecompressedRead_MultipleRequestsWithMemoryBudget_MemoryStaysWithinBudget)
+    {
+        // The budget allows for two buffers, so the third read can't start until one of the decompression jobs completed.
+        constexpr size_t memoryBudget = 2 * 1024 * 1024 + 2 * FullFileDecompressorTestDescription::m_arbitrarilyLargeAlignment;
+        SetupEnvironment(4, 4, memoryBudget);
+        ProcessMultipleCompressedReads();
+        EXPECT_LE(m_peakMemoryUsageMB, memoryBudget / (1024.0 * 1024.0));
+    }
+
+    TEST_F(Streamer_FullDecompressorTest, DecompressedRead_MemoryBudgetSmallerThanFile_AllRequestsComplete)
+    {
+        SetupEnvironment(4, 4, 1024);
+        ProcessMultipleCompressedReads();
+    }
+
+    TEST_F(Streamer_FullDecompressorTest, CollectStatistics_DecompressWithTaggedCodec_ThroughputIsReportedForCodec)
+    {
+        CompressionTag tag;
+        tag.m_code = static_cast<uint32_t>('T') << 24 | static_cast<uint32_t>('E') << 16 | static_cast<uint32_t>('S') << 8 | static_cast<uint32_t>('T');
+
+        SetupEnvironment(2, 2);
+        ProcessMultipleCompressedReads(tag);
+
+        AZStd::vector<Statistic> statistics;
+        m_decompressor->CollectStatistics(statistics);
+        auto it = AZStd::find_if(statistics.begin(), statistics.end(),
+            [](const Statistic& statistic) { return statistic.GetName() == "Decompression Speed TEST (avg. mbps)"; });
+        ASSERT_NE(statistics.end(), it);
+        EXPECT_GT(it->GetFloatValue(), 0.0);
+    }
 } // namespace AZ::IO
@@ -24,6 +24,8 @@ public:
         size_t, AZStd::chrono::microseconds, IStreamerTypes::Priority, size_t));
     MOCK_METHOD7(Read, FileRequestPtr& (FileRequestPtr&, AZStd::string_view, IStreamerTypes::RequestMemoryAllocator&,
         size_t, AZStd::chrono::microseconds, IStreamerTypes::Priority, size_t));
+    MOCK_METHOD3(Map, FileRequestPtr(AZStd::string_view, size_t, size_t));
+    MOCK_METHOD4(Map, FileRequestPtr& (FileRequestPtr&, AZStd::string_view, size_t, size_t));
     MOCK_METHOD1(Cancel, FileRequestPtr(FileRequestPtr));
     MOCK_METHOD2(Cancel, FileRequestPtr& (FileRequestPtr&, FileRequestPtr));
     MOCK_METHOD3(RescheduleRequest, FileRequestPtr(FileRequestPtr, AZStd::chrono::microseconds, IStreamerTypes::Priority));
@@ -48,6 +50,7 @@ public:
     MOCK_CONST_METHOD1(GetRequestStatus, IStreamerTypes::RequestStatus(FileRequestHandle));
     MOCK_CONST_METHOD1(GetEstimatedRequestCompletionTime, AZStd::chrono::system_clock::time_point(FileRequestHandle));
     MOCK_CONST_METHOD4(GetReadRequestResult, bool(FileRequestHandle, void*&, AZ::u64&, IStreamerTypes::ClaimMemory));
+    MOCK_CONST_METHOD2(GetMapRequestResult, bool(FileRequestHandle, MappedFileViewPtr&));
     MOCK_METHOD1(CollectStatistics, void(AZStd::vector<Statistic>&));
     MOCK_CONST_METHOD0(GetRecommendations, const IStreamerTypes::Recommendations&());
     MOCK_METHOD0(SuspendProcessing, void());
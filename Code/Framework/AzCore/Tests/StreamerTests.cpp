@@ -660,13 +660,56 @@ namespace AZ
             EXPECT_TRUE(readSuccessful);
         }
 
+        // Map a range of a file that doesn't start at a page boundary.
+        TYPED_TEST_P(StreamerTest, Map_MapFileAtUnalignedOffset_ViewMatchesFileOrFailsForCompressedFile)
+        {
+            constexpr size_t fileSize = 64_kib;
+            constexpr size_t offset = 4_kib + 12;
+            constexpr size_t mapSize = fileSize - offset;
+            auto testFile = this->CreateTestFile(fileSize, PadArchive::No);
+
+            AZStd::binary_semaphore sync;
+            AZStd::atomic<IStreamerTypes::RequestStatus> status{ IStreamerTypes::RequestStatus::Pending };
+            auto callback = [&status, &sync](FileRequestHandle request)
+            {
+                auto streamer = AZ::Interface<AZ::IO::IStreamer>::Get();
+                status = streamer->GetRequestStatus(request);
+                sync.release();
+            };
+
+            FileRequestPtr request = this->m_streamer->Map(testFile->GetFileName(), mapSize, offset);
+            this->m_streamer->SetRequestCompleteCallback(request, AZStd::move(callback));
+            this->m_streamer->QueueRequest(request);
+
+            bool hasTimedOut = !sync.try_acquire_for(AZStd::chrono::seconds(5));
+            ASSERT_FALSE(hasTimedOut);
+
+            MappedFileViewPtr view;
+            if (this->IsUsingArchive())
+            {
+                // The mock archive only contains compressed files, which can't be mapped.
+                EXPECT_EQ(IStreamerTypes::RequestStatus::Failed, status.load());
+                EXPECT_FALSE(this->m_streamer->GetMapRequestResult(request, view));
+            }
+            else
+            {
+                ASSERT_EQ(IStreamerTypes::RequestStatus::Completed, status.load());
+                ASSERT_TRUE(this->m_streamer->GetMapRequestResult(request, view));
+                ASSERT_EQ(mapSize, view->GetSize());
+                // The view needs to remain valid after the request has been released.
+                request.reset();
+                this->VerifyTestFile(view->GetData(), mapSize, offset);
+            }
+        }
+
         REGISTER_TYPED_TEST_CASE_P(StreamerTest,
             Read_ReadSmallFileEntirely_FileFullyRead,
             Read_ReadLargeFileEntirely_FileFullyRead,
             Read_ReadMultiplePieces_AllReadRequestWereSuccessful,
             Read_ReadMultiplePiecesWithBatch_AllReadRequestWereSuccessful,
             SuspendProcessing_SuspendWhileFileIsQueued_FileIsNotReadUntilProcessingIsRestarted,
-            FlushCaches_FlushAfterEveryRead_FilesAreReadCorrectly);
+            FlushCaches_FlushAfterEveryRead_FilesAreReadCorrectly,
+            Map_MapFileAtUnalignedOffset_ViewMatchesFileOrFailsForCompressedFile);
 
         using StreamerTestCases = ::testing::Types<GlobalCache_Uncompressed, DedicatedCache_Uncompressed, GlobalCache_Compressed, DedicatedCache_Compressed>;
 
@@ -165,7 +165,9 @@ set(FILES
     Math/Vector3Tests.cpp
     Math/Vector4PerformanceTests.cpp
     Math/Vector4Tests.cpp
+    Memory/AllocationSampler.cpp
     Memory/AllocatorManager.cpp
+    Memory/FrameArenaAllocator.cpp
     Memory/HphaSchema.cpp
     Memory/HphaSchemaErrorDetection.cpp
     Memory/LeakDetection.cpp
@@ -2531,6 +2531,12 @@ namespace AZ::IO
                 info.m_uncompressedSize = entry->desc.lSizeUncompressed;
                 info.m_isCompressed = entry->IsCompressed();
                 info.m_isSharedPak = true;
+                if (info.m_isCompressed && entry->IsSeekable())
+                {
+                    // Seekable entries allow the streamer to only read and decompress the frames needed for partial reads. The
+                    // seek table is stored at the end of the entry's data, so leave reading it to the first partial read.
+                    info.m_seekTableLoader = [archive, entry]() { return archive->GetSeekTable(entry); };
+                }
 
                 switch (GetPakPriority())
                 {
@@ -2576,6 +2582,45 @@ namespace AZ::IO
         return aznumeric_cast<uint64_t>(pFileEntry->nFileDataOffset);
     }
 
+    AZ::IO::MappedFileViewPtr Archive::MapFile(AZStd::string_view szName)
+    {
+        auto szFullPath = AZ::IO::FileIOBase::GetDirectInstance()->ResolvePath(szName);
+        if (!szFullPath)
+        {
+            AZ_Assert(false, "Unable to resolve path for filepath %.*s", aznumeric_cast<int>(szName.size()), szName.data());
+            return {};
+        }
+
+        CheckFileAccess(szFullPath->Native());
+
+        const ArchiveLocationPriority priority = GetPakPriority();
+        const bool useLooseFile = priority == ArchiveLocationPriority::ePakPriorityFileFirst &&
+            AZ::IO::SystemFile::Exists(szFullPath->c_str());
+        if (!useLooseFile)
+        {
+            uint32_t archiveFlags = 0;
+            ZipDir::CachePtr archive;
+            CCachedFileDataPtr pFileData = GetFileData(szFullPath->Native(), archiveFlags, &archive);
+            if (pFileData && archive)
+            {
+                ZipDir::FileEntry* entry = pFileData->GetFileEntry();
+                if (!entry || !entry->IsInitialized() || entry->IsCompressed())
+                {
+                    // Compressed data can't be used as-is, so the file needs to be read and decompressed instead.
+                    return {};
+                }
+                return AZ::IO::MappedFileView::Create(archive->GetFilePath(), pFileData->GetFileDataOffset(), entry->desc.lSizeUncompressed);
+            }
+        }
+
+        if (priority != ArchiveLocationPriority::ePakPriorityPakOnly)
+        {
+            // SystemFile::Length returns zero for missing files, which MappedFileView rejects as well.
+            return AZ::IO::MappedFileView::Create(szFullPath->c_str(), 0, AZ::IO::SystemFile::Length(szFullPath->c_str()));
+        }
+        return {};
+    }
+
     EStreamSourceMediaType Archive::GetFileMediaType(AZStd::string_view szName) const 
     {
         auto szFullPath = AZ::IO::FileIOBase::GetDirectInstance()->ResolvePath(szName);
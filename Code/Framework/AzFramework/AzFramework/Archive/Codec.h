@@ -19,10 +19,11 @@ namespace CompressionCodec
         ZLIB = 0,
         ZSTD,
         LZ4,
+        ZSTD_SEEKABLE, // zstd compressed in independent frames with a seek table so ranges can be decompressed separately.
         NUM_CODECS
     };
 
-    inline constexpr Codec s_AllCodecs[] = { Codec::ZLIB, Codec::ZSTD, Codec::LZ4 };
+    inline constexpr Codec s_AllCodecs[] = { Codec::ZLIB, Codec::ZSTD, Codec::LZ4, Codec::ZSTD_SEEKABLE };
 
     inline bool CheckMagic(const void* pCompressedData, const uint32_t magicNumber, const uint32_t magicSkippable)
     {
@@ -11,6 +11,7 @@
 
 #include <AzCore/EBus/Event.h>
 #include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/MappedFileView.h>
 #include <AzCore/std/containers/map.h>
 #include <AzCore/std/smart_ptr/intrusive_base.h>
 #include <AzCore/std/smart_ptr/intrusive_ptr.h>
@@ -417,6 +418,14 @@ namespace AZ::IO
         // Return offset in archive file (ideally has to return offset on DVD) for streaming requests sorting
         virtual uint64_t GetFileOffsetOnMedia(AZStd::string_view szName) const = 0;
 
+        // Summary:
+        // Maps the entire file into memory as a read-only view. This avoids copying the file's content into a buffer. Files inside
+        // archives can only be mapped if they're stored uncompressed.
+        // Returns:
+        // The view on the file's content or null if the file couldn't be found or isn't mappable, in which case the file needs
+        // to be read instead.
+        virtual AZ::IO::MappedFileViewPtr MapFile(AZStd::string_view szName) = 0;
+
         // Summary:
         // Return media type for the file
         virtual EStreamSourceMediaType GetFileMediaType(AZStd::string_view szName) const = 0;
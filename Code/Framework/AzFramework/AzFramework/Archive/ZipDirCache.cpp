@@ -10,6 +10,7 @@
 #include <AzCore/Console/Console.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/string/conversions.h>
 
 #include <AzFramework/Archive/ZipFileFormat.h>
@@ -182,6 +183,7 @@ namespace AZ::IO::ZipDir
             }
         }
         m_allocator = nullptr;
+        ClearSeekTables();
         m_treeDir.Clear();
     }
 
@@ -248,6 +250,8 @@ namespace AZ::IO::ZipDir
             return ZSTD_compressBound(uncompressedSize);
         case CompressionCodec::Codec::LZ4:
             return LZ4F_compressFrameBound(uncompressedSize, nullptr);
+        case CompressionCodec::Codec::ZSTD_SEEKABLE:
+            return ZipRawCompressZSTDSeekableBound(uncompressedSize);
         default:
             AZ_Assert(false, "Unknown codec passed in for size estimate");
             break;
@@ -292,6 +296,10 @@ namespace AZ::IO::ZipDir
             case CompressionCodec::Codec::LZ4:
                 nError = ZipRawCompressLZ4(pUncompressed, &nSizeCompressed, pCompressed, nSize, nCompressionLevel);
                 break;
+
+            case CompressionCodec::Codec::ZSTD_SEEKABLE:
+                nError = ZipRawCompressZSTDSeekable(pUncompressed, &nSizeCompressed, pCompressed, nSize, nCompressionLevel);
+                break;
             }
             if (Z_OK != nError)
             {
@@ -317,7 +325,13 @@ namespace AZ::IO::ZipDir
             return ZD_ERROR_INVALID_PATH;
         }
 
+        ClearSeekTables();
         pFileEntry->OnNewFileData(pUncompressed, nSize, aznumeric_cast<uint32_t>(nSizeCompressed), nCompressionMethod, false);
+        // mark seekable data in the CDR so readers only look for a seek table in entries that have one
+        if (nCompressionMethod == ZipFile::METHOD_DEFLATE && codec == CompressionCodec::Codec::ZSTD_SEEKABLE)
+        {
+            pFileEntry->nFlags |= ZipFile::GPF_SEEKABLE_FRAMES;
+        }
         // since we changed the time, we'll have to update CDR
         m_nFlags |= FLAGS_CDR_DIRTY;
 
@@ -491,6 +505,7 @@ namespace AZ::IO::ZipDir
     {
         const bool shouldOverwriteSeekOffset = nOverwriteSeekPos != (std::numeric_limits<uint64_t>::max)();
         AZ::IO::MemoryBlock memoryBlock;
+        ClearSeekTables();
 
         // create or find the file entry.. this object will rollback (delete the object
         // if the operation fails) if needed.
@@ -587,6 +602,8 @@ namespace AZ::IO::ZipDir
     // deletes the file from the archive
     ErrorEnum Cache::RemoveFile(AZStd::string_view szRelativePathSrc)
     {
+        ClearSeekTables();
+
         // Normalize and lower case the relative path
         AZ::IO::PathString szRelativePath{ szRelativePathSrc };
         AZ::StringFunc::Path::Normalize(szRelativePath);
@@ -635,6 +652,8 @@ namespace AZ::IO::ZipDir
     // deletes the directory, with all its descendants (files and subdirs)
     ErrorEnum Cache::RemoveDir(AZStd::string_view szRelativePathSrc)
     {
+        ClearSeekTables();
+
         // Normalize and lower case the relative path
         AZ::IO::PathString szRelativePath{ szRelativePathSrc };
         AZ::StringFunc::Path::Normalize(szRelativePath);
@@ -682,6 +701,7 @@ namespace AZ::IO::ZipDir
     // deletes all files and directories in this archive
     ErrorEnum Cache::RemoveAll()
     {
+        ClearSeekTables();
         ErrorEnum e = m_treeDir.RemoveAll();
         if (e == ZD_ERROR_SUCCESS)
         {
@@ -765,6 +785,77 @@ namespace AZ::IO::ZipDir
     }
 
 
+    AZStd::shared_ptr<const AZ::IO::CompressionSeekTable> Cache::GetSeekTable(FileEntry* pFileEntry)
+    {
+        // Only entries that were marked as seekable when the archive was built have a seek table. Files that fit in a single frame
+        // can't be partially decompressed, so there's no need to look for a seek table either.
+        if (!pFileEntry || !pFileEntry->IsSeekable() || pFileEntry->desc.lSizeUncompressed <= g_nZSTDSeekableFrameSize ||
+            pFileEntry->desc.lSizeCompressed <= g_nZSTDSeekTableFooterSize)
+        {
+            return {};
+        }
+
+        AZStd::scoped_lock lock(m_seekTableLock);
+        auto it = m_seekTables.find(pFileEntry);
+        if (it != m_seekTables.end())
+        {
+            return it->second;
+        }
+
+        AZStd::shared_ptr<const AZ::IO::CompressionSeekTable> seekTable = ReadSeekTable(pFileEntry);
+        m_seekTables.emplace(pFileEntry, seekTable);
+        return seekTable;
+    }
+
+    AZStd::shared_ptr<const AZ::IO::CompressionSeekTable> Cache::ReadSeekTable(FileEntry* pFileEntry)
+    {
+        // The file handle is shared, so prevent reads of the same file from moving the file position.
+        AZStd::scoped_lock lock(pFileEntry->m_readLock);
+        if (Refresh(pFileEntry) != ZD_ERROR_SUCCESS)
+        {
+            return {};
+        }
+
+        AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetDirectInstance();
+        const size_t nCompressedSize = pFileEntry->desc.lSizeCompressed;
+        const uint64_t nDataEnd = uint64_t{ pFileEntry->nFileDataOffset } + nCompressedSize;
+
+        uint8_t footer[g_nZSTDSeekTableFooterSize];
+        if (!fileIO->Seek(m_fileHandle, nDataEnd - g_nZSTDSeekTableFooterSize, AZ::IO::SeekType::SeekFromStart) ||
+            !fileIO->Read(m_fileHandle, footer, sizeof(footer), true))
+        {
+            return {};
+        }
+
+        size_t nSeekTableSize = ZipRawGetZSTDSeekTableSize(footer, nCompressedSize);
+        if (nSeekTableSize == 0)
+        {
+            return {};
+        }
+
+        AZStd::vector<uint8_t> seekTableData(nSeekTableSize);
+        if (!fileIO->Seek(m_fileHandle, nDataEnd - nSeekTableSize, AZ::IO::SeekType::SeekFromStart) ||
+            !fileIO->Read(m_fileHandle, seekTableData.data(), nSeekTableSize, true))
+        {
+            return {};
+        }
+
+        auto seekTable = AZStd::make_shared<AZ::IO::CompressionSeekTable>();
+        if (!ZipRawReadZSTDSeekTable(seekTableData.data(), nSeekTableSize, nCompressedSize, pFileEntry->desc.lSizeUncompressed, *seekTable))
+        {
+            AZ_Warning("Archive", false, "File in archive '%s' has a corrupted zstd seek table and will be fully decompressed on every read.",
+                GetFilePath());
+            return {};
+        }
+        return seekTable;
+    }
+
+    void Cache::ClearSeekTables()
+    {
+        AZStd::scoped_lock lock(m_seekTableLock);
+        m_seekTables.clear();
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // finds the file by exact path
     FileEntry* Cache::FindFile(AZStd::string_view szPathSrc, [[maybe_unused]] bool bFullInfo)
@@ -15,9 +15,13 @@
 //
 #pragma once
 
+#include <AzCore/IO/CompressionBus.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/smart_ptr/intrusive_base.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzFramework/Archive/Codec.h>
 #include <AzFramework/Archive/ZipDirStructures.h>
 #include <AzFramework/Archive/ZipDirTree.h>
@@ -81,6 +85,11 @@ namespace AZ::IO::ZipDir
 
         ErrorEnum ReadFile(FileEntry* pFileEntry, void* pCompressed, void* pUncompressed);
 
+        // returns the seek table for files that were compressed with the seekable zstd codec, or null if the file can only be
+        // decompressed as a whole. The table is read from the archive the first time it's requested and cached afterwards, so
+        // this should only be called once a partial read needs it.
+        AZStd::shared_ptr<const AZ::IO::CompressionSeekTable> GetSeekTable(FileEntry* pFileEntry);
+
         void Free(void* ptr)
         {
             m_allocator->DeAllocate(ptr);
@@ -129,6 +138,10 @@ namespace AZ::IO::ZipDir
 
         size_t GetCompressedSizeEstimate(size_t uncompressedSize, CompressionCodec::Codec codec);
 
+        AZStd::shared_ptr<const AZ::IO::CompressionSeekTable> ReadSeekTable(FileEntry* pFileEntry);
+        // seek tables are cached by file entry, so they need to be cleared when entries are changed or removed
+        void ClearSeekTables();
+
     protected:
         friend class CacheFactory;
         friend class FileEntryTransactionAdd;
@@ -161,6 +174,10 @@ namespace AZ::IO::ZipDir
         // CDR buffer.
         AZStd::vector<uint8_t> m_CDR_buffer;
 
+        // Seek tables of the files that have been looked up so far. Files without a seek table are stored with a null table.
+        AZStd::unordered_map<const FileEntry*, AZStd::shared_ptr<const AZ::IO::CompressionSeekTable>> m_seekTables;
+        AZStd::mutex m_seekTableLock;
+
         ZipFile::EHeaderEncryptionType m_encryptedHeaders;
         ZipFile::EHeaderSignatureType m_signedHeaders;
 
@@ -113,7 +113,7 @@ namespace AZ::IO::ZipDir
             h.lSignature = h.SIGNATURE;
             h.nVersionMadeBy = 20;
             h.nVersionNeeded = 20;
-            h.nFlags = 0;
+            h.nFlags = it->pFileEntryBase->nFlags & ZipFile::GPF_SEEKABLE_FRAMES;
             h.nMethod = it->pFileEntryBase->nMethod;
             h.nLastModTime = it->pFileEntryBase->nLastModTime;
             h.nLastModDate = it->pFileEntryBase->nLastModDate;
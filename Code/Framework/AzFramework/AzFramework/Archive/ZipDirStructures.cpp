@@ -316,6 +316,29 @@ namespace AZ::IO::ZipDir::ZipDirStructuresInternal
 
         return memoryBlock;
     }
+
+    // Values in the zstd seek table are always stored in little endian, independent of the platform.
+    static void WriteLittleEndian32(uint8_t* pDest, uint32_t value)
+    {
+        pDest[0] = static_cast<uint8_t>(value);
+        pDest[1] = static_cast<uint8_t>(value >> 8);
+        pDest[2] = static_cast<uint8_t>(value >> 16);
+        pDest[3] = static_cast<uint8_t>(value >> 24);
+    }
+
+    static uint32_t ReadLittleEndian32(const uint8_t* pSrc)
+    {
+        return static_cast<uint32_t>(pSrc[0]) | (static_cast<uint32_t>(pSrc[1]) << 8) |
+            (static_cast<uint32_t>(pSrc[2]) << 16) | (static_cast<uint32_t>(pSrc[3]) << 24);
+    }
+
+    constexpr uint32_t ZStdSeekTableSkippableMagic = 0x184D2A5E;
+    constexpr uint32_t ZStdSeekableMagic = 0x8F92EAB1;
+    constexpr uint8_t ZStdSeekTableChecksumFlag = 0x80;
+    constexpr uint8_t ZStdSeekTableReservedBits = 0x7C;
+    constexpr size_t ZStdSkippableHeaderSize = 8;
+    constexpr size_t ZStdSeekTableEntrySize = 8;
+    constexpr size_t ZStdSeekTableEntryWithChecksumSize = 12;
 }
 
 namespace AZ::IO::ZipDir
@@ -499,6 +522,7 @@ namespace AZ::IO::ZipDir
         this->nFileHeaderOffset = header.lLocalHeaderOffset;
         //this->nFileDataOffset   = INVALID_DATA_OFFSET; // we don't know yet
         this->nMethod = header.nMethod;
+        this->nFlags = header.nFlags & ZipFile::GPF_SEEKABLE_FRAMES;
         this->nNameOffset = 0; // we don't know yet
         this->nLastModTime = header.nLastModTime;
         this->nLastModDate = header.nLastModDate;
@@ -649,6 +673,129 @@ namespace AZ::IO::ZipDir
         return returnCode;
     }
 
+    size_t ZipRawCompressZSTDSeekableBound(size_t nSrcSize)
+    {
+        using namespace ZipDirStructuresInternal;
+        size_t numFrames = AZStd::max<size_t>((nSrcSize + g_nZSTDSeekableFrameSize - 1) / g_nZSTDSeekableFrameSize, 1);
+        return numFrames * (ZSTD_compressBound(g_nZSTDSeekableFrameSize) + ZStdSeekTableEntrySize) +
+            ZStdSkippableHeaderSize + g_nZSTDSeekTableFooterSize;
+    }
+
+    int ZipRawCompressZSTDSeekable(const void* pUncompressed, size_t* pDestSize, void* pCompressed, size_t nSrcSize, [[maybe_unused]] int nLevel)
+    {
+        using namespace ZipDirStructuresInternal;
+
+        const uint8_t* pSrc = static_cast<const uint8_t*>(pUncompressed);
+        uint8_t* pDest = static_cast<uint8_t*>(pCompressed);
+        const size_t nDestCapacity = *pDestSize;
+        size_t nDestOffset = 0;
+
+        // The compressed and uncompressed sizes of every frame are stored in the order the frames are written.
+        AZStd::vector<uint32_t> frameSizes;
+        frameSizes.reserve(((nSrcSize + g_nZSTDSeekableFrameSize - 1) / g_nZSTDSeekableFrameSize) * 2);
+
+        ZSTD_CCtx* context = ZSTD_createCCtx();
+        if (!context)
+        {
+            return Z_MEM_ERROR;
+        }
+
+        int err = Z_OK;
+        for (size_t nSrcOffset = 0; nSrcOffset < nSrcSize; nSrcOffset += g_nZSTDSeekableFrameSize)
+        {
+            size_t nFrameSize = AZStd::min(g_nZSTDSeekableFrameSize, nSrcSize - nSrcOffset);
+            size_t result = ZSTD_compressCCtx(context, pDest + nDestOffset, nDestCapacity - nDestOffset, pSrc + nSrcOffset, nFrameSize, 1);
+            if (ZSTD_isError(result))
+            {
+                AZ_Error("ZipDirStructures", false, "Error compressing using seekable zstd: %s", ZSTD_getErrorName(result));
+                err = Z_BUF_ERROR;
+                break;
+            }
+            frameSizes.push_back(aznumeric_cast<uint32_t>(result));
+            frameSizes.push_back(aznumeric_cast<uint32_t>(nFrameSize));
+            nDestOffset += result;
+        }
+        ZSTD_freeCCtx(context);
+        if (err != Z_OK)
+        {
+            return err;
+        }
+
+        const uint32_t numFrames = aznumeric_cast<uint32_t>(frameSizes.size() / 2);
+        const size_t nTableContentSize = numFrames * ZStdSeekTableEntrySize + g_nZSTDSeekTableFooterSize;
+        if (nDestCapacity - nDestOffset < ZStdSkippableHeaderSize + nTableContentSize)
+        {
+            AZ_Error("ZipDirStructures", false, "Not enough space to store the seek table for seekable zstd data.");
+            return Z_BUF_ERROR;
+        }
+
+        WriteLittleEndian32(pDest + nDestOffset, ZStdSeekTableSkippableMagic);
+        WriteLittleEndian32(pDest + nDestOffset + 4, aznumeric_cast<uint32_t>(nTableContentSize));
+        nDestOffset += ZStdSkippableHeaderSize;
+        for (uint32_t frameSize : frameSizes)
+        {
+            WriteLittleEndian32(pDest + nDestOffset, frameSize);
+            nDestOffset += 4;
+        }
+        WriteLittleEndian32(pDest + nDestOffset, numFrames);
+        pDest[nDestOffset + 4] = 0; // Seek table descriptor, no checksums are stored.
+        WriteLittleEndian32(pDest + nDestOffset + 5, ZStdSeekableMagic);
+        nDestOffset += g_nZSTDSeekTableFooterSize;
+
+        *pDestSize = nDestOffset;
+        return Z_OK;
+    }
+
+    size_t ZipRawGetZSTDSeekTableSize(const void* pFooter, size_t nCompressedSize)
+    {
+        using namespace ZipDirStructuresInternal;
+
+        const uint8_t* pFooterBytes = static_cast<const uint8_t*>(pFooter);
+        const uint32_t numFrames = ReadLittleEndian32(pFooterBytes);
+        const uint8_t descriptor = pFooterBytes[4];
+        if (ReadLittleEndian32(pFooterBytes + 5) != ZStdSeekableMagic || (descriptor & ZStdSeekTableReservedBits) != 0 || numFrames == 0)
+        {
+            return 0;
+        }
+
+        const size_t nEntrySize = (descriptor & ZStdSeekTableChecksumFlag) ? ZStdSeekTableEntryWithChecksumSize : ZStdSeekTableEntrySize;
+        const size_t nSeekTableSize = ZStdSkippableHeaderSize + numFrames * nEntrySize + g_nZSTDSeekTableFooterSize;
+        return nSeekTableSize <= nCompressedSize ? nSeekTableSize : 0;
+    }
+
+    bool ZipRawReadZSTDSeekTable(const void* pSeekTable, size_t nSeekTableSize, size_t nCompressedSize, size_t nUncompressedSize,
+        AZ::IO::CompressionSeekTable& seekTable)
+    {
+        using namespace ZipDirStructuresInternal;
+
+        const uint8_t* pTableBytes = static_cast<const uint8_t*>(pSeekTable);
+        if (nSeekTableSize < ZStdSkippableHeaderSize + g_nZSTDSeekTableFooterSize ||
+            ReadLittleEndian32(pTableBytes) != ZStdSeekTableSkippableMagic ||
+            ReadLittleEndian32(pTableBytes + 4) != nSeekTableSize - ZStdSkippableHeaderSize ||
+            ZipRawGetZSTDSeekTableSize(pTableBytes + nSeekTableSize - g_nZSTDSeekTableFooterSize, nCompressedSize) != nSeekTableSize)
+        {
+            return false;
+        }
+
+        const uint32_t numFrames = ReadLittleEndian32(pTableBytes + nSeekTableSize - g_nZSTDSeekTableFooterSize);
+        const size_t nEntrySize = (nSeekTableSize - ZStdSkippableHeaderSize - g_nZSTDSeekTableFooterSize) / numFrames;
+
+        seekTable.clear();
+        seekTable.reserve(numFrames + 1);
+        AZ::IO::CompressionSeekPoint point;
+        seekTable.push_back(point);
+        const uint8_t* pEntry = pTableBytes + ZStdSkippableHeaderSize;
+        for (uint32_t i = 0; i < numFrames; ++i, pEntry += nEntrySize)
+        {
+            point.m_compressedOffset += ReadLittleEndian32(pEntry);
+            point.m_uncompressedOffset += ReadLittleEndian32(pEntry + 4);
+            seekTable.push_back(point);
+        }
+
+        // The frames have to exactly cover the data in front of the seek table, otherwise the table doesn't belong to this data.
+        return point.m_compressedOffset == nCompressedSize - nSeekTableSize && point.m_uncompressedOffset == nUncompressedSize;
+    }
+
 
     // finds the subdirectory entry by the name, using the names from the name pool
     // assumes: all directories are sorted in alphabetical order.
@@ -767,7 +914,8 @@ namespace AZ::IO::ZipDir
         header.desc.lSizeCompressed = pFileEntry->desc.lSizeCompressed;
         header.desc.lSizeUncompressed = pFileEntry->desc.lSizeUncompressed;
         header.nMethod = pFileEntry->nMethod;
-        header.nFlags &= ~ZipFile::GPF_ENCRYPTED; // we don't support encrypted files
+        header.nFlags &= ~(ZipFile::GPF_ENCRYPTED | ZipFile::GPF_SEEKABLE_FRAMES); // we don't support encrypted files
+        header.nFlags |= pFileEntry->nFlags & ZipFile::GPF_SEEKABLE_FRAMES;
 
         if (!AZ::IO::FileIOBase::GetDirectInstance()->Seek(fileHandle, pFileEntry->nFileHeaderOffset, AZ::IO::SeekType::SeekFromStart))
         {
@@ -802,7 +950,7 @@ namespace AZ::IO::ZipDir
         ZipFile::LocalFileHeader header;
         header.lSignature = ZipFile::LocalFileHeader::SIGNATURE;
         header.nVersionNeeded = 10;
-        header.nFlags = 0;
+        header.nFlags = pFileEntry->nFlags & ZipFile::GPF_SEEKABLE_FRAMES;
         header.nMethod = pFileEntry->nMethod;
         header.nLastModDate = pFileEntry->nLastModDate;
         header.nLastModTime = pFileEntry->nLastModTime;
@@ -873,6 +1021,8 @@ namespace AZ::IO::ZipDir
         this->desc.lCRC32 = AZ::Crc32(pUncompressed, nSize);
 
         this->nMethod = nCompressionMethod;
+        // the new data isn't seekable unless the caller marks it as such
+        this->nFlags = 0;
     }
 
     uint64_t FileEntry::GetModificationTime()
@@ -13,6 +13,7 @@
 #pragma once
 
 #include <AzCore/base.h>
+#include <AzCore/IO/CompressionBus.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/SystemFile.h>
 #include <AzCore/std/smart_ptr/intrusive_ptr.h>
@@ -146,6 +147,25 @@ namespace AZ::IO::ZipDir
     int ZipRawCompressZSTD(const void* pUncompressed, size_t* pDestSize, void* pCompressed, size_t nSrcSize, int nLevel);
     int ZipRawCompressLZ4(const void* pUncompressed, size_t* pDestSize, void* pCompressed, size_t nSrcSize, int nLevel);
 
+    // Seekable zstd data is split into frames that are compressed independently, followed by a skippable frame with a table that
+    // stores the compressed and uncompressed size of every frame, using the layout of zstd's seekable format. Regular zstd
+    // decompression skips the table, but with it a range of the file can be decompressed without the frames that come before it.
+    inline constexpr size_t g_nZSTDSeekableFrameSize = 256 * 1024;
+    inline constexpr size_t g_nZSTDSeekTableFooterSize = 9;
+
+    // returns the size the buffer for seekable zstd data needs to be to be able to hold nSrcSize bytes after compression
+    size_t ZipRawCompressZSTDSeekableBound(size_t nSrcSize);
+    int ZipRawCompressZSTDSeekable(const void* pUncompressed, size_t* pDestSize, void* pCompressed, size_t nSrcSize, int nLevel);
+
+    // checks the footer, which are the last g_nZSTDSeekTableFooterSize bytes of the compressed data, and returns the size of the
+    // skippable frame at the end of the data that holds the seek table or 0 if the data isn't seekable zstd data
+    size_t ZipRawGetZSTDSeekTableSize(const void* pFooter, size_t nCompressedSize);
+
+    // converts the skippable frame with the seek table to seek points. Returns false if the table is corrupted or doesn't match the
+    // sizes of the compressed and uncompressed data
+    bool ZipRawReadZSTDSeekTable(const void* pSeekTable, size_t nSeekTableSize, size_t nCompressedSize, size_t nUncompressedSize,
+        AZ::IO::CompressionSeekTable& seekTable);
+
     // fseek wrapper with memory in file support.
     int64_t FSeek(CZipFile* zipFile, int64_t origin, int command);
 
@@ -178,7 +198,7 @@ namespace AZ::IO::ZipDir
         uint32_t nNameOffset{};       // offset of the file name in the name pool for the directory
 
         uint16_t nMethod{};             // the method of compression (0 if no compression/store)
-        uint16_t nReserved0{};          // Reserved
+        uint16_t nFlags{};              // the general purpose bit flags that are kept in the CDR, see ZipFile::GPF_SEEKABLE_FRAMES
 
         // the file modification times
         uint16_t nLastModTime{};
@@ -227,6 +247,12 @@ namespace AZ::IO::ZipDir
                 nMethod != ZipFile::METHOD_STORE
                 );
         }
+
+        // whether the file was compressed in independent frames with a seek table when the archive was built
+        bool IsSeekable() const
+        {
+            return IsCompressed() && (nFlags & ZipFile::GPF_SEEKABLE_FRAMES) != 0;
+        }
     };
 
 
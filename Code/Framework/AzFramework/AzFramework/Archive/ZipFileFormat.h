@@ -23,6 +23,7 @@ namespace AZ::IO::ZipFile
         GPF_DATA_DESCRIPTOR = 1 << 3, // if set, the CRC32 and sizes aren't set in the file header, but only in the data descriptor following compressed data
         GPF_RESERVED_8_ENHANCED_DEFLATING = 1 << 4, // Reserved for use with method 8, for enhanced deflating.
         GPF_COMPRESSED_PATCHED = 1 << 5, // the file is compressed patched data
+        GPF_SEEKABLE_FRAMES = 1 << 14, // the file is compressed in independent frames followed by a seek table (CompressionCodec::Codec::ZSTD_SEEKABLE)
     };
 
     enum
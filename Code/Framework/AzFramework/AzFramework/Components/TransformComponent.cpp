@@ -7,6 +7,7 @@
  */
 
 #include <AzFramework/Components/TransformComponent.h>
+#include <AzFramework/Components/TransformHierarchyBus.h>
 #include <AzFramework/Visibility/EntityBoundsUnionBus.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/RTTI/BehaviorContext.h>
@@ -115,6 +116,7 @@ namespace AzFramework
         , m_onNewParentKeepWorldTM(copy.m_onNewParentKeepWorldTM)
         , m_parentActivationTransformMode(copy.m_parentActivationTransformMode)
         , m_isStatic(copy.m_isStatic)
+        , m_useTransformHierarchy(copy.m_useTransformHierarchy)
     {
         ;
     }
@@ -128,6 +130,7 @@ namespace AzFramework
             m_parentId = config->m_parentId;
             m_parentActivationTransformMode = config->m_parentActivationTransformMode;
             m_isStatic = config->m_isStatic;
+            m_useTransformHierarchy = config->m_useTransformHierarchy;
             return true;
         }
         return false;
@@ -142,6 +145,7 @@ namespace AzFramework
             config->m_parentId = m_parentId;
             config->m_parentActivationTransformMode = m_parentActivationTransformMode;
             config->m_isStatic = m_isStatic;
+            config->m_useTransformHierarchy = m_useTransformHierarchy;
             return true;
         }
         return false;
@@ -153,6 +157,11 @@ namespace AzFramework
         AZ::TransformNotificationBus::Bind(m_notificationBus, m_entity->GetId());
 
         const bool keepWorldTm = (m_parentActivationTransformMode == ParentActivationTransformMode::MaintainCurrentWorldTransform || !m_parentId.IsValid());
+        if (m_useTransformHierarchy)
+        {
+            // Added as a root, the parent is linked once it's active
+            ConnectToTransformHierarchy(keepWorldTm ? m_worldTM : m_localTM);
+        }
         SetParentImpl(m_parentId, keepWorldTm);
     }
 
@@ -173,6 +182,35 @@ namespace AzFramework
             AZ::EntityBus::Handler::BusDisconnect();
         }
         AZ::TransformBus::Handler::BusDisconnect();
+
+        if (m_transformHierarchy)
+        {
+            DisconnectFromTransformHierarchy();
+        }
+    }
+
+    const AZ::Transform& TransformComponent::GetLocalTM()
+    {
+        if (m_transformHierarchy)
+        {
+            m_localTM = m_transformHierarchy->GetLocalTM(GetEntityId());
+        }
+        return m_localTM;
+    }
+
+    const AZ::Transform& TransformComponent::GetWorldTM()
+    {
+        if (m_transformHierarchy)
+        {
+            m_worldTM = m_transformHierarchy->GetWorldTM(GetEntityId());
+        }
+        return m_worldTM;
+    }
+
+    void TransformComponent::GetLocalAndWorld(AZ::Transform& localTM, AZ::Transform& worldTM)
+    {
+        localTM = GetLocalTM();
+        worldTM = GetWorldTM();
     }
 
     void TransformComponent::BindTransformChangedEventHandler(AZ::TransformChangedEvent::Handler& handler)
@@ -223,49 +261,49 @@ namespace AzFramework
 
     void TransformComponent::SetWorldTranslation(const AZ::Vector3& newPosition)
     {
-        AZ::Transform newWorldTransform = m_worldTM;
+        AZ::Transform newWorldTransform = GetWorldTM();
         newWorldTransform.SetTranslation(newPosition);
         SetWorldTM(newWorldTransform);
     }
 
     void TransformComponent::SetLocalTranslation(const AZ::Vector3& newPosition)
     {
-        AZ::Transform newLocalTransform = m_localTM;
+        AZ::Transform newLocalTransform = GetLocalTM();
         newLocalTransform.SetTranslation(newPosition);
         SetLocalTM(newLocalTransform);
     }
 
     AZ::Vector3 TransformComponent::GetWorldTranslation()
     {
-        return m_worldTM.GetTranslation();
+        return GetWorldTM().GetTranslation();
     }
 
     AZ::Vector3 TransformComponent::GetLocalTranslation()
     {
-        return m_localTM.GetTranslation();
+        return GetLocalTM().GetTranslation();
     }
 
     void TransformComponent::MoveEntity(const AZ::Vector3& offset)
     {
-        const AZ::Vector3& worldPosition = m_worldTM.GetTranslation();
+        const AZ::Vector3& worldPosition = GetWorldTM().GetTranslation();
         SetWorldTranslation(worldPosition + offset);
     }
 
     void TransformComponent::SetWorldX(float x)
     {
-        const AZ::Vector3& worldPosition = m_worldTM.GetTranslation();
+        const AZ::Vector3& worldPosition = GetWorldTM().GetTranslation();
         SetWorldTranslation(AZ::Vector3(x, worldPosition.GetY(), worldPosition.GetZ()));
     }
 
     void TransformComponent::SetWorldY(float y)
     {
-        const AZ::Vector3& worldPosition = m_worldTM.GetTranslation();
+        const AZ::Vector3& worldPosition = GetWorldTM().GetTranslation();
         SetWorldTranslation(AZ::Vector3(worldPosition.GetX(), y, worldPosition.GetZ()));
     }
 
     void TransformComponent::SetWorldZ(float z)
     {
-        const AZ::Vector3& worldPosition = m_worldTM.GetTranslation();
+        const AZ::Vector3& worldPosition = GetWorldTM().GetTranslation();
         SetWorldTranslation(AZ::Vector3(worldPosition.GetX(), worldPosition.GetY(), z));
     }
 
@@ -286,70 +324,70 @@ namespace AzFramework
 
     void TransformComponent::SetLocalX(float x)
     {
-        AZ::Vector3 newLocalTranslation = m_localTM.GetTranslation();
+        AZ::Vector3 newLocalTranslation = GetLocalTM().GetTranslation();
         newLocalTranslation.SetX(x);
         SetLocalTranslation(newLocalTranslation);
     }
 
     void TransformComponent::SetLocalY(float y)
     {
-        AZ::Vector3 newLocalTranslation = m_localTM.GetTranslation();
+        AZ::Vector3 newLocalTranslation = GetLocalTM().GetTranslation();
         newLocalTranslation.SetY(y);
         SetLocalTranslation(newLocalTranslation);
     }
 
     void TransformComponent::SetLocalZ(float z)
     {
-        AZ::Vector3 newLocalTranslation = m_localTM.GetTranslation();
+        AZ::Vector3 newLocalTranslation = GetLocalTM().GetTranslation();
         newLocalTranslation.SetZ(z);
         SetLocalTranslation(newLocalTranslation);
     }
 
     float TransformComponent::GetLocalX()
     {
-        float localX = m_localTM.GetTranslation().GetX();
+        float localX = GetLocalTM().GetTranslation().GetX();
         return localX;
     }
 
     float TransformComponent::GetLocalY()
     {
-        float localY = m_localTM.GetTranslation().GetY();
+        float localY = GetLocalTM().GetTranslation().GetY();
         return localY;
     }
 
     float TransformComponent::GetLocalZ()
     {
-        float localZ = m_localTM.GetTranslation().GetZ();
+        float localZ = GetLocalTM().GetTranslation().GetZ();
         return localZ;
     }
 
     void TransformComponent::SetWorldRotationQuaternion(const AZ::Quaternion& quaternion)
     {
-        AZ::Transform newWorldTransform = m_worldTM;
+        AZ::Transform newWorldTransform = GetWorldTM();
         newWorldTransform.SetRotation(quaternion);
         SetWorldTM(newWorldTransform);
     }
 
     AZ::Vector3 TransformComponent::GetWorldRotation()
     {
-        return m_worldTM.GetRotation().GetEulerRadians();
+        return GetWorldTM().GetRotation().GetEulerRadians();
     }
 
     AZ::Quaternion TransformComponent::GetWorldRotationQuaternion()
     {
-        return m_worldTM.GetRotation();
+        return GetWorldTM().GetRotation();
     }
 
     void TransformComponent::SetLocalRotation(const AZ::Vector3& eulerRadianAngles)
     {
-        AZ::Transform newLocalTM = m_localTM;
+        AZ::Transform newLocalTM = GetLocalTM();
         newLocalTM.SetRotation(AZ::Quaternion::CreateFromEulerAnglesRadians(eulerRadianAngles));
         SetLocalTM(newLocalTM);
     }
 
     void TransformComponent::SetLocalRotationQuaternion(const AZ::Quaternion& quaternion)
     {
-        AZ::Transform newLocalTM = m_localTM;
+        AZ::Transform newLocalTM = GetLocalTM();
         newLocalTM.SetRotation(quaternion);
         SetLocalTM(newLocalTM);
     }
@@ -367,62 +405,62 @@ namespace AzFramework
 
     void TransformComponent::RotateAroundLocalX(float eulerAngleRadian)
     {
-        AZ::Vector3 xAxis = m_localTM.GetBasisX();
+        AZ::Vector3 xAxis = GetLocalTM().GetBasisX();
         
-        AZ::Transform newLocalTM = RotateAroundLocalHelper(eulerAngleRadian, m_localTM, xAxis);
+        AZ::Transform newLocalTM = RotateAroundLocalHelper(eulerAngleRadian, GetLocalTM(), xAxis);
         
         SetLocalTM(newLocalTM);
     }
 
     void TransformComponent::RotateAroundLocalY(float eulerAngleRadian)
     {
-        AZ::Vector3 yAxis = m_localTM.GetBasisY();
+        AZ::Vector3 yAxis = GetLocalTM().GetBasisY();
         
-        AZ::Transform newLocalTM = RotateAroundLocalHelper(eulerAngleRadian, m_localTM, yAxis);
+        AZ::Transform newLocalTM = RotateAroundLocalHelper(eulerAngleRadian, GetLocalTM(), yAxis);
 
         SetLocalTM(newLocalTM);
     }
 
     void TransformComponent::RotateAroundLocalZ(float eulerAngleRadian)
     {
-        AZ::Vector3 zAxis = m_localTM.GetBasisZ();
+        AZ::Vector3 zAxis = GetLocalTM().GetBasisZ();
         
-        AZ::Transform newLocalTM = RotateAroundLocalHelper(eulerAngleRadian, m_localTM, zAxis);
+        AZ::Transform newLocalTM = RotateAroundLocalHelper(eulerAngleRadian, GetLocalTM(), zAxis);
 
         SetLocalTM(newLocalTM);
     }
 
     AZ::Vector3 TransformComponent::GetLocalRotation()
     {
-        return m_localTM.GetRotation().GetEulerRadians();
+        return GetLocalTM().GetRotation().GetEulerRadians();
     }
 
     AZ::Quaternion TransformComponent::GetLocalRotationQuaternion()
     {
-        return m_localTM.GetRotation();
+        return GetLocalTM().GetRotation();
     }
 
     AZ::Vector3 TransformComponent::GetLocalScale()
     {
         AZ_WarningOnce("TransformComponent", false, "GetLocalScale is deprecated, please use GetLocalUniformScale instead");
-        return AZ::Vector3(m_localTM.GetUniformScale());
+        return AZ::Vector3(GetLocalTM().GetUniformScale());
     }
 
     void TransformComponent::SetLocalUniformScale(float scale)
     {
-        AZ::Transform newLocalTM = m_localTM;
+        AZ::Transform newLocalTM = GetLocalTM();
         newLocalTM.SetUniformScale(scale);
         SetLocalTM(newLocalTM);
     }
 
     float TransformComponent::GetLocalUniformScale()
     {
-        return m_localTM.GetUniformScale();
+        return GetLocalTM().GetUniformScale();
     }
 
     float TransformComponent::GetWorldUniformScale()
     {
-        return m_worldTM.GetUniformScale();
+        return GetWorldTM().GetUniformScale();
     }
 
     AZStd::vector<AZ::EntityId> TransformComponent::GetChildren()
@@ -506,6 +544,19 @@ namespace AzFramework
                 "Entity '%s' %s has static transform, but parent has non-static transform. This may lead to unexpected movement.",
                 GetEntity()->GetName().c_str(), GetEntityId().ToString().c_str());
 
+            if (m_transformHierarchy)
+            {
+                if (m_transformHierarchy->SetParent(GetEntityId(), parentEntityId, m_onNewParentKeepWorldTM))
+                {
+                    return;
+                }
+
+                AZ_Warning("TransformComponent", false,
+                    "Entity '%s' %s uses the transform hierarchy but its parent doesn't, it falls back to storing its own transforms.",
+                    GetEntity()->GetName().c_str(), GetEntityId().ToString().c_str());
+                DisconnectFromTransformHierarchy();
+            }
+
             if (m_onNewParentKeepWorldTM)
             {
                 ComputeLocalTM();
@@ -522,6 +573,11 @@ namespace AzFramework
         AZ_Assert(parentEntityId == m_parentId, "We expect to receive notifications only from the current parent!");
         m_parentTM = nullptr;
         m_parentActive = false;
+        if (m_transformHierarchy)
+        {
+            m_transformHierarchy->SetParent(GetEntityId(), AZ::EntityId(), true);
+            return;
+        }
         ComputeLocalTM();
     }
 
@@ -540,6 +596,12 @@ namespace AzFramework
             AZ::TransformHierarchyInformationBus::Handler::BusDisconnect();
             AZ::EntityBus::Handler::BusDisconnect();
             m_parentActive = false;
+
+            if (m_transformHierarchy)
+            {
+                // The new parent is linked in the hierarchy once it's active
+                m_transformHierarchy->SetParent(GetEntityId(), AZ::EntityId(), isKeepWorldTM);
+            }
         }
 
         m_parentId = parentId;
@@ -561,14 +623,15 @@ namespace AzFramework
 
             if (isKeepWorldTM)
             {
-                SetWorldTM(m_worldTM);
+                SetWorldTM(GetWorldTM());
             }
             else
             {
-                SetLocalTM(m_localTM);
+                SetLocalTM(GetLocalTM());
             }
 
-            if (oldParent.IsValid())
+            // The hierarchy notifies once the change is processed
+            if (oldParent.IsValid() && !m_transformHierarchy)
             {
                 EBUS_EVENT_PTR(m_notificationBus, AZ::TransformNotificationBus, OnTransformChanged, m_localTM, m_worldTM);
                 m_transformChangedEvent.Signal(m_localTM, m_worldTM);
@@ -612,7 +675,8 @@ namespace AzFramework
     {
         // Called when our parent transform changes
         // Ignore the event until we've already derived our local transform.
-        if (m_parentTM)
+        // The transform hierarchy propagates the change to its children itself.
+        if (m_parentTM && !m_transformHierarchy)
         {
             m_worldTM = parentWorldTM * m_localTM;
             EBUS_EVENT_PTR(m_notificationBus, AZ::TransformNotificationBus, OnTransformChanged, m_localTM, m_worldTM);
@@ -622,6 +686,13 @@ namespace AzFramework
 
     void TransformComponent::ComputeLocalTM()
     {
+        if (m_transformHierarchy)
+        {
+            // The hierarchy derives the local transform, the notifications are sent once the change is processed
+            m_transformHierarchy->SetWorldTM(GetEntityId(), m_worldTM);
+            return;
+        }
+
         if (m_parentTM)
         {
             m_localTM = m_parentTM->GetWorldTM().GetInverse() * m_worldTM;
@@ -643,6 +714,13 @@ namespace AzFramework
 
     void TransformComponent::ComputeWorldTM()
     {
+        if (m_transformHierarchy)
+        {
+            // The hierarchy derives the world transform, the notifications are sent once the change is processed
+            m_transformHierarchy->SetLocalTM(GetEntityId(), m_localTM);
+            return;
+        }
+
         if (m_parentTM)
         {
             m_worldTM = m_parentTM->GetWorldTM() * m_localTM;
@@ -668,6 +746,56 @@ namespace AzFramework
         return true;
     }
 
+    void TransformComponent::ConnectToTransformHierarchy(const AZ::Transform& localTM)
+    {
+        m_transformHierarchy = AZ::Interface<ITransformHierarchySystem>::Get();
+        if (!m_transformHierarchy)
+        {
+            AZ_Warning("TransformComponent", false, "Entity '%s' %s uses the transform hierarchy but it isn't available.",
+                GetEntity()->GetName().c_str(), GetEntityId().ToString().c_str());
+            return;
+        }
+
+        if (!m_transformHierarchy->AddEntity(GetEntityId(), localTM))
+        {
+            m_transformHierarchy = nullptr;
+            return;
+        }
+
+        m_transformHierarchyChangedHandler = AZ::TransformChangedEvent::Handler(
+            [this](const AZ::Transform& localTM, const AZ::Transform& worldTM)
+            {
+                OnTransformHierarchyChanged(localTM, worldTM);
+            });
+        m_transformHierarchy->BindEntityTransformChangedEventHandler(GetEntityId(), m_transformHierarchyChangedHandler);
+    }
+
+    void TransformComponent::DisconnectFromTransformHierarchy()
+    {
+        // Keep the last transforms, so they're serialized and used when the entity activates again
+        m_localTM = m_transformHierarchy->GetLocalTM(GetEntityId());
+        m_worldTM = m_transformHierarchy->GetWorldTM(GetEntityId());
+
+        m_transformHierarchyChangedHandler.Disconnect();
+        m_transformHierarchy->RemoveEntity(GetEntityId());
+        m_transformHierarchy = nullptr;
+    }
+
+    void TransformComponent::OnTransformHierarchyChanged(const AZ::Transform& localTM, const AZ::Transform& worldTM)
+    {
+        m_localTM = localTM;
+        m_worldTM = worldTM;
+
+        EBUS_EVENT_PTR(m_notificationBus, AZ::TransformNotificationBus, OnTransformChanged, m_localTM, m_worldTM);
+        m_transformChangedEvent.Signal(m_localTM, m_worldTM);
+
+        AzFramework::IEntityBoundsUnion* boundsUnion = AZ::Interface<AzFramework::IEntityBoundsUnion>::Get();
+        if (boundsUnion != nullptr)
+        {
+            boundsUnion->OnTransformUpdated(GetEntity());
+        }
+    }
+
     void TransformComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
     {
         provided.push_back(AZ_CRC("TransformService", 0x8ee22c50));
@@ -687,6 +815,7 @@ namespace AzFramework
                 ->Field("LocalTransform", &TransformComponent::m_localTM)
                 ->Field("ParentActivationTransformMode", &TransformComponent::m_parentActivationTransformMode)
                 ->Field("IsStatic", &TransformComponent::m_isStatic)
+                ->Field("UseTransformHierarchy", &TransformComponent::m_useTransformHierarchy)
                 ;
         }
 
@@ -774,6 +903,7 @@ namespace AzFramework
                     [](AZ::TransformConfig* config) { return (int&)(config->m_parentActivationTransformMode); },
                     [](AZ::TransformConfig* config, const int& i) { config->m_parentActivationTransformMode = (AZ::TransformConfig::ParentActivationTransformMode)i; })
                 ->Property("isStatic", BehaviorValueProperty(&AZ::TransformConfig::m_isStatic))
+                ->Property("useTransformHierarchy", BehaviorValueProperty(&AZ::TransformConfig::m_useTransformHierarchy))
                 ;
         }
     }
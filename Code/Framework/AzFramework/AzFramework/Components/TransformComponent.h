@@ -25,6 +25,7 @@ namespace AzToolsFramework
 namespace AzFramework
 {
     class GameEntityContextComponent;
+    class ITransformHierarchySystem;
 
     /// @deprecated Use AZ::TransformConfig
     using TransformComponentConfiguration = AZ::TransformConfig;
@@ -54,11 +55,11 @@ namespace AzFramework
         void BindChildChangedEventHandler(AZ::ChildChangedEvent::Handler& handler) override;
         void NotifyChildChangedEvent(AZ::ChildChangeType changeType, AZ::EntityId entityId) override;
         //! Returns true if the tm was set to the local transform.
-        const AZ::Transform& GetLocalTM() override { return m_localTM; }
+        const AZ::Transform& GetLocalTM() override;
         //! Returns true if the tm was set to the world transform.
-        const AZ::Transform& GetWorldTM() override { return m_worldTM; }
+        const AZ::Transform& GetWorldTM() override;
         //! Returns both local and world transforms.
-        void GetLocalAndWorld(AZ::Transform& localTM, AZ::Transform& worldTM) override { localTM = m_localTM; worldTM = m_worldTM; }
+        void GetLocalAndWorld(AZ::Transform& localTM, AZ::Transform& worldTM) override;
         //! Returns parent EntityId.
         AZ::EntityId GetParentId() override { return m_parentId; }
         //! Returns parent interface if available.
@@ -162,6 +163,15 @@ namespace AzFramework
         //! Returns whether external calls are currently allowed to move the transform.
         bool AreMoveRequestsAllowed() const;
 
+        //! Methods implementing the storage in the ITransformHierarchySystem.
+        //! While connected the system owns the transforms, m_localTM and m_worldTM only cache the last values read from it,
+        //! and the notifications are sent when the system processes the changes.
+        //! @{
+        void ConnectToTransformHierarchy(const AZ::Transform& localTM);
+        void DisconnectFromTransformHierarchy();
+        void OnTransformHierarchyChanged(const AZ::Transform& localTM, const AZ::Transform& worldTM);
+        //! @}
+
         // TransformHierarchyInformationBus
         void GatherChildren(AZStd::vector<AZ::EntityId>& children) override;
 
@@ -185,5 +195,8 @@ namespace AzFramework
         bool m_parentActive = false; ///< Keeps track of the state of the parent entity.
         bool m_onNewParentKeepWorldTM = true; ///< If set, recompute localTM instead of worldTM when parent becomes active.
         bool m_isStatic = false; ///< If true, the transform is static and doesn't move while entity is active.
+        bool m_useTransformHierarchy = false; ///< If true, the transforms are stored in the ITransformHierarchySystem while active.
+        ITransformHierarchySystem* m_transformHierarchy = nullptr; ///< Valid while the transforms are stored in the system.
+        AZ::TransformChangedEvent::Handler m_transformHierarchyChangedHandler; ///< Sends the notifications for changes processed by the system.
     };
 }   // namespace AZ
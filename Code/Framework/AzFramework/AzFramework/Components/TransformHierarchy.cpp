@@ -0,0 +1,500 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzFramework/Components/TransformHierarchy.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+
+namespace AzFramework
+{
+    TransformHierarchy::NodeId TransformHierarchy::AddNode(AZ::EntityId entityId, const AZ::Transform& localTM, NodeId parentId)
+    {
+        if (parentId != InvalidNodeId && !IsValidNode(parentId))
+        {
+            AZ_Error("TransformHierarchy", false, "Parent node %u of entity %s doesn't exist.", parentId, entityId.ToString().c_str());
+            parentId = InvalidNodeId;
+        }
+
+        NodeId nodeId;
+        if (!m_freeNodeIds.empty())
+        {
+            nodeId = m_freeNodeIds.back();
+            m_freeNodeIds.pop_back();
+        }
+        else
+        {
+            nodeId = aznumeric_cast<NodeId>(m_indices.size());
+            m_indices.push_back(InvalidIndex);
+            m_firstChildIds.push_back(InvalidNodeId);
+            m_nextSiblingIds.push_back(InvalidNodeId);
+            m_prevSiblingIds.push_back(InvalidNodeId);
+            m_depths.push_back(0);
+        }
+
+        // New nodes are placed at the end of their level right away, so the order always stays sorted by depth
+        m_depths[nodeId] = parentId != InvalidNodeId ? m_depths[parentId] + 1 : 0;
+        const Index index = InsertIntoLevel(m_depths[nodeId]);
+        m_localTMs[index] = localTM;
+        m_worldTMs[index] = localTM;
+        m_parentIds[index] = parentId;
+        m_nodeIds[index] = nodeId;
+        m_entityIds[index] = entityId;
+        m_dirty[index] = 0;
+        LinkToParent(nodeId, parentId);
+        SetIndex(nodeId, index);
+        MarkDirty(index);
+
+        return nodeId;
+    }
+
+    void TransformHierarchy::RemoveNode(NodeId nodeId)
+    {
+        const Index index = GetIndex(nodeId);
+        if (index == InvalidIndex)
+        {
+            AZ_Error("TransformHierarchy", false, "Trying to remove node %u which doesn't exist.", nodeId);
+            return;
+        }
+
+        // Only the subtrees of the direct children move to other levels, the rest of the hierarchy isn't touched
+        if (m_firstChildIds[nodeId] != InvalidNodeId)
+        {
+            const AZ::Transform worldTM = CalculateWorldTM(nodeId);
+            AZStd::vector<NodeId> childIds;
+            for (NodeId childId = m_firstChildIds[nodeId]; childId != InvalidNodeId;)
+            {
+                const NodeId nextSiblingId = m_nextSiblingIds[childId];
+                const Index childIndex = m_indices[childId];
+                m_localTMs[childIndex] = worldTM * m_localTMs[childIndex];
+                m_parentIds[childIndex] = InvalidNodeId;
+                MarkDirty(childIndex);
+                m_nextSiblingIds[childId] = InvalidNodeId;
+                m_prevSiblingIds[childId] = InvalidNodeId;
+                childIds.push_back(childId);
+                childId = nextSiblingId;
+            }
+            m_firstChildIds[nodeId] = InvalidNodeId;
+
+            for (NodeId childId : childIds)
+            {
+                ChangeSubtreeDepth(childId, 0);
+            }
+        }
+
+        // Moving the children can move the node as well
+        const Index nodeIndex = m_indices[nodeId];
+        UnlinkFromParent(nodeId, m_parentIds[nodeIndex]);
+
+        if (m_dirty[nodeIndex])
+        {
+            --m_dirtyCount;
+        }
+
+        m_indices[nodeId] = InvalidIndex;
+        RemoveFromLevel(nodeIndex, m_depths[nodeId]);
+        m_freeNodeIds.push_back(nodeId);
+    }
+
+    bool TransformHierarchy::SetParent(NodeId nodeId, NodeId parentId, bool keepWorldTM)
+    {
+        const Index index = GetIndex(nodeId);
+        if (index == InvalidIndex)
+        {
+            AZ_Error("TransformHierarchy", false, "Trying to set the parent of node %u which doesn't exist.", nodeId);
+            return false;
+        }
+
+        if (parentId != InvalidNodeId && (!IsValidNode(parentId) || IsDescendantOrSelf(parentId, nodeId)))
+        {
+            AZ_Warning("TransformHierarchy", false, "Node %u can't be parented to node %u.", nodeId, parentId);
+            return false;
+        }
+
+        if (m_parentIds[index] == parentId)
+        {
+            return true;
+        }
+
+        if (keepWorldTM)
+        {
+            const AZ::Transform worldTM = CalculateWorldTM(nodeId);
+            m_localTMs[index] = parentId != InvalidNodeId ? CalculateWorldTM(parentId).GetInverse() * worldTM : worldTM;
+        }
+        UnlinkFromParent(nodeId, m_parentIds[index]);
+        m_parentIds[index] = parentId;
+        LinkToParent(nodeId, parentId);
+        MarkDirty(index);
+
+        // Only the moved subtree changes its position, and only if it ends up at a different depth
+        const Index depth = parentId != InvalidNodeId ? m_depths[parentId] + 1 : 0;
+        if (depth != m_depths[nodeId])
+        {
+            ChangeSubtreeDepth(nodeId, depth);
+        }
+        else
+        {
+            m_parentIndices[index] = GetIndex(parentId);
+        }
+        return true;
+    }
+
+    TransformHierarchy::NodeId TransformHierarchy::GetParent(NodeId nodeId) const
+    {
+        const Index index = GetIndex(nodeId);
+        return index != InvalidIndex ? m_parentIds[index] : InvalidNodeId;
+    }
+
+    void TransformHierarchy::SetLocalTM(NodeId nodeId, const AZ::Transform& localTM)
+    {
+        const Index index = GetIndex(nodeId);
+        AZ_Assert(index != InvalidIndex, "Invalid transform hierarchy node %u.", nodeId);
+        m_localTMs[index] = localTM;
+        MarkDirty(index);
+    }
+
+    void TransformHierarchy::SetWorldTM(NodeId nodeId, const AZ::Transform& worldTM)
+    {
+        const Index index = GetIndex(nodeId);
+        AZ_Assert(index != InvalidIndex, "Invalid transform hierarchy node %u.", nodeId);
+        const NodeId parentId = m_parentIds[index];
+        m_localTMs[index] = parentId != InvalidNodeId ? CalculateWorldTM(parentId).GetInverse() * worldTM : worldTM;
+        MarkDirty(index);
+    }
+
+    const AZ::Transform& TransformHierarchy::GetLocalTM(NodeId nodeId) const
+    {
+        const Index index = GetIndex(nodeId);
+        AZ_Assert(index != InvalidIndex, "Invalid transform hierarchy node %u.", nodeId);
+        return m_localTMs[index];
+    }
+
+    const AZ::Transform& TransformHierarchy::GetWorldTM(NodeId nodeId) const
+    {
+        const Index index = GetIndex(nodeId);
+        AZ_Assert(index != InvalidIndex, "Invalid transform hierarchy node %u.", nodeId);
+        return m_worldTMs[index];
+    }
+
+    AZ::Transform TransformHierarchy::CalculateWorldTM(NodeId nodeId) const
+    {
+        const Index index = GetIndex(nodeId);
+        AZ_Assert(index != InvalidIndex, "Invalid transform hierarchy node %u.", nodeId);
+
+        // The stored world transforms are up to date above the topmost dirty node on the path to the root
+        Index topmostDirty = InvalidIndex;
+        for (Index i = index; i != InvalidIndex; i = GetIndex(m_parentIds[i]))
+        {
+            if (m_dirty[i])
+            {
+                topmostDirty = i;
+            }
+        }
+
+        if (topmostDirty == InvalidIndex)
+        {
+            return m_worldTMs[index];
+        }
+
+        AZ::Transform worldTM = m_localTMs[index];
+        for (Index i = index; i != topmostDirty;)
+        {
+            i = GetIndex(m_parentIds[i]);
+            worldTM = m_localTMs[i] * worldTM;
+        }
+
+        const Index parentIndex = GetIndex(m_parentIds[topmostDirty]);
+        return parentIndex != InvalidIndex ? m_worldTMs[parentIndex] * worldTM : worldTM;
+    }
+
+    AZ::EntityId TransformHierarchy::GetEntityId(NodeId nodeId) const
+    {
+        const Index index = GetIndex(nodeId);
+        return index != InvalidIndex ? m_entityIds[index] : AZ::EntityId();
+    }
+
+    bool TransformHierarchy::IsValidNode(NodeId nodeId) const
+    {
+        return GetIndex(nodeId) != InvalidIndex;
+    }
+
+    void TransformHierarchy::Update(bool allowParallel)
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzFramework);
+
+        m_changedTransforms.clear();
+        if (m_dirtyCount == 0)
+        {
+            return;
+        }
+
+        // Propagate the dirty flags down the hierarchy, parents are always stored before their children
+        const Index count = aznumeric_cast<Index>(m_entityIds.size());
+        for (Index i = m_levelOffsets[1]; i < count; ++i)
+        {
+            m_dirty[i] |= m_dirty[m_parentIndices[i]];
+        }
+
+        AZ::JobContext* jobContext = allowParallel ? AZ::JobContext::GetGlobalContext() : nullptr;
+        for (size_t level = 0; level + 1 < m_levelOffsets.size(); ++level)
+        {
+            UpdateLevel(m_levelOffsets[level], m_levelOffsets[level + 1], jobContext);
+        }
+
+        m_changedTransforms.reserve(m_dirtyCount);
+        for (Index i = 0; i < count; ++i)
+        {
+            if (m_dirty[i])
+            {
+                m_changedTransforms.push_back({ m_entityIds[i], m_nodeIds[i], m_localTMs[i], m_worldTMs[i] });
+                m_dirty[i] = 0;
+            }
+        }
+        m_dirtyCount = 0;
+
+        m_transformsChangedEvent.Signal(m_changedTransforms);
+    }
+
+    void TransformHierarchy::BindTransformsChangedEventHandler(TransformsChangedEvent::Handler& handler)
+    {
+        handler.Connect(m_transformsChangedEvent);
+    }
+
+    void TransformHierarchy::MarkDirty(Index index)
+    {
+        if (!m_dirty[index])
+        {
+            m_dirty[index] = 1;
+            ++m_dirtyCount;
+        }
+    }
+
+    TransformHierarchy::Index TransformHierarchy::InsertIntoLevel(Index level)
+    {
+        if (m_levelOffsets.empty())
+        {
+            m_levelOffsets.push_back(0);
+        }
+        AZ_Assert(level < m_levelOffsets.size(), "Level %u is more than one level below the deepest one.", level);
+        if (level + 1 == m_levelOffsets.size())
+        {
+            m_levelOffsets.push_back(m_levelOffsets.back());
+        }
+
+        m_localTMs.push_back(AZ::Transform::CreateIdentity());
+        m_worldTMs.push_back(AZ::Transform::CreateIdentity());
+        m_parentIndices.push_back(InvalidIndex);
+        m_parentIds.push_back(InvalidNodeId);
+        m_nodeIds.push_back(InvalidNodeId);
+        m_entityIds.push_back(AZ::EntityId());
+        m_dirty.push_back(0);
+
+        // Open a slot at the end of the level by moving the first node of every deeper level to the end of its level,
+        // so it only costs one move per level instead of shifting all the nodes behind it
+        Index slot = m_levelOffsets.back()++;
+        for (Index deeperLevel = aznumeric_cast<Index>(m_levelOffsets.size()) - 2; deeperLevel > level; --deeperLevel)
+        {
+            const Index first = m_levelOffsets[deeperLevel];
+            if (first != slot)
+            {
+                MoveSlot(first, slot);
+            }
+            slot = first;
+            ++m_levelOffsets[deeperLevel];
+        }
+        return slot;
+    }
+
+    void TransformHierarchy::RemoveFromLevel(Index index, Index level)
+    {
+        // Fill the hole with the last node of its level, which moves the hole to the start of the next level
+        Index hole = index;
+        for (size_t currentLevel = level; currentLevel + 1 < m_levelOffsets.size(); ++currentLevel)
+        {
+            const Index last = m_levelOffsets[currentLevel + 1] - 1;
+            if (hole != last)
+            {
+                MoveSlot(last, hole);
+            }
+            hole = last;
+            --m_levelOffsets[currentLevel + 1];
+        }
+
+        m_localTMs.pop_back();
+        m_worldTMs.pop_back();
+        m_parentIndices.pop_back();
+        m_parentIds.pop_back();
+        m_nodeIds.pop_back();
+        m_entityIds.pop_back();
+        m_dirty.pop_back();
+
+        while (m_levelOffsets.size() > 1 && m_levelOffsets[m_levelOffsets.size() - 2] == m_levelOffsets.back())
+        {
+            m_levelOffsets.pop_back();
+        }
+    }
+
+    void TransformHierarchy::MoveSlot(Index from, Index to)
+    {
+        m_localTMs[to] = m_localTMs[from];
+        m_worldTMs[to] = m_worldTMs[from];
+        m_parentIds[to] = m_parentIds[from];
+        m_nodeIds[to] = m_nodeIds[from];
+        m_entityIds[to] = m_entityIds[from];
+        m_dirty[to] = m_dirty[from];
+        SetIndex(m_nodeIds[to], to);
+    }
+
+    void TransformHierarchy::SetIndex(NodeId nodeId, Index index)
+    {
+        m_indices[nodeId] = index;
+        m_parentIndices[index] = GetIndex(m_parentIds[index]);
+        for (NodeId childId = m_firstChildIds[nodeId]; childId != InvalidNodeId; childId = m_nextSiblingIds[childId])
+        {
+            // Children that are being moved themselves pick up the index once they're placed again
+            const Index childIndex = m_indices[childId];
+            if (childIndex != InvalidIndex)
+            {
+                m_parentIndices[childIndex] = index;
+            }
+        }
+    }
+
+    void TransformHierarchy::ChangeSubtreeDepth(NodeId nodeId, Index depth)
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzFramework);
+
+        // Parents are moved before their children, so the level above a node always exists when it's placed
+        AZStd::vector<AZStd::pair<NodeId, Index>> pending = { { nodeId, depth } };
+        while (!pending.empty())
+        {
+            const auto [currentId, currentDepth] = pending.back();
+            pending.pop_back();
+
+            const Index index = m_indices[currentId];
+            const AZ::Transform localTM = m_localTMs[index];
+            const AZ::Transform worldTM = m_worldTMs[index];
+            const NodeId parentId = m_parentIds[index];
+            const AZ::EntityId entityId = m_entityIds[index];
+            const AZ::u8 dirty = m_dirty[index];
+
+            m_indices[currentId] = InvalidIndex;
+            RemoveFromLevel(index, m_depths[currentId]);
+
+            m_depths[currentId] = currentDepth;
+            const Index newIndex = InsertIntoLevel(currentDepth);
+            m_localTMs[newIndex] = localTM;
+            m_worldTMs[newIndex] = worldTM;
+            m_parentIds[newIndex] = parentId;
+            m_nodeIds[newIndex] = currentId;
+            m_entityIds[newIndex] = entityId;
+            m_dirty[newIndex] = dirty;
+            SetIndex(currentId, newIndex);
+
+            for (NodeId childId = m_firstChildIds[currentId]; childId != InvalidNodeId; childId = m_nextSiblingIds[childId])
+            {
+                pending.push_back({ childId, currentDepth + 1 });
+            }
+        }
+    }
+
+    void TransformHierarchy::UpdateLevel(Index begin, Index end, AZ::JobContext* jobContext)
+    {
+        if (!jobContext || end - begin < 2 * ParallelBatchSize)
+        {
+            UpdateRange(begin, end);
+            return;
+        }
+
+        AZ::JobCompletion jobCompletion(jobContext);
+        for (Index batchBegin = begin; batchBegin < end; batchBegin += ParallelBatchSize)
+        {
+            const Index batchEnd = AZStd::min(batchBegin + ParallelBatchSize, end);
+            AZ::Job* job = AZ::CreateJobFunction([this, batchBegin, batchEnd]()
+                {
+                    UpdateRange(batchBegin, batchEnd);
+                }, true, jobContext);
+            job->SetDependent(&jobCompletion);
+            job->Start();
+        }
+        jobCompletion.StartAndWaitForCompletion();
+    }
+
+    void TransformHierarchy::UpdateRange(Index begin, Index end)
+    {
+        for (Index i = begin; i < end; ++i)
+        {
+            if (m_dirty[i])
+            {
+                const Index parentIndex = m_parentIndices[i];
+                m_worldTMs[i] = parentIndex != InvalidIndex ? m_worldTMs[parentIndex] * m_localTMs[i] : m_localTMs[i];
+            }
+        }
+    }
+
+    TransformHierarchy::Index TransformHierarchy::GetIndex(NodeId nodeId) const
+    {
+        return nodeId < m_indices.size() ? m_indices[nodeId] : InvalidIndex;
+    }
+
+    bool TransformHierarchy::IsDescendantOrSelf(NodeId nodeId, NodeId ancestorId) const
+    {
+        for (NodeId current = nodeId; current != InvalidNodeId; current = GetParent(current))
+        {
+            if (current == ancestorId)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void TransformHierarchy::LinkToParent(NodeId nodeId, NodeId parentId)
+    {
+        m_prevSiblingIds[nodeId] = InvalidNodeId;
+        m_nextSiblingIds[nodeId] = InvalidNodeId;
+        if (parentId == InvalidNodeId)
+        {
+            return;
+        }
+
+        const NodeId firstChildId = m_firstChildIds[parentId];
+        if (firstChildId != InvalidNodeId)
+        {
+            m_prevSiblingIds[firstChildId] = nodeId;
+        }
+        m_nextSiblingIds[nodeId] = firstChildId;
+        m_firstChildIds[parentId] = nodeId;
+    }
+
+    void TransformHierarchy::UnlinkFromParent(NodeId nodeId, NodeId parentId)
+    {
+        if (parentId == InvalidNodeId)
+        {
+            return;
+        }
+
+        const NodeId prevSiblingId = m_prevSiblingIds[nodeId];
+        const NodeId nextSiblingId = m_nextSiblingIds[nodeId];
+        if (prevSiblingId != InvalidNodeId)
+        {
+            m_nextSiblingIds[prevSiblingId] = nextSiblingId;
+        }
+        else
+        {
+            m_firstChildIds[parentId] = nextSiblingId;
+        }
+        if (nextSiblingId != InvalidNodeId)
+        {
+            m_prevSiblingIds[nextSiblingId] = prevSiblingId;
+        }
+        m_prevSiblingIds[nodeId] = InvalidNodeId;
+        m_nextSiblingIds[nodeId] = InvalidNodeId;
+    }
+} // namespace AzFramework
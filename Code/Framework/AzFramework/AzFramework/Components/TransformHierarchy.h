@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/EBus/Event.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/limits.h>
+
+namespace AZ
+{
+    class JobContext;
+}
+
+namespace AzFramework
+{
+    //! Data-oriented storage and propagation for a hierarchy of transforms.
+    //! Local transforms, world transforms and parent links are kept in contiguous arrays sorted by depth, so every
+    //! parent is stored before its children and all nodes of a level are next to each other.
+    //! Adding, removing or reparenting a node only moves the affected subtree to its new levels, which costs one move per
+    //! level below it for every node of the subtree, so the rest of the hierarchy is never re-sorted.
+    //! Changing a transform only marks the node as dirty. Update() propagates the dirty flags to all descendants in a
+    //! single linear pass and then recomputes the world transforms level by level, splitting large levels into batches
+    //! that run in parallel on the job system. Each node that changed is reported once per update, no matter how often
+    //! it or its ancestors moved in the meantime.
+    //! The hierarchy isn't thread safe, all calls have to come from the same thread.
+    class TransformHierarchy
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(TransformHierarchy, AZ::SystemAllocator, 0);
+
+        //! Stable handle of a node, it stays valid until the node is removed.
+        using NodeId = AZ::u32;
+        static constexpr NodeId InvalidNodeId = AZStd::numeric_limits<NodeId>::max();
+
+        //! Levels with fewer nodes than this are always processed on the calling thread.
+        static constexpr AZ::u32 ParallelBatchSize = 512;
+
+        struct ChangedTransform
+        {
+            AZ::EntityId m_entityId;
+            NodeId m_nodeId;
+            AZ::Transform m_localTM;
+            AZ::Transform m_worldTM;
+        };
+
+        using ChangedTransforms = AZStd::vector<ChangedTransform>;
+        using TransformsChangedEvent = AZ::Event<const ChangedTransforms&>;
+
+        TransformHierarchy() = default;
+        TransformHierarchy(const TransformHierarchy&) = delete;
+        TransformHierarchy& operator=(const TransformHierarchy&) = delete;
+
+        //! Adds a node with the given transform relative to its parent, or to the world if it doesn't have a parent.
+        NodeId AddNode(AZ::EntityId entityId, const AZ::Transform& localTM, NodeId parentId = InvalidNodeId);
+        //! Removes a node, its children become roots and keep their current world transform.
+        void RemoveNode(NodeId nodeId);
+
+        //! Changes the parent of a node, InvalidNodeId turns the node into a root.
+        //! @param keepWorldTM If true the local transform is recomputed so the node doesn't move, otherwise the local
+        //!                    transform is kept and the node moves along with its new parent.
+        //! @return False if the new parent is the node itself or one of its descendants.
+        bool SetParent(NodeId nodeId, NodeId parentId, bool keepWorldTM = true);
+        NodeId GetParent(NodeId nodeId) const;
+
+        void SetLocalTM(NodeId nodeId, const AZ::Transform& localTM);
+        //! Sets the local transform that places the node at the given world transform.
+        void SetWorldTM(NodeId nodeId, const AZ::Transform& worldTM);
+
+        const AZ::Transform& GetLocalTM(NodeId nodeId) const;
+        //! Returns the world transform as of the last Update().
+        const AZ::Transform& GetWorldTM(NodeId nodeId) const;
+        //! Returns the world transform including the changes that haven't been propagated by Update() yet.
+        AZ::Transform CalculateWorldTM(NodeId nodeId) const;
+
+        AZ::EntityId GetEntityId(NodeId nodeId) const;
+        bool IsValidNode(NodeId nodeId) const;
+        size_t GetNodeCount() const { return m_entityIds.size(); }
+        //! Returns the number of levels in the hierarchy.
+        size_t GetDepth() const { return m_levelOffsets.empty() ? 0 : m_levelOffsets.size() - 1; }
+
+        //! Recomputes the world transforms of all dirty nodes and their descendants, then signals the changes.
+        //! @param allowParallel Use the global job context to process large levels in parallel batches if it exists.
+        void Update(bool allowParallel = true);
+
+        //! Returns the nodes that changed during the last Update().
+        const ChangedTransforms& GetChangedTransforms() const { return m_changedTransforms; }
+        //! The event is signaled once per Update() with all the nodes that changed.
+        void BindTransformsChangedEventHandler(TransformsChangedEvent::Handler& handler);
+
+    private:
+        using Index = AZ::u32;
+        static constexpr Index InvalidIndex = AZStd::numeric_limits<Index>::max();
+
+        void MarkDirty(Index index);
+        //! Appends a slot to the level and returns its position, the nodes of the deeper levels are moved to make room.
+        Index InsertIntoLevel(Index level);
+        //! Closes the slot at the position in the level, the node stored there has to be moved out already.
+        void RemoveFromLevel(Index index, Index level);
+        void MoveSlot(Index from, Index to);
+        //! Stores the position of the node and updates the parent positions of the node and its children.
+        void SetIndex(NodeId nodeId, Index index);
+        //! Moves the node to the given depth and its descendants to the levels below it.
+        void ChangeSubtreeDepth(NodeId nodeId, Index depth);
+        void UpdateLevel(Index begin, Index end, AZ::JobContext* jobContext);
+        void UpdateRange(Index begin, Index end);
+        Index GetIndex(NodeId nodeId) const;
+        bool IsDescendantOrSelf(NodeId nodeId, NodeId ancestorId) const;
+        void LinkToParent(NodeId nodeId, NodeId parentId);
+        void UnlinkFromParent(NodeId nodeId, NodeId parentId);
+
+        // Per node data, indexed by the position in the depth sorted order.
+        AZStd::vector<AZ::Transform> m_localTMs;
+        AZStd::vector<AZ::Transform> m_worldTMs;
+        AZStd::vector<Index> m_parentIndices; //!< Updated whenever a node or its parent moves.
+        AZStd::vector<NodeId> m_parentIds;
+        AZStd::vector<NodeId> m_nodeIds;
+        AZStd::vector<AZ::EntityId> m_entityIds;
+        AZStd::vector<AZ::u8> m_dirty;
+
+        AZStd::vector<Index> m_indices; //!< Maps a node id to its position.
+        // Children of every node as a doubly linked list, indexed by node id so they don't change when sorting.
+        AZStd::vector<NodeId> m_firstChildIds;
+        AZStd::vector<NodeId> m_nextSiblingIds;
+        AZStd::vector<NodeId> m_prevSiblingIds;
+        AZStd::vector<Index> m_depths; //!< Level of every node, indexed by node id.
+        AZStd::vector<NodeId> m_freeNodeIds;
+        AZStd::vector<Index> m_levelOffsets; //!< First position of every level, plus the end of the last one.
+
+        ChangedTransforms m_changedTransforms;
+        TransformsChangedEvent m_transformsChangedEvent;
+        size_t m_dirtyCount = 0;
+    };
+} // namespace AzFramework
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzFramework/Components/TransformHierarchy.h>
+
+namespace AzFramework
+{
+    //! Opt-in system that keeps the transforms of registered entities in a data-oriented \ref TransformHierarchy.
+    //! Transform changes are propagated once per tick instead of child by child and signaled as one batch through
+    //! \ref BindTransformsChangedEventHandler and per entity through \ref BindEntityTransformChangedEventHandler.
+    //! Entities only take part if they're explicitly added, parents have to be added before their children.
+    //! A TransformComponent with AZ::TransformConfig::m_useTransformHierarchy set adds itself on activation and keeps its
+    //! transforms here, its TransformBus reads and TransformNotificationBus notifications then go through this system.
+    //! Entities are removed automatically when they deactivate, unless a handler was bound with
+    //! \ref BindEntityTransformChangedEventHandler, then the owner of the handler has to remove them.
+    class ITransformHierarchySystem
+    {
+    public:
+        AZ_RTTI(ITransformHierarchySystem, "{4B9C2E1D-7A35-4F06-9E8B-2D61C3F0A5B7}");
+
+        //! Adds an entity with a transform relative to its parent, or to the world if the parent isn't valid.
+        //! @return False if the entity was already added or the parent hasn't been added.
+        virtual bool AddEntity(AZ::EntityId entityId, const AZ::Transform& localTM, AZ::EntityId parentId = AZ::EntityId()) = 0;
+        //! Removes an entity, its children become roots and keep their world transform.
+        virtual void RemoveEntity(AZ::EntityId entityId) = 0;
+        virtual bool IsEntityAdded(AZ::EntityId entityId) const = 0;
+
+        //! Changes the parent of an entity, an invalid parent turns the entity into a root.
+        virtual bool SetParent(AZ::EntityId entityId, AZ::EntityId parentId, bool keepWorldTM = true) = 0;
+        virtual void SetLocalTM(AZ::EntityId entityId, const AZ::Transform& localTM) = 0;
+        virtual void SetWorldTM(AZ::EntityId entityId, const AZ::Transform& worldTM) = 0;
+        virtual AZ::Transform GetLocalTM(AZ::EntityId entityId) const = 0;
+        //! Returns the world transform including the changes that haven't been processed yet.
+        virtual AZ::Transform GetWorldTM(AZ::EntityId entityId) const = 0;
+
+        //! Recomputes the world transforms that changed and signals them to the bound handlers.
+        //! @note During normal operation this is called every frame in OnTick but can
+        //! also be called explicitly (e.g. For testing purposes).
+        virtual void ProcessTransformChanges() = 0;
+
+        //! The handler is called once per processing with all the entities that moved.
+        virtual void BindTransformsChangedEventHandler(TransformHierarchy::TransformsChangedEvent::Handler& handler) = 0;
+        //! The handler is called with the new local and world transform whenever the processing moved the entity.
+        //! It's disconnected when the entity is removed, which then has to be done by the owner of the handler.
+        virtual void BindEntityTransformChangedEventHandler(AZ::EntityId entityId, AZ::TransformChangedEvent::Handler& handler) = 0;
+
+    protected:
+        ~ITransformHierarchySystem() = default;
+    };
+} // namespace AzFramework
@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzFramework/Components/TransformHierarchySystem.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
+
+namespace AzFramework
+{
+    TransformHierarchySystem::TransformHierarchySystem()
+        : m_entityDeactivatedEventHandler([this](AZ::Entity* entity)
+            {
+                // Entities with a bound handler are removed by its owner, so a TransformComponent can keep its last transforms
+                auto nodeIt = m_nodes.find(entity->GetId());
+                if (nodeIt != m_nodes.end() && !nodeIt->second.m_transformChangedEvent.HasHandlerConnected())
+                {
+                    RemoveEntity(entity->GetId());
+                }
+            })
+    {
+    }
+
+    void TransformHierarchySystem::Connect()
+    {
+        AZ::Interface<ITransformHierarchySystem>::Register(this);
+        AZ::TickBus::Handler::BusConnect();
+
+        if (auto componentApplication = AZ::Interface<AZ::ComponentApplicationRequests>::Get())
+        {
+            componentApplication->RegisterEntityDeactivatedEventHandler(m_entityDeactivatedEventHandler);
+        }
+    }
+
+    void TransformHierarchySystem::Disconnect()
+    {
+        m_entityDeactivatedEventHandler.Disconnect();
+
+        AZ::TickBus::Handler::BusDisconnect();
+        AZ::Interface<ITransformHierarchySystem>::Unregister(this);
+    }
+
+    bool TransformHierarchySystem::AddEntity(AZ::EntityId entityId, const AZ::Transform& localTM, AZ::EntityId parentId)
+    {
+        if (IsEntityAdded(entityId))
+        {
+            AZ_Warning("TransformHierarchySystem", false, "Entity %s was already added.", entityId.ToString().c_str());
+            return false;
+        }
+
+        TransformHierarchy::NodeId parentNode = TransformHierarchy::InvalidNodeId;
+        if (parentId.IsValid())
+        {
+            parentNode = FindNode(parentId);
+            if (parentNode == TransformHierarchy::InvalidNodeId)
+            {
+                AZ_Warning("TransformHierarchySystem", false, "Parent %s of entity %s has to be added first.",
+                    parentId.ToString().c_str(), entityId.ToString().c_str());
+                return false;
+            }
+        }
+
+        m_nodes[entityId].m_nodeId = m_hierarchy.AddNode(entityId, localTM, parentNode);
+        return true;
+    }
+
+    void TransformHierarchySystem::RemoveEntity(AZ::EntityId entityId)
+    {
+        auto nodeIt = m_nodes.find(entityId);
+        if (nodeIt == m_nodes.end() || nodeIt->second.m_nodeId == TransformHierarchy::InvalidNodeId)
+        {
+            return;
+        }
+
+        m_hierarchy.RemoveNode(nodeIt->second.m_nodeId);
+        if (m_isSignalingChanges)
+        {
+            // The event of the entity might be the one that is being signaled, it's erased once all changes are signaled
+            nodeIt->second.m_nodeId = TransformHierarchy::InvalidNodeId;
+            m_removedEntities.push_back(entityId);
+        }
+        else
+        {
+            m_nodes.erase(nodeIt);
+        }
+    }
+
+    bool TransformHierarchySystem::IsEntityAdded(AZ::EntityId entityId) const
+    {
+        return FindNode(entityId) != TransformHierarchy::InvalidNodeId;
+    }
+
+    bool TransformHierarchySystem::SetParent(AZ::EntityId entityId, AZ::EntityId parentId, bool keepWorldTM)
+    {
+        const TransformHierarchy::NodeId node = FindNode(entityId);
+        const TransformHierarchy::NodeId parentNode = parentId.IsValid() ? FindNode(parentId) : TransformHierarchy::InvalidNodeId;
+        if (node == TransformHierarchy::InvalidNodeId || (parentId.IsValid() && parentNode == TransformHierarchy::InvalidNodeId))
+        {
+            return false;
+        }
+        return m_hierarchy.SetParent(node, parentNode, keepWorldTM);
+    }
+
+    void TransformHierarchySystem::SetLocalTM(AZ::EntityId entityId, const AZ::Transform& localTM)
+    {
+        const TransformHierarchy::NodeId node = FindNode(entityId);
+        if (node != TransformHierarchy::InvalidNodeId)
+        {
+            m_hierarchy.SetLocalTM(node, localTM);
+        }
+    }
+
+    void TransformHierarchySystem::SetWorldTM(AZ::EntityId entityId, const AZ::Transform& worldTM)
+    {
+        const TransformHierarchy::NodeId node = FindNode(entityId);
+        if (node != TransformHierarchy::InvalidNodeId)
+        {
+            m_hierarchy.SetWorldTM(node, worldTM);
+        }
+    }
+
+    AZ::Transform TransformHierarchySystem::GetLocalTM(AZ::EntityId entityId) const
+    {
+        const TransformHierarchy::NodeId node = FindNode(entityId);
+        return node != TransformHierarchy::InvalidNodeId ? m_hierarchy.GetLocalTM(node) : AZ::Transform::CreateIdentity();
+    }
+
+    AZ::Transform TransformHierarchySystem::GetWorldTM(AZ::EntityId entityId) const
+    {
+        const TransformHierarchy::NodeId node = FindNode(entityId);
+        return node != TransformHierarchy::InvalidNodeId ? m_hierarchy.CalculateWorldTM(node) : AZ::Transform::CreateIdentity();
+    }
+
+    void TransformHierarchySystem::ProcessTransformChanges()
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzFramework);
+
+        m_hierarchy.Update();
+
+        // Forward the changes to the entities that listen for their own transform, like a TransformComponent which stores
+        // its transforms here and sends the TransformNotificationBus notifications from its handler.
+        // A handler can remove entities, so the entity is looked up again for every change.
+        m_isSignalingChanges = true;
+        for (const TransformHierarchy::ChangedTransform& changedTransform : m_hierarchy.GetChangedTransforms())
+        {
+            auto nodeIt = m_nodes.find(changedTransform.m_entityId);
+            if (nodeIt != m_nodes.end() && nodeIt->second.m_nodeId == changedTransform.m_nodeId &&
+                nodeIt->second.m_transformChangedEvent.HasHandlerConnected())
+            {
+                nodeIt->second.m_transformChangedEvent.Signal(changedTransform.m_localTM, changedTransform.m_worldTM);
+            }
+        }
+        m_isSignalingChanges = false;
+
+        for (AZ::EntityId entityId : m_removedEntities)
+        {
+            // Skip entities that were added again in the meantime
+            if (auto nodeIt = m_nodes.find(entityId); nodeIt != m_nodes.end() && nodeIt->second.m_nodeId == TransformHierarchy::InvalidNodeId)
+            {
+                m_nodes.erase(nodeIt);
+            }
+        }
+        m_removedEntities.clear();
+    }
+
+    void TransformHierarchySystem::BindTransformsChangedEventHandler(TransformHierarchy::TransformsChangedEvent::Handler& handler)
+    {
+        m_hierarchy.BindTransformsChangedEventHandler(handler);
+    }
+
+    void TransformHierarchySystem::BindEntityTransformChangedEventHandler(AZ::EntityId entityId, AZ::TransformChangedEvent::Handler& handler)
+    {
+        if (auto nodeIt = m_nodes.find(entityId); nodeIt != m_nodes.end())
+        {
+            handler.Connect(nodeIt->second.m_transformChangedEvent);
+        }
+        else
+        {
+            AZ_Warning("TransformHierarchySystem", false, "Entity %s has to be added before binding to its changes.",
+                entityId.ToString().c_str());
+        }
+    }
+
+    void TransformHierarchySystem::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        ProcessTransformChanges();
+    }
+
+    int TransformHierarchySystem::GetTickOrder()
+    {
+        // After gameplay, physics and attachments moved entities, before rendering reads the transforms
+        return AZ::TICK_PRE_RENDER;
+    }
+
+    TransformHierarchy::NodeId TransformHierarchySystem::FindNode(AZ::EntityId entityId) const
+    {
+        auto nodeIt = m_nodes.find(entityId);
+        return nodeIt != m_nodes.end() ? nodeIt->second.m_nodeId : TransformHierarchy::InvalidNodeId;
+    }
+} // namespace AzFramework
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzFramework/Components/TransformHierarchyBus.h>
+
+namespace AzFramework
+{
+    //! Implementation of \ref ITransformHierarchySystem, owned by the game entity context.
+    class TransformHierarchySystem
+        : public ITransformHierarchySystem
+        , private AZ::TickBus::Handler
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(TransformHierarchySystem, AZ::SystemAllocator, 0);
+
+        TransformHierarchySystem();
+
+        void Connect();
+        void Disconnect();
+
+        // ITransformHierarchySystem overrides ...
+        bool AddEntity(AZ::EntityId entityId, const AZ::Transform& localTM, AZ::EntityId parentId = AZ::EntityId()) override;
+        void RemoveEntity(AZ::EntityId entityId) override;
+        bool IsEntityAdded(AZ::EntityId entityId) const override;
+        bool SetParent(AZ::EntityId entityId, AZ::EntityId parentId, bool keepWorldTM = true) override;
+        void SetLocalTM(AZ::EntityId entityId, const AZ::Transform& localTM) override;
+        void SetWorldTM(AZ::EntityId entityId, const AZ::Transform& worldTM) override;
+        AZ::Transform GetLocalTM(AZ::EntityId entityId) const override;
+        AZ::Transform GetWorldTM(AZ::EntityId entityId) const override;
+        void ProcessTransformChanges() override;
+        void BindTransformsChangedEventHandler(TransformHierarchy::TransformsChangedEvent::Handler& handler) override;
+        void BindEntityTransformChangedEventHandler(AZ::EntityId entityId, AZ::TransformChangedEvent::Handler& handler) override;
+
+    private:
+        struct EntityNode
+        {
+            TransformHierarchy::NodeId m_nodeId = TransformHierarchy::InvalidNodeId;
+            AZ::TransformChangedEvent m_transformChangedEvent;
+        };
+
+        // TickBus overrides ...
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+        int GetTickOrder() override;
+
+        TransformHierarchy::NodeId FindNode(AZ::EntityId entityId) const;
+
+        TransformHierarchy m_hierarchy;
+        AZStd::unordered_map<AZ::EntityId, EntityNode> m_nodes;
+        AZStd::vector<AZ::EntityId> m_removedEntities; //!< Entities removed while their changes were signaled.
+        bool m_isSignalingChanges = false;
+
+        AZ::EntityDeactivatedEvent::Handler m_entityDeactivatedEventHandler; //!< Removes entities when they deactivate.
+    };
+} // namespace AzFramework
@@ -92,6 +92,7 @@ namespace AzFramework
         GameEntityContextRequestBus::Handler::BusConnect();
 
         m_entityVisibilityBoundsUnionSystem.Connect();
+        m_transformHierarchySystem.Connect();
     }
 
     //=========================================================================
@@ -105,6 +106,9 @@ namespace AzFramework
 
         DestroyContext();
 
+        // Disconnected after the entities are destroyed, their transform components remove themselves from it
+        m_transformHierarchySystem.Disconnect();
+
         m_entityOwnershipService.reset();
     }
 
@@ -14,6 +14,7 @@
 #include <AzCore/Component/Component.h>
 #include <AzFramework/Entity/GameEntityContextBus.h>
 #include <AzFramework/Entity/SliceGameEntityOwnershipService.h>
+#include <AzFramework/Components/TransformHierarchySystem.h>
 #include <AzFramework/Visibility/EntityVisibilityBoundsUnionSystem.h>
 
 #include "EntityContext.h"
@@ -97,6 +98,7 @@ namespace AzFramework
         /////////////////////////////////////////////////////////////////////////
 
         AzFramework::EntityVisibilityBoundsUnionSystem m_entityVisibilityBoundsUnionSystem;
+        AzFramework::TransformHierarchySystem m_transformHierarchySystem;
     };
 } // namespace AzFramework
 
@@ -9,6 +9,7 @@
 #include <AzCore/RTTI/ReflectContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzFramework/Spawnable/Spawnable.h>
+#include <AzFramework/Spawnable/SpawnableInstantiationTemplate.h>
 
 namespace AzFramework
 {
@@ -17,6 +18,8 @@ namespace AzFramework
     {
     }
 
+    Spawnable::~Spawnable() = default;
+
     const Spawnable::EntityList& Spawnable::GetEntities() const
     {
         return m_entities;
@@ -27,6 +30,19 @@ namespace AzFramework
         return m_entities;
     }
 
+    const SpawnableInstantiationTemplate* Spawnable::GetInstantiationTemplate(AZ::SerializeContext& serializeContext) const
+    {
+        AZStd::scoped_lock lock(m_instantiationTemplateMutex);
+        // Spawnables don't change after loading, but tools may fill the same spawnable with different entities
+        if (!m_instantiationTemplate || !m_instantiationTemplate->IsCompiledFrom(m_entities))
+        {
+            m_instantiationTemplate = AZStd::make_unique<SpawnableInstantiationTemplate>(m_entities, serializeContext);
+        }
+        return m_instantiationTemplate->IsValid() && m_instantiationTemplate->GetSerializeContext() == &serializeContext
+            ? m_instantiationTemplate.get()
+            : nullptr;
+    }
+
     bool Spawnable::IsEmpty() const
     {
         return m_entities.empty();
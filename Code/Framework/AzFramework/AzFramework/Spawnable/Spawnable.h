@@ -12,16 +12,20 @@
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzFramework/Spawnable/SpawnableMetaData.h>
 
 namespace AZ
 {
     class ReflectContext;
+    class SerializeContext;
 }
 
 namespace AzFramework
 {
+    class SpawnableInstantiationTemplate;
+
     class Spawnable final
         : public AZ::Data::AssetData
     {
@@ -38,7 +42,7 @@ namespace AzFramework
         explicit Spawnable(const AZ::Data::AssetId& id, AssetStatus status = AssetStatus::NotLoaded);
         Spawnable(const Spawnable& rhs) = delete;
         Spawnable(Spawnable&& other) = delete;
-        ~Spawnable() override = default;
+        ~Spawnable() override;
 
         Spawnable& operator=(const Spawnable& rhs) = delete;
         Spawnable& operator=(Spawnable&& other) = delete;
@@ -47,6 +51,13 @@ namespace AzFramework
         EntityList& GetEntities();
         bool IsEmpty() const;
 
+        //! Returns the instantiation template for the entities, which is compiled the first time it's requested.
+        //! The template is compiled again if the entities were replaced, changes to the components of the entities
+        //! after the first request aren't picked up.
+        //! Returns null if the entities can't be instantiated in batches or the template was compiled for a different
+        //! serialize context.
+        const SpawnableInstantiationTemplate* GetInstantiationTemplate(AZ::SerializeContext& serializeContext) const;
+
         SpawnableMetaData& GetMetaData();
         const SpawnableMetaData& GetMetaData() const;
 
@@ -58,6 +69,9 @@ namespace AzFramework
         // Container for keeping all entities of the prefab the Spawnable was created from.
         // Includes both direct and nested entities of the prefab.
         EntityList m_entities;
+
+        mutable AZStd::mutex m_instantiationTemplateMutex;
+        mutable AZStd::unique_ptr<SpawnableInstantiationTemplate> m_instantiationTemplate;
     };
 
     using SpawnableList = AZStd::vector<Spawnable>;
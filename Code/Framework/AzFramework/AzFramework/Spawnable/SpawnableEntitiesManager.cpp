@@ -8,6 +8,7 @@
 
 #include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Jobs/JobContext.h>
 #include <AzCore/Serialization/IdUtils.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Settings/SettingsRegistry.h>
@@ -17,6 +18,7 @@
 #include <AzFramework/Entity/GameEntityContextBus.h>
 #include <AzFramework/Spawnable/Spawnable.h>
 #include <AzFramework/Spawnable/SpawnableEntitiesManager.h>
+#include <AzFramework/Spawnable/SpawnableInstantiationTemplate.h>
 
 namespace AzFramework
 {
@@ -43,6 +45,8 @@ namespace AzFramework
             AZ::u64 value = aznumeric_caster(m_highPriorityThreshold);
             settingsRegistry->Get(value, "/O3DE/AzFramework/Spawnables/HighPriorityThreshold");
             m_highPriorityThreshold = aznumeric_cast<SpawnablePriority>(AZStd::clamp(value, 0llu, 255llu));
+
+            settingsRegistry->Get(m_parallelInstantiationThreshold, "/O3DE/AzFramework/Spawnables/ParallelInstantiationThreshold");
         }
     }
 
@@ -253,6 +257,37 @@ namespace AzFramework
                 &entityTemplate, templateToCloneMap, &serializeContext);
     }
 
+    bool SpawnableEntitiesManager::InstantiateEntityBatch(
+        Ticket& ticket, const AZStd::vector<size_t>& entityIndices, AZ::SerializeContext& serializeContext)
+    {
+        const SpawnableInstantiationTemplate* instantiationTemplate = ticket.m_spawnable->GetInstantiationTemplate(serializeContext);
+        if (!instantiationTemplate)
+        {
+            return false;
+        }
+
+        // The batch reads from the id map without updating it, which is only correct if none of the entities needs a fresh id,
+        // so any entity that has been spawned before, or is spawned more than once in this batch, requires cloning one by one.
+        const Spawnable::EntityList& entities = ticket.m_spawnable->GetEntities();
+        for (auto it = entityIndices.begin(); it != entityIndices.end(); ++it)
+        {
+            if (!ticket.m_previouslySpawned.emplace(entities[*it]->GetId()).second)
+            {
+                for (auto rollbackIt = entityIndices.begin(); rollbackIt != it; ++rollbackIt)
+                {
+                    ticket.m_previouslySpawned.erase(entities[*rollbackIt]->GetId());
+                }
+                return false;
+            }
+        }
+
+        AZ::JobContext* jobContext =
+            entityIndices.size() >= m_parallelInstantiationThreshold ? AZ::JobContext::GetGlobalContext() : nullptr;
+        instantiationTemplate->Instantiate(ticket.m_spawnedEntities, entities, entityIndices, ticket.m_entityIdReferenceMap, jobContext);
+        ticket.m_spawnedEntityIndices.insert(ticket.m_spawnedEntityIndices.end(), entityIndices.begin(), entityIndices.end());
+        return true;
+    }
+
     void SpawnableEntitiesManager::InitializeEntityIdMappings(
         const Spawnable::EntityList& entities, EntityIdMap& idMap, AZStd::unordered_set<AZ::EntityId>& previouslySpawned)
     {
@@ -314,16 +349,25 @@ namespace AzFramework
             // previously-spawned entities from a previous SpawnEntities or SpawnAllEntities call.
             InitializeEntityIdMappings(entitiesToSpawn, ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
 
+            AZStd::vector<size_t> entityIndices(entitiesToSpawnSize);
             for (size_t i = 0; i < entitiesToSpawnSize; ++i)
             {
-                // If this entity has previously been spawned, give it a new id in the reference map
-                RefreshEntityIdMapping(entitiesToSpawn[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+                entityIndices[i] = i;
+            }
+
+            if (!InstantiateEntityBatch(ticket, entityIndices, *request.m_serializeContext))
+            {
+                for (size_t i = 0; i < entitiesToSpawnSize; ++i)
+                {
+                    // If this entity has previously been spawned, give it a new id in the reference map
+                    RefreshEntityIdMapping(entitiesToSpawn[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
 
-                AZ::Entity* clone = CloneSingleEntity(*entitiesToSpawn[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext);
-                AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
+                    AZ::Entity* clone = CloneSingleEntity(*entitiesToSpawn[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext);
+                    AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
 
-                spawnedEntities.emplace_back(clone);
-                spawnedEntityIndices.push_back(i);
+                    spawnedEntities.emplace_back(clone);
+                    spawnedEntityIndices.push_back(i);
+                }
             }
 
             // loadAll is true if every entity has been spawned only once
@@ -392,9 +436,16 @@ namespace AzFramework
             spawnedEntities.reserve(spawnedEntities.size() + entitiesToSpawnSize);
             spawnedEntityIndices.reserve(spawnedEntityIndices.size() + entitiesToSpawnSize);
 
-            for (size_t index : request.m_entityIndices)
+            // Drop out-of-range indices up front so the batch only has to deal with valid entities.
+            AZStd::vector<size_t>& entityIndices = request.m_entityIndices;
+            entityIndices.erase(
+                AZStd::remove_if(entityIndices.begin(), entityIndices.end(),
+                    [&entitiesToSpawn](size_t index) { return index >= entitiesToSpawn.size(); }),
+                entityIndices.end());
+
+            if (!InstantiateEntityBatch(ticket, entityIndices, *request.m_serializeContext))
             {
-                if (index < entitiesToSpawn.size())
+                for (size_t index : entityIndices)
                 {
                     // If this entity has previously been spawned, give it a new id in the reference map
                     RefreshEntityIdMapping(
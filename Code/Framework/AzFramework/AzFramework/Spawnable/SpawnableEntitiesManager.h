@@ -195,6 +195,10 @@ namespace AzFramework
 
         AZ::Entity* CloneSingleEntity(
             const AZ::Entity& entityTemplate, EntityIdMap& templateToCloneMap, AZ::SerializeContext& serializeContext);
+        //! Clones all entities in a single batch using the spawnable's instantiation template, in parallel for large batches.
+        //! Returns false without spawning anything if the batch can't be instantiated this way, for instance because some of the
+        //! entities need new ids in the reference map. In that case the entities have to be cloned one by one.
+        bool InstantiateEntityBatch(Ticket& ticket, const AZStd::vector<size_t>& entityIndices, AZ::SerializeContext& serializeContext);
         
         bool ProcessRequest(SpawnAllEntitiesCommand& request);
         bool ProcessRequest(SpawnEntitiesCommand& request);
@@ -224,6 +228,9 @@ namespace AzFramework
         //! SpawnablePriority_Default which gives users a bit of room to fine tune the priorities as this value can be configured
         //! through the Settings Registry under the key "/O3DE/AzFramework/Spawnables/HighPriorityThreshold".
         SpawnablePriority m_highPriorityThreshold { 64 };
+        //! Batches with at least this many entities are instantiated in parallel on the job system. This value can be configured
+        //! through the Settings Registry under the key "/O3DE/AzFramework/Spawnables/ParallelInstantiationThreshold".
+        AZ::u64 m_parallelInstantiationThreshold { 64 };
     };
 
     AZ_DEFINE_ENUM_BITWISE_OPERATORS(AzFramework::SpawnableEntitiesManager::CommandQueuePriority);
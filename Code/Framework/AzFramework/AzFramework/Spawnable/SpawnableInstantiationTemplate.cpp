@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Serialization/IdUtils.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzFramework/Spawnable/SpawnableInstantiationTemplate.h>
+
+namespace AzFramework
+{
+    SpawnableInstantiationTemplate::SpawnableInstantiationTemplate(
+        const Spawnable::EntityList& entities, AZ::SerializeContext& serializeContext)
+        : m_serializeContext(&serializeContext)
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzFramework);
+
+        AZStd::unordered_set<AZ::EntityId> spawnableIds;
+        spawnableIds.reserve(entities.size());
+        m_entityIds.reserve(entities.size());
+        for (const AZStd::unique_ptr<AZ::Entity>& entity : entities)
+        {
+            spawnableIds.insert(entity->GetId());
+            m_entityIds.push_back(entity->GetId());
+        }
+
+        m_hasReferences.reserve(entities.size());
+        for (const AZStd::unique_ptr<AZ::Entity>& entity : entities)
+        {
+            // The entity's own id is always found once, anything beyond that has to go through the fix-up pass
+            size_t idCount = 0;
+            auto beginCB = [this, &idCount, &spawnableIds](
+                void* ptr, const AZ::SerializeContext::ClassData* classData, const AZ::SerializeContext::ClassElement* elementData) -> bool
+            {
+                if (classData->m_typeId == azrtti_typeid<AZ::EntityId>())
+                {
+                    const AZ::EntityId* id = reinterpret_cast<const AZ::EntityId*>(ptr);
+                    if (elementData && (elementData->m_flags & AZ::SerializeContext::ClassElement::FLG_POINTER))
+                    {
+                        id = *reinterpret_cast<const AZ::EntityId* const*>(ptr);
+                    }
+
+                    if (id->IsValid())
+                    {
+                        ++idCount;
+                        if (elementData && AZ::FindAttribute(AZ::Edit::Attributes::IdGeneratorFunction, elementData->m_attributes) &&
+                            !spawnableIds.contains(*id))
+                        {
+                            // The remapper would generate a new id for this, which can't be done with a read-only id map
+                            m_isValid = false;
+                        }
+                    }
+                }
+                return true;
+            };
+
+            m_serializeContext->EnumerateObject(entity.get(), beginCB, nullptr, AZ::SerializeContext::ENUM_ACCESS_FOR_READ);
+            m_hasReferences.push_back(idCount > 1);
+        }
+    }
+
+    bool SpawnableInstantiationTemplate::IsValid() const
+    {
+        return m_isValid;
+    }
+
+    AZ::SerializeContext* SpawnableInstantiationTemplate::GetSerializeContext() const
+    {
+        return m_serializeContext;
+    }
+
+    bool SpawnableInstantiationTemplate::IsCompiledFrom(const Spawnable::EntityList& entities) const
+    {
+        if (entities.size() != m_entityIds.size())
+        {
+            return false;
+        }
+        for (size_t i = 0; i < entities.size(); ++i)
+        {
+            if (entities[i]->GetId() != m_entityIds[i])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void SpawnableInstantiationTemplate::Instantiate(
+        AZStd::vector<AZ::Entity*>& output, const Spawnable::EntityList& entities, const AZStd::vector<size_t>& indices,
+        const EntityIdMap& idMap, AZ::JobContext* jobContext) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzFramework);
+        AZ_Assert(m_isValid, "Instantiating entities with a spawnable instantiation template that can't be used.");
+        AZ_Assert(m_hasReferences.size() == entities.size(), "Spawnable instantiation template doesn't match the spawnable.");
+
+        const size_t outputOffset = output.size();
+        output.resize(outputOffset + indices.size());
+
+        if (!jobContext || indices.size() < 2 * ParallelBatchSize)
+        {
+            for (size_t i = 0; i < indices.size(); ++i)
+            {
+                output[outputOffset + i] = InstantiateEntity(*entities[indices[i]], indices[i], idMap);
+            }
+            return;
+        }
+
+        AZ::JobCompletion jobCompletion(jobContext);
+        for (size_t batchBegin = 0; batchBegin < indices.size(); batchBegin += ParallelBatchSize)
+        {
+            const size_t batchEnd = AZStd::min(batchBegin + ParallelBatchSize, indices.size());
+            AZ::Job* job = AZ::CreateJobFunction([this, &output, &entities, &indices, &idMap, outputOffset, batchBegin, batchEnd]()
+                {
+                    for (size_t i = batchBegin; i < batchEnd; ++i)
+                    {
+                        output[outputOffset + i] = InstantiateEntity(*entities[indices[i]], indices[i], idMap);
+                    }
+                }, true, jobContext);
+            job->SetDependent(&jobCompletion);
+            job->Start();
+        }
+        jobCompletion.StartAndWaitForCompletion();
+    }
+
+    AZ::Entity* SpawnableInstantiationTemplate::InstantiateEntity(
+        const AZ::Entity& entityTemplate, size_t index, const EntityIdMap& idMap) const
+    {
+        AZ::Entity* clone = m_serializeContext->CloneObject(&entityTemplate);
+        AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
+
+        if (m_hasReferences[index])
+        {
+            AZ::IdUtils::Remapper<AZ::EntityId>::RemapIdsAndIdRefs(clone,
+                [&idMap](const AZ::EntityId& originalId) -> AZ::EntityId
+                {
+                    auto it = idMap.find(originalId);
+                    return it != idMap.end() ? it->second : originalId;
+                }, m_serializeContext);
+        }
+        else
+        {
+            auto it = idMap.find(entityTemplate.GetId());
+            AZ_Assert(it != idMap.end(), "No new id was generated for spawnable entity %s.", entityTemplate.GetId().ToString().c_str());
+            clone->SetId(it->second);
+        }
+        return clone;
+    }
+} // namespace AzFramework
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzFramework/Spawnable/Spawnable.h>
+
+namespace AZ
+{
+    class Entity;
+    class JobContext;
+    class SerializeContext;
+}
+
+namespace AzFramework
+{
+    //! Data compiled once per spawnable that allows its entities to be instantiated in batches.
+    //! Cloning through IdUtils::Remapper walks the reflection data of an entity three times: once to clone it, once to
+    //! generate new ids and once to fix up the references. When all new ids are known up front, the template uses a fix-up
+    //! table built from a single walk over the template entities instead:
+    //! - Entities that only contain their own id are cloned and assigned their new id directly.
+    //! - Entities that reference (other) entities get all their ids patched in a single pass.
+    //! Because the id map isn't modified while instantiating, the clones are independent and can be created in parallel.
+    class SpawnableInstantiationTemplate
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(SpawnableInstantiationTemplate, AZ::SystemAllocator, 0);
+
+        using EntityIdMap = AZStd::unordered_map<AZ::EntityId, AZ::EntityId>;
+
+        //! Number of entities cloned by a single job when instantiating in parallel.
+        static constexpr size_t ParallelBatchSize = 16;
+
+        SpawnableInstantiationTemplate(const Spawnable::EntityList& entities, AZ::SerializeContext& serializeContext);
+
+        //! Returns false if the entities contain ids that have to be generated while cloning, for instance because they're
+        //! tagged with an IdGeneratorFunction but don't belong to the spawnable. These can only be instantiated one by one.
+        bool IsValid() const;
+        AZ::SerializeContext* GetSerializeContext() const;
+        //! Checks if the template was compiled for the same set of entities.
+        bool IsCompiledFrom(const Spawnable::EntityList& entities) const;
+
+        //! Clones the template entities at the given indices and appends the clones to output in the same order.
+        //! The id map has to contain the new id for every entity in the spawnable and isn't modified.
+        //! If a job context is provided, large batches are cloned in parallel.
+        void Instantiate(
+            AZStd::vector<AZ::Entity*>& output, const Spawnable::EntityList& entities, const AZStd::vector<size_t>& indices,
+            const EntityIdMap& idMap, AZ::JobContext* jobContext) const;
+
+    private:
+        AZ::Entity* InstantiateEntity(const AZ::Entity& entityTemplate, size_t index, const EntityIdMap& idMap) const;
+
+        //! For every template entity, whether it contains entity ids besides its own that need to be fixed up.
+        AZStd::vector<bool> m_hasReferences;
+        AZStd::vector<AZ::EntityId> m_entityIds;
+        AZ::SerializeContext* m_serializeContext;
+        bool m_isValid{ true };
+    };
+} // namespace AzFramework
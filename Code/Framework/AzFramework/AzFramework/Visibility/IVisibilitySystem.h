@@ -57,6 +57,7 @@ namespace AzFramework
         {
             const AZ::Aabb m_bounds;
             const AZStd::vector<VisibilityEntry*>& m_entries;
+            bool m_isContained = false; //!< True if the node is known to be fully contained by the query volume, so its entries don't need to be tested individually.
         };
         using EnumerateCallback = AZStd::function<void(const NodeData&)>;
 
@@ -94,6 +95,12 @@ namespace AzFramework
         //! @return the intersection result of the frustum against the visibility system
         virtual void Enumerate(const AZ::Frustum& frustum, const EnumerateCallback& callback) const = 0;
 
+        //! Intersects a frustum against the visibility system, also culling the individual entries of nodes that are only partially
+        //! inside the frustum. Nodes that are fully inside the frustum are passed with all of their entries and m_isContained set.
+        //! @param frustum the frustum to test against
+        //! @param callback the callback to invoke with the visible entries of each visible node, the NodeData is only valid during the callback
+        virtual void EnumerateEntries(const AZ::Frustum& frustum, const EnumerateCallback& callback) const = 0;
+
         //! Enumerate *all* OctreeNodes that have any entries in them (without any culling).
         //! @param callback the callback to invoke when a node is visible
         virtual void EnumerateNoCull(const EnumerateCallback& callback) const = 0;
@@ -7,7 +7,9 @@
  */
 
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
+#include <AzCore/Math/MathIntrinsics.h>
 #include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Math/SimdMath.h>
 #include <AzCore/Serialization/SerializeContext.h>
 
 namespace AzFramework
@@ -26,6 +28,114 @@ namespace AzFramework
     }
 
 
+    //! The planes of a frustum in SoA layout, each component splatted across a vector so four bounding boxes can be tested at once.
+    struct OctreeFrustumPlanes
+    {
+        explicit OctreeFrustumPlanes(const AZ::Frustum& frustum)
+        {
+            for (uint32_t planeIndex = 0; planeIndex < AZ::Frustum::PlaneId::MAX; ++planeIndex)
+            {
+                const AZ::Plane plane = frustum.GetPlane(static_cast<AZ::Frustum::PlaneId>(planeIndex));
+                const AZ::Vector3 normal = plane.GetNormal();
+                m_normalX[planeIndex] = AZ::Simd::Vec4::Splat(normal.GetX());
+                m_normalY[planeIndex] = AZ::Simd::Vec4::Splat(normal.GetY());
+                m_normalZ[planeIndex] = AZ::Simd::Vec4::Splat(normal.GetZ());
+                m_absNormalX[planeIndex] = AZ::Simd::Vec4::Splat(fabsf(normal.GetX()));
+                m_absNormalY[planeIndex] = AZ::Simd::Vec4::Splat(fabsf(normal.GetY()));
+                m_absNormalZ[planeIndex] = AZ::Simd::Vec4::Splat(fabsf(normal.GetZ()));
+                m_distance[planeIndex] = AZ::Simd::Vec4::Splat(plane.GetDistance());
+            }
+        }
+
+        AZ::Simd::Vec4::FloatType m_normalX[AZ::Frustum::PlaneId::MAX];
+        AZ::Simd::Vec4::FloatType m_normalY[AZ::Frustum::PlaneId::MAX];
+        AZ::Simd::Vec4::FloatType m_normalZ[AZ::Frustum::PlaneId::MAX];
+        AZ::Simd::Vec4::FloatType m_absNormalX[AZ::Frustum::PlaneId::MAX];
+        AZ::Simd::Vec4::FloatType m_absNormalY[AZ::Frustum::PlaneId::MAX];
+        AZ::Simd::Vec4::FloatType m_absNormalZ[AZ::Frustum::PlaneId::MAX];
+        AZ::Simd::Vec4::FloatType m_distance[AZ::Frustum::PlaneId::MAX];
+    };
+
+
+    //! Tests four bounding boxes against a frustum, matching ShapeIntersection::Overlaps and ShapeIntersection::Contains.
+    //! Sets bit N of overlapMask if box N overlaps the frustum, and bit N of containedMask if it is fully inside the frustum.
+    static void ClassifyBounds(const OctreeFrustumPlanes& planes, const OctreeNode::BoundsSoA& bounds, uint32_t& overlapMask, uint32_t& containedMask)
+    {
+        using AZ::Simd::Vec4;
+
+        // Splitting the multiplies avoids overflowing for the FLT_MAX bounds of unused lanes
+        const Vec4::FloatType half = Vec4::Splat(0.5f);
+        const Vec4::FloatType halfMinX = Vec4::Mul(Vec4::LoadAligned(bounds.m_minX), half);
+        const Vec4::FloatType halfMinY = Vec4::Mul(Vec4::LoadAligned(bounds.m_minY), half);
+        const Vec4::FloatType halfMinZ = Vec4::Mul(Vec4::LoadAligned(bounds.m_minZ), half);
+        const Vec4::FloatType halfMaxX = Vec4::Mul(Vec4::LoadAligned(bounds.m_maxX), half);
+        const Vec4::FloatType halfMaxY = Vec4::Mul(Vec4::LoadAligned(bounds.m_maxY), half);
+        const Vec4::FloatType halfMaxZ = Vec4::Mul(Vec4::LoadAligned(bounds.m_maxZ), half);
+
+        const Vec4::FloatType centerX = Vec4::Add(halfMaxX, halfMinX);
+        const Vec4::FloatType centerY = Vec4::Add(halfMaxY, halfMinY);
+        const Vec4::FloatType centerZ = Vec4::Add(halfMaxZ, halfMinZ);
+        const Vec4::FloatType extentsX = Vec4::Sub(halfMaxX, halfMinX);
+        const Vec4::FloatType extentsY = Vec4::Sub(halfMaxY, halfMinY);
+        const Vec4::FloatType extentsZ = Vec4::Sub(halfMaxZ, halfMinZ);
+
+        const Vec4::FloatType zero = Vec4::ZeroFloat();
+        Vec4::FloatType overlaps = Vec4::CmpEq(zero, zero);
+        Vec4::FloatType contained = overlaps;
+        for (uint32_t plane = 0; plane < AZ::Frustum::PlaneId::MAX; ++plane)
+        {
+            // Distance from the box centers to the plane, and the projection interval radius of the boxes onto the plane normal
+            const Vec4::FloatType distance = Vec4::Madd(planes.m_normalX[plane], centerX,
+                Vec4::Madd(planes.m_normalY[plane], centerY, Vec4::Madd(planes.m_normalZ[plane], centerZ, planes.m_distance[plane])));
+            const Vec4::FloatType radius = Vec4::Madd(planes.m_absNormalX[plane], extentsX,
+                Vec4::Madd(planes.m_absNormalY[plane], extentsY, Vec4::Mul(planes.m_absNormalZ[plane], extentsZ)));
+
+            overlaps = Vec4::And(overlaps, Vec4::CmpGt(Vec4::Add(distance, radius), zero));
+            contained = Vec4::And(contained, Vec4::CmpGtEq(Vec4::Sub(distance, radius), zero));
+        }
+
+        alignas(16) int32_t overlapLanes[OctreeNode::BoundsSoA::LaneCount];
+        alignas(16) int32_t containedLanes[OctreeNode::BoundsSoA::LaneCount];
+        Vec4::StoreAligned(overlapLanes, Vec4::CastToInt(overlaps));
+        Vec4::StoreAligned(containedLanes, Vec4::CastToInt(contained));
+
+        overlapMask = 0;
+        containedMask = 0;
+        for (uint32_t lane = 0; lane < OctreeNode::BoundsSoA::LaneCount; ++lane)
+        {
+            overlapMask |= (overlapLanes[lane] != 0) ? (1u << lane) : 0;
+            containedMask |= (containedLanes[lane] != 0) ? (1u << lane) : 0;
+        }
+    }
+
+
+    OctreeNode::BoundsSoA::BoundsSoA()
+    {
+        for (uint32_t lane = 0; lane < LaneCount; ++lane)
+        {
+            Clear(lane);
+        }
+    }
+
+
+    void OctreeNode::BoundsSoA::Set(uint32_t lane, const AZ::Aabb& aabb)
+    {
+        m_minX[lane] = aabb.GetMin().GetX();
+        m_minY[lane] = aabb.GetMin().GetY();
+        m_minZ[lane] = aabb.GetMin().GetZ();
+        m_maxX[lane] = aabb.GetMax().GetX();
+        m_maxY[lane] = aabb.GetMax().GetY();
+        m_maxZ[lane] = aabb.GetMax().GetZ();
+    }
+
+
+    void OctreeNode::BoundsSoA::Clear(uint32_t lane)
+    {
+        m_minX[lane] = m_minY[lane] = m_minZ[lane] = AZ::Constants::FloatMax;
+        m_maxX[lane] = m_maxY[lane] = m_maxZ[lane] = -AZ::Constants::FloatMax;
+    }
+
+
     OctreeNode::OctreeNode(const AZ::Aabb& bounds)
         : m_bounds(bounds)
     {
@@ -38,7 +148,11 @@ namespace AzFramework
         , m_parent(rhs.m_parent)
         , m_children(rhs.m_children)
         , m_entries(AZStd::move(rhs.m_entries))
+        , m_entryBounds(AZStd::move(rhs.m_entryBounds))
     {
+        m_childBounds[0] = rhs.m_childBounds[0];
+        m_childBounds[1] = rhs.m_childBounds[1];
+
         // Correct internal node pointers
         for (VisibilityEntry* entry : m_entries)
         {
@@ -53,6 +167,9 @@ namespace AzFramework
         m_parent = rhs.m_parent;
         m_children = rhs.m_children;
         m_entries = AZStd::move(rhs.m_entries);
+        m_entryBounds = AZStd::move(rhs.m_entryBounds);
+        m_childBounds[0] = rhs.m_childBounds[0];
+        m_childBounds[1] = rhs.m_childBounds[1];
 
         // Correct internal node pointers
         for (VisibilityEntry* entry : m_entries)
@@ -92,9 +209,7 @@ namespace AzFramework
         }
         else
         {
-            m_entries.push_back(entry);
-            entry->m_internalNode = this;
-            entry->m_internalNodeIndex = aznumeric_cast<uint32_t>(m_entries.size() - 1);
+            AddEntry(entry);
         }
     }
 
@@ -109,6 +224,8 @@ namespace AzFramework
             // Entry moved, but is still fully contained within the current node
             // We can only do this for leaf nodes, otherwise entries can get 'stuck' in non-leaf nodes
             // even when one of the child nodes would be an adequate fit, due to this early out check
+            const uint32_t index = entry->m_internalNodeIndex;
+            m_entryBounds[index / BoundsSoA::LaneCount].Set(index % BoundsSoA::LaneCount, boundingVolume);
             return;
         }
 
@@ -139,13 +256,24 @@ namespace AzFramework
         const uint32_t removeIndex = entry->m_internalNodeIndex;
         m_entries[removeIndex]->m_internalNode = nullptr;
         m_entries[removeIndex]->m_internalNodeIndex = 0;
-        if (removeIndex < (m_entries.size() - 1))
+        const uint32_t lastIndex = aznumeric_cast<uint32_t>(m_entries.size() - 1);
+        if (removeIndex < lastIndex)
         {
             AZStd::swap(m_entries[removeIndex], m_entries.back());
             m_entries[removeIndex]->m_internalNodeIndex = removeIndex;
+            m_entryBounds[removeIndex / BoundsSoA::LaneCount].Set(removeIndex % BoundsSoA::LaneCount, m_entries[removeIndex]->m_boundingVolume);
         }
         m_entries.pop_back();
 
+        if ((lastIndex % BoundsSoA::LaneCount) == 0)
+        {
+            m_entryBounds.pop_back();
+        }
+        else
+        {
+            m_entryBounds.back().Clear(lastIndex % BoundsSoA::LaneCount);
+        }
+
         if (m_parent != nullptr)
         {
             m_parent->TryMerge(octreeScene);
@@ -167,27 +295,21 @@ namespace AzFramework
 
     void OctreeNode::Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        EnumerateHelper(frustum, callback);
+        const OctreeFrustumPlanes planes(frustum);
+        EnumerateFrustumHelper(planes, AZ::ShapeIntersection::Contains(frustum, m_bounds), nullptr, callback);
     }
 
 
-    void OctreeNode::EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const
+    void OctreeNode::EnumerateEntries(const AZ::Frustum& frustum, AZStd::vector<VisibilityEntry*>& visibleEntries, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        // Invoke the callback for the current node
-        if (!m_entries.empty())
-        {
-            callback({m_bounds, m_entries});
-        }
+        const OctreeFrustumPlanes planes(frustum);
+        EnumerateFrustumHelper(planes, AZ::ShapeIntersection::Contains(frustum, m_bounds), &visibleEntries, callback);
+    }
 
-        if (m_children != nullptr)
-        {
-            // If this is not a leaf node, recurse into the children
-            const uint32_t childCount = GetChildNodeCount();
-            for (uint32_t child = 0; child < childCount; ++child)
-            {
-                m_children[child].EnumerateNoCull(callback);
-            }
-        }
+
+    void OctreeNode::EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        EnumerateAll(false, callback);
     }
 
 
@@ -263,6 +385,106 @@ namespace AzFramework
     }
 
 
+    void OctreeNode::EnumerateFrustumHelper(const OctreeFrustumPlanes& planes, bool isContained, AZStd::vector<VisibilityEntry*>* visibleEntries, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        if (isContained)
+        {
+            // Everything below a node that is fully inside the frustum is visible, so there is nothing left to test
+            EnumerateAll(true, callback);
+            return;
+        }
+
+        // Invoke the callback for the current node
+        if (!m_entries.empty())
+        {
+            if (visibleEntries == nullptr)
+            {
+                callback({m_bounds, m_entries});
+            }
+            else
+            {
+                // Cull the entries four at a time, passing on only the visible ones
+                visibleEntries->clear();
+                for (uint32_t block = 0; block < m_entryBounds.size(); ++block)
+                {
+                    uint32_t overlapMask;
+                    uint32_t containedMask;
+                    ClassifyBounds(planes, m_entryBounds[block], overlapMask, containedMask);
+                    for (; overlapMask != 0; overlapMask &= overlapMask - 1)
+                    {
+                        visibleEntries->push_back(m_entries[block * BoundsSoA::LaneCount + az_ctz_u32(overlapMask)]);
+                    }
+                }
+
+                if (!visibleEntries->empty())
+                {
+                    callback({m_bounds, *visibleEntries});
+                }
+            }
+        }
+
+        if (m_children != nullptr)
+        {
+            // If this is not a leaf node, test the children four at a time and recurse into the visible ones
+            const uint32_t childCount = GetChildNodeCount();
+            for (uint32_t block = 0; block * BoundsSoA::LaneCount < childCount; ++block)
+            {
+                uint32_t overlapMask;
+                uint32_t containedMask;
+                ClassifyBounds(planes, m_childBounds[block], overlapMask, containedMask);
+                for (; overlapMask != 0; overlapMask &= overlapMask - 1)
+                {
+                    const uint32_t lane = az_ctz_u32(overlapMask);
+                    const bool childIsContained = (containedMask & (1u << lane)) != 0;
+                    m_children[block * BoundsSoA::LaneCount + lane].EnumerateFrustumHelper(planes, childIsContained, visibleEntries, callback);
+                }
+            }
+        }
+    }
+
+
+    void OctreeNode::EnumerateAll(bool isContained, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        // Invoke the callback for the current node
+        if (!m_entries.empty())
+        {
+            callback({m_bounds, m_entries, isContained});
+        }
+
+        if (m_children != nullptr)
+        {
+            // If this is not a leaf node, recurse into the children
+            const uint32_t childCount = GetChildNodeCount();
+            for (uint32_t child = 0; child < childCount; ++child)
+            {
+                m_children[child].EnumerateAll(isContained, callback);
+            }
+        }
+    }
+
+
+    void OctreeNode::AddEntry(VisibilityEntry* entry)
+    {
+        const uint32_t index = aznumeric_cast<uint32_t>(m_entries.size());
+        m_entries.push_back(entry);
+        entry->m_internalNode = this;
+        entry->m_internalNodeIndex = index;
+
+        if ((index % BoundsSoA::LaneCount) == 0)
+        {
+            m_entryBounds.emplace_back();
+        }
+        m_entryBounds.back().Set(index % BoundsSoA::LaneCount, entry->m_boundingVolume);
+    }
+
+
+    void OctreeNode::ClearEntries()
+    {
+        m_entries.clear();
+        m_entryBounds.clear();
+    }
+
+
     void OctreeNode::Split(OctreeScene& octreeScene)
     {
         AZ_Assert(m_children == nullptr, "Split invoked on an octreeScene node that has already been split");
@@ -299,11 +521,13 @@ namespace AzFramework
 
                 m_children[child].m_bounds = childBound.GetTranslated(childOffset);
                 m_children[child].m_parent = this;
+                m_childBounds[child / BoundsSoA::LaneCount].Set(child % BoundsSoA::LaneCount, m_children[child].m_bounds);
             }
         }
 
         // Re-partition our entry set across ourself and our child nodes
         AZStd::vector<VisibilityEntry*> entrySet(AZStd::move(m_entries));
+        ClearEntries();
         for (VisibilityEntry* entry : entrySet)
         {
             entry->m_internalNode = nullptr;
@@ -323,11 +547,9 @@ namespace AzFramework
         {
             for (VisibilityEntry* childEntry : m_children[child].m_entries)
             {
-                childEntry->m_internalNode = this;
-                childEntry->m_internalNodeIndex = aznumeric_cast<uint32_t>(m_entries.size());
-                m_entries.push_back(childEntry);
+                AddEntry(childEntry);
             }
-            m_children[child].m_entries.clear();
+            m_children[child].ClearEntries();
         }
 
         octreeScene.ReleaseChildNodes(m_childNodeIndex);
@@ -404,6 +626,16 @@ namespace AzFramework
     }
 
 
+    void OctreeScene::EnumerateEntries(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        AZStd::vector<VisibilityEntry*> visibleEntries;
+        visibleEntries.reserve(bg_octreeNodeMaxEntries);
+
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        m_root.EnumerateEntries(frustum, visibleEntries, callback);
+    }
+
+
     void OctreeScene::EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const
     {
         AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
@@ -20,6 +20,7 @@ namespace AzFramework
 {
     class OctreeSystemComponent;
     class OctreeScene;
+    struct OctreeFrustumPlanes;
 
     //! An internal node within the tree.
     //! It contains all objects that are *fully contained* by the node, if an object spans multiple child nodes that object will be stored in the parent.
@@ -54,6 +55,10 @@ namespace AzFramework
         void Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const;
         //! @}
 
+        //! Recursively enumerates any OctreeNodes and their children that intersect the provided frustum, culling the entries of nodes
+        //! that are partially inside the frustum. Visible entries of those nodes are gathered in visibleEntries.
+        void EnumerateEntries(const AZ::Frustum& frustum, AZStd::vector<VisibilityEntry*>& visibleEntries, const IVisibilityScene::EnumerateCallback& callback) const;
+
         //! Recursively enumerate *all* OctreeNodes that have any entries in them (without any culling).
         void EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const;
 
@@ -66,6 +71,24 @@ namespace AzFramework
         //! Returns true if this is a leaf node.
         bool IsLeaf() const;
 
+        //! Bounding boxes of up to four entries or child nodes in SoA layout, so they can be tested against a frustum at once.
+        //! Unused lanes hold inverted bounds which never overlap anything.
+        struct alignas(16) BoundsSoA
+        {
+            static constexpr uint32_t LaneCount = 4;
+
+            BoundsSoA();
+            void Set(uint32_t lane, const AZ::Aabb& aabb);
+            void Clear(uint32_t lane);
+
+            float m_minX[LaneCount];
+            float m_minY[LaneCount];
+            float m_minZ[LaneCount];
+            float m_maxX[LaneCount];
+            float m_maxY[LaneCount];
+            float m_maxZ[LaneCount];
+        };
+
     private:
 
         void TryMerge(OctreeScene& octreeScene);
@@ -73,6 +96,13 @@ namespace AzFramework
         template <typename T>
         void EnumerateHelper(const T& boundingVolume, const IVisibilityScene::EnumerateCallback& callback) const;
 
+        void EnumerateFrustumHelper(const OctreeFrustumPlanes& planes, bool isContained, AZStd::vector<VisibilityEntry*>* visibleEntries, const IVisibilityScene::EnumerateCallback& callback) const;
+        void EnumerateAll(bool isContained, const IVisibilityScene::EnumerateCallback& callback) const;
+
+        //! Adds an entry to the end of the entry set, and updates its node binding and SoA bounds.
+        void AddEntry(VisibilityEntry* entry);
+        void ClearEntries();
+
         void Split(OctreeScene& octreeScene);
         void Merge(OctreeScene& octreeScene);
 
@@ -84,6 +114,8 @@ namespace AzFramework
         OctreeNode* m_parent = nullptr; //< This is a pointer to an array of GetChildNodeCount() nodes, or nullptr if this is a leaf node
         OctreeNode* m_children = nullptr;
         AZStd::vector<VisibilityEntry*> m_entries;
+        AZStd::vector<BoundsSoA> m_entryBounds; //< Bounds of m_entries, four per block
+        BoundsSoA m_childBounds[2]; //< Bounds of the child nodes, set when the node is split
     };
 
     //! Implementation of the visibility system interface.
@@ -107,6 +139,7 @@ namespace AzFramework
         void Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const override;
         void Enumerate(const AZ::Sphere& sphere, const IVisibilityScene::EnumerateCallback& callback) const override;
         void Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const override;
+        void EnumerateEntries(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const override;
         void EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const override;
         uint32_t GetEntryCount() const override;
         //! @}
@@ -134,6 +134,11 @@ set(FILES
     Components/EditorEntityEvents.h
     Components/TransformComponent.cpp
     Components/TransformComponent.h
+    Components/TransformHierarchy.cpp
+    Components/TransformHierarchy.h
+    Components/TransformHierarchyBus.h
+    Components/TransformHierarchySystem.cpp
+    Components/TransformHierarchySystem.h
     Components/CameraBus.h
     Components/ConsoleBus.h
     Components/ConsoleBus.cpp
@@ -293,6 +298,8 @@ set(FILES
     Spawnable/SpawnableEntitiesInterface.cpp
     Spawnable/SpawnableEntitiesManager.h
     Spawnable/SpawnableEntitiesManager.cpp
+    Spawnable/SpawnableInstantiationTemplate.h
+    Spawnable/SpawnableInstantiationTemplate.cpp
     Spawnable/SpawnableMetaData.cpp
     Spawnable/SpawnableMetaData.h
     Spawnable/SpawnableMonitor.h
@@ -0,0 +1,264 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzFramework/Archive/ZipDirStructures.h>
+
+#include <random>
+
+namespace UnitTest
+{
+    namespace ArchiveSeekableCompressionInternal
+    {
+        // Creates data that compresses reasonably well but isn't trivially repetitive.
+        static AZStd::vector<uint8_t> CreateTestData(size_t size)
+        {
+            AZStd::vector<uint8_t> data;
+            data.resize_no_construct(size);
+            std::mt19937 rng(42);
+            std::uniform_int_distribution<int> distribution(0, 15);
+            for (size_t i = 0; i < size; ++i)
+            {
+                data[i] = static_cast<uint8_t>('a' + distribution(rng));
+            }
+            return data;
+        }
+
+        static AZStd::vector<uint8_t> CompressSeekable(const AZStd::vector<uint8_t>& source)
+        {
+            AZStd::vector<uint8_t> compressed;
+            size_t compressedSize = AZ::IO::ZipDir::ZipRawCompressZSTDSeekableBound(source.size());
+            compressed.resize_no_construct(compressedSize);
+            if (AZ::IO::ZipDir::ZipRawCompressZSTDSeekable(source.data(), &compressedSize, compressed.data(), source.size(), -1) != 0)
+            {
+                return {};
+            }
+            compressed.resize(compressedSize);
+            return compressed;
+        }
+
+        static bool ReadSeekTable(const AZStd::vector<uint8_t>& compressed, size_t uncompressedSize, AZ::IO::CompressionSeekTable& seekTable)
+        {
+            const uint8_t* footer = compressed.data() + compressed.size() - AZ::IO::ZipDir::g_nZSTDSeekTableFooterSize;
+            size_t seekTableSize = AZ::IO::ZipDir::ZipRawGetZSTDSeekTableSize(footer, compressed.size());
+            if (seekTableSize == 0)
+            {
+                return false;
+            }
+            return AZ::IO::ZipDir::ZipRawReadZSTDSeekTable(compressed.data() + compressed.size() - seekTableSize, seekTableSize,
+                compressed.size(), uncompressedSize, seekTable);
+        }
+
+        // Decompresses the range by only decompressing the frames that overlap with it.
+        static bool DecompressRange(const AZStd::vector<uint8_t>& compressed, const AZ::IO::CompressionSeekTable& seekTable,
+            size_t offset, size_t size, AZStd::vector<uint8_t>& frameBuffer, uint8_t* output)
+        {
+            auto first = AZStd::upper_bound(seekTable.begin(), seekTable.end(), offset,
+                [](size_t value, const AZ::IO::CompressionSeekPoint& point) { return value < point.m_uncompressedOffset; }) - 1;
+            auto last = AZStd::lower_bound(first, seekTable.end(), offset + size,
+                [](const AZ::IO::CompressionSeekPoint& point, size_t value) { return point.m_uncompressedOffset < value; });
+
+            size_t decompressedSize = last->m_uncompressedOffset - first->m_uncompressedOffset;
+            frameBuffer.resize_no_construct(decompressedSize);
+            if (AZ::IO::ZipDir::ZipRawUncompress(frameBuffer.data(), &decompressedSize, compressed.data() + first->m_compressedOffset,
+                last->m_compressedOffset - first->m_compressedOffset) != 0)
+            {
+                return false;
+            }
+            memcpy(output, frameBuffer.data() + (offset - first->m_uncompressedOffset), size);
+            return true;
+        }
+    }
+
+    class ArchiveSeekableCompressionTest
+        : public ScopedAllocatorSetupFixture
+    {
+    public:
+        // Deliberately not a multiple of the frame size so the last frame is only partially filled.
+        static constexpr size_t s_dataSize = 4 * AZ::IO::ZipDir::g_nZSTDSeekableFrameSize + 12345;
+    };
+
+    TEST_F(ArchiveSeekableCompressionTest, ZipRawCompressZSTDSeekable_FullDecompression_MatchesSource)
+    {
+        using namespace ArchiveSeekableCompressionInternal;
+        AZStd::vector<uint8_t> source = CreateTestData(s_dataSize);
+        AZStd::vector<uint8_t> compressed = CompressSeekable(source);
+        ASSERT_FALSE(compressed.empty());
+        EXPECT_LT(compressed.size(), source.size());
+
+        // Regular decompression should skip the seek table.
+        AZStd::vector<uint8_t> decompressed;
+        decompressed.resize_no_construct(source.size());
+        size_t decompressedSize = decompressed.size();
+        ASSERT_EQ(0, AZ::IO::ZipDir::ZipRawUncompress(decompressed.data(), &decompressedSize, compressed.data(), compressed.size()));
+        EXPECT_EQ(source.size(), decompressedSize);
+        EXPECT_EQ(source, decompressed);
+    }
+
+    TEST_F(ArchiveSeekableCompressionTest, ZipRawReadZSTDSeekTable_ValidData_TableCoversAllFrames)
+    {
+        using namespace ArchiveSeekableCompressionInternal;
+        AZStd::vector<uint8_t> source = CreateTestData(s_dataSize);
+        AZStd::vector<uint8_t> compressed = CompressSeekable(source);
+
+        AZ::IO::CompressionSeekTable seekTable;
+        ASSERT_TRUE(ReadSeekTable(compressed, source.size(), seekTable));
+        ASSERT_EQ(6, seekTable.size());
+        EXPECT_EQ(0, seekTable.front().m_compressedOffset);
+        EXPECT_EQ(0, seekTable.front().m_uncompressedOffset);
+        for (size_t i = 1; i < seekTable.size() - 1; ++i)
+        {
+            EXPECT_EQ(i * AZ::IO::ZipDir::g_nZSTDSeekableFrameSize, seekTable[i].m_uncompressedOffset);
+            EXPECT_GT(seekTable[i].m_compressedOffset, seekTable[i - 1].m_compressedOffset);
+        }
+        EXPECT_EQ(source.size(), seekTable.back().m_uncompressedOffset);
+    }
+
+    TEST_F(ArchiveSeekableCompressionTest, ZipRawReadZSTDSeekTable_RangesAcrossFrames_MatchSource)
+    {
+        using namespace ArchiveSeekableCompressionInternal;
+        AZStd::vector<uint8_t> source = CreateTestData(s_dataSize);
+        AZStd::vector<uint8_t> compressed = CompressSeekable(source);
+        AZ::IO::CompressionSeekTable seekTable;
+        ASSERT_TRUE(ReadSeekTable(compressed, source.size(), seekTable));
+
+        constexpr size_t frameSize = AZ::IO::ZipDir::g_nZSTDSeekableFrameSize;
+        const size_t ranges[][2] = {
+            { 0, 4096 },                        // Start of the first frame.
+            { frameSize - 100, 200 },           // Crosses a frame boundary.
+            { frameSize, frameSize },           // Exactly one frame.
+            { 2 * frameSize + 17, frameSize },  // Partially covers two frames.
+            { s_dataSize - 4096, 4096 }         // End of the last, partially filled, frame.
+        };
+
+        AZStd::vector<uint8_t> frameBuffer;
+        for (const auto& range : ranges)
+        {
+            AZStd::vector<uint8_t> output;
+            output.resize_no_construct(range[1]);
+            ASSERT_TRUE(DecompressRange(compressed, seekTable, range[0], range[1], frameBuffer, output.data()));
+            EXPECT_EQ(0, memcmp(source.data() + range[0], output.data(), range[1]));
+        }
+    }
+
+    TEST_F(ArchiveSeekableCompressionTest, ZipRawGetZSTDSeekTableSize_RegularZSTDData_NotSeekable)
+    {
+        using namespace ArchiveSeekableCompressionInternal;
+        AZStd::vector<uint8_t> source = CreateTestData(s_dataSize);
+        AZStd::vector<uint8_t> compressed;
+        size_t compressedSize = source.size();
+        compressed.resize_no_construct(compressedSize);
+        ASSERT_EQ(0, AZ::IO::ZipDir::ZipRawCompressZSTD(source.data(), &compressedSize, compressed.data(), source.size(), -1));
+
+        EXPECT_EQ(0, AZ::IO::ZipDir::ZipRawGetZSTDSeekTableSize(
+            compressed.data() + compressedSize - AZ::IO::ZipDir::g_nZSTDSeekTableFooterSize, compressedSize));
+    }
+
+    TEST_F(ArchiveSeekableCompressionTest, ZipRawReadZSTDSeekTable_MismatchedUncompressedSize_Fails)
+    {
+        using namespace ArchiveSeekableCompressionInternal;
+        AZStd::vector<uint8_t> source = CreateTestData(s_dataSize);
+        AZStd::vector<uint8_t> compressed = CompressSeekable(source);
+
+        AZ::IO::CompressionSeekTable seekTable;
+        EXPECT_FALSE(ReadSeekTable(compressed, source.size() + 1, seekTable));
+    }
+} // namespace UnitTest
+
+#if defined(HAVE_BENCHMARK)
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    class BM_ArchiveSeekableCompression
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr size_t s_dataSize = 64 * 1024 * 1024;
+        static constexpr size_t s_readSize = 4 * 1024;
+
+        void SetUp(const ::benchmark::State& state) override
+        {
+            using namespace UnitTest::ArchiveSeekableCompressionInternal;
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            m_source = CreateTestData(s_dataSize);
+            m_compressedSeekable = CompressSeekable(m_source);
+            ReadSeekTable(m_compressedSeekable, m_source.size(), m_seekTable);
+
+            size_t compressedSize = AZ::IO::ZipDir::ZipRawCompressZSTDSeekableBound(s_dataSize);
+            m_compressed.resize_no_construct(compressedSize);
+            AZ::IO::ZipDir::ZipRawCompressZSTD(m_source.data(), &compressedSize, m_compressed.data(), s_dataSize, -1);
+            m_compressed.resize(compressedSize);
+
+            m_output.resize_no_construct(s_readSize);
+            std::mt19937 rng(1);
+            std::uniform_int_distribution<size_t> distribution(0, s_dataSize - s_readSize);
+            m_readOffsets.resize(256);
+            for (size_t& offset : m_readOffsets)
+            {
+                offset = distribution(rng);
+            }
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            m_source = {};
+            m_compressed = {};
+            m_compressedSeekable = {};
+            m_seekTable = {};
+            m_frameBuffer = {};
+            m_output = {};
+            m_readOffsets = {};
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        AZStd::vector<uint8_t> m_source;
+        AZStd::vector<uint8_t> m_compressed;
+        AZStd::vector<uint8_t> m_compressedSeekable;
+        AZ::IO::CompressionSeekTable m_seekTable;
+        AZStd::vector<uint8_t> m_frameBuffer;
+        AZStd::vector<uint8_t> m_output;
+        AZStd::vector<size_t> m_readOffsets;
+    };
+
+    // Random 4kb reads from a file that was compressed as a single stream, which needs to be decompressed fully for every read.
+    BENCHMARK_F(BM_ArchiveSeekableCompression, RandomReads_FullDecompression)(benchmark::State& state)
+    {
+        size_t readIndex = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            size_t offset = m_readOffsets[readIndex++ % m_readOffsets.size()];
+            m_frameBuffer.resize_no_construct(s_dataSize);
+            size_t decompressedSize = s_dataSize;
+            AZ::IO::ZipDir::ZipRawUncompress(m_frameBuffer.data(), &decompressedSize, m_compressed.data(), m_compressed.size());
+            memcpy(m_output.data(), m_frameBuffer.data() + offset, s_readSize);
+            benchmark::DoNotOptimize(m_output.data());
+        }
+        state.SetBytesProcessed(state.iterations() * s_readSize);
+    }
+
+    // Random 4kb reads from a file that was compressed with the seekable codec, which only decompresses the overlapping frames.
+    BENCHMARK_F(BM_ArchiveSeekableCompression, RandomReads_SeekableDecompression)(benchmark::State& state)
+    {
+        using namespace UnitTest::ArchiveSeekableCompressionInternal;
+        size_t readIndex = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            size_t offset = m_readOffsets[readIndex++ % m_readOffsets.size()];
+            DecompressRange(m_compressedSeekable, m_seekTable, offset, s_readSize, m_frameBuffer, m_output.data());
+            benchmark::DoNotOptimize(m_output.data());
+        }
+        state.SetBytesProcessed(state.iterations() * s_readSize);
+    }
+} // namespace Benchmark
+
+#endif // HAVE_BENCHMARK
@@ -8,6 +8,7 @@
 
 #include <AzTest/AzTest.h>
 #include <AzCore/Console/IConsole.h>
+#include <AzCore/IO/CompressionBus.h>
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/UnitTest/UnitTest.h>
 
@@ -1032,6 +1033,54 @@ namespace UnitTest
         EXPECT_STREQ(conversionResult->c_str(), expectedResult.c_str());
     }
 
+    TEST_F(ArchiveTestFixture, FindCompressionInfo_SeekableEntry_DefersReadingSeekTable)
+    {
+        constexpr const char* testArchivePath = "@usercache@/seekable.pak";
+
+        AZ::IO::FileIOBase* fileIo = AZ::IO::FileIOBase::GetInstance();
+        ASSERT_NE(nullptr, fileIo);
+
+        AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
+        ASSERT_NE(nullptr, archive);
+
+        archive->ClosePack(testArchivePath);
+        fileIo->Remove(testArchivePath);
+
+        // Large enough to span multiple seekable frames.
+        AZStd::vector<uint8_t> data(3 * 256 * 1024 + 100);
+        for (size_t i = 0; i < data.size(); ++i)
+        {
+            data[i] = static_cast<uint8_t>(i % 251);
+        }
+
+        AZStd::intrusive_ptr<AZ::IO::INestedArchive> pArchive = archive->OpenArchive(testArchivePath, {}, AZ::IO::INestedArchive::FLAGS_CREATE_NEW);
+        ASSERT_NE(nullptr, pArchive);
+        EXPECT_EQ(0, pArchive->UpdateFile("seekable.dat", data.data(), data.size(), AZ::IO::INestedArchive::METHOD_COMPRESS,
+            AZ::IO::INestedArchive::LEVEL_FASTEST, CompressionCodec::Codec::ZSTD_SEEKABLE));
+        EXPECT_EQ(0, pArchive->UpdateFile("regular.dat", data.data(), data.size(), AZ::IO::INestedArchive::METHOD_COMPRESS,
+            AZ::IO::INestedArchive::LEVEL_FASTEST, CompressionCodec::Codec::ZSTD));
+        pArchive.reset();
+
+        // The seekable flag is stored in the CDR, so it has to survive reopening the archive.
+        EXPECT_TRUE(archive->OpenPack("@assets@", testArchivePath));
+
+        AZ::IO::CompressionInfo seekableInfo;
+        ASSERT_TRUE(AZ::IO::CompressionUtils::FindCompressionInfo(seekableInfo, "@assets@/seekable.dat"));
+        EXPECT_EQ(nullptr, seekableInfo.m_seekTable);
+        ASSERT_TRUE(seekableInfo.m_seekTableLoader);
+        AZStd::shared_ptr<const AZ::IO::CompressionSeekTable> seekTable = seekableInfo.m_seekTableLoader();
+        ASSERT_NE(nullptr, seekTable);
+        EXPECT_EQ(5u, seekTable->size()); // 4 frames plus the end point
+        EXPECT_EQ(data.size(), seekTable->back().m_uncompressedOffset);
+
+        AZ::IO::CompressionInfo regularInfo;
+        ASSERT_TRUE(AZ::IO::CompressionUtils::FindCompressionInfo(regularInfo, "@assets@/regular.dat"));
+        EXPECT_FALSE(regularInfo.m_seekTableLoader);
+
+        archive->ClosePack(testArchivePath);
+        fileIo->Remove(testArchivePath);
+    }
+
     TEST_F(ArchiveUnitTestsWithAllocators, ConvertAbsolutePathToAliasedPath_SourceLongerThanMaxPath_ReturnsFailure)
     {
         const int longPathArraySize = AZ::IO::MaxPathLength + 2;
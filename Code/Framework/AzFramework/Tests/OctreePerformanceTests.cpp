@@ -7,6 +7,7 @@
  */
 
 #include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Math/ShapeIntersection.h>
 #include <AzCore/Name/NameDictionary.h>
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
 
@@ -328,6 +329,89 @@ namespace Benchmark
         }
         RemoveEntries(EntryCount);
     }
+
+    BENCHMARK_F(BM_Octree, EnumerateFrustumPerEntry100000)(benchmark::State& state)
+    {
+        // Culls the individual entries of each node with scalar tests, as callers did before EnumerateEntries
+        constexpr uint32_t EntryCount = 100000;
+        InsertEntries(EntryCount);
+        for (auto _ : state)
+        {
+            for (auto& queryData : m_queryDataArray)
+            {
+                uint32_t visibleCount = 0;
+                m_visScene->Enumerate(queryData.frustum, [&queryData, &visibleCount](const AzFramework::IVisibilityScene::NodeData& nodeData)
+                {
+                    for (const AzFramework::VisibilityEntry* entry : nodeData.m_entries)
+                    {
+                        visibleCount += AZ::ShapeIntersection::Overlaps(queryData.frustum, entry->m_boundingVolume) ? 1 : 0;
+                    }
+                });
+                benchmark::DoNotOptimize(visibleCount);
+            }
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_Octree, EnumerateEntriesFrustum100000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 100000;
+        InsertEntries(EntryCount);
+        for (auto _ : state)
+        {
+            for (auto& queryData : m_queryDataArray)
+            {
+                uint32_t visibleCount = 0;
+                m_visScene->EnumerateEntries(queryData.frustum, [&visibleCount](const AzFramework::IVisibilityScene::NodeData& nodeData)
+                {
+                    visibleCount += aznumeric_cast<uint32_t>(nodeData.m_entries.size());
+                });
+                benchmark::DoNotOptimize(visibleCount);
+            }
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_Octree, EnumerateFrustumPerEntry1000000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 1000000;
+        InsertEntries(EntryCount);
+        for (auto _ : state)
+        {
+            for (auto& queryData : m_queryDataArray)
+            {
+                uint32_t visibleCount = 0;
+                m_visScene->Enumerate(queryData.frustum, [&queryData, &visibleCount](const AzFramework::IVisibilityScene::NodeData& nodeData)
+                {
+                    for (const AzFramework::VisibilityEntry* entry : nodeData.m_entries)
+                    {
+                        visibleCount += AZ::ShapeIntersection::Overlaps(queryData.frustum, entry->m_boundingVolume) ? 1 : 0;
+                    }
+                });
+                benchmark::DoNotOptimize(visibleCount);
+            }
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_Octree, EnumerateEntriesFrustum1000000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 1000000;
+        InsertEntries(EntryCount);
+        for (auto _ : state)
+        {
+            for (auto& queryData : m_queryDataArray)
+            {
+                uint32_t visibleCount = 0;
+                m_visScene->EnumerateEntries(queryData.frustum, [&visibleCount](const AzFramework::IVisibilityScene::NodeData& nodeData)
+                {
+                    visibleCount += aznumeric_cast<uint32_t>(nodeData.m_entries.size());
+                });
+                benchmark::DoNotOptimize(visibleCount);
+            }
+        }
+        RemoveEntries(EntryCount);
+    }
 }
 
 #endif
@@ -11,6 +11,8 @@
 #include <AzCore/Console/Console.h>
 #include <AzCore/Name/NameDictionary.h>
 #include <AzCore/Console/IConsole.h>
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/std/sort.h>
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
 #include <random>
 
@@ -420,4 +422,70 @@ namespace UnitTest
         // Expect all the entries to be in the scene
         ValidateEntryCountEqualsExpectedCount(m_octreeScene, visEntries.size());
     }
+
+    TEST_F(OctreeTests, EnumerateEntriesFrustum_MatchesPerEntryTests)
+    {
+        // Scatter small entries through the world, move them around, and compare the entries gathered by EnumerateEntries
+        // against testing every entry individually
+        const unsigned int seed = 1;
+        std::mt19937_64 rng(seed);
+        std::uniform_real_distribution<float> unif(-0.95f, 0.95f);
+
+        AZStd::vector<AzFramework::VisibilityEntry> visEntries(200);
+        auto scatterEntries = [this, &visEntries, &unif, &rng]()
+        {
+            for (AzFramework::VisibilityEntry& entry : visEntries)
+            {
+                const AZ::Vector3 aabbMin(unif(rng), unif(rng), unif(rng));
+                entry.m_boundingVolume = AZ::Aabb::CreateFromMinMax(aabbMin, aabbMin + AZ::Vector3(0.05f));
+                m_octreeScene->InsertOrUpdateEntry(entry);
+            }
+        };
+
+        AZStd::vector<AZ::Frustum> frustums;
+        for (int i = 0; i < 20; ++i)
+        {
+            const AZ::Vector3 frustumOrigin(unif(rng), unif(rng) - 2.0f, unif(rng));
+            const AZ::Quaternion frustumDirection = AZ::Quaternion::CreateRotationZ(unif(rng));
+            const AZ::Transform frustumTransform = AZ::Transform::CreateFromQuaternionAndTranslation(frustumDirection, frustumOrigin);
+            frustums.push_back(AZ::Frustum(AZ::ViewFrustumAttributes(frustumTransform, 1.0f, 2.0f * atanf(0.5f), 0.5f, 3.0f)));
+        }
+
+        for (int pass = 0; pass < 2; ++pass)
+        {
+            scatterEntries();
+            ValidateEntryCountEqualsExpectedCount(m_octreeScene, visEntries.size());
+
+            for (const AZ::Frustum& frustum : frustums)
+            {
+                AZStd::vector<VisibilityEntry*> gatheredEntries;
+                m_octreeScene->EnumerateEntries(frustum, [&gatheredEntries, &frustum](const AzFramework::IVisibilityScene::NodeData& nodeData)
+                {
+                    for (VisibilityEntry* entry : nodeData.m_entries)
+                    {
+                        EXPECT_TRUE(!nodeData.m_isContained || AZ::ShapeIntersection::Contains(frustum, entry->m_boundingVolume));
+                        gatheredEntries.push_back(entry);
+                    }
+                });
+
+                AZStd::vector<VisibilityEntry*> expectedEntries;
+                for (AzFramework::VisibilityEntry& entry : visEntries)
+                {
+                    if (AZ::ShapeIntersection::Overlaps(frustum, entry.m_boundingVolume))
+                    {
+                        expectedEntries.push_back(&entry);
+                    }
+                }
+
+                AZStd::sort(gatheredEntries.begin(), gatheredEntries.end());
+                EXPECT_EQ(gatheredEntries, expectedEntries);
+            }
+        }
+
+        for (AzFramework::VisibilityEntry& entry : visEntries)
+        {
+            m_octreeScene->RemoveEntry(entry);
+        }
+        ValidateEntryCountEqualsExpectedCount(m_octreeScene, 0);
+    }
 }
@@ -6,11 +6,14 @@
  *
  */
 
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Serialization/IdUtils.h>
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/UserSettings/UserSettingsComponent.h>
 #include <AzFramework/Application/Application.h>
 #include <AzFramework/Spawnable/SpawnableAssetHandler.h>
 #include <AzFramework/Spawnable/SpawnableEntitiesManager.h>
+#include <AzFramework/Spawnable/SpawnableInstantiationTemplate.h>
 #include <AzFramework/Components/TransformComponent.h>
 #include <AzTest/AzTest.h>
 
@@ -366,6 +369,45 @@ namespace UnitTest
         }
     }
 
+    TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_LargeBatchesReferenceOtherEntities_EntityIdsAreMappedAndUnique)
+    {
+        // Large enough to be instantiated in parallel. Each batch should get its own ids and only refer to entities in that batch.
+        constexpr size_t NumEntities = 256;
+        FillSpawnable(NumEntities);
+        CreateEntityReferences(EntityReferenceScheme::AllReferencePreviousCircular);
+
+        AZStd::unordered_set<AZ::EntityId> templateIds;
+        for (const auto& entity : m_spawnable->GetEntities())
+        {
+            templateIds.insert(entity->GetId());
+        }
+
+        AZStd::unordered_set<AZ::EntityId> spawnedIds;
+        size_t spawnedEntitiesCount = 0;
+        auto callback = [this, &templateIds, &spawnedIds, &spawnedEntitiesCount, NumEntities]
+            (AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+        {
+            ValidateEntityReferences(EntityReferenceScheme::AllReferencePreviousCircular, NumEntities, entities);
+            for (const AZ::Entity* entity : entities)
+            {
+                EXPECT_FALSE(templateIds.contains(entity->GetId()));
+                EXPECT_TRUE(spawnedIds.insert(entity->GetId()).second);
+            }
+            spawnedEntitiesCount += entities.size();
+        };
+
+        constexpr size_t NumSpawnAllCalls = 2;
+        for (size_t spawns = 0; spawns < NumSpawnAllCalls; spawns++)
+        {
+            AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
+            optionalArgs.m_completionCallback = callback;
+            m_manager->SpawnAllEntities(*m_ticket, AZStd::move(optionalArgs));
+        }
+        m_manager->ProcessQueue(AzFramework::SpawnableEntitiesManager::CommandQueuePriority::Regular);
+
+        EXPECT_EQ(NumEntities * NumSpawnAllCalls, spawnedEntitiesCount);
+    }
+
     TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_DeleteTicketBeforeCall_NoCrash)
     {
         {
@@ -956,3 +998,132 @@ namespace UnitTest
         EXPECT_LT(defaultPriorityCallId, highPriorityCallId);
     }
 } // namespace UnitTest
+
+#if defined(HAVE_BENCHMARK)
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    class BM_SpawnableInstantiation
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            m_application = new UnitTest::TestApplication();
+            AZ::ComponentApplication::Descriptor descriptor;
+            m_application->Start(descriptor);
+            m_application->RegisterComponentDescriptor(UnitTest::ComponentWithEntityReference::CreateDescriptor());
+            AZ::UserSettingsComponentRequestBus::Broadcast(&AZ::UserSettingsComponentRequests::DisableSaveOnFinalize);
+            AZ::ComponentApplicationBus::BroadcastResult(m_serializeContext, &AZ::ComponentApplicationBus::Events::GetSerializeContext);
+
+            // A hierarchy where every entity refers to its parent, similar to a typical prefab.
+            const size_t entityCount = aznumeric_cast<size_t>(state.range(0));
+            m_entities.reserve(entityCount);
+            for (size_t i = 0; i < entityCount; ++i)
+            {
+                auto& entity = m_entities.emplace_back(AZStd::make_unique<AZ::Entity>());
+                auto transform = entity->CreateComponent<AzFramework::TransformComponent>();
+                auto reference = entity->CreateComponent<UnitTest::ComponentWithEntityReference>();
+                if (i > 0)
+                {
+                    transform->SetParent(m_entities[i / 2]->GetId());
+                    reference->m_entityReference = m_entities[i / 2]->GetId();
+                }
+            }
+
+            m_indices.resize(entityCount);
+            for (size_t i = 0; i < entityCount; ++i)
+            {
+                m_indices[i] = i;
+            }
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            m_entities = {};
+            m_indices = {};
+            m_clones = {};
+            m_idMap = {};
+            delete m_application;
+            m_application = nullptr;
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void GenerateIdMap()
+        {
+            m_idMap.clear();
+            for (const auto& entity : m_entities)
+            {
+                m_idMap.emplace(entity->GetId(), AZ::Entity::MakeId());
+            }
+        }
+
+        void DeleteClones(::benchmark::State& state)
+        {
+            state.PauseTiming();
+            for (AZ::Entity* clone : m_clones)
+            {
+                delete clone;
+            }
+            m_clones.clear();
+            state.ResumeTiming();
+        }
+
+        UnitTest::TestApplication* m_application{ nullptr };
+        AZ::SerializeContext* m_serializeContext{ nullptr };
+        AzFramework::Spawnable::EntityList m_entities;
+        AZStd::vector<size_t> m_indices;
+        AZStd::vector<AZ::Entity*> m_clones;
+        AzFramework::SpawnableInstantiationTemplate::EntityIdMap m_idMap;
+    };
+
+    // The path used before instantiation templates, every entity is cloned and has its ids generated and fixed up separately.
+    BENCHMARK_DEFINE_F(BM_SpawnableInstantiation, CloneAndRemapPerEntity)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            GenerateIdMap();
+            for (const auto& entity : m_entities)
+            {
+                m_clones.push_back(AZ::IdUtils::Remapper<AZ::EntityId>::CloneObjectAndGenerateNewIdsAndFixRefs(
+                    entity.get(), m_idMap, m_serializeContext));
+            }
+            DeleteClones(state);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK_DEFINE_F(BM_SpawnableInstantiation, InstantiationTemplate_Serial)(benchmark::State& state)
+    {
+        AzFramework::SpawnableInstantiationTemplate instantiationTemplate(m_entities, *m_serializeContext);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            GenerateIdMap();
+            instantiationTemplate.Instantiate(m_clones, m_entities, m_indices, m_idMap, nullptr);
+            DeleteClones(state);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK_DEFINE_F(BM_SpawnableInstantiation, InstantiationTemplate_Parallel)(benchmark::State& state)
+    {
+        AzFramework::SpawnableInstantiationTemplate instantiationTemplate(m_entities, *m_serializeContext);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            GenerateIdMap();
+            instantiationTemplate.Instantiate(m_clones, m_entities, m_indices, m_idMap, AZ::JobContext::GetGlobalContext());
+            DeleteClones(state);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK_REGISTER_F(BM_SpawnableInstantiation, CloneAndRemapPerEntity)->Arg(16)->Arg(256)->Arg(2048)->UseRealTime();
+    BENCHMARK_REGISTER_F(BM_SpawnableInstantiation, InstantiationTemplate_Serial)->Arg(16)->Arg(256)->Arg(2048)->UseRealTime();
+    BENCHMARK_REGISTER_F(BM_SpawnableInstantiation, InstantiationTemplate_Parallel)->Arg(16)->Arg(256)->Arg(2048)->UseRealTime();
+} // namespace Benchmark
+
+#endif
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzFramework/Components/TransformHierarchy.h>
+
+#if defined(HAVE_BENCHMARK)
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    class BM_TransformHierarchy
+        : public benchmark::Fixture
+    {
+    public:
+        void SetUp([[maybe_unused]] const ::benchmark::State& state) override
+        {
+            // Create the SystemAllocator if not available
+            if (!AZ::AllocatorInstance<AZ::SystemAllocator>::IsReady())
+            {
+                AZ::AllocatorInstance<AZ::SystemAllocator>::Create();
+                m_ownsSystemAllocator = true;
+            }
+            m_hierarchy = new AzFramework::TransformHierarchy;
+        }
+
+        void TearDown([[maybe_unused]] const ::benchmark::State& state) override
+        {
+            delete m_hierarchy;
+            m_roots.clear();
+            m_roots.shrink_to_fit();
+
+            // Destroy system allocator only if it was created by this environment
+            if (m_ownsSystemAllocator)
+            {
+                AZ::AllocatorInstance<AZ::SystemAllocator>::Destroy();
+            }
+        }
+
+        //! Builds chains where every node is the only child of the previous one.
+        void CreateDeepHierarchy(uint32_t chainCount, uint32_t chainLength)
+        {
+            const AZ::Transform localTM = AZ::Transform::CreateTranslation(AZ::Vector3(0.0f, 0.0f, 1.0f));
+            for (uint32_t chain = 0; chain < chainCount; ++chain)
+            {
+                AzFramework::TransformHierarchy::NodeId parent = m_hierarchy->AddNode(AZ::EntityId(m_nextEntityId++), localTM);
+                m_roots.push_back(parent);
+                for (uint32_t i = 1; i < chainLength; ++i)
+                {
+                    parent = m_hierarchy->AddNode(AZ::EntityId(m_nextEntityId++), localTM, parent);
+                }
+            }
+            m_hierarchy->Update();
+        }
+
+        //! Builds a single root with a few levels of many children each.
+        void CreateWideHierarchy(uint32_t childrenPerNode, uint32_t levelCount)
+        {
+            const AZ::Transform localTM = AZ::Transform::CreateTranslation(AZ::Vector3(1.0f, 0.0f, 0.0f));
+            AZStd::vector<AzFramework::TransformHierarchy::NodeId> level = { m_hierarchy->AddNode(AZ::EntityId(m_nextEntityId++), localTM) };
+            m_roots.push_back(level.front());
+            for (uint32_t depth = 1; depth < levelCount; ++depth)
+            {
+                AZStd::vector<AzFramework::TransformHierarchy::NodeId> nextLevel;
+                for (AzFramework::TransformHierarchy::NodeId parent : level)
+                {
+                    for (uint32_t i = 0; i < childrenPerNode; ++i)
+                    {
+                        nextLevel.push_back(m_hierarchy->AddNode(AZ::EntityId(m_nextEntityId++), localTM, parent));
+                    }
+                }
+                level.swap(nextLevel);
+            }
+            m_hierarchy->Update();
+        }
+
+        void MoveRoots(float offset)
+        {
+            for (AzFramework::TransformHierarchy::NodeId root : m_roots)
+            {
+                m_hierarchy->SetLocalTM(root, AZ::Transform::CreateTranslation(AZ::Vector3(offset, 0.0f, 0.0f)));
+            }
+        }
+
+        bool m_ownsSystemAllocator = false;
+        AZ::u64 m_nextEntityId = 1;
+        AzFramework::TransformHierarchy* m_hierarchy = nullptr;
+        AZStd::vector<AzFramework::TransformHierarchy::NodeId> m_roots;
+    };
+
+    BENCHMARK_F(BM_TransformHierarchy, DeepHierarchy_100Chains_100Deep)(benchmark::State& state)
+    {
+        CreateDeepHierarchy(100, 100);
+        float offset = 0.0f;
+        for (auto _ : state)
+        {
+            MoveRoots(offset += 1.0f);
+            m_hierarchy->Update();
+        }
+    }
+
+    BENCHMARK_F(BM_TransformHierarchy, DeepHierarchy_10Chains_1000Deep)(benchmark::State& state)
+    {
+        CreateDeepHierarchy(10, 1000);
+        float offset = 0.0f;
+        for (auto _ : state)
+        {
+            MoveRoots(offset += 1.0f);
+            m_hierarchy->Update();
+        }
+    }
+
+    BENCHMARK_F(BM_TransformHierarchy, WideHierarchy_10000Children)(benchmark::State& state)
+    {
+        CreateWideHierarchy(10000, 2);
+        float offset = 0.0f;
+        for (auto _ : state)
+        {
+            MoveRoots(offset += 1.0f);
+            m_hierarchy->Update();
+        }
+    }
+
+    BENCHMARK_F(BM_TransformHierarchy, WideHierarchy_100x100Children)(benchmark::State& state)
+    {
+        CreateWideHierarchy(100, 3);
+        float offset = 0.0f;
+        for (auto _ : state)
+        {
+            MoveRoots(offset += 1.0f);
+            m_hierarchy->Update();
+        }
+    }
+
+    BENCHMARK_F(BM_TransformHierarchy, WideHierarchy_100x100Children_Serial)(benchmark::State& state)
+    {
+        CreateWideHierarchy(100, 3);
+        float offset = 0.0f;
+        for (auto _ : state)
+        {
+            MoveRoots(offset += 1.0f);
+            m_hierarchy->Update(false);
+        }
+    }
+
+    BENCHMARK_F(BM_TransformHierarchy, WideHierarchy_ReparentSubtree)(benchmark::State& state)
+    {
+        CreateWideHierarchy(100, 3);
+        // The last node that was added is on the deepest level
+        const AzFramework::TransformHierarchy::NodeId deepParent =
+            aznumeric_cast<AzFramework::TransformHierarchy::NodeId>(m_hierarchy->GetNodeCount() - 1);
+
+        const AzFramework::TransformHierarchy::NodeId subtreeRoot =
+            m_hierarchy->AddNode(AZ::EntityId(m_nextEntityId++), AZ::Transform::CreateIdentity());
+        for (uint32_t i = 0; i < 10; ++i)
+        {
+            m_hierarchy->AddNode(AZ::EntityId(m_nextEntityId++), AZ::Transform::CreateIdentity(), subtreeRoot);
+        }
+        m_hierarchy->Update();
+
+        bool isAttached = false;
+        for (auto _ : state)
+        {
+            isAttached = !isAttached;
+            m_hierarchy->SetParent(subtreeRoot, isAttached ? deepParent : AzFramework::TransformHierarchy::InvalidNodeId);
+            m_hierarchy->Update();
+        }
+    }
+
+    BENCHMARK_F(BM_TransformHierarchy, WideHierarchy_NothingMoved)(benchmark::State& state)
+    {
+        CreateWideHierarchy(100, 3);
+        for (auto _ : state)
+        {
+            m_hierarchy->Update();
+        }
+    }
+} // namespace Benchmark
+
+#endif
@@ -0,0 +1,257 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzFramework/Components/TransformHierarchy.h>
+
+namespace UnitTest
+{
+    using AzFramework::TransformHierarchy;
+
+    class TransformHierarchyTests
+        : public AllocatorsFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AllocatorsFixture::SetUp();
+            m_hierarchy = AZStd::make_unique<TransformHierarchy>();
+        }
+
+        void TearDown() override
+        {
+            m_hierarchy.reset();
+            AllocatorsFixture::TearDown();
+        }
+
+        static AZ::Transform Translation(float x, float y, float z)
+        {
+            return AZ::Transform::CreateTranslation(AZ::Vector3(x, y, z));
+        }
+
+        AZStd::unique_ptr<TransformHierarchy> m_hierarchy;
+    };
+
+    TEST_F(TransformHierarchyTests, Update_ChildOfMovedParent_WorldTransformIsPropagated)
+    {
+        const auto root = m_hierarchy->AddNode(AZ::EntityId(1), Translation(1.0f, 0.0f, 0.0f));
+        const auto child = m_hierarchy->AddNode(AZ::EntityId(2), Translation(0.0f, 2.0f, 0.0f), root);
+        const auto grandChild = m_hierarchy->AddNode(AZ::EntityId(3), Translation(0.0f, 0.0f, 3.0f), child);
+        m_hierarchy->Update(false);
+
+        EXPECT_EQ(m_hierarchy->GetDepth(), 3);
+        EXPECT_TRUE(m_hierarchy->GetWorldTM(grandChild).IsClose(Translation(1.0f, 2.0f, 3.0f)));
+
+        m_hierarchy->SetLocalTM(root, Translation(5.0f, 0.0f, 0.0f));
+        m_hierarchy->Update(false);
+
+        EXPECT_TRUE(m_hierarchy->GetWorldTM(child).IsClose(Translation(5.0f, 2.0f, 0.0f)));
+        EXPECT_TRUE(m_hierarchy->GetWorldTM(grandChild).IsClose(Translation(5.0f, 2.0f, 3.0f)));
+        EXPECT_TRUE(m_hierarchy->GetLocalTM(grandChild).IsClose(Translation(0.0f, 0.0f, 3.0f)));
+    }
+
+    TEST_F(TransformHierarchyTests, Update_MultipleChangesBeforeUpdate_EachNodeIsReportedOnce)
+    {
+        const auto root = m_hierarchy->AddNode(AZ::EntityId(1), AZ::Transform::CreateIdentity());
+        const auto child = m_hierarchy->AddNode(AZ::EntityId(2), AZ::Transform::CreateIdentity(), root);
+        m_hierarchy->AddNode(AZ::EntityId(3), AZ::Transform::CreateIdentity());
+        m_hierarchy->Update(false);
+
+        size_t eventCount = 0;
+        size_t changedCount = 0;
+        TransformHierarchy::TransformsChangedEvent::Handler handler(
+            [&eventCount, &changedCount](const TransformHierarchy::ChangedTransforms& changed)
+            {
+                ++eventCount;
+                changedCount += changed.size();
+            });
+        m_hierarchy->BindTransformsChangedEventHandler(handler);
+
+        m_hierarchy->SetLocalTM(root, Translation(1.0f, 0.0f, 0.0f));
+        m_hierarchy->SetLocalTM(root, Translation(2.0f, 0.0f, 0.0f));
+        m_hierarchy->SetLocalTM(child, Translation(0.0f, 1.0f, 0.0f));
+        m_hierarchy->Update(false);
+
+        // The unrelated root didn't move and isn't reported
+        EXPECT_EQ(eventCount, 1);
+        EXPECT_EQ(changedCount, 2);
+        ASSERT_EQ(m_hierarchy->GetChangedTransforms().size(), 2);
+        EXPECT_EQ(m_hierarchy->GetChangedTransforms()[1].m_entityId, AZ::EntityId(2));
+        EXPECT_TRUE(m_hierarchy->GetChangedTransforms()[1].m_worldTM.IsClose(Translation(2.0f, 1.0f, 0.0f)));
+
+        // Nothing changed, so nothing is signaled
+        m_hierarchy->Update(false);
+        EXPECT_EQ(eventCount, 1);
+        EXPECT_TRUE(m_hierarchy->GetChangedTransforms().empty());
+    }
+
+    TEST_F(TransformHierarchyTests, SetParent_KeepWorldTM_NodeDoesNotMove)
+    {
+        const auto first = m_hierarchy->AddNode(AZ::EntityId(1), Translation(1.0f, 0.0f, 0.0f));
+        const auto second = m_hierarchy->AddNode(AZ::EntityId(2), Translation(0.0f, 4.0f, 0.0f));
+        const auto child = m_hierarchy->AddNode(AZ::EntityId(3), Translation(0.0f, 0.0f, 1.0f), first);
+        m_hierarchy->Update(false);
+
+        EXPECT_TRUE(m_hierarchy->SetParent(child, second, true));
+        m_hierarchy->Update(false);
+
+        EXPECT_EQ(m_hierarchy->GetParent(child), second);
+        EXPECT_TRUE(m_hierarchy->GetWorldTM(child).IsClose(Translation(1.0f, 0.0f, 1.0f)));
+        EXPECT_TRUE(m_hierarchy->GetLocalTM(child).IsClose(Translation(1.0f, -4.0f, 1.0f)));
+    }
+
+    TEST_F(TransformHierarchyTests, SetParent_KeepLocalTM_NodeMovesWithNewParent)
+    {
+        const auto first = m_hierarchy->AddNode(AZ::EntityId(1), Translation(1.0f, 0.0f, 0.0f));
+        const auto second = m_hierarchy->AddNode(AZ::EntityId(2), Translation(0.0f, 4.0f, 0.0f));
+        const auto child = m_hierarchy->AddNode(AZ::EntityId(3), Translation(0.0f, 0.0f, 1.0f), first);
+        m_hierarchy->Update(false);
+
+        EXPECT_TRUE(m_hierarchy->SetParent(child, second, false));
+        m_hierarchy->Update(false);
+
+        EXPECT_TRUE(m_hierarchy->GetWorldTM(child).IsClose(Translation(0.0f, 4.0f, 1.0f)));
+    }
+
+    TEST_F(TransformHierarchyTests, SetParent_ToDescendant_IsRejected)
+    {
+        const auto root = m_hierarchy->AddNode(AZ::EntityId(1), AZ::Transform::CreateIdentity());
+        const auto child = m_hierarchy->AddNode(AZ::EntityId(2), AZ::Transform::CreateIdentity(), root);
+        const auto grandChild = m_hierarchy->AddNode(AZ::EntityId(3), AZ::Transform::CreateIdentity(), child);
+
+        EXPECT_FALSE(m_hierarchy->SetParent(root, grandChild));
+        EXPECT_FALSE(m_hierarchy->SetParent(root, root));
+        EXPECT_EQ(m_hierarchy->GetParent(root), TransformHierarchy::InvalidNodeId);
+    }
+
+    TEST_F(TransformHierarchyTests, RemoveNode_WithChildren_ChildrenBecomeRootsAndKeepWorldTM)
+    {
+        const auto root = m_hierarchy->AddNode(AZ::EntityId(1), Translation(1.0f, 0.0f, 0.0f));
+        const auto child = m_hierarchy->AddNode(AZ::EntityId(2), Translation(0.0f, 2.0f, 0.0f), root);
+        const auto grandChild = m_hierarchy->AddNode(AZ::EntityId(3), Translation(0.0f, 0.0f, 3.0f), child);
+        m_hierarchy->Update(false);
+
+        m_hierarchy->RemoveNode(child);
+        m_hierarchy->Update(false);
+
+        EXPECT_FALSE(m_hierarchy->IsValidNode(child));
+        EXPECT_EQ(m_hierarchy->GetNodeCount(), 2);
+        EXPECT_EQ(m_hierarchy->GetParent(grandChild), TransformHierarchy::InvalidNodeId);
+        EXPECT_TRUE(m_hierarchy->GetWorldTM(grandChild).IsClose(Translation(1.0f, 2.0f, 3.0f)));
+
+        // Moving the former grandparent doesn't affect the new root
+        m_hierarchy->SetLocalTM(root, AZ::Transform::CreateIdentity());
+        m_hierarchy->Update(false);
+        EXPECT_TRUE(m_hierarchy->GetWorldTM(grandChild).IsClose(Translation(1.0f, 2.0f, 3.0f)));
+
+        // Node ids are reused
+        EXPECT_EQ(m_hierarchy->AddNode(AZ::EntityId(4), AZ::Transform::CreateIdentity()), child);
+    }
+
+    TEST_F(TransformHierarchyTests, RemoveNode_AfterSiblingsReparented_OnlyRemainingChildrenBecomeRoots)
+    {
+        const auto root = m_hierarchy->AddNode(AZ::EntityId(1), Translation(1.0f, 0.0f, 0.0f));
+        const auto otherRoot = m_hierarchy->AddNode(AZ::EntityId(2), Translation(0.0f, 5.0f, 0.0f));
+        const auto first = m_hierarchy->AddNode(AZ::EntityId(3), Translation(0.0f, 1.0f, 0.0f), root);
+        const auto middle = m_hierarchy->AddNode(AZ::EntityId(4), Translation(0.0f, 2.0f, 0.0f), root);
+        const auto last = m_hierarchy->AddNode(AZ::EntityId(5), Translation(0.0f, 3.0f, 0.0f), root);
+        m_hierarchy->Update(false);
+
+        // Unlink a child from the middle of the sibling list, then remove another child directly
+        EXPECT_TRUE(m_hierarchy->SetParent(middle, otherRoot));
+        m_hierarchy->RemoveNode(last);
+        m_hierarchy->RemoveNode(root);
+        m_hierarchy->Update(false);
+
+        EXPECT_EQ(m_hierarchy->GetNodeCount(), 3);
+        EXPECT_EQ(m_hierarchy->GetParent(first), TransformHierarchy::InvalidNodeId);
+        EXPECT_EQ(m_hierarchy->GetParent(middle), otherRoot);
+        EXPECT_TRUE(m_hierarchy->GetWorldTM(first).IsClose(Translation(1.0f, 1.0f, 0.0f)));
+        EXPECT_TRUE(m_hierarchy->GetWorldTM(middle).IsClose(Translation(1.0f, 2.0f, 0.0f)));
+
+        // The reparented child is still found through its new parent
+        m_hierarchy->RemoveNode(otherRoot);
+        m_hierarchy->Update(false);
+        EXPECT_EQ(m_hierarchy->GetParent(middle), TransformHierarchy::InvalidNodeId);
+        EXPECT_TRUE(m_hierarchy->GetWorldTM(middle).IsClose(Translation(1.0f, 2.0f, 0.0f)));
+    }
+
+    TEST_F(TransformHierarchyTests, CalculateWorldTM_BeforeUpdate_IncludesPendingChanges)
+    {
+        const auto root = m_hierarchy->AddNode(AZ::EntityId(1), Translation(1.0f, 0.0f, 0.0f));
+        const auto child = m_hierarchy->AddNode(AZ::EntityId(2), Translation(0.0f, 2.0f, 0.0f), root);
+        m_hierarchy->Update(false);
+
+        m_hierarchy->SetLocalTM(root, Translation(3.0f, 0.0f, 0.0f));
+
+        EXPECT_TRUE(m_hierarchy->GetWorldTM(child).IsClose(Translation(1.0f, 2.0f, 0.0f)));
+        EXPECT_TRUE(m_hierarchy->CalculateWorldTM(child).IsClose(Translation(3.0f, 2.0f, 0.0f)));
+
+        m_hierarchy->SetWorldTM(child, Translation(0.0f, 0.0f, 0.0f));
+        EXPECT_TRUE(m_hierarchy->GetLocalTM(child).IsClose(Translation(-3.0f, 0.0f, 0.0f)));
+    }
+
+    TEST_F(TransformHierarchyTests, Update_ChildAddedBeforeParent_IsSortedByDepth)
+    {
+        const auto parent = m_hierarchy->AddNode(AZ::EntityId(1), Translation(1.0f, 0.0f, 0.0f));
+        const auto child = m_hierarchy->AddNode(AZ::EntityId(2), Translation(0.0f, 1.0f, 0.0f));
+        const auto grandParent = m_hierarchy->AddNode(AZ::EntityId(3), Translation(0.0f, 0.0f, 1.0f));
+
+        m_hierarchy->SetParent(child, parent, false);
+        m_hierarchy->SetParent(parent, grandParent, false);
+        m_hierarchy->Update(false);
+
+        EXPECT_EQ(m_hierarchy->GetDepth(), 3);
+        EXPECT_TRUE(m_hierarchy->GetWorldTM(child).IsClose(Translation(1.0f, 1.0f, 1.0f)));
+    }
+
+    TEST_F(TransformHierarchyTests, SetParent_SubtreeInLargeHierarchy_OnlySubtreeMovesToNewLevels)
+    {
+        // Many chains of a root, a child and a grand child
+        constexpr AZ::u64 chainCount = 1000;
+        AZStd::vector<TransformHierarchy::NodeId> chains[3];
+        for (AZ::u64 chain = 0; chain < chainCount; ++chain)
+        {
+            chains[0].push_back(m_hierarchy->AddNode(AZ::EntityId(3 * chain + 1), Translation(aznumeric_cast<float>(chain), 0.0f, 0.0f)));
+            chains[1].push_back(m_hierarchy->AddNode(AZ::EntityId(3 * chain + 2), Translation(0.0f, 1.0f, 0.0f), chains[0].back()));
+            chains[2].push_back(m_hierarchy->AddNode(AZ::EntityId(3 * chain + 3), Translation(0.0f, 0.0f, 1.0f), chains[1].back()));
+        }
+        m_hierarchy->Update(false);
+        EXPECT_EQ(m_hierarchy->GetDepth(), 3);
+
+        // Move a whole chain below the grand child of another one, keeping the local transforms
+        EXPECT_TRUE(m_hierarchy->SetParent(chains[0][10], chains[2][500], false));
+        EXPECT_EQ(m_hierarchy->GetDepth(), 6);
+        m_hierarchy->Update(false);
+
+        EXPECT_EQ(m_hierarchy->GetChangedTransforms().size(), 3);
+        EXPECT_TRUE(m_hierarchy->GetWorldTM(chains[2][10]).IsClose(Translation(510.0f, 2.0f, 2.0f)));
+        for (AZ::u64 chain = 0; chain < chainCount; chain += 99)
+        {
+            if (chain != 10)
+            {
+                EXPECT_TRUE(m_hierarchy->GetWorldTM(chains[2][chain]).IsClose(Translation(aznumeric_cast<float>(chain), 1.0f, 1.0f)));
+            }
+        }
+
+        // Moving nodes of other chains still finds the moved ones through their new parents
+        m_hierarchy->SetLocalTM(chains[0][500], Translation(0.0f, 0.0f, 0.0f));
+        m_hierarchy->Update(false);
+        EXPECT_EQ(m_hierarchy->GetChangedTransforms().size(), 6);
+        EXPECT_TRUE(m_hierarchy->GetWorldTM(chains[2][10]).IsClose(Translation(10.0f, 2.0f, 2.0f)));
+
+        // Moving the chain back to the top keeps its world transform and removes the levels below
+        EXPECT_TRUE(m_hierarchy->SetParent(chains[0][10], TransformHierarchy::InvalidNodeId));
+        m_hierarchy->RemoveNode(chains[0][20]);
+        m_hierarchy->Update(false);
+        EXPECT_EQ(m_hierarchy->GetDepth(), 3);
+        EXPECT_EQ(m_hierarchy->GetNodeCount(), 3 * chainCount - 1);
+        EXPECT_TRUE(m_hierarchy->GetWorldTM(chains[2][10]).IsClose(Translation(10.0f, 2.0f, 2.0f)));
+        EXPECT_TRUE(m_hierarchy->GetWorldTM(chains[2][20]).IsClose(Translation(20.0f, 1.0f, 1.0f)));
+    }
+} // namespace UnitTest
@@ -10,6 +10,7 @@ set(FILES
     ../../AzCore/Tests/Main.cpp
     Spawnable/SpawnableEntitiesManagerTests.cpp
     ArchiveCompressionTests.cpp
+    ArchiveSeekableCompressionTests.cpp
     ArchiveTests.cpp
     BehaviorEntityTests.cpp
     BinToTextEncode.cpp
@@ -22,6 +23,8 @@ set(FILES
     GenAppDescriptors.cpp
     OctreePerformanceTests.cpp
     OctreeTests.cpp
+    TransformHierarchyPerformanceTests.cpp
+    TransformHierarchyTests.cpp
     AssetCatalog.cpp
     AssetProcessorConnection.cpp
     NativeWindow.cpp
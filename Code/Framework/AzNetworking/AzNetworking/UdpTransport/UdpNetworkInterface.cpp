@@ -37,6 +37,7 @@ namespace AzNetworking
     AZ_CVAR(int32_t, net_MaxTimeoutsPerFrame, 1000, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Maximum number of packet timeouts to allow to process in a single frame");
     AZ_CVAR(float, net_RttFudgeScalar, 2.0f, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Scalar value to multiply computed Rtt by to determine an optimal packet timeout threshold");
     AZ_CVAR(uint32_t, net_FragmentedHeaderOverhead, 32, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "A fudge overhead value to take out of fragmented packet payloads");
+    AZ_CVAR(bool, net_UdpBatchedIo, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "If true, UDP sockets will send and receive multiple datagrams per system call where supported. Must be set before creating the network interface");
     AZ_CVAR(AZ::CVarFixedString, net_UdpCompressor, "MultiplayerCompressor", nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "UDP compressor to use."); // WARN: similar to encryption this needs to be set once and only once before creating the network interface
 
     static uint64_t ConstructTimeoutId(ConnectionId connectionId, PacketId packetId, ReliabilityType reliability)
@@ -65,6 +66,11 @@ namespace AzNetworking
         const AZ::CVarFixedString compressor = static_cast<AZ::CVarFixedString>(net_UdpCompressor);
         const AZ::Name compressorName = AZ::Name(compressor);
         m_compressor = AZ::Interface<INetworking>::Get()->CreateCompressor(compressorName);
+
+        if (net_UdpBatchedIo)
+        {
+            SetBatchedIoEnabled(true);
+        }
     }
 
     UdpNetworkInterface::~UdpNetworkInterface()
@@ -166,6 +172,9 @@ namespace AzNetworking
             return;
         }
 
+        // Push out anything queued for batched transmission since the last update
+        m_socket->FlushSends();
+
         const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
         const UdpReaderThread::ReceivedPackets* packets = m_readerThread.GetReceivedPackets(m_socket.get());
         if (packets == nullptr)
@@ -332,6 +341,9 @@ namespace AzNetworking
         }
         m_removedConnections.clear();
 
+        // Push out acks, heartbeats and retransmits generated during this update
+        m_socket->FlushSends();
+
         // Update metrics
         GetMetrics().m_sendPackets = m_socket->GetSentPackets();
         GetMetrics().m_sendBytes = m_socket->GetSentBytes();
@@ -403,6 +415,28 @@ namespace AzNetworking
         return m_socket->IsEncrypted();
     }
 
+    bool UdpNetworkInterface::SetBatchedIoEnabled(bool enabled)
+    {
+        if (m_socket->IsOpen())
+        {
+            AZ_Assert(false, "Batched IO must be configured before the network interface is opened");
+            return false;
+        }
+
+        // Encrypted payloads are written through the SSL layer one at a time and are never batched
+        if (enabled && m_socket->IsEncrypted())
+        {
+            return false;
+        }
+
+        return m_socket->SetBatchedIoEnabled(enabled);
+    }
+
+    bool UdpNetworkInterface::IsBatchedIoEnabled() const
+    {
+        return m_socket->IsBatchedIoEnabled();
+    }
+
     bool UdpNetworkInterface::IsOpen() const
     {
         return m_socket->IsOpen();
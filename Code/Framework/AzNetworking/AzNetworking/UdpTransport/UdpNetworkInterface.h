@@ -110,6 +110,17 @@ namespace AzNetworking
         //! @return boolean true if this is an encrypted socket, false if not
         bool IsEncrypted() const;
 
+        //! Enables or disables batched socket IO, where many datagrams are sent or received per system call.
+        //! Outgoing unencrypted packets are queued and flushed at the start and end of every Update, so packets sent outside of Update
+        //! may be delayed by up to one update interval. Must be configured before Listen or Connect is called.
+        //! @param enabled true to enable batched IO
+        //! @return boolean true if the requested mode was applied, false if unsupported on this platform or for encrypted interfaces
+        bool SetBatchedIoEnabled(bool enabled);
+
+        //! Returns true if batched socket IO is enabled on this network interface.
+        //! @return boolean true if batched socket IO is enabled on this network interface
+        bool IsBatchedIoEnabled() const;
+
         //! Returns true if this connection instance is in an open state, and is capable of actively sending and receiving packets.
         //! @return boolean true if this connection instance is in an open state
         bool IsOpen() const;
@@ -11,6 +11,7 @@
 #include <AzNetworking/Utilities/NetworkCommon.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
+#include <AzCore/std/algorithm.h>
 
 namespace AzNetworking
 {
@@ -167,6 +168,12 @@ namespace AzNetworking
             }
 
             ReceivedPackets& receivedPackets = socketEntry.m_receivedPackets;
+            if (socket->IsBatchedIoEnabled())
+            {
+                ReadBatchedPackets(*socket, receiveBuffer, receivedPackets, startTimeMs, updateRateMs);
+                continue;
+            }
+
             for (;;)
             {
                 AZ::TimeMs elapsedTimeMs = AZ::GetElapsedTimeMs() - startTimeMs;
@@ -204,6 +211,64 @@ namespace AzNetworking
         m_updateTimeMs += AZ::GetElapsedTimeMs() - startTimeMs;
     }
 
+    void UdpReaderThread::ReadBatchedPackets
+    (
+        UdpSocket& socket,
+        ByteBuffer<MaxUdpReceiveBufferSize>& receiveBuffer,
+        ReceivedPackets& receivedPackets,
+        AZ::TimeMs startTimeMs,
+        AZ::TimeMs updateRateMs
+    )
+    {
+        UdpSocket::ReceiveEntry entries[UdpSocket::MaxBatchedIoCount];
+        for (;;)
+        {
+            AZ::TimeMs elapsedTimeMs = AZ::GetElapsedTimeMs() - startTimeMs;
+            if (elapsedTimeMs > updateRateMs)
+            {
+                AZLOG_INFO("ReceivePackets bled %d ms", aznumeric_cast<int32_t>(elapsedTimeMs - updateRateMs));
+                break;
+            }
+
+            // Each datagram gets its own MTU sized slot in the receive buffer so the kernel can write directly into place
+            const uint32_t bufferHead = receiveBuffer.GetSize();
+            const uint32_t freeSlots = (receiveBuffer.GetCapacity() - bufferHead) / MaxUdpTransmissionUnit;
+            const uint32_t freePackets = aznumeric_cast<uint32_t>(receivedPackets.capacity() - receivedPackets.size());
+            const uint32_t slotCount = AZStd::min(AZStd::min(freeSlots, freePackets), UdpSocket::MaxBatchedIoCount);
+            if (slotCount == 0)
+            {
+                AZLOG_INFO("Receive buffer full, leaving data on the socket");
+                break;
+            }
+
+            uint8_t* dstData = receiveBuffer.GetBufferEnd();
+            for (uint32_t i = 0; i < slotCount; ++i)
+            {
+                entries[i].m_buffer = dstData + (i * MaxUdpTransmissionUnit);
+                entries[i].m_bufferSize = MaxUdpTransmissionUnit;
+                entries[i].m_receivedBytes = 0;
+            }
+            receiveBuffer.Resize(bufferHead + slotCount * MaxUdpTransmissionUnit);
+
+            const int32_t receivedCount = socket.ReceiveBatch(entries, slotCount);
+            const uint32_t usedSlots = (receivedCount > 0) ? aznumeric_cast<uint32_t>(receivedCount) : 0;
+            for (uint32_t i = 0; i < usedSlots; ++i)
+            {
+                if (entries[i].m_receivedBytes > 0)
+                {
+                    receivedPackets.push_back(ReceivedPacket(entries[i].m_address, entries[i].m_buffer, entries[i].m_receivedBytes));
+                }
+            }
+            receiveBuffer.Resize(bufferHead + usedSlots * MaxUdpTransmissionUnit);
+
+            if (usedSlots < slotCount)
+            {
+                // The socket has been drained
+                break;
+            }
+        }
+    }
+
     UdpReaderThread::ReceivedPacket::ReceivedPacket(const IpAddress& address, const uint8_t* buffer, int32_t receivedBytes)
         : m_address(address)
         , m_buffer(buffer)
@@ -76,6 +76,21 @@ namespace AzNetworking
         void OnStop() override;
         void OnUpdate(AZ::TimeMs updateRateMs) override;
 
+        //! Reads as many packets as possible off a socket with batched IO enabled.
+        //! @param socket          the socket to read from
+        //! @param receiveBuffer   the buffer to read packet data into
+        //! @param receivedPackets the set of packets to append received packets to
+        //! @param startTimeMs     the time the current update started
+        //! @param updateRateMs    the time budget for the current update
+        void ReadBatchedPackets
+        (
+            UdpSocket& socket,
+            ByteBuffer<MaxUdpReceiveBufferSize>& receiveBuffer,
+            ReceivedPackets& receivedPackets,
+            AZ::TimeMs startTimeMs,
+            AZ::TimeMs updateRateMs
+        );
+
         AZ_DISABLE_COPY_MOVE(UdpReaderThread);
 
         struct SocketEntry
@@ -98,6 +98,8 @@ namespace AzNetworking
 
     void UdpSocket::Close()
     {
+        // Make sure anything queued (disconnect notifications in particular) makes it onto the wire
+        FlushSends();
         CloseSocket(m_socketFd);
         m_socketFd = InvalidSocketFd;
     }
@@ -140,6 +142,14 @@ namespace AzNetworking
         if (connectionQuality.m_latencyMs <= AZ::TimeMs{ 0 })
 #endif
         {
+            if ((m_sendBatch != nullptr) && !encrypt && (size <= MaxUdpTransmissionUnit))
+            {
+                // Queued packets are only accounted for once FlushSends has handed them to the operating system
+                return QueueSend(address, data, size);
+            }
+
+            // Preserve submission order relative to anything already queued
+            FlushSends();
             sentBytes = SendInternal(address, data, size, encrypt, dtlsEndpoint);
 
             if (sentBytes < 0)
@@ -225,6 +235,203 @@ namespace AzNetworking
         return receivedBytes;
     }
 
+    int32_t UdpSocket::ReceiveBatch(ReceiveEntry* outEntries, uint32_t count) const
+    {
+        AZ_Assert(outEntries != nullptr, "NULL entry pointer passed to receive");
+
+        if (!IsOpen() || (count == 0))
+        {
+            return 0;
+        }
+
+#if AZ_TRAIT_USE_SOCKET_BATCHED_IO
+        if (m_batchedIo)
+        {
+            count = AZStd::min(count, MaxBatchedIoCount);
+
+            mmsghdr messages[MaxBatchedIoCount];
+            iovec ioVectors[MaxBatchedIoCount];
+            sockaddr_in fromAddresses[MaxBatchedIoCount];
+            memset(messages, 0, sizeof(mmsghdr) * count);
+
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                AZ_Assert(outEntries[i].m_buffer != nullptr, "NULL data pointer passed to receive");
+                ioVectors[i].iov_base = outEntries[i].m_buffer;
+                ioVectors[i].iov_len = outEntries[i].m_bufferSize;
+                messages[i].msg_hdr.msg_name = &fromAddresses[i];
+                messages[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+                messages[i].msg_hdr.msg_iov = &ioVectors[i];
+                messages[i].msg_hdr.msg_iovlen = 1;
+            }
+
+            const int32_t receivedCount = recvmmsg(static_cast<int32_t>(m_socketFd), messages, count, MSG_DONTWAIT, nullptr);
+            if (receivedCount < 0)
+            {
+                const int32_t error = GetLastNetworkError();
+
+                if (ErrorIsWouldBlock(error)) // Filter would block messages
+                {
+                    return 0;
+                }
+
+                AZLOG_ERROR("Failed to batch read from socket (%d:%s)", error, GetNetworkErrorDesc(error));
+                return SocketOpResultError;
+            }
+
+            uint32_t validCount = 0;
+            for (int32_t i = 0; i < receivedCount; ++i)
+            {
+                outEntries[i].m_address = IpAddress(ByteOrder::Network, fromAddresses[i].sin_addr.s_addr, fromAddresses[i].sin_port);
+                if ((messages[i].msg_hdr.msg_flags & MSG_TRUNC) != 0)
+                {
+                    // The datagram didn't fit its receive slot and was cut off by the kernel, drop it rather than hand on a partial packet
+                    outEntries[i].m_receivedBytes = 0;
+                    ++m_recvTruncatedPackets;
+                    continue;
+                }
+                outEntries[i].m_receivedBytes = aznumeric_cast<int32_t>(messages[i].msg_len);
+                m_recvBytes += messages[i].msg_len;
+                ++validCount;
+            }
+            m_recvPackets += validCount;
+            return receivedCount;
+        }
+#endif
+
+        int32_t receivedCount = 0;
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            ReceiveEntry& entry = outEntries[i];
+            entry.m_receivedBytes = Receive(entry.m_address, entry.m_buffer, entry.m_bufferSize);
+            if (entry.m_receivedBytes <= 0)
+            {
+                return ((entry.m_receivedBytes < 0) && (receivedCount == 0)) ? entry.m_receivedBytes : receivedCount;
+            }
+            ++receivedCount;
+        }
+        return receivedCount;
+    }
+
+    bool UdpSocket::SetBatchedIoEnabled(bool enabled)
+    {
+        if (!enabled)
+        {
+            FlushSends();
+            m_sendBatch.reset();
+            m_batchedIo = false;
+            return true;
+        }
+
+#if AZ_TRAIT_USE_SOCKET_BATCHED_IO
+        if (m_sendBatch == nullptr)
+        {
+            m_sendBatch = AZStd::make_unique<SendBatch>();
+        }
+        m_batchedIo = true;
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    uint32_t UdpSocket::FlushSends() const
+    {
+        if ((m_sendBatch == nullptr) || (m_sendBatch->m_count == 0))
+        {
+            return 0;
+        }
+
+        SendBatch& batch = *m_sendBatch;
+        uint32_t flushedCount = 0;
+
+#if AZ_TRAIT_USE_SOCKET_BATCHED_IO
+        mmsghdr messages[MaxBatchedIoCount];
+        iovec ioVectors[MaxBatchedIoCount];
+        sockaddr_in destAddresses[MaxBatchedIoCount];
+        memset(messages, 0, sizeof(mmsghdr) * batch.m_count);
+        memset(destAddresses, 0, sizeof(sockaddr_in) * batch.m_count);
+
+        for (uint32_t i = 0; i < batch.m_count; ++i)
+        {
+            destAddresses[i].sin_family = AF_INET;
+            destAddresses[i].sin_addr.s_addr = batch.m_addresses[i].GetAddress(ByteOrder::Network);
+            destAddresses[i].sin_port = batch.m_addresses[i].GetPort(ByteOrder::Network);
+            ioVectors[i].iov_base = batch.m_buffers[i].data();
+            ioVectors[i].iov_len = batch.m_sizes[i];
+            messages[i].msg_hdr.msg_name = &destAddresses[i];
+            messages[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+            messages[i].msg_hdr.msg_iov = &ioVectors[i];
+            messages[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        bool retryUnsent = false;
+        while (flushedCount < batch.m_count)
+        {
+            // sendmmsg may stop short of the full batch, resubmit from wherever it stopped
+            const int32_t sentCount = sendmmsg(static_cast<int32_t>(m_socketFd), messages + flushedCount, batch.m_count - flushedCount, 0);
+            if (sentCount <= 0)
+            {
+                const int32_t error = GetLastNetworkError();
+
+                if (ErrorIsWouldBlock(error))
+                {
+                    // The send buffer is full, keep the rest of the batch for the next flush
+                    retryUnsent = true;
+                }
+                else
+                {
+                    AZLOG_ERROR("Failed to batch write to socket, dropping %u packets (%d:%s)",
+                        batch.m_count - flushedCount, error, GetNetworkErrorDesc(error));
+                }
+                break;
+            }
+            for (int32_t i = 0; i < sentCount; ++i)
+            {
+                m_sentBytes += messages[flushedCount + i].msg_len;
+            }
+            m_sentPackets += aznumeric_cast<uint32_t>(sentCount);
+            flushedCount += aznumeric_cast<uint32_t>(sentCount);
+        }
+
+        if (retryUnsent && (flushedCount > 0))
+        {
+            for (uint32_t i = flushedCount; i < batch.m_count; ++i)
+            {
+                const uint32_t index = i - flushedCount;
+                batch.m_addresses[index] = batch.m_addresses[i];
+                batch.m_sizes[index] = batch.m_sizes[i];
+                memcpy(batch.m_buffers[index].data(), batch.m_buffers[i].data(), batch.m_sizes[i]);
+            }
+        }
+        batch.m_count = retryUnsent ? batch.m_count - flushedCount : 0;
+#else
+        batch.m_count = 0;
+#endif
+
+        return flushedCount;
+    }
+
+    int32_t UdpSocket::QueueSend(const IpAddress& address, const uint8_t* data, uint32_t size) const
+    {
+        if (m_sendBatch->m_count >= MaxBatchedIoCount)
+        {
+            FlushSends();
+            if (m_sendBatch->m_count >= MaxBatchedIoCount)
+            {
+                // Still blocked, drop the packet just like an unbatched send that would block
+                return SocketOpResultSuccess;
+            }
+        }
+
+        SendBatch& batch = *m_sendBatch;
+        const uint32_t index = batch.m_count++;
+        batch.m_addresses[index] = address;
+        batch.m_sizes[index] = size;
+        memcpy(batch.m_buffers[index].data(), data, size);
+        return aznumeric_cast<int32_t>(size);
+    }
+
     int32_t UdpSocket::SendInternal(const IpAddress& address, const uint8_t* data, uint32_t size,
         [[maybe_unused]] bool encrypt, [[maybe_unused]] DtlsEndpoint& dtlsEndpoint) const
     {
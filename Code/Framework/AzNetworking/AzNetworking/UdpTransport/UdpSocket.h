@@ -13,7 +13,9 @@
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzNetworking/UdpTransport/DtlsEndpoint.h>
 #include <AzCore/Math/Random.h>
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 
 #ifndef _RELEASE
 #   define ENABLE_LATENCY_DEBUG 1
@@ -42,6 +44,18 @@ namespace AzNetworking
             True   // Socket can accept incoming connections and may require a valid certificate and private key file
         };
 
+        //! Maximum number of datagrams transferred by a single batched send or receive system call.
+        static constexpr uint32_t MaxBatchedIoCount = 64;
+
+        //! A single receive slot used by ReceiveBatch.
+        struct ReceiveEntry
+        {
+            IpAddress m_address;
+            uint8_t*  m_buffer = nullptr;
+            uint32_t  m_bufferSize = 0;
+            int32_t   m_receivedBytes = 0;
+        };
+
         UdpSocket() = default;
         virtual ~UdpSocket();
 
@@ -93,6 +107,30 @@ namespace AzNetworking
         //! @return number of bytes received, <= 0 on error
         int32_t Receive(IpAddress& outAddress, uint8_t* outData, uint32_t size) const;
 
+        //! Receives up to count payloads from the UDP socket.
+        //! If batched IO is enabled this uses a single system call for the whole batch, otherwise it falls back to repeated calls to Receive.
+        //! @param outEntries array of receive slots, each slot provides the buffer to write to and receives the sender address and size
+        //! @param count      the number of receive slots available in outEntries
+        //! @return number of receive slots used, < 0 on error. Slots of dropped packets have m_receivedBytes set to 0
+        int32_t ReceiveBatch(ReceiveEntry* outEntries, uint32_t count) const;
+
+        //! Enables or disables batched socket IO.
+        //! While enabled, unencrypted payloads passed to Send are queued and transmitted together on FlushSends, and ReceiveBatch
+        //! reads multiple datagrams per system call. This must be configured before the socket is registered with a UdpReaderThread.
+        //! @param enabled true to enable batched IO
+        //! @return boolean true if the requested mode is supported on this platform
+        bool SetBatchedIoEnabled(bool enabled);
+
+        //! Returns true if batched socket IO is enabled on this socket.
+        //! @return boolean true if batched socket IO is enabled on this socket
+        bool IsBatchedIoEnabled() const;
+
+        //! Transmits all payloads queued by Send while batched IO is enabled.
+        //! Sent packet and byte counts only include the packets the operating system accepted. If the socket would block,
+        //! the packets that weren't accepted stay queued and are retried on the next flush.
+        //! @return number of packets handed off to the operating system
+        uint32_t FlushSends() const;
+
         //! Returns the underlying socket file descriptor.
         //! @return the underlying socket file descriptor
         SocketFd GetSocketFd() const;
@@ -121,6 +159,10 @@ namespace AzNetworking
         //! @return the total number of bytes received on this socket
         uint32_t GetRecvBytes() const;
 
+        //! Returns the total number of packets dropped by ReceiveBatch because they didn't fit their receive buffer.
+        //! @return the total number of truncated packets dropped on this socket
+        uint32_t GetRecvTruncatedPackets() const;
+
     protected:
 
         mutable uint32_t m_sentPacketsEncrypted = 0;
@@ -130,11 +172,29 @@ namespace AzNetworking
 
     private:
 
+        //! Queues a payload for transmission on the next call to FlushSends.
+        //! @param address the address to send the payload to
+        //! @param data    pointer to the data to send
+        //! @param size    size of the payload in bytes
+        //! @return number of bytes queued
+        int32_t QueueSend(const IpAddress& address, const uint8_t* data, uint32_t size) const;
+
+        struct SendBatch
+        {
+            AZStd::array<IpAddress, MaxBatchedIoCount> m_addresses;
+            AZStd::array<uint32_t, MaxBatchedIoCount> m_sizes;
+            AZStd::array<AZStd::array<uint8_t, MaxUdpTransmissionUnit>, MaxBatchedIoCount> m_buffers;
+            uint32_t m_count = 0;
+        };
+
         SocketFd m_socketFd = InvalidSocketFd;
+        bool m_batchedIo = false;
+        mutable AZStd::unique_ptr<SendBatch> m_sendBatch;
         mutable uint32_t m_sentPackets = 0;
         mutable uint32_t m_sentBytes = 0;
         mutable uint32_t m_recvPackets = 0;
         mutable uint32_t m_recvBytes = 0;
+        mutable uint32_t m_recvTruncatedPackets = 0;
 
 #ifdef ENABLE_LATENCY_DEBUG
         struct DeferredData
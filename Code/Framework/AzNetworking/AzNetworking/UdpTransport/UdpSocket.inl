@@ -15,6 +15,11 @@ namespace AzNetworking
         return (m_socketFd > SocketFd{ 0 });
     }
 
+    inline bool UdpSocket::IsBatchedIoEnabled() const
+    {
+        return m_batchedIo;
+    }
+
     inline SocketFd UdpSocket::GetSocketFd() const
     {
         return m_socketFd;
@@ -49,4 +54,9 @@ namespace AzNetworking
     {
         return m_recvBytes;
     }
+
+    inline uint32_t UdpSocket::GetRecvTruncatedPackets() const
+    {
+        return m_recvTruncatedPackets;
+    }
 }
@@ -11,4 +11,25 @@
 
 namespace UnitTest
 {
+    TEST(FixedSizeVectorBitset, TestEquality)
+    {
+        AzNetworking::FixedSizeVectorBitset<128> lhs;
+        AzNetworking::FixedSizeVectorBitset<128> rhs;
+        lhs.Resize(40);
+        rhs.Resize(40);
+        EXPECT_TRUE(lhs == rhs);
+
+        lhs.SetBit(33, true);
+        EXPECT_TRUE(lhs != rhs);
+
+        rhs.SetBit(33, true);
+        EXPECT_TRUE(lhs == rhs);
+
+        // Bitsets of differing sizes are never equal, even when no bits are set
+        AzNetworking::FixedSizeVectorBitset<128> shorter;
+        shorter.Resize(8);
+        AzNetworking::FixedSizeVectorBitset<128> longer;
+        longer.Resize(16);
+        EXPECT_FALSE(shorter == longer);
+    }
 }
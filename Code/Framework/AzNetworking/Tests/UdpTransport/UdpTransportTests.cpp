@@ -9,6 +9,7 @@
 #include <AzNetworking/UdpTransport/UdpNetworkInterface.h>
 #include <AzNetworking/UdpTransport/UdpPacketTracker.h>
 #include <AzNetworking/UdpTransport/UdpPacketIdWindow.h>
+#include <AzNetworking/UdpTransport/UdpSocket.h>
 #include <AzNetworking/ConnectionLayer/IConnectionListener.h>
 #include <AzNetworking/Framework/NetworkingSystemComponent.h>
 #include <AzNetworking/AutoGen/CorePackets.AutoPackets.h>
@@ -299,4 +300,196 @@ namespace UnitTest
             EXPECT_EQ(testClient[i].m_clientNetworkInterface->GetConnectionSet().GetConnectionCount(), 1);
         }
     }
+
+    TEST_F(UdpTransportTests, BatchedSocketIo)
+    {
+        constexpr uint16_t TestPort = 12346;
+        constexpr uint32_t NumTestPackets = 100;
+
+        UdpSocket sendSocket;
+        UdpSocket recvSocket;
+        const bool batchedIoSupported = sendSocket.SetBatchedIoEnabled(true);
+        EXPECT_EQ(recvSocket.SetBatchedIoEnabled(true), batchedIoSupported);
+        EXPECT_EQ(sendSocket.IsBatchedIoEnabled(), batchedIoSupported);
+
+        EXPECT_TRUE(sendSocket.Open(0, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer));
+        EXPECT_TRUE(recvSocket.Open(TestPort, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer));
+
+        DtlsEndpoint dtlsEndpoint;
+        const ConnectionQuality connectionQuality;
+        const IpAddress recvAddress(127, 0, 0, 1, TestPort);
+        for (uint32_t i = 0; i < NumTestPackets; ++i)
+        {
+            const uint8_t payload[sizeof(uint32_t)] = { uint8_t(i), uint8_t(i >> 8), 0, 0 };
+            EXPECT_EQ(sendSocket.Send(recvAddress, payload, sizeof(payload), false, dtlsEndpoint, connectionQuality), int32_t(sizeof(payload)));
+        }
+        // Full batches are flushed while queuing, the remainder isn't counted until it has actually been sent
+        const uint32_t queuedPackets = batchedIoSupported ? NumTestPackets % UdpSocket::MaxBatchedIoCount : 0;
+        EXPECT_EQ(sendSocket.GetSentPackets(), NumTestPackets - queuedPackets);
+        EXPECT_EQ(sendSocket.FlushSends(), queuedPackets);
+        EXPECT_EQ(sendSocket.GetSentPackets(), NumTestPackets);
+        EXPECT_EQ(sendSocket.GetSentBytes(), NumTestPackets * sizeof(uint32_t));
+
+        uint8_t recvBuffer[UdpSocket::MaxBatchedIoCount][MaxUdpTransmissionUnit];
+        UdpSocket::ReceiveEntry entries[UdpSocket::MaxBatchedIoCount];
+        for (uint32_t i = 0; i < UdpSocket::MaxBatchedIoCount; ++i)
+        {
+            entries[i].m_buffer = recvBuffer[i];
+            entries[i].m_bufferSize = MaxUdpTransmissionUnit;
+        }
+
+        uint32_t receivedPackets = 0;
+        const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+        while ((receivedPackets < NumTestPackets) && (AZ::GetElapsedTimeMs() - startTimeMs < AZ::TimeMs{ 1000 }))
+        {
+            const int32_t receivedCount = recvSocket.ReceiveBatch(entries, UdpSocket::MaxBatchedIoCount);
+            EXPECT_GE(receivedCount, 0);
+            for (int32_t i = 0; i < receivedCount; ++i)
+            {
+                EXPECT_EQ(entries[i].m_receivedBytes, int32_t(sizeof(uint32_t)));
+                EXPECT_EQ(entries[i].m_buffer[0], uint8_t(receivedPackets));
+                ++receivedPackets;
+            }
+        }
+
+        EXPECT_EQ(receivedPackets, NumTestPackets);
+        EXPECT_EQ(recvSocket.GetRecvPackets(), NumTestPackets);
+    }
+
+    TEST_F(UdpTransportTests, BatchedSocketIoDropsTruncatedPackets)
+    {
+        constexpr uint16_t TestPort = 12347;
+        constexpr uint32_t PayloadSize = 200;
+        constexpr uint32_t RecvBufferSize = 64;
+
+        UdpSocket sendSocket;
+        UdpSocket recvSocket;
+        if (!recvSocket.SetBatchedIoEnabled(true))
+        {
+            GTEST_SKIP() << "Batched socket IO is not supported on this platform";
+        }
+
+        EXPECT_TRUE(sendSocket.Open(0, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer));
+        EXPECT_TRUE(recvSocket.Open(TestPort, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer));
+
+        DtlsEndpoint dtlsEndpoint;
+        const ConnectionQuality connectionQuality;
+        const IpAddress recvAddress(127, 0, 0, 1, TestPort);
+        const uint8_t payload[PayloadSize] = {};
+        EXPECT_EQ(sendSocket.Send(recvAddress, payload, sizeof(payload), false, dtlsEndpoint, connectionQuality), int32_t(sizeof(payload)));
+
+        uint8_t recvBuffer[RecvBufferSize];
+        UdpSocket::ReceiveEntry entry;
+        entry.m_buffer = recvBuffer;
+        entry.m_bufferSize = RecvBufferSize;
+
+        int32_t receivedCount = 0;
+        const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+        while ((receivedCount == 0) && (AZ::GetElapsedTimeMs() - startTimeMs < AZ::TimeMs{ 1000 }))
+        {
+            receivedCount = recvSocket.ReceiveBatch(&entry, 1);
+            EXPECT_GE(receivedCount, 0);
+        }
+
+        // The truncated datagram uses its receive slot but is reported as empty and isn't counted as received
+        EXPECT_EQ(receivedCount, 1);
+        EXPECT_EQ(entry.m_receivedBytes, 0);
+        EXPECT_EQ(recvSocket.GetRecvTruncatedPackets(), 1u);
+        EXPECT_EQ(recvSocket.GetRecvPackets(), 0u);
+    }
+}
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    using namespace AzNetworking;
+
+    class UdpSocketBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        using UnitTest::AllocatorsBenchmarkFixture::SetUp;
+        using UnitTest::AllocatorsBenchmarkFixture::TearDown;
+
+        void SetUp(benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            AzNetworking::SocketLayerInit();
+
+            const bool batchedIo = state.range(0) != 0;
+            m_sendSocket = AZStd::make_unique<UdpSocket>();
+            m_recvSocket = AZStd::make_unique<UdpSocket>();
+            m_sendSocket->SetBatchedIoEnabled(batchedIo);
+            m_recvSocket->SetBatchedIoEnabled(batchedIo);
+            m_sendSocket->Open(0, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer);
+            m_recvSocket->Open(TestPort, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer);
+
+            for (uint32_t i = 0; i < UdpSocket::MaxBatchedIoCount; ++i)
+            {
+                m_entries[i].m_buffer = m_recvBuffer[i];
+                m_entries[i].m_bufferSize = MaxUdpTransmissionUnit;
+            }
+        }
+
+        void TearDown(benchmark::State& state) override
+        {
+            m_sendSocket.reset();
+            m_recvSocket.reset();
+            AzNetworking::SocketLayerShutdown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        //! Sends and drains a burst of packets over loopback, returns the number of packets received.
+        uint32_t TransferBurst(uint32_t packetCount)
+        {
+            for (uint32_t i = 0; i < packetCount; ++i)
+            {
+                m_sendSocket->Send(m_recvAddress, m_payload, sizeof(m_payload), false, m_dtlsEndpoint, m_connectionQuality);
+            }
+            m_sendSocket->FlushSends();
+
+            uint32_t receivedPackets = 0;
+            for (uint32_t attempts = 0; (receivedPackets < packetCount) && (attempts < packetCount); ++attempts)
+            {
+                const int32_t receivedCount = m_recvSocket->ReceiveBatch(m_entries, UdpSocket::MaxBatchedIoCount);
+                if (receivedCount <= 0)
+                {
+                    break;
+                }
+                receivedPackets += aznumeric_cast<uint32_t>(receivedCount);
+            }
+            return receivedPackets;
+        }
+
+    private:
+        static constexpr uint16_t TestPort = 12347;
+
+        AZStd::unique_ptr<UdpSocket> m_sendSocket;
+        AZStd::unique_ptr<UdpSocket> m_recvSocket;
+        DtlsEndpoint m_dtlsEndpoint;
+        ConnectionQuality m_connectionQuality;
+        IpAddress m_recvAddress = IpAddress(127, 0, 0, 1, TestPort);
+        uint8_t m_payload[256] = {};
+        uint8_t m_recvBuffer[UdpSocket::MaxBatchedIoCount][MaxUdpTransmissionUnit];
+        UdpSocket::ReceiveEntry m_entries[UdpSocket::MaxBatchedIoCount];
+    };
+
+    BENCHMARK_DEFINE_F(UdpSocketBenchmark, LoopbackThroughput)(benchmark::State& state)
+    {
+        const uint32_t burstSize = aznumeric_cast<uint32_t>(state.range(1));
+        int64_t totalPackets = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            totalPackets += TransferBurst(burstSize);
+        }
+        state.counters["PacketsPerSecond"] = benchmark::Counter(aznumeric_cast<double>(totalPackets), benchmark::Counter::kIsRate);
+    }
+
+    // First argument toggles batched IO, second is the number of packets transmitted per iteration
+    BENCHMARK_REGISTER_F(UdpSocketBenchmark, LoopbackThroughput)
+        ->ArgNames({ "Batched", "Burst" })
+        ->Args({ 0, 1 })->Args({ 0, 16 })->Args({ 0, 64 })
+        ->Args({ 1, 1 })->Args({ 1, 16 })->Args({ 1, 64 })
+        ->Unit(benchmark::kMicrosecond);
 }
+#endif // HAVE_BENCHMARK
@@ -16,6 +16,7 @@
 
 #include <AzFramework/Application/Application.h>
 #include <AzFramework/Components/TransformComponent.h>
+#include <AzFramework/Components/TransformHierarchySystem.h>
 
 #include <AzToolsFramework/Application/ToolsApplication.h>
 #include <AzToolsFramework/ToolsComponents/TransformComponent.h>
@@ -723,6 +724,130 @@ namespace UnitTest
         EXPECT_TRUE(actualChildWorldPos == expectedChildLocalPos);
     }
 
+    // Fixture provides a parent and child entity whose TransformComponent stores the transforms in the transform hierarchy.
+    class TransformComponentTransformHierarchy
+        : public TransformComponentApplication
+        , public TransformNotificationBus::MultiHandler
+    {
+    protected:
+        void SetUp() override
+        {
+            TransformComponentApplication::SetUp();
+
+            m_transformHierarchySystem = AZStd::make_unique<TransformHierarchySystem>();
+            m_transformHierarchySystem->Connect();
+
+            TransformConfig parentConfig(Transform::CreateTranslation(Vector3(1.0f, 0.0f, 0.0f)));
+            parentConfig.m_useTransformHierarchy = true;
+            m_parentEntity = aznew Entity("Parent");
+            m_parentId = m_parentEntity->GetId();
+            m_parentEntity->Init();
+            m_parentEntity->CreateComponent<TransformComponent>()->SetConfiguration(parentConfig);
+
+            TransformConfig childConfig(Transform::CreateTranslation(Vector3(0.0f, 2.0f, 0.0f)));
+            childConfig.m_parentId = m_parentId;
+            childConfig.m_useTransformHierarchy = true;
+            m_childEntity = aznew Entity("Child");
+            m_childId = m_childEntity->GetId();
+            m_childEntity->Init();
+            m_childEntity->CreateComponent<TransformComponent>()->SetConfiguration(childConfig);
+
+            m_parentEntity->Activate();
+            m_childEntity->Activate();
+            m_transformHierarchySystem->ProcessTransformChanges();
+
+            TransformNotificationBus::MultiHandler::BusConnect(m_parentId);
+            TransformNotificationBus::MultiHandler::BusConnect(m_childId);
+        }
+
+        void TearDown() override
+        {
+            TransformNotificationBus::MultiHandler::BusDisconnect();
+
+            m_childEntity->Deactivate();
+            m_parentEntity->Deactivate();
+            delete m_childEntity;
+            delete m_parentEntity;
+
+            m_transformHierarchySystem->Disconnect();
+            m_transformHierarchySystem.reset();
+
+            TransformComponentApplication::TearDown();
+        }
+
+        // TransformNotificationBus
+        void OnTransformChanged([[maybe_unused]] const Transform& local, [[maybe_unused]] const Transform& world) override
+        {
+            ++m_transformChangedCount;
+        }
+
+        AZStd::unique_ptr<TransformHierarchySystem> m_transformHierarchySystem;
+        Entity* m_parentEntity = nullptr;
+        EntityId m_parentId = EntityId();
+        Entity* m_childEntity = nullptr;
+        EntityId m_childId = EntityId();
+        int m_transformChangedCount = 0;
+    };
+
+    TEST_F(TransformComponentTransformHierarchy, Activate_ParentAndChild_TransformsAreStoredInHierarchy)
+    {
+        EXPECT_TRUE(m_transformHierarchySystem->IsEntityAdded(m_parentId));
+        EXPECT_TRUE(m_transformHierarchySystem->IsEntityAdded(m_childId));
+
+        Vector3 childWorldPos;
+        TransformBus::EventResult(childWorldPos, m_childId, &TransformBus::Events::GetWorldTranslation);
+        EXPECT_THAT(childWorldPos, IsClose(Vector3(1.0f, 2.0f, 0.0f)));
+        EXPECT_THAT(m_transformHierarchySystem->GetWorldTM(m_childId).GetTranslation(), IsClose(Vector3(1.0f, 2.0f, 0.0f)));
+    }
+
+    TEST_F(TransformComponentTransformHierarchy, SetLocalTranslation_MovedParent_ChildIsReadFromHierarchyBeforeProcessing)
+    {
+        TransformBus::Event(m_parentId, &TransformBus::Events::SetLocalTranslation, Vector3(5.0f, 0.0f, 0.0f));
+
+        Vector3 childWorldPos;
+        TransformBus::EventResult(childWorldPos, m_childId, &TransformBus::Events::GetWorldTranslation);
+        EXPECT_THAT(childWorldPos, IsClose(Vector3(5.0f, 2.0f, 0.0f)));
+        EXPECT_EQ(m_transformChangedCount, 0);
+    }
+
+    TEST_F(TransformComponentTransformHierarchy, ProcessTransformChanges_MultipleMoves_EachEntityIsNotifiedOnce)
+    {
+        TransformBus::Event(m_parentId, &TransformBus::Events::SetLocalTranslation, Vector3(5.0f, 0.0f, 0.0f));
+        TransformBus::Event(m_parentId, &TransformBus::Events::SetLocalTranslation, Vector3(6.0f, 0.0f, 0.0f));
+        TransformBus::Event(m_childId, &TransformBus::Events::SetLocalTranslation, Vector3(0.0f, 3.0f, 0.0f));
+
+        m_transformHierarchySystem->ProcessTransformChanges();
+
+        EXPECT_EQ(m_transformChangedCount, 2);
+        Transform childWorldTM = Transform::CreateIdentity();
+        TransformBus::EventResult(childWorldTM, m_childId, &TransformBus::Events::GetWorldTM);
+        EXPECT_THAT(childWorldTM.GetTranslation(), IsClose(Vector3(6.0f, 3.0f, 0.0f)));
+    }
+
+    TEST_F(TransformComponentTransformHierarchy, SetParent_Null_ChildKeepsWorldTransform)
+    {
+        TransformBus::Event(m_childId, &TransformBus::Events::SetParent, EntityId());
+        TransformBus::Event(m_parentId, &TransformBus::Events::SetLocalTranslation, Vector3(5.0f, 0.0f, 0.0f));
+        m_transformHierarchySystem->ProcessTransformChanges();
+
+        Vector3 childWorldPos;
+        TransformBus::EventResult(childWorldPos, m_childId, &TransformBus::Events::GetWorldTranslation);
+        EXPECT_THAT(childWorldPos, IsClose(Vector3(1.0f, 2.0f, 0.0f)));
+    }
+
+    TEST_F(TransformComponentTransformHierarchy, Deactivate_MovedEntity_LastTransformIsKept)
+    {
+        TransformBus::Event(m_childId, &TransformBus::Events::SetLocalTranslation, Vector3(0.0f, 3.0f, 0.0f));
+        m_childEntity->Deactivate();
+
+        EXPECT_FALSE(m_transformHierarchySystem->IsEntityAdded(m_childId));
+        TransformConfig childConfig;
+        m_childEntity->FindComponent<TransformComponent>()->GetConfiguration(childConfig);
+        EXPECT_THAT(childConfig.m_worldTransform.GetTranslation(), IsClose(Vector3(1.0f, 3.0f, 0.0f)));
+
+        m_childEntity->Activate();
+    }
+
     // Fixture provides TransformComponent that is static (or not static) on an entity that has been activated.
     template<bool IsStatic>
     class StaticOrMovableTransformComponent
@@ -892,6 +1017,7 @@ namespace UnitTest
         return lhs.m_parentId == rhs.m_parentId
             && lhs.m_parentActivationTransformMode == rhs.m_parentActivationTransformMode
             && lhs.m_isStatic == rhs.m_isStatic
+            && lhs.m_useTransformHierarchy == rhs.m_useTransformHierarchy
             && lhs.m_localTransform == rhs.m_localTransform
             && lhs.m_worldTransform == rhs.m_worldTransform
             ;
@@ -920,6 +1046,7 @@ namespace UnitTest
             config.m_interpolatePosition = (m_random.GetRandom() % 2) == 1 ? InterpolationMode::NoInterpolation : InterpolationMode::LinearInterpolation;
             config.m_interpolateRotation = (m_random.GetRandom() % 2) == 1 ? InterpolationMode::NoInterpolation : InterpolationMode::LinearInterpolation;
             config.m_isStatic = (m_random.GetRandom() % 2) == 1;
+            config.m_useTransformHierarchy = (m_random.GetRandom() % 2) == 1;
 
             return config;
         }
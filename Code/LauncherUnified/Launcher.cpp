@@ -504,6 +504,7 @@ namespace O3DELauncher
 
         const AZStd::string_view buildTargetName = GetBuildTargetName();
         AZ::SettingsRegistryMergeUtils::MergeSettingsToRegistry_AddBuildSystemTargetSpecialization(*settingsRegistry, buildTargetName);
+        AZ::SettingsRegistryMergeUtils::ConfigureMergeCache(*settingsRegistry, true);
 
         AZ_TracePrintf("Launcher", R"(Running project "%.*s")" "\n"
             R"(The project name has been successfully set in the Settings Registry at key "%s/project_name")"
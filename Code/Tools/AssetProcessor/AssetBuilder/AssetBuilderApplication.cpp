@@ -93,6 +93,8 @@ AssetBuilderApplication::AssetBuilderApplication(int* argc, char*** argv)
     auto settingsRegistry = AZ::SettingsRegistry::Get();
     AZ::SettingsRegistryMergeUtils::MergeSettingsToRegistry_AddBuildSystemTargetSpecialization(
         *settingsRegistry, AssetBuilder::GetBuildTargetName());
+    // A builder process is started for every batch of jobs, so it benefits from caching the parsed registry folders
+    AZ::SettingsRegistryMergeUtils::ConfigureMergeCache(*settingsRegistry, true);
 
     AZ::Interface<IBuilderApplication>::Register(this);
 }
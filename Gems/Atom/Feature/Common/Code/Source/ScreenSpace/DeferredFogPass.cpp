@@ -189,12 +189,12 @@ namespace AZ
             RPI::ShaderOptionGroup shaderOption = m_shader->CreateShaderOptionGroup();
             DeferredFogSettings* fogSettings = GetPassFogSettings();
 
-            // [TODO][ATOM-13659] - AZ::Name all over our code base should use init with string and
-            // hash key for the iterations themselves.
-            shaderOption.SetValue(AZ::Name("o_enableFogLayer"),
-                fogSettings->GetEnableFogLayerShaderOption() ? AZ::Name("true") : AZ::Name("false"));
-            shaderOption.SetValue(AZ::Name("o_useNoiseTexture"),
-                fogSettings->GetUseNoiseTextureShaderOption() ? AZ::Name("true") : AZ::Name("false"));
+            const AZ::NameLiteral& trueValue = AZ_NAME_LITERAL("true");
+            const AZ::NameLiteral& falseValue = AZ_NAME_LITERAL("false");
+            shaderOption.SetValue(AZ_NAME_LITERAL("o_enableFogLayer"),
+                fogSettings->GetEnableFogLayerShaderOption() ? trueValue : falseValue);
+            shaderOption.SetValue(AZ_NAME_LITERAL("o_useNoiseTexture"),
+                fogSettings->GetUseNoiseTextureShaderOption() ? trueValue : falseValue);
 
             // The following method returns the specified options, as well as fall back values for all 
             // non-specified options.  If all were set you can use the method GetShaderVariantKey that is 
@@ -294,6 +294,8 @@ namespace AZ
                 , m_jobData(jobData)
                 , m_worklist(worklist)
             {
+                //the frame can't be submitted until culling is done
+                SetPriorityClass(AZ::JobPriorityClass::Critical);
             }
 
             //work function
@@ -309,7 +311,8 @@ namespace AZ
                 for (const AzFramework::IVisibilityScene::NodeData& nodeData : m_worklist)
                 {
                     //If a node is entirely contained within the frustum, then we can skip the fine grained culling.
-                    bool nodeIsContainedInFrustum = ShapeIntersection::Contains(m_jobData->m_frustum, nodeData.m_bounds);
+                    //The visibility scene already flags nodes below a fully contained ancestor, so only the others need testing.
+                    bool nodeIsContainedInFrustum = nodeData.m_isContained || ShapeIntersection::Contains(m_jobData->m_frustum, nodeData.m_bounds);
 
 #ifdef AZ_CULL_PROFILE_VERBOSE
                     AZ_PROFILE_SCOPE_DYNAMIC(Debug::ProfileCategory::AzRender, "process node (view: %s, skip fine cull: %d",
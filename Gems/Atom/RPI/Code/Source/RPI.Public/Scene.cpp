@@ -507,6 +507,7 @@ namespace AZ
                             m_cullingScene->ProcessCullables(*this, *viewPtr, thisJob);
                         },
                         true, nullptr); //auto-deletes
+                    processCullablesJob->SetPriorityClass(AZ::JobPriorityClass::Critical);
                     if (m_cullingScene->GetDebugContext().m_parallelOctreeTraversal)
                     {
                         processCullablesJob->SetDependent(collectDrawPacketsCompletion);
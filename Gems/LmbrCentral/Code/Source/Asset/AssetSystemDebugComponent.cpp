@@ -25,6 +25,9 @@ namespace LmbrCentral
     AZ_CVAR(std::uint8_t, cl_assetStatusDebugDisplayCount, 20, nullptr, AZ::ConsoleFunctorFlags::Null,
         "Sets the max number of assets to record and display in debug stats.  This will only update after more assets have loaded.");
 
+    AZ_CVAR(bool, cl_assetStatusDebugContainers, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Print how long each asset container took from the load request until it and all of its dependencies were ready.");
+
     void AssetSystemDebugComponent::Activate()
     {
         BusConnect();
@@ -218,6 +221,15 @@ namespace LmbrCentral
         }
     }
 
+    void AssetSystemDebugComponent::AssetContainerReady(AZ::Data::AssetId id, AZStd::chrono::milliseconds timeToReady)
+    {
+        if (cl_assetStatusDebugContainers)
+        {
+            AZ_TracePrintf("AssetSystemDebug", "Asset container %s ready after %lld ms\n",
+                id.ToString<AZStd::string>().c_str(), static_cast<long long>(timeToReady.count()));
+        }
+    }
+
     void AssetSystemDebugComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
     {
         provided.push_back(AZ_CRC_CE("AssetSystemDebug"));
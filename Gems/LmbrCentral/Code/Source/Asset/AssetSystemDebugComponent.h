@@ -40,6 +40,7 @@ namespace LmbrCentral
         // IDebugAssetEvent
         void AssetStatusUpdate(AZ::Data::AssetId id, AZ::Data::AssetData::AssetStatus status) override;
         void ReleaseAsset(AZ::Data::AssetId id) override;
+        void AssetContainerReady(AZ::Data::AssetId id, AZStd::chrono::milliseconds timeToReady) override;
         //////////////////////////////////////////////////////////////////////////
 
         /// \ref ComponentDescriptor::GetProvidedServices
@@ -40,9 +40,15 @@ namespace Multiplayer
         virtual EntityReplicationManager& GetReplicationManager() = 0;
 
         //! Creates and manages sending updates to the remote endpoint.
+        //! Entities pending activation on the replication manager are expected to have been activated by the caller beforehand.
         //! @param hostTimeMs current server game time in milliseconds
         virtual void Update(AZ::TimeMs hostTimeMs) = 0;
 
+        //! Generates the update messages for the remote endpoint ahead of Update, without sending them.
+        //! Connections prepare independently of one another, so this may be invoked from a job for several connections at once.
+        //! @param hostTimeMs current server game time in milliseconds
+        virtual void PrepareUpdates(AZ::TimeMs hostTimeMs) = 0;
+
         //! Returns whether update messages can be sent to the connection.
         //! @return true if update messages can be sent
         virtual bool CanSendUpdates() const = 0;
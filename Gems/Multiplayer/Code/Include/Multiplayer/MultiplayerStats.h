@@ -26,6 +26,10 @@ namespace Multiplayer
         uint64_t m_clientConnectionCount = 0;
         uint64_t m_serverConnectionCount = 0;
 
+        // Number of property deltas reused from, or serialized into, the shared per tick serialization cache
+        uint64_t m_serializationCacheHits = 0;
+        uint64_t m_serializationCacheMisses = 0;
+
         uint64_t m_recordMetricIndex = 0;
         AZ::TimeMs m_totalHistoryTimeMs = AZ::TimeMs{ 0 };
 
@@ -49,9 +53,29 @@ namespace Multiplayer
         };
         AZStd::vector<ComponentStats> m_componentStats;
 
+        struct DeferredPropertySent
+        {
+            NetComponentId m_netComponentId = InvalidNetComponentId;
+            PropertyIndex m_propertyId = PropertyIndex{ 0 };
+            uint32_t m_totalBytes = 0;
+        };
+        using DeferredPropertySentList = AZStd::vector<DeferredPropertySent>;
+
+        //! While in scope, property sent metrics recorded on the constructing thread are appended to the provided list instead of being applied.
+        //! This allows property updates to be serialized off the main thread, the buffered metrics are applied later using ApplyDeferredPropertySent.
+        class ScopedDeferPropertySent
+        {
+        public:
+            explicit ScopedDeferPropertySent(DeferredPropertySentList& deferredList);
+            ~ScopedDeferPropertySent();
+        private:
+            DeferredPropertySentList* m_previousList = nullptr;
+        };
+
         void ReserveComponentStats(NetComponentId netComponentId, uint16_t propertyCount, uint16_t rpcCount);
         void RecordPropertySent(NetComponentId netComponentId, PropertyIndex propertyId, uint32_t totalBytes);
         void RecordPropertyReceived(NetComponentId netComponentId, PropertyIndex propertyId, uint32_t totalBytes);
+        void ApplyDeferredPropertySent(const DeferredPropertySentList& deferredList);
         void RecordRpcSent(NetComponentId netComponentId, RpcIndex rpcId, uint32_t totalBytes);
         void RecordRpcReceived(NetComponentId netComponentId, RpcIndex rpcId, uint32_t totalBytes);
         void TickStats(AZ::TimeMs metricFrameTimeMs);
@@ -64,5 +88,9 @@ namespace Multiplayer
         Metric CalculateTotalPropertyUpdateRecvMetrics() const;
         Metric CalculateTotalRpcsSentMetrics() const;
         Metric CalculateTotalRpcsRecvMetrics() const;
+
+        //! Returns the fraction of serialized property deltas that were reused from the shared serialization cache.
+        //! @return the cache hit rate in the range [0, 1], 0 if nothing has been serialized
+        float CalculateSerializationCacheHitRate() const;
     };
 }
@@ -55,6 +55,12 @@ namespace Multiplayer
         void Subtract(const ReplicationRecord &rhs);
         bool HasChanges() const;
 
+        //! Returns true if both records target the same remote role and contain the same dirty bits.
+        //! Consumed bit counts and the sent packet id are not considered.
+        //! @param rhs the record to compare against
+        //! @return boolean true if both records would serialize the same set of properties
+        bool HasSameChanges(const ReplicationRecord& rhs) const;
+
         bool Serialize(AzNetworking::ISerializer& serializer);
 
         void ConsumeAuthorityToClientBits(uint32_t consumedBits);
@@ -50,7 +50,11 @@ namespace Multiplayer
 
     void ClientToServerConnectionData::Update(AZ::TimeMs hostTimeMs)
     {
-        m_entityReplicationManager.ActivatePendingEntities();
         m_entityReplicationManager.SendUpdates(hostTimeMs);
     }
+
+    void ClientToServerConnectionData::PrepareUpdates([[maybe_unused]] AZ::TimeMs hostTimeMs)
+    {
+        m_entityReplicationManager.PrepareUpdates();
+    }
 }
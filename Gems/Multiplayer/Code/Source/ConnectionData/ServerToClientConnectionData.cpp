@@ -68,17 +68,29 @@ namespace Multiplayer
 
     void ServerToClientConnectionData::Update(AZ::TimeMs hostTimeMs)
     {
-        m_entityReplicationManager.ActivatePendingEntities();
+        if (ShouldSendUpdates() || m_entityReplicationManager.HasPreparedUpdates())
+        {
+            m_entityReplicationManager.SendUpdates(hostTimeMs);
+        }
+    }
 
+    void ServerToClientConnectionData::PrepareUpdates([[maybe_unused]] AZ::TimeMs hostTimeMs)
+    {
+        if (ShouldSendUpdates())
+        {
+            m_entityReplicationManager.PrepareUpdates();
+        }
+    }
+
+    bool ServerToClientConnectionData::ShouldSendUpdates() const
+    {
         if (CanSendUpdates())
         {
-            NetBindComponent* netBindComponent = m_controlledEntity.GetNetBindComponent();
+            const NetBindComponent* netBindComponent = m_controlledEntity.GetNetBindComponent();
             // potentially false if we just migrated the player, if that is the case, don't send any more updates
-            if (netBindComponent != nullptr && (netBindComponent->GetNetEntityRole() == NetEntityRole::Authority))
-            {
-                m_entityReplicationManager.SendUpdates(hostTimeMs);
-            }
+            return netBindComponent != nullptr && (netBindComponent->GetNetEntityRole() == NetEntityRole::Authority);
         }
+        return false;
     }
 
     void ServerToClientConnectionData::OnControlledEntityRemove()
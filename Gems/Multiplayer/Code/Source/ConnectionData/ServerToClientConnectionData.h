@@ -31,6 +31,7 @@ namespace Multiplayer
         AzNetworking::IConnection* GetConnection() const override;
         EntityReplicationManager& GetReplicationManager() override;
         void Update(AZ::TimeMs hostTimeMs) override;
+        void PrepareUpdates(AZ::TimeMs hostTimeMs) override;
         bool CanSendUpdates() const override;
         void SetCanSendUpdates(bool canSendUpdates) override;
         //! @}
@@ -41,6 +42,7 @@ namespace Multiplayer
         void SetProviderTicket(const AZStd::string&);
 
     private:
+        bool ShouldSendUpdates() const;
         void OnControlledEntityRemove();
         void OnControlledEntityMigration(const ConstNetworkEntityHandle& entityHandle, HostId remoteHostId, AzNetworking::ConnectionId connectionId);
         void OnGameplayStarted();
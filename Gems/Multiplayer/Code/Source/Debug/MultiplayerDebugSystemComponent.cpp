@@ -279,6 +279,7 @@ namespace Multiplayer
                 ImGui::Text("Total networked entities: %llu", aznumeric_cast<AZ::u64>(stats.m_entityCount));
                 ImGui::Text("Total client connections: %llu", aznumeric_cast<AZ::u64>(stats.m_clientConnectionCount));
                 ImGui::Text("Total server connections: %llu", aznumeric_cast<AZ::u64>(stats.m_serverConnectionCount));
+                ImGui::Text("Serialization cache hit rate: %.2f%%", stats.CalculateSerializationCacheHitRate() * 100.0f);
                 ImGui::NewLine();
 
                 static ImGuiTableFlags flags = ImGuiTableFlags_BordersV
@@ -10,6 +10,9 @@
 
 namespace Multiplayer
 {
+    // Set while a ScopedDeferPropertySent is alive on the current thread
+    static thread_local MultiplayerStats::DeferredPropertySentList* s_deferredPropertySent = nullptr;
+
     MultiplayerStats::Metric::Metric()
     {
         AZStd::uninitialized_fill_n(m_callHistory.data(), RingbufferSamples, 0);
@@ -29,8 +32,25 @@ namespace Multiplayer
         m_componentStats[netComponentIndex].m_rpcsRecv.resize(rpcCount);
     }
 
+    MultiplayerStats::ScopedDeferPropertySent::ScopedDeferPropertySent(DeferredPropertySentList& deferredList)
+        : m_previousList(s_deferredPropertySent)
+    {
+        s_deferredPropertySent = &deferredList;
+    }
+
+    MultiplayerStats::ScopedDeferPropertySent::~ScopedDeferPropertySent()
+    {
+        s_deferredPropertySent = m_previousList;
+    }
+
     void MultiplayerStats::RecordPropertySent(NetComponentId netComponentId, PropertyIndex propertyId, uint32_t totalBytes)
     {
+        if (s_deferredPropertySent != nullptr)
+        {
+            s_deferredPropertySent->push_back(DeferredPropertySent{ netComponentId, propertyId, totalBytes });
+            return;
+        }
+
         const uint16_t netComponentIndex = aznumeric_cast<uint16_t>(netComponentId);
         const uint16_t propertyIndex = aznumeric_cast<uint16_t>(propertyId);
         m_componentStats[netComponentIndex].m_propertyUpdatesSent[propertyIndex].m_totalCalls++;
@@ -49,6 +69,14 @@ namespace Multiplayer
         m_componentStats[netComponentIndex].m_propertyUpdatesRecv[propertyIndex].m_byteHistory[m_recordMetricIndex] += totalBytes;
     }
 
+    void MultiplayerStats::ApplyDeferredPropertySent(const DeferredPropertySentList& deferredList)
+    {
+        for (const DeferredPropertySent& deferred : deferredList)
+        {
+            RecordPropertySent(deferred.m_netComponentId, deferred.m_propertyId, deferred.m_totalBytes);
+        }
+    }
+
     void MultiplayerStats::RecordRpcSent(NetComponentId netComponentId, RpcIndex rpcId, uint32_t totalBytes)
     {
         const uint16_t netComponentIndex = aznumeric_cast<uint16_t>(netComponentId);
@@ -186,4 +214,14 @@ namespace Multiplayer
         }
         return result;
     }
+
+    float MultiplayerStats::CalculateSerializationCacheHitRate() const
+    {
+        const uint64_t totalLookups = m_serializationCacheHits + m_serializationCacheMisses;
+        if (totalLookups == 0)
+        {
+            return 0.0f;
+        }
+        return aznumeric_cast<float>(static_cast<double>(m_serializationCacheHits) / static_cast<double>(totalLookups));
+    }
 }
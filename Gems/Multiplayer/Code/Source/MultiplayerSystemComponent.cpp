@@ -22,6 +22,10 @@
 #include <AzCore/Component/TransformBus.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Math/ShapeIntersection.h>
 #include <AzCore/Asset/AssetCommon.h>
 #include <AzCore/Asset/AssetManagerBus.h>
@@ -81,6 +85,11 @@ namespace Multiplayer
     AZ_CVAR(bool, sv_isTransient, true, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Whether a dedicated server shuts down if all existing connections disconnect.");
     AZ_CVAR(AZ::TimeMs, cl_defaultNetworkEntityActivationTimeSliceMs, AZ::TimeMs{ 0 }, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Max Ms to use to activate entities coming from the network, 0 means instantiate everything");
     AZ_CVAR(AZ::TimeMs, sv_serverSendRateMs, AZ::TimeMs{ 50 }, nullptr, AZ::ConsoleFunctorFlags::Null, "Minimum number of milliseconds between each network update");
+    AZ_CVAR(bool, sv_replicationSpatialIndex, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "If true, server to client replication windows gather entities from a shared spatial grid rather than the visibility system");
+    AZ_CVAR(float, sv_replicationSpatialIndexCellSize, 128.0f, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The edge length of a single cell in the shared replication spatial grid");
+    AZ_CVAR(bool, sv_propertySerializationCache, true, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "If true, identical property deltas sent to several clients within a tick are serialized once and shared between connections");
+    AZ_CVAR(bool, sv_parallelReplication, true, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "If true, connections generate their entity update messages in parallel on the job system before sending them in order");
+    AZ_CVAR(uint32_t, sv_parallelReplicationMinConnections, 8, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The minimum number of connections before entity update messages are generated in parallel");
     AZ_CVAR(AZ::CVarFixedString, sv_defaultPlayerSpawnAsset, "prefabs/player.network.spawnable", nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The default spawnable to use when a new player connects");
 
     void MultiplayerSystemComponent::Reflect(AZ::ReflectContext* context)
@@ -189,6 +198,7 @@ namespace Multiplayer
 
     void MultiplayerSystemComponent::Deactivate()
     {
+        m_networkEntitySpatialIndex.reset();
         AZ::Interface<AzFramework::ISessionHandlingClientRequests>::Unregister(this);
         AZ::Interface<IMultiplayer>::Unregister(this);
         m_consoleCommandHandler.Disconnect();
@@ -342,12 +352,16 @@ namespace Multiplayer
 
         // Send out the game state update to all connections
         {
-            auto sendNetworkUpdates = [hostTimeMs, &stats](IConnection& connection)
+            // Entity state is final for this tick, so cached payloads from the previous tick are stale
+            m_propertySerializationCache.Clear();
+
+            m_connectionsToUpdate.clear();
+            auto gatherConnections = [this, &stats](IConnection& connection)
             {
                 if (connection.GetUserData() != nullptr)
                 {
                     IConnectionData* connectionData = reinterpret_cast<IConnectionData*>(connection.GetUserData());
-                    connectionData->Update(hostTimeMs);
+                    m_connectionsToUpdate.push_back(connectionData);
                     if (connectionData->GetConnectionDataType() == ConnectionDataType::ServerToClient)
                     {
                         stats.m_clientConnectionCount++;
@@ -359,7 +373,11 @@ namespace Multiplayer
                 }
             };
 
-            m_networkInterface->GetConnectionSet().VisitConnections(sendNetworkUpdates);
+            m_networkInterface->GetConnectionSet().VisitConnections(gatherConnections);
+            UpdateConnections(m_connectionsToUpdate, hostTimeMs, sv_parallelReplication);
+
+            stats.m_serializationCacheHits += m_propertySerializationCache.GetHitCount();
+            stats.m_serializationCacheMisses += m_propertySerializationCache.GetMissCount();
         }
 
         MultiplayerPackets::SyncConsole packet;
@@ -644,8 +662,10 @@ namespace Multiplayer
                 connection->SetUserData(new ServerToClientConnectionData(connection, *this, controlledEntity));
             }
 
-            AZStd::unique_ptr<IReplicationWindow> window = AZStd::make_unique<ServerToClientReplicationWindow>(controlledEntity, connection);
-            reinterpret_cast<ServerToClientConnectionData*>(connection->GetUserData())->GetReplicationManager().SetReplicationWindow(AZStd::move(window));
+            AZStd::unique_ptr<IReplicationWindow> window = AZStd::make_unique<ServerToClientReplicationWindow>(controlledEntity, connection, m_networkEntitySpatialIndex.get());
+            EntityReplicationManager& replicationManager = reinterpret_cast<ServerToClientConnectionData*>(connection->GetUserData())->GetReplicationManager();
+            replicationManager.SetReplicationWindow(AZStd::move(window));
+            replicationManager.SetPropertySerializationCache(sv_propertySerializationCache ? &m_propertySerializationCache : nullptr);
         }
         else
         {
@@ -746,8 +766,18 @@ namespace Multiplayer
                 //const AZ::Aabb worldBounds = AZ::Interface<IPhysics>.Get()->GetWorldBounds();
                 AZStd::unique_ptr<IEntityDomain> newDomain = AZStd::make_unique<FullOwnershipEntityDomain>();
                 m_networkEntityManager.Initialize(InvalidHostId, AZStd::move(newDomain));
+
+                if (sv_replicationSpatialIndex)
+                {
+                    m_networkEntitySpatialIndex = AZStd::make_unique<NetworkEntitySpatialIndex>(sv_replicationSpatialIndexCellSize);
+                    m_networkEntitySpatialIndex->Activate();
+                }
             }
         }
+        else if (multiplayerType == MultiplayerAgentType::Uninitialized)
+        {
+            m_networkEntitySpatialIndex.reset();
+        }
         m_agentType = multiplayerType;
 
         // Spawn the default player for this host since the host is also a player (not a dedicated server)
@@ -845,6 +875,9 @@ namespace Multiplayer
         AZLOG_INFO("Total RPCs sent bytes: %llu", aznumeric_cast<AZ::u64>(rpcsSent.m_totalBytes));
         AZLOG_INFO("Total RPCs received: %llu", aznumeric_cast<AZ::u64>(rpcsRecv.m_totalCalls));
         AZLOG_INFO("Total RPCs received bytes: %llu", aznumeric_cast<AZ::u64>(rpcsRecv.m_totalBytes));
+        AZLOG_INFO("Serialization cache hits: %llu", aznumeric_cast<AZ::u64>(stats.m_serializationCacheHits));
+        AZLOG_INFO("Serialization cache misses: %llu", aznumeric_cast<AZ::u64>(stats.m_serializationCacheMisses));
+        AZLOG_INFO("Serialization cache hit rate: %.2f%%", stats.CalculateSerializationCacheHitRate() * 100.0f);
     }
 
     void MultiplayerSystemComponent::TickVisibleNetworkEntities(float deltaTime, float serverRateSeconds)
@@ -913,6 +946,64 @@ namespace Multiplayer
         }
     }
 
+    void MultiplayerSystemComponent::UpdateConnections(const AZStd::vector<IConnectionData*>& connections, AZ::TimeMs hostTimeMs, bool allowParallel)
+    {
+        // Activation creates entities and may touch any replication manager, so it happens on this thread for every connection
+        // before any updates are generated, entities activated this tick are then sent this tick by both the serial and parallel paths
+        for (IConnectionData* connectionData : connections)
+        {
+            connectionData->GetReplicationManager().ActivatePendingEntities();
+        }
+
+        if (allowParallel)
+        {
+            PrepareConnectionUpdates(connections, hostTimeMs);
+        }
+
+        for (IConnectionData* connectionData : connections)
+        {
+            connectionData->Update(hostTimeMs);
+        }
+    }
+
+    void MultiplayerSystemComponent::PrepareConnectionUpdates(const AZStd::vector<IConnectionData*>& connections, AZ::TimeMs hostTimeMs)
+    {
+        AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+        if (jobContext == nullptr)
+        {
+            // Connections will prepare their own updates when Update is invoked
+            return;
+        }
+
+        const uint32_t connectionCount = aznumeric_cast<uint32_t>(connections.size());
+        if (connectionCount < AZStd::max<uint32_t>(sv_parallelReplicationMinConnections, 2))
+        {
+            return;
+        }
+
+        // Split the connections into one contiguous range per worker, each connection only touches its own replication state
+        // so no synchronization is needed while preparing, and the single threaded Update pass sends in connection order
+        const uint32_t jobCount = AZStd::min(connectionCount, jobContext->GetJobManager().GetNumWorkerThreads() + 1);
+        const uint32_t connectionsPerJob = (connectionCount + jobCount - 1) / jobCount;
+
+        AZ::JobCompletion jobCompletion(jobContext);
+        for (uint32_t startIndex = 0; startIndex < connectionCount; startIndex += connectionsPerJob)
+        {
+            const uint32_t endIndex = AZStd::min(startIndex + connectionsPerJob, connectionCount);
+            const auto prepareLambda = [&connections, hostTimeMs, startIndex, endIndex]()
+            {
+                for (uint32_t index = startIndex; index < endIndex; ++index)
+                {
+                    connections[index]->PrepareUpdates(hostTimeMs);
+                }
+            };
+            AZ::Job* prepareJob = AZ::CreateJobFunction(prepareLambda, true, jobContext);
+            prepareJob->SetDependent(&jobCompletion);
+            prepareJob->Start();
+        }
+        jobCompletion.StartAndWaitForCompletion();
+    }
+
     void MultiplayerSystemComponent::OnConsoleCommandInvoked
     (
         AZStd::string_view command,
@@ -9,9 +9,12 @@
 #pragma once
 
 #include <Multiplayer/IMultiplayer.h>
+#include <Multiplayer/ConnectionData/IConnectionData.h>
 #include <Editor/MultiplayerEditorConnection.h>
 #include <NetworkTime/NetworkTime.h>
 #include <NetworkEntity/NetworkEntityManager.h>
+#include <NetworkEntity/EntityReplication/PropertySerializationCache.h>
+#include <ReplicationWindows/NetworkEntitySpatialIndex.h>
 #include <Source/AutoGen/Multiplayer.AutoPacketDispatcher.h>
 
 #include <AzCore/Component/Component.h>
@@ -124,9 +127,17 @@ namespace Multiplayer
         void DumpStats(const AZ::ConsoleCommandContainer& arguments);
         //! @}
 
+        //! Activates pending entities, then generates and sends the entity updates for the provided connections.
+        //! Sends always happen in connection order on the calling thread, so the packets produced are identical whether or not preparation ran in parallel.
+        //! @param connections   the connections to update
+        //! @param hostTimeMs    current server game time in milliseconds
+        //! @param allowParallel if true, update messages may be generated on the global job context before sending
+        void UpdateConnections(const AZStd::vector<IConnectionData*>& connections, AZ::TimeMs hostTimeMs, bool allowParallel);
+
     private:
 
         void TickVisibleNetworkEntities(float deltaTime, float serverRateSeconds);
+        void PrepareConnectionUpdates(const AZStd::vector<IConnectionData*>& connections, AZ::TimeMs hostTimeMs);
         void OnConsoleCommandInvoked(AZStd::string_view command, const AZ::ConsoleCommandContainer& args, AZ::ConsoleFunctorFlags flags, AZ::ConsoleInvokedFrom invokedFrom);
         void ExecuteConsoleCommandList(AzNetworking::IConnection* connection, const AZStd::fixed_vector<Multiplayer::LongNetworkString, 32>& commands);
         NetworkEntityHandle SpawnDefaultPlayerPrefab();
@@ -140,6 +151,8 @@ namespace Multiplayer
 
         NetworkEntityManager m_networkEntityManager;
         NetworkTime m_networkTime;
+        AZStd::unique_ptr<NetworkEntitySpatialIndex> m_networkEntitySpatialIndex; // Shared by all server to client replication windows
+        PropertySerializationCache m_propertySerializationCache; // Shared by all server to client replication managers, cleared every tick
         MultiplayerAgentType m_agentType = MultiplayerAgentType::Uninitialized;
         
         IFilterEntityManager* m_filterEntityManager = nullptr; // non-owning pointer
@@ -150,6 +163,7 @@ namespace Multiplayer
         ClientDisconnectedEvent m_clientDisconnectedEvent;
 
         AZStd::queue<AZStd::string> m_pendingConnectionTickets;
+        AZStd::vector<IConnectionData*> m_connectionsToUpdate; // Scratch list of connections reused each tick
 
         AZ::TimeMs m_lastReplicatedHostTimeMs = AZ::TimeMs{ 0 };
         HostFrameId m_lastReplicatedHostFrameId = HostFrameId(0);
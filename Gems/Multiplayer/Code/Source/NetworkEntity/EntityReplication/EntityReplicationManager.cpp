@@ -93,9 +93,41 @@ namespace Multiplayer
         }
     }
 
-    void EntityReplicationManager::SendUpdates(AZ::TimeMs hostTimeMs)
+    void EntityReplicationManager::PrepareUpdates()
     {
+        AZ_Assert(!m_hasPreparedUpdates, "PrepareUpdates invoked twice without sending the prepared updates");
         m_frameTimeMs = AZ::GetElapsedTimeMs();
+
+        // Property metrics are buffered while preparing, as several managers may be preparing at once
+        MultiplayerStats::ScopedDeferPropertySent deferPropertySent(m_deferredPropertySent);
+
+        EntityReplicatorList toSendList = GenerateEntityUpdateList();
+
+        // prep a replication record for send, at this point, everything needs to be sent
+        for (EntityReplicator* replicator : toSendList)
+        {
+            replicator->GetPropertyPublisher()->PrepareSerialization();
+        }
+
+        for (EntityReplicator* replicator : toSendList)
+        {
+            m_preparedUpdates.push_back(PreparedUpdate{ replicator, replicator->GenerateUpdatePacket() });
+        }
+
+        m_hasPreparedUpdates = true;
+    }
+
+    bool EntityReplicationManager::HasPreparedUpdates() const
+    {
+        return m_hasPreparedUpdates;
+    }
+
+    void EntityReplicationManager::SendUpdates(AZ::TimeMs hostTimeMs)
+    {
+        if (!m_hasPreparedUpdates)
+        {
+            PrepareUpdates();
+        }
         SendEntityUpdates(hostTimeMs);
 
         SendEntityRpcs(m_deferredRpcMessagesReliable, true);
@@ -119,7 +151,7 @@ namespace Multiplayer
     void EntityReplicationManager::SendEntityUpdatesPacketHelper
     (
         AZ::TimeMs hostTimeMs,
-        EntityReplicatorList& toSendList,
+        PreparedUpdateList& preparedUpdates,
         uint32_t maxPayloadSize,
         AzNetworking::IConnection& connection
     )
@@ -130,12 +162,12 @@ namespace Multiplayer
         entityUpdatePacket.SetHostTimeMs(hostTimeMs);
         entityUpdatePacket.SetHostFrameId(GetNetworkTime()->GetHostFrameId());
         // Serialize everything
-        while (!toSendList.empty())
+        while (!preparedUpdates.empty())
         {
-            EntityReplicator* replicator = toSendList.front();
-            NetworkEntityUpdateMessage updateMessage(replicator->GenerateUpdatePacket());
+            PreparedUpdate& preparedUpdate = preparedUpdates.front();
+            EntityReplicator* replicator = preparedUpdate.m_replicator;
 
-            const uint32_t nextMessageSize = updateMessage.GetEstimatedSerializeSize();
+            const uint32_t nextMessageSize = preparedUpdate.m_updateMessage.GetEstimatedSerializeSize();
 
             // Check if we are over our limits
             const bool payloadFull = (pendingPacketSize + nextMessageSize > maxPayloadSize);
@@ -147,9 +179,9 @@ namespace Multiplayer
             }
 
             pendingPacketSize += nextMessageSize;
-            entityUpdatePacket.ModifyEntityMessages().push_back(updateMessage);
+            entityUpdatePacket.ModifyEntityMessages().push_back(AZStd::move(preparedUpdate.m_updateMessage));
             replicatorUpdatedList.push_back(replicator);
-            toSendList.pop_front();
+            preparedUpdates.pop_front();
 
             if (largeEntityDetected)
             {
@@ -248,21 +280,22 @@ namespace Multiplayer
 
     void EntityReplicationManager::SendEntityUpdates(AZ::TimeMs hostTimeMs)
     {
-        EntityReplicatorList toSendList = GenerateEntityUpdateList();
-    
-        AZLOG(NET_ReplicationInfo, "Sending %zd updates from %d to %d", toSendList.size(), (uint8_t)GetNetworkEntityManager()->GetHostId(), (uint8_t)GetRemoteHostId());
-    
-        // prep a replication record for send, at this point, everything needs to be sent
-        for (EntityReplicator* replicator : toSendList)
+        AZLOG(NET_ReplicationInfo, "Sending %zd updates from %d to %d", m_preparedUpdates.size(), (uint8_t)GetNetworkEntityManager()->GetHostId(), (uint8_t)GetRemoteHostId());
+
+        // Apply the property metrics gathered while preparing, now that we are back on the thread that owns the stats
+        if (!m_deferredPropertySent.empty())
         {
-            replicator->GetPropertyPublisher()->PrepareSerialization();
+            GetMultiplayer()->GetStats().ApplyDeferredPropertySent(m_deferredPropertySent);
+            m_deferredPropertySent.clear();
         }
-    
-        // While our to send list is not empty, build up another packet to send
+
+        // While our prepared list is not empty, build up another packet to send
         do
         {
-            SendEntityUpdatesPacketHelper(hostTimeMs, toSendList, m_maxPayloadSize, m_connection);
-        } while (!toSendList.empty());
+            SendEntityUpdatesPacketHelper(hostTimeMs, m_preparedUpdates, m_maxPayloadSize, m_connection);
+        } while (!m_preparedUpdates.empty());
+
+        m_hasPreparedUpdates = false;
     }
 
     void EntityReplicationManager::SendEntityRpcs(RpcMessages& deferredRpcs, bool reliable)
@@ -330,6 +363,11 @@ namespace Multiplayer
             m_replicatorsPendingSend.clear();
         }
 
+        // Prepared updates reference the replicators being destroyed
+        m_preparedUpdates.clear();
+        m_deferredPropertySent.clear();
+        m_hasPreparedUpdates = false;
+
         m_entityReplicatorMap.clear();
     }
 
@@ -1062,6 +1100,16 @@ namespace Multiplayer
         return m_replicationWindow.get();
     }
 
+    void EntityReplicationManager::SetPropertySerializationCache(PropertySerializationCache* serializationCache)
+    {
+        m_propertySerializationCache = serializationCache;
+    }
+
+    PropertySerializationCache* EntityReplicationManager::GetPropertySerializationCache() const
+    {
+        return m_propertySerializationCache;
+    }
+
     void EntityReplicationManager::MigrateEntityInternal(NetEntityId netEntityId)
     {
         ConstNetworkEntityHandle entityHandle = GetNetworkEntityManager()->GetEntity(netEntityId);
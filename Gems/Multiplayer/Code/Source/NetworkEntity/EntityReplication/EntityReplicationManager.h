@@ -16,6 +16,7 @@
 #include <Multiplayer/NetworkEntity/NetworkEntityUpdateMessage.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityRpcMessage.h>
 #include <Multiplayer/ReplicationWindows/IReplicationWindow.h>
+#include <Multiplayer/MultiplayerStats.h>
 #include <AzNetworking/DataStructures/TimeoutQueue.h>
 #include <AzNetworking/PacketLayer/IPacketHeader.h>
 #include <AzCore/std/containers/map.h>
@@ -35,6 +36,7 @@ namespace Multiplayer
 {
     class IEntityDomain;
     class EntityReplicator;
+    class PropertySerializationCache;
     
     //! @class EntityReplicationManager
     //! @brief Handles replication of relevant entities for one connection.
@@ -58,6 +60,15 @@ namespace Multiplayer
         HostId GetRemoteHostId() const;
 
         void ActivatePendingEntities();
+
+        //! Generates the entity update messages for this connection without sending them.
+        //! Only state owned by this manager, its replicators and its connection is modified, so distinct managers may prepare concurrently.
+        //! Any messages prepared here are sent by the next call to SendUpdates.
+        void PrepareUpdates();
+        bool HasPreparedUpdates() const;
+
+        //! Sends entity updates and deferred rpcs to the remote endpoint, preparing updates first if PrepareUpdates was not invoked.
+        //! @param hostTimeMs current server game time in milliseconds
         void SendUpdates(AZ::TimeMs hostTimeMs);
         void Clear(bool forMigration);
 
@@ -74,6 +85,11 @@ namespace Multiplayer
         void SetReplicationWindow(AZStd::unique_ptr<IReplicationWindow> replicationWindow);
         IReplicationWindow* GetReplicationWindow();
 
+        //! Sets the cache used to share serialized property deltas with other connections, may be nullptr to always serialize.
+        //! @param serializationCache non-owning pointer to the cache to use
+        void SetPropertySerializationCache(PropertySerializationCache* serializationCache);
+        PropertySerializationCache* GetPropertySerializationCache() const;
+
         void GetEntityReplicatorIdList(AZStd::list<NetEntityId>& outList);
         uint32_t GetEntityReplicatorCount(NetEntityRole localNetworkRole);
 
@@ -117,7 +133,14 @@ namespace Multiplayer
         using EntityReplicatorList = AZStd::deque<EntityReplicator*>;
         EntityReplicatorList GenerateEntityUpdateList();
 
-        void SendEntityUpdatesPacketHelper(AZ::TimeMs hostTimeMs, EntityReplicatorList& toSendList, uint32_t maxPayloadSize, AzNetworking::IConnection& connection);
+        struct PreparedUpdate
+        {
+            EntityReplicator* m_replicator = nullptr;
+            NetworkEntityUpdateMessage m_updateMessage;
+        };
+        using PreparedUpdateList = AZStd::deque<PreparedUpdate>;
+
+        void SendEntityUpdatesPacketHelper(AZ::TimeMs hostTimeMs, PreparedUpdateList& preparedUpdates, uint32_t maxPayloadSize, AzNetworking::IConnection& connection);
 
         void SendEntityUpdates(AZ::TimeMs hostTimeMs);
         void SendEntityRpcs(RpcMessages& deferredRpcs, bool reliable);
@@ -188,6 +211,11 @@ namespace Multiplayer
         RpcMessages m_deferredRpcMessagesReliable;
         RpcMessages m_deferredRpcMessagesUnreliable;
 
+        // Update messages generated by PrepareUpdates, along with the property metrics recorded while generating them
+        PreparedUpdateList m_preparedUpdates;
+        MultiplayerStats::DeferredPropertySentList m_deferredPropertySent;
+        bool m_hasPreparedUpdates = false;
+
         AZ::Event<NetEntityId> m_autonomousEntityReplicatorCreated;
         EntityExitDomainEvent::Handler m_entityExitDomainEventHandler;
 
@@ -198,6 +226,7 @@ namespace Multiplayer
         AzNetworking::IConnection& m_connection;
         AZStd::unique_ptr<IReplicationWindow> m_replicationWindow;
         AZStd::unique_ptr<IEntityDomain> m_remoteEntityDomain;
+        PropertySerializationCache* m_propertySerializationCache = nullptr; // non-owning pointer
 
         AZ::TimeMs m_entityActivationTimeSliceMs = AZ::TimeMs{ 0 };
         AZ::TimeMs m_entityPendingRemovalMs = AZ::TimeMs{ 0 };
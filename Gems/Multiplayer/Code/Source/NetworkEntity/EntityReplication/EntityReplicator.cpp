@@ -9,6 +9,7 @@
 #include <Source/NetworkEntity/EntityReplication/EntityReplicator.h>
 #include <Source/NetworkEntity/EntityReplication/EntityReplicationManager.h>
 #include <Source/NetworkEntity/EntityReplication/PropertyPublisher.h>
+#include <Source/NetworkEntity/EntityReplication/PropertySerializationCache.h>
 #include <Source/NetworkEntity/EntityReplication/PropertySubscriber.h>
 #include <Source/NetworkEntity/NetworkEntityAuthorityTracker.h>
 #include <Source/NetworkEntity/NetworkEntityTracker.h>
@@ -430,9 +431,38 @@ namespace Multiplayer
             updateMessage.SetPrefabEntityId(netBindComponent->GetPrefabEntityId());
         }
 
-        AzNetworking::NetworkInputSerializer inputSerializer(updateMessage.ModifyData().GetBuffer(), updateMessage.ModifyData().GetCapacity());
-        m_propertyPublisher->UpdateSerialization(inputSerializer);
-        updateMessage.ModifyData().Resize(inputSerializer.GetSize());
+        PropertySerializationCache* serializationCache = m_replicationManager.GetPropertySerializationCache();
+        if (serializationCache == nullptr || !m_propertyPublisher->IsSerializingProperties())
+        {
+            AzNetworking::NetworkInputSerializer inputSerializer(updateMessage.ModifyData().GetBuffer(), updateMessage.ModifyData().GetCapacity());
+            m_propertyPublisher->UpdateSerialization(inputSerializer);
+            updateMessage.ModifyData().Resize(inputSerializer.GetSize());
+            return updateMessage;
+        }
+
+        // Other connections may already have serialized this exact delta for this entity during the current tick
+        const NetEntityId netEntityId = GetEntityHandle().GetNetEntityId();
+        const ReplicationRecord& pendingRecord = m_propertyPublisher->GetPendingRecord();
+        MultiplayerStats& stats = GetMultiplayer()->GetStats();
+        if (!serializationCache->Fetch(netEntityId, pendingRecord, updateMessage.ModifyData(), stats))
+        {
+            // Capture the property metrics so they can be recorded again whenever the cached payload is reused
+            MultiplayerStats::DeferredPropertySentList propertySent;
+            {
+                MultiplayerStats::ScopedDeferPropertySent deferPropertySent(propertySent);
+                AzNetworking::NetworkInputSerializer inputSerializer(updateMessage.ModifyData().GetBuffer(), updateMessage.ModifyData().GetCapacity());
+                if (m_propertyPublisher->UpdateSerialization(inputSerializer))
+                {
+                    updateMessage.ModifyData().Resize(inputSerializer.GetSize());
+                    serializationCache->Store(netEntityId, pendingRecord, updateMessage.ModifyData(), propertySent);
+                }
+                else
+                {
+                    updateMessage.ModifyData().Resize(inputSerializer.GetSize());
+                }
+            }
+            stats.ApplyDeferredPropertySent(propertySent);
+        }
 
         return updateMessage;
     }
@@ -318,6 +318,17 @@ namespace Multiplayer
         return success;
     }
 
+    bool PropertyPublisher::IsSerializingProperties() const
+    {
+        return (m_replicatorState == PropertyPublisher::EntityReplicatorState::Creating)
+            || (m_replicatorState == PropertyPublisher::EntityReplicatorState::Updating);
+    }
+
+    const ReplicationRecord& PropertyPublisher::GetPendingRecord() const
+    {
+        return m_pendingRecord;
+    }
+
     void PropertyPublisher::FinalizeSerialization(AzNetworking::PacketId sentId)
     {
         switch (m_replicatorState)
@@ -47,6 +47,14 @@ namespace Multiplayer
         void FinalizeSerialization(AzNetworking::PacketId sentId);
         //! @}
 
+        //! Returns true if the prepared update serializes property data, as opposed to a delete.
+        //! @return boolean true if the prepared update serializes property data
+        bool IsSerializingProperties() const;
+
+        //! Returns the record describing the properties the prepared update will serialize.
+        //! @return the record describing the properties the prepared update will serialize
+        const ReplicationRecord& GetPendingRecord() const;
+
     private:
         enum class EntityReplicatorState
         {
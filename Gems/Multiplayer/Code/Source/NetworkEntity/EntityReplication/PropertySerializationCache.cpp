@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/NetworkEntity/EntityReplication/PropertySerializationCache.h>
+
+namespace Multiplayer
+{
+    void PropertySerializationCache::Clear()
+    {
+        for (Shard& shard : m_shards)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(shard.m_mutex);
+            shard.m_payloads.clear();
+        }
+        m_hitCount = 0;
+        m_missCount = 0;
+    }
+
+    bool PropertySerializationCache::Fetch(NetEntityId netEntityId, const ReplicationRecord& record, AzNetworking::PacketEncodingBuffer& outData, MultiplayerStats& stats)
+    {
+        Shard& shard = GetShard(netEntityId);
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(shard.m_mutex);
+            auto iter = shard.m_payloads.find(netEntityId);
+            if (iter != shard.m_payloads.end())
+            {
+                for (const CachedPayload& payload : iter->second)
+                {
+                    if (payload.m_record.HasSameChanges(record))
+                    {
+                        outData.CopyValues(payload.m_data.data(), payload.m_data.size());
+                        stats.ApplyDeferredPropertySent(payload.m_propertySent);
+                        ++m_hitCount;
+                        return true;
+                    }
+                }
+            }
+        }
+        ++m_missCount;
+        return false;
+    }
+
+    void PropertySerializationCache::Store(NetEntityId netEntityId, const ReplicationRecord& record, const AzNetworking::PacketEncodingBuffer& data, const MultiplayerStats::DeferredPropertySentList& propertySent)
+    {
+        Shard& shard = GetShard(netEntityId);
+        AZStd::lock_guard<AZStd::mutex> lock(shard.m_mutex);
+        AZStd::vector<CachedPayload>& payloads = shard.m_payloads[netEntityId];
+        for (const CachedPayload& payload : payloads)
+        {
+            if (payload.m_record.HasSameChanges(record))
+            {
+                // Another connection serialized the same payload concurrently, the existing entry is identical
+                return;
+            }
+        }
+
+        CachedPayload& payload = payloads.emplace_back();
+        payload.m_record = record;
+        payload.m_data.assign(data.GetBuffer(), data.GetBuffer() + data.GetSize());
+        payload.m_propertySent = propertySent;
+    }
+
+    uint64_t PropertySerializationCache::GetHitCount() const
+    {
+        return m_hitCount;
+    }
+
+    uint64_t PropertySerializationCache::GetMissCount() const
+    {
+        return m_missCount;
+    }
+
+    PropertySerializationCache::Shard& PropertySerializationCache::GetShard(NetEntityId netEntityId)
+    {
+        return m_shards[static_cast<uint64_t>(netEntityId) % ShardCount];
+    }
+}
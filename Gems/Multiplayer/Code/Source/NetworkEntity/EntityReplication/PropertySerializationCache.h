@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/MultiplayerStats.h>
+#include <Multiplayer/MultiplayerTypes.h>
+#include <Multiplayer/NetworkEntity/EntityReplication/ReplicationRecord.h>
+#include <AzNetworking/DataStructures/ByteBuffer.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace Multiplayer
+{
+    //! @class PropertySerializationCache
+    //! @brief Shares serialized property deltas between connections within a single tick.
+    //!
+    //! The serialized delta for an entity depends only on the entity's current state and the replication record being sent,
+    //! so when several connections need the same record for the same entity the payload is serialized once and copied into
+    //! each connection's update message. Entries are only valid for the tick they were stored in and must be discarded using Clear
+    //! before entity state changes. Lookups and stores are thread safe so connections may prepare their updates in parallel.
+    class PropertySerializationCache
+    {
+    public:
+
+        PropertySerializationCache() = default;
+        ~PropertySerializationCache() = default;
+
+        //! Discards all cached payloads and resets the hit and miss counters.
+        void Clear();
+
+        //! Copies a previously stored payload for the given entity and record into the output buffer.
+        //! On success the property metrics recorded when the payload was serialized are recorded again into the provided stats.
+        //! @param netEntityId the network identifier of the entity being serialized
+        //! @param record      the replication record being serialized
+        //! @param outData     buffer to copy the cached payload into
+        //! @param stats       stats instance to record the cached property metrics to
+        //! @return boolean true if a cached payload was found and copied
+        bool Fetch(NetEntityId netEntityId, const ReplicationRecord& record, AzNetworking::PacketEncodingBuffer& outData, MultiplayerStats& stats);
+
+        //! Stores a serialized payload for the given entity and record.
+        //! @param netEntityId  the network identifier of the entity that was serialized
+        //! @param record       the replication record that was serialized
+        //! @param data         the serialized payload
+        //! @param propertySent the property metrics recorded while serializing the payload
+        void Store(NetEntityId netEntityId, const ReplicationRecord& record, const AzNetworking::PacketEncodingBuffer& data, const MultiplayerStats::DeferredPropertySentList& propertySent);
+
+        //! Returns the number of successful fetches since the last clear.
+        //! @return the number of successful fetches since the last clear
+        uint64_t GetHitCount() const;
+
+        //! Returns the number of failed fetches since the last clear.
+        //! @return the number of failed fetches since the last clear
+        uint64_t GetMissCount() const;
+
+    private:
+
+        AZ_DISABLE_COPY_MOVE(PropertySerializationCache);
+
+        struct CachedPayload
+        {
+            ReplicationRecord m_record;
+            AZStd::vector<uint8_t> m_data;
+            MultiplayerStats::DeferredPropertySentList m_propertySent;
+        };
+
+        // Shards are selected by entity id to keep contention low while connections prepare in parallel
+        static constexpr uint32_t ShardCount = 32;
+        struct Shard
+        {
+            AZStd::mutex m_mutex;
+            AZStd::unordered_map<NetEntityId, AZStd::vector<CachedPayload>> m_payloads;
+        };
+
+        Shard& GetShard(NetEntityId netEntityId);
+
+        AZStd::array<Shard, ShardCount> m_shards;
+        AZStd::atomic<uint64_t> m_hitCount{ 0 };
+        AZStd::atomic<uint64_t> m_missCount{ 0 };
+    };
+}
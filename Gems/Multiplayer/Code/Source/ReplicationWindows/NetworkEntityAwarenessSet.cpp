@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/ReplicationWindows/NetworkEntityAwarenessSet.h>
+#include <AzCore/std/sort.h>
+
+namespace Multiplayer
+{
+    NetworkEntityAwarenessSet::NetworkEntityAwarenessSet(NetworkEntitySpatialIndex& spatialIndex)
+        : m_spatialIndex(&spatialIndex)
+    {
+        ;
+    }
+
+    NetworkEntityAwarenessSet::~NetworkEntityAwarenessSet()
+    {
+        Reset();
+    }
+
+    bool NetworkEntityAwarenessSet::IsAttached() const
+    {
+        return m_spatialIndex != nullptr;
+    }
+
+    bool NetworkEntityAwarenessSet::SetAwarenessSphere(const AZ::Sphere& sphere)
+    {
+        if (m_spatialIndex == nullptr)
+        {
+            return false;
+        }
+
+        m_scratchCells.clear();
+        m_spatialIndex->EnumerateCellsInSphere(sphere, [this](CellKey cellKey) { m_scratchCells.push_back(cellKey); });
+        AZStd::sort(m_scratchCells.begin(), m_scratchCells.end());
+
+        if (m_scratchCells == m_observedCells)
+        {
+            // Common case, the owner is still within the same cell
+            return false;
+        }
+
+        // Both lists are sorted, so a single merge finds the cells to stop and start observing
+        size_t oldIndex = 0;
+        size_t newIndex = 0;
+        while ((oldIndex < m_observedCells.size()) || (newIndex < m_scratchCells.size()))
+        {
+            if ((newIndex == m_scratchCells.size()) || ((oldIndex < m_observedCells.size()) && (m_observedCells[oldIndex] < m_scratchCells[newIndex])))
+            {
+                m_spatialIndex->UnobserveCell(m_observedCells[oldIndex++], *this);
+            }
+            else if ((oldIndex == m_observedCells.size()) || (m_scratchCells[newIndex] < m_observedCells[oldIndex]))
+            {
+                m_spatialIndex->ObserveCell(m_scratchCells[newIndex++], *this);
+            }
+            else
+            {
+                ++oldIndex;
+                ++newIndex;
+            }
+        }
+
+        m_observedCells.swap(m_scratchCells);
+        return true;
+    }
+
+    void NetworkEntityAwarenessSet::Reset()
+    {
+        if (m_spatialIndex != nullptr)
+        {
+            for (CellKey cellKey : m_observedCells)
+            {
+                m_spatialIndex->UnobserveCell(cellKey, *this);
+            }
+        }
+        m_observedCells.clear();
+    }
+
+    const NetworkEntityAwarenessSet::AwareEntityMap& NetworkEntityAwarenessSet::GetAwareEntities() const
+    {
+        return m_awareEntities;
+    }
+
+    const AZStd::vector<NetEntityId>& NetworkEntityAwarenessSet::GetEnteredEntities() const
+    {
+        return m_enteredEntities;
+    }
+
+    const AZStd::vector<NetEntityId>& NetworkEntityAwarenessSet::GetLeftEntities() const
+    {
+        return m_leftEntities;
+    }
+
+    const AZStd::vector<NetEntityId>& NetworkEntityAwarenessSet::GetMovedEntities() const
+    {
+        return m_movedEntities;
+    }
+
+    void NetworkEntityAwarenessSet::ClearChanges()
+    {
+        for (NetEntityId netEntityId : m_movedEntities)
+        {
+            auto awareIter = m_awareEntities.find(netEntityId);
+            if (awareIter != m_awareEntities.end())
+            {
+                awareIter->second.m_isMoved = false;
+            }
+        }
+        m_enteredEntities.clear();
+        m_leftEntities.clear();
+        m_movedEntities.clear();
+    }
+
+    void NetworkEntityAwarenessSet::OnEntityEntered(const NetworkEntitySpatialIndex::CellEntry& entry)
+    {
+        m_awareEntities[entry.m_netEntityId] = AwareEntity{ entry.m_position, entry.m_netBindComponent };
+        m_enteredEntities.push_back(entry.m_netEntityId);
+    }
+
+    void NetworkEntityAwarenessSet::OnEntityMoved(const NetworkEntitySpatialIndex::CellEntry& entry)
+    {
+        auto awareIter = m_awareEntities.find(entry.m_netEntityId);
+        if (awareIter != m_awareEntities.end())
+        {
+            awareIter->second.m_position = entry.m_position;
+            if (!awareIter->second.m_isMoved)
+            {
+                awareIter->second.m_isMoved = true;
+                m_movedEntities.push_back(entry.m_netEntityId);
+            }
+        }
+    }
+
+    void NetworkEntityAwarenessSet::OnEntityLeft(NetEntityId netEntityId)
+    {
+        if (m_awareEntities.erase(netEntityId) > 0)
+        {
+            m_leftEntities.push_back(netEntityId);
+        }
+    }
+
+    void NetworkEntityAwarenessSet::OnObservationsCleared()
+    {
+        for (const auto& awarePair : m_awareEntities)
+        {
+            m_leftEntities.push_back(awarePair.first);
+        }
+        m_awareEntities.clear();
+        m_observedCells.clear();
+
+        // A cleared index that's still active has been rebuilt, the cells are observed again on the next call to SetAwarenessSphere
+        if (!m_spatialIndex->IsActive())
+        {
+            m_spatialIndex = nullptr;
+        }
+    }
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Source/ReplicationWindows/NetworkEntitySpatialIndex.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace Multiplayer
+{
+    //! @class NetworkEntityAwarenessSet
+    //! @brief The network entities within the spatial index cells around a single replication window.
+    //!
+    //! The set observes the cells overlapping an awareness sphere and keeps its own membership up to date from the cell crossings the
+    //! spatial index reports. The entities that entered, left or moved since the last call to ClearChanges are recorded, allowing the
+    //! owner to update its state from the deltas only. Membership is resolved at cell granularity, entities are members if their cell
+    //! overlaps the sphere, so owners that need an exact radius have to check the distance of the members themselves.
+    class NetworkEntityAwarenessSet
+        : public NetworkEntitySpatialIndex::ICellObserver
+    {
+    public:
+
+        //! A single entity within the observed cells.
+        struct AwareEntity
+        {
+            AZ::Vector3 m_position = AZ::Vector3::CreateZero();
+            NetBindComponent* m_netBindComponent = nullptr;
+            bool m_isMoved = false; ///< Whether the entity is listed in the moved entities
+        };
+        using AwareEntityMap = AZStd::unordered_map<NetEntityId, AwareEntity>;
+
+        explicit NetworkEntityAwarenessSet(NetworkEntitySpatialIndex& spatialIndex);
+        ~NetworkEntityAwarenessSet() override;
+
+        //! Returns true if the set is attached to a spatial index, false once the index has been deactivated.
+        //! @return boolean true if the set is attached to a spatial index
+        bool IsAttached() const;
+
+        //! Observes the cells overlapping the provided sphere, stopping observation of any cells that no longer overlap it.
+        //! @param sphere the awareness sphere of the owner
+        //! @return boolean true if the set of observed cells changed
+        bool SetAwarenessSphere(const AZ::Sphere& sphere);
+
+        //! Stops observing all cells, every member is recorded as having left.
+        void Reset();
+
+        //! Returns all entities within the observed cells.
+        //! @return all entities within the observed cells
+        const AwareEntityMap& GetAwareEntities() const;
+
+        //! Returns the entities that entered the observed cells since the last call to ClearChanges.
+        //! An entity can be listed both here and in GetLeftEntities, GetAwareEntities holds the final membership.
+        //! @return the entities that entered the observed cells since the last call to ClearChanges
+        const AZStd::vector<NetEntityId>& GetEnteredEntities() const;
+
+        //! Returns the entities that left the observed cells since the last call to ClearChanges.
+        //! @return the entities that left the observed cells since the last call to ClearChanges
+        const AZStd::vector<NetEntityId>& GetLeftEntities() const;
+
+        //! Returns the members that moved since the last call to ClearChanges, which includes moves within a single cell.
+        //! Members may have left since, GetAwareEntities holds the final membership.
+        //! @return the members that moved since the last call to ClearChanges
+        const AZStd::vector<NetEntityId>& GetMovedEntities() const;
+
+        //! Forgets the recorded entered and left entities.
+        void ClearChanges();
+
+        //! NetworkEntitySpatialIndex::ICellObserver interface
+        //! @{
+        void OnEntityEntered(const NetworkEntitySpatialIndex::CellEntry& entry) override;
+        void OnEntityMoved(const NetworkEntitySpatialIndex::CellEntry& entry) override;
+        void OnEntityLeft(NetEntityId netEntityId) override;
+        void OnObservationsCleared() override;
+        //! @}
+
+    private:
+
+        using CellKey = NetworkEntitySpatialIndex::CellKey;
+
+        NetworkEntitySpatialIndex* m_spatialIndex = nullptr;
+        AZStd::vector<CellKey> m_observedCells; // Sorted
+        AZStd::vector<CellKey> m_scratchCells;
+        AwareEntityMap m_awareEntities;
+        AZStd::vector<NetEntityId> m_enteredEntities;
+        AZStd::vector<NetEntityId> m_leftEntities;
+        AZStd::vector<NetEntityId> m_movedEntities;
+    };
+}
@@ -0,0 +1,329 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/ReplicationWindows/NetworkEntitySpatialIndex.h>
+#include <Source/NetworkEntity/NetworkEntityTracker.h>
+#include <Multiplayer/IMultiplayer.h>
+#include <Multiplayer/Components/NetBindComponent.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/sort.h>
+
+namespace Multiplayer
+{
+    NetworkEntitySpatialIndex::NetworkEntitySpatialIndex(float cellSize)
+        : m_cellSize(AZStd::max(cellSize, 1.0f))
+        , m_invCellSize(1.0f / AZStd::max(cellSize, 1.0f))
+        , m_entityActivatedEventHandler([this](AZ::Entity* entity) { OnEntityActivated(entity); })
+        , m_entityDeactivatedEventHandler([this](AZ::Entity* entity) { OnEntityDeactivated(entity); })
+    {
+        ;
+    }
+
+    NetworkEntitySpatialIndex::~NetworkEntitySpatialIndex()
+    {
+        Deactivate();
+    }
+
+    void NetworkEntitySpatialIndex::Activate()
+    {
+        if (m_isActive)
+        {
+            return;
+        }
+
+        if (AZ::ComponentApplicationRequests* componentApplication = AZ::Interface<AZ::ComponentApplicationRequests>::Get())
+        {
+            componentApplication->RegisterEntityActivatedEventHandler(m_entityActivatedEventHandler);
+            componentApplication->RegisterEntityDeactivatedEventHandler(m_entityDeactivatedEventHandler);
+        }
+        m_isActive = true;
+
+        // Pick up any network entities that were activated before the index was
+        InsertActiveNetworkEntities();
+    }
+
+    void NetworkEntitySpatialIndex::Deactivate()
+    {
+        m_entityActivatedEventHandler.Disconnect();
+        m_entityDeactivatedEventHandler.Disconnect();
+        m_isActive = false;
+        Clear();
+    }
+
+    void NetworkEntitySpatialIndex::InsertEntity(NetEntityId netEntityId, NetBindComponent* netBindComponent, const AZ::Vector3& position)
+    {
+        if (m_trackedEntities.find(netEntityId) != m_trackedEntities.end())
+        {
+            UpdateEntity(netEntityId, position);
+            return;
+        }
+
+        CellEntry entry;
+        entry.m_position = position;
+        entry.m_netEntityId = netEntityId;
+        entry.m_netBindComponent = netBindComponent;
+        const CellKey cellKey = GetCellKey(position);
+        AddToCell(cellKey, entry, m_trackedEntities[netEntityId]);
+
+        if (const CellObservers* observers = FindCellObservers(cellKey))
+        {
+            for (ICellObserver* observer : *observers)
+            {
+                observer->OnEntityEntered(entry);
+            }
+        }
+    }
+
+    bool NetworkEntitySpatialIndex::UpdateEntity(NetEntityId netEntityId, const AZ::Vector3& position)
+    {
+        auto trackedIter = m_trackedEntities.find(netEntityId);
+        if (trackedIter == m_trackedEntities.end())
+        {
+            return false;
+        }
+
+        TrackedEntity& trackedEntity = trackedIter->second;
+        const CellKey newCellKey = GetCellKey(position);
+        if (newCellKey == trackedEntity.m_cellKey)
+        {
+            // Common case, the entity is still within the same cell so only the cached position changes
+            CellEntry& entry = m_cells[trackedEntity.m_cellKey][trackedEntity.m_cellIndex];
+            entry.m_position = position;
+            if (const CellObservers* observers = FindCellObservers(trackedEntity.m_cellKey))
+            {
+                for (ICellObserver* observer : *observers)
+                {
+                    observer->OnEntityMoved(entry);
+                }
+            }
+            return false;
+        }
+
+        const CellKey oldCellKey = trackedEntity.m_cellKey;
+        CellEntry entry = m_cells[oldCellKey][trackedEntity.m_cellIndex];
+        entry.m_position = position;
+        RemoveFromCell(trackedEntity);
+        AddToCell(newCellKey, entry, trackedEntity);
+        ++m_cellTransitionCount;
+        NotifyCellTransition(oldCellKey, newCellKey, entry);
+        return true;
+    }
+
+    void NetworkEntitySpatialIndex::RemoveEntity(NetEntityId netEntityId)
+    {
+        m_transformChangedHandlers.erase(netEntityId);
+
+        auto trackedIter = m_trackedEntities.find(netEntityId);
+        if (trackedIter == m_trackedEntities.end())
+        {
+            return;
+        }
+
+        const CellKey cellKey = trackedIter->second.m_cellKey;
+        RemoveFromCell(trackedIter->second);
+        m_trackedEntities.erase(trackedIter);
+
+        if (const CellObservers* observers = FindCellObservers(cellKey))
+        {
+            for (ICellObserver* observer : *observers)
+            {
+                observer->OnEntityLeft(netEntityId);
+            }
+        }
+    }
+
+    void NetworkEntitySpatialIndex::Clear()
+    {
+        m_transformChangedHandlers.clear();
+        m_trackedEntities.clear();
+        m_cells.clear();
+
+        // Observers may be destroyed along with the index, tell each of them once that it has to let go
+        CellObservers observers;
+        for (const auto& cellObserversPair : m_cellObservers)
+        {
+            observers.insert(observers.end(), cellObserversPair.second.begin(), cellObserversPair.second.end());
+        }
+        m_cellObservers.clear();
+
+        AZStd::sort(observers.begin(), observers.end(), AZStd::less<ICellObserver*>());
+        observers.erase(AZStd::unique(observers.begin(), observers.end()), observers.end());
+
+        // An active index keeps tracking the network entities, observers are told afterwards so they can observe the rebuilt cells
+        if (m_isActive)
+        {
+            InsertActiveNetworkEntities();
+        }
+
+        for (ICellObserver* observer : observers)
+        {
+            observer->OnObservationsCleared();
+        }
+    }
+
+    void NetworkEntitySpatialIndex::ObserveCell(CellKey cellKey, ICellObserver& observer)
+    {
+        CellObservers& observers = m_cellObservers[cellKey];
+        auto observerIter = AZStd::lower_bound(observers.begin(), observers.end(), &observer, AZStd::less<ICellObserver*>());
+        if ((observerIter != observers.end()) && (*observerIter == &observer))
+        {
+            return;
+        }
+        observers.insert(observerIter, &observer);
+
+        auto cellIter = m_cells.find(cellKey);
+        if (cellIter != m_cells.end())
+        {
+            for (const CellEntry& entry : cellIter->second)
+            {
+                observer.OnEntityEntered(entry);
+            }
+        }
+    }
+
+    void NetworkEntitySpatialIndex::UnobserveCell(CellKey cellKey, ICellObserver& observer)
+    {
+        auto observersIter = m_cellObservers.find(cellKey);
+        if (observersIter == m_cellObservers.end())
+        {
+            return;
+        }
+
+        CellObservers& observers = observersIter->second;
+        auto observerIter = AZStd::lower_bound(observers.begin(), observers.end(), &observer, AZStd::less<ICellObserver*>());
+        if ((observerIter == observers.end()) || (*observerIter != &observer))
+        {
+            return;
+        }
+        observers.erase(observerIter);
+        if (observers.empty())
+        {
+            m_cellObservers.erase(observersIter);
+        }
+
+        auto cellIter = m_cells.find(cellKey);
+        if (cellIter != m_cells.end())
+        {
+            for (const CellEntry& entry : cellIter->second)
+            {
+                observer.OnEntityLeft(entry.m_netEntityId);
+            }
+        }
+    }
+
+    void NetworkEntitySpatialIndex::NotifyCellTransition(CellKey fromCellKey, CellKey toCellKey, const CellEntry& entry)
+    {
+        const CellObservers* fromObservers = FindCellObservers(fromCellKey);
+        const CellObservers* toObservers = FindCellObservers(toCellKey);
+        const size_t fromCount = fromObservers ? fromObservers->size() : 0;
+        const size_t toCount = toObservers ? toObservers->size() : 0;
+
+        // Both lists are sorted, so a single merge splits the observers into those the entity left, entered or moved within
+        AZStd::less<ICellObserver*> less;
+        size_t fromIndex = 0;
+        size_t toIndex = 0;
+        while ((fromIndex < fromCount) || (toIndex < toCount))
+        {
+            if ((toIndex == toCount) || ((fromIndex < fromCount) && less((*fromObservers)[fromIndex], (*toObservers)[toIndex])))
+            {
+                (*fromObservers)[fromIndex++]->OnEntityLeft(entry.m_netEntityId);
+            }
+            else if ((fromIndex == fromCount) || less((*toObservers)[toIndex], (*fromObservers)[fromIndex]))
+            {
+                (*toObservers)[toIndex++]->OnEntityEntered(entry);
+            }
+            else
+            {
+                (*toObservers)[toIndex++]->OnEntityMoved(entry);
+                ++fromIndex;
+            }
+        }
+    }
+
+    const NetworkEntitySpatialIndex::CellObservers* NetworkEntitySpatialIndex::FindCellObservers(CellKey cellKey) const
+    {
+        auto observersIter = m_cellObservers.find(cellKey);
+        return (observersIter != m_cellObservers.end()) ? &observersIter->second : nullptr;
+    }
+
+    void NetworkEntitySpatialIndex::AddToCell(CellKey cellKey, const CellEntry& entry, TrackedEntity& trackedEntity)
+    {
+        Cell& cell = m_cells[cellKey];
+        trackedEntity.m_cellKey = cellKey;
+        trackedEntity.m_cellIndex = aznumeric_cast<uint32_t>(cell.size());
+        cell.push_back(entry);
+    }
+
+    void NetworkEntitySpatialIndex::RemoveFromCell(const TrackedEntity& trackedEntity)
+    {
+        auto cellIter = m_cells.find(trackedEntity.m_cellKey);
+        AZ_Assert(cellIter != m_cells.end(), "Tracked entity references a cell that does not exist");
+
+        // Swap and pop, fixing up the index of whichever entry filled the vacated slot
+        Cell& cell = cellIter->second;
+        const uint32_t lastIndex = aznumeric_cast<uint32_t>(cell.size() - 1);
+        if (trackedEntity.m_cellIndex != lastIndex)
+        {
+            cell[trackedEntity.m_cellIndex] = cell[lastIndex];
+            m_trackedEntities[cell[trackedEntity.m_cellIndex].m_netEntityId].m_cellIndex = trackedEntity.m_cellIndex;
+        }
+        cell.pop_back();
+
+        if (cell.empty())
+        {
+            m_cells.erase(cellIter);
+        }
+    }
+
+    void NetworkEntitySpatialIndex::InsertActiveNetworkEntities()
+    {
+        if (NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker())
+        {
+            for (auto& entityPair : *networkEntityTracker)
+            {
+                AZ::Entity* entity = entityPair.second;
+                if ((entity != nullptr) && (entity->GetState() == AZ::Entity::State::Active))
+                {
+                    OnEntityActivated(entity);
+                }
+            }
+        }
+    }
+
+    void NetworkEntitySpatialIndex::OnEntityActivated(AZ::Entity* entity)
+    {
+        NetBindComponent* netBindComponent = entity->FindComponent<NetBindComponent>();
+        AZ::TransformInterface* transformInterface = entity->GetTransform();
+        if ((netBindComponent == nullptr) || (transformInterface == nullptr))
+        {
+            return;
+        }
+
+        const NetEntityId netEntityId = netBindComponent->GetNetEntityId();
+        InsertEntity(netEntityId, netBindComponent, transformInterface->GetWorldTranslation());
+
+        AZ::TransformChangedEvent::Handler& handler = m_transformChangedHandlers[netEntityId];
+        handler = AZ::TransformChangedEvent::Handler([this, netEntityId]([[maybe_unused]] const AZ::Transform& localTm, const AZ::Transform& worldTm)
+        {
+            UpdateEntity(netEntityId, worldTm.GetTranslation());
+        });
+        transformInterface->BindTransformChangedEventHandler(handler);
+    }
+
+    void NetworkEntitySpatialIndex::OnEntityDeactivated(AZ::Entity* entity)
+    {
+        NetBindComponent* netBindComponent = entity->FindComponent<NetBindComponent>();
+        if (netBindComponent != nullptr)
+        {
+            RemoveEntity(netBindComponent->GetNetEntityId());
+        }
+    }
+}
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/MultiplayerTypes.h>
+#include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Math/Sphere.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/math.h>
+
+namespace Multiplayer
+{
+    class NetBindComponent;
+
+    //! @class NetworkEntitySpatialIndex
+    //! @brief A uniform grid over the world positions of all network entities, shared by every server to client replication window.
+    //!
+    //! Entities are bucketed into square cells on the XY plane. Position updates only touch the grid bookkeeping when an entity moves
+    //! across a cell boundary, so the per tick cost scales with the number of entities changing cells rather than clients x entities.
+    //! Replication windows observe the cells overlapping their awareness sphere and are only told about entities entering, leaving or
+    //! moving within those cells, rather than walking every entity within range each update.
+    class NetworkEntitySpatialIndex
+    {
+    public:
+
+        using CellKey = uint64_t;
+
+        //! A single entity stored in a grid cell.
+        struct CellEntry
+        {
+            AZ::Vector3 m_position = AZ::Vector3::CreateZero();
+            NetEntityId m_netEntityId = InvalidNetEntityId;
+            NetBindComponent* m_netBindComponent = nullptr;
+        };
+
+        //! Receives the entities entering and leaving a set of observed cells.
+        //! Notifications are sent while the index is being modified, so observers must not observe or unobserve cells from within them.
+        class ICellObserver
+        {
+        public:
+            virtual ~ICellObserver() = default;
+
+            //! An entity entered the observed cells, either by being inserted, by moving or because its cell became observed.
+            //! @param entry the entity that entered the observed cells
+            virtual void OnEntityEntered(const CellEntry& entry) = 0;
+
+            //! An entity moved within an observed cell or between two observed cells.
+            //! @param entry the entity that moved
+            virtual void OnEntityMoved(const CellEntry& entry) = 0;
+
+            //! An entity left the observed cells, either by being removed, by moving or because its cell is no longer observed.
+            //! @param netEntityId the network identifier of the entity that left the observed cells
+            virtual void OnEntityLeft(NetEntityId netEntityId) = 0;
+
+            //! The index was cleared and all cells stopped being observed. If the index is still active it has been rebuilt from the
+            //! active network entities and the observer may observe cells again, otherwise it must not use the index anymore.
+            virtual void OnObservationsCleared() = 0;
+        };
+
+        explicit NetworkEntitySpatialIndex(float cellSize);
+        ~NetworkEntitySpatialIndex();
+
+        //! Starts tracking activation, deactivation and transform changes of all network entities.
+        void Activate();
+
+        //! Stops tracking network entities and clears the index.
+        void Deactivate();
+
+        //! Returns true if the index is tracking network entities.
+        //! @return boolean true if the index is tracking network entities
+        bool IsActive() const;
+
+        //! Adds an entity to the index.
+        //! @param netEntityId      the network identifier of the entity to add
+        //! @param netBindComponent the entity's NetBindComponent, may be nullptr for entities not backed by a live AZ::Entity
+        //! @param position         the world position of the entity
+        void InsertEntity(NetEntityId netEntityId, NetBindComponent* netBindComponent, const AZ::Vector3& position);
+
+        //! Updates the position of an entity already in the index.
+        //! @param netEntityId the network identifier of the entity to update
+        //! @param position    the new world position of the entity
+        //! @return boolean true if the entity moved across a cell boundary
+        bool UpdateEntity(NetEntityId netEntityId, const AZ::Vector3& position);
+
+        //! Removes an entity from the index.
+        //! @param netEntityId the network identifier of the entity to remove
+        void RemoveEntity(NetEntityId netEntityId);
+
+        //! Removes all entities from the index and drops all cell observers.
+        //! An active index is then rebuilt from the network entities that are currently active.
+        void Clear();
+
+        //! Starts sending the changes of a cell to an observer. The observer is told about every entity already within the cell.
+        //! @param cellKey  the cell to observe
+        //! @param observer the observer to notify
+        void ObserveCell(CellKey cellKey, ICellObserver& observer);
+
+        //! Stops sending the changes of a cell to an observer. The observer is told that every entity within the cell left.
+        //! @param cellKey  the cell to stop observing
+        //! @param observer the observer to stop notifying
+        void UnobserveCell(CellKey cellKey, ICellObserver& observer);
+
+        //! Invokes the visitor for every cell that overlaps the provided sphere on the XY plane.
+        //! @param sphere  the sphere to gather cells within
+        //! @param visitor callable with the signature void(CellKey cellKey)
+        template <typename VISITOR>
+        void EnumerateCellsInSphere(const AZ::Sphere& sphere, VISITOR&& visitor) const;
+
+        //! Invokes the visitor for every indexed entity within the provided sphere.
+        //! @param sphere  the sphere to gather entities within
+        //! @param visitor callable with the signature void(const CellEntry& entry, float distanceSquared)
+        template <typename VISITOR>
+        void EnumerateSphere(const AZ::Sphere& sphere, VISITOR&& visitor) const;
+
+        //! Returns the edge length of a single grid cell.
+        //! @return the edge length of a single grid cell
+        float GetCellSize() const;
+
+        //! Returns the number of entities stored in the index.
+        //! @return the number of entities stored in the index
+        uint32_t GetEntityCount() const;
+
+        //! Returns the number of non-empty cells in the index.
+        //! @return the number of non-empty cells in the index
+        uint32_t GetCellCount() const;
+
+        //! Returns the total number of times an entity has moved across a cell boundary.
+        //! @return the total number of times an entity has moved across a cell boundary
+        uint64_t GetCellTransitionCount() const;
+
+    private:
+
+        using Cell = AZStd::vector<CellEntry>;
+        using CellObservers = AZStd::vector<ICellObserver*>; // Sorted so that the observers of two cells can be merged
+
+        struct TrackedEntity
+        {
+            CellKey m_cellKey = 0;
+            uint32_t m_cellIndex = 0;
+        };
+
+        int32_t GetCellCoordinate(float value) const;
+        CellKey GetCellKey(const AZ::Vector3& position) const;
+        static CellKey MakeCellKey(int32_t x, int32_t y);
+
+        void AddToCell(CellKey cellKey, const CellEntry& entry, TrackedEntity& trackedEntity);
+        void RemoveFromCell(const TrackedEntity& trackedEntity);
+        void NotifyCellTransition(CellKey fromCellKey, CellKey toCellKey, const CellEntry& entry);
+        const CellObservers* FindCellObservers(CellKey cellKey) const;
+
+        void InsertActiveNetworkEntities();
+        void OnEntityActivated(AZ::Entity* entity);
+        void OnEntityDeactivated(AZ::Entity* entity);
+
+        float m_cellSize = 1.0f;
+        float m_invCellSize = 1.0f;
+        uint64_t m_cellTransitionCount = 0;
+
+        AZStd::unordered_map<CellKey, Cell> m_cells;
+        AZStd::unordered_map<NetEntityId, TrackedEntity> m_trackedEntities;
+        AZStd::unordered_map<CellKey, CellObservers> m_cellObservers;
+
+        // Transform handlers are stored separately so that the grid bookkeeping stays compact
+        AZStd::unordered_map<NetEntityId, AZ::TransformChangedEvent::Handler> m_transformChangedHandlers;
+
+        AZ::EntityActivatedEvent::Handler m_entityActivatedEventHandler;
+        AZ::EntityDeactivatedEvent::Handler m_entityDeactivatedEventHandler;
+        bool m_isActive = false;
+    };
+}
+
+#include <Source/ReplicationWindows/NetworkEntitySpatialIndex.inl>
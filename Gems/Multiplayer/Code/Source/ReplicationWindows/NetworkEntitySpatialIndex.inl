@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+namespace Multiplayer
+{
+    template <typename VISITOR>
+    inline void NetworkEntitySpatialIndex::EnumerateSphere(const AZ::Sphere& sphere, VISITOR&& visitor) const
+    {
+        const AZ::Vector3& center = sphere.GetCenter();
+        const float radius = sphere.GetRadius();
+        const float radiusSquared = radius * radius;
+
+        const int32_t minX = GetCellCoordinate(center.GetX() - radius);
+        const int32_t maxX = GetCellCoordinate(center.GetX() + radius);
+        const int32_t minY = GetCellCoordinate(center.GetY() - radius);
+        const int32_t maxY = GetCellCoordinate(center.GetY() + radius);
+
+        for (int32_t y = minY; y <= maxY; ++y)
+        {
+            for (int32_t x = minX; x <= maxX; ++x)
+            {
+                auto cellIter = m_cells.find(MakeCellKey(x, y));
+                if (cellIter == m_cells.end())
+                {
+                    continue;
+                }
+
+                for (const CellEntry& entry : cellIter->second)
+                {
+                    const float distanceSquared = center.GetDistanceSq(entry.m_position);
+                    if (distanceSquared <= radiusSquared)
+                    {
+                        visitor(entry, distanceSquared);
+                    }
+                }
+            }
+        }
+    }
+
+    template <typename VISITOR>
+    inline void NetworkEntitySpatialIndex::EnumerateCellsInSphere(const AZ::Sphere& sphere, VISITOR&& visitor) const
+    {
+        const AZ::Vector3& center = sphere.GetCenter();
+        const float radius = sphere.GetRadius();
+        const float radiusSquared = radius * radius;
+
+        const int32_t minX = GetCellCoordinate(center.GetX() - radius);
+        const int32_t maxX = GetCellCoordinate(center.GetX() + radius);
+        const int32_t minY = GetCellCoordinate(center.GetY() - radius);
+        const int32_t maxY = GetCellCoordinate(center.GetY() + radius);
+
+        for (int32_t y = minY; y <= maxY; ++y)
+        {
+            // Distance from the center to the closest point of the cell, corner cells of the bounding square may not touch the sphere
+            const float cellMinY = aznumeric_cast<float>(y) * m_cellSize;
+            const float deltaY = AZStd::max(AZStd::max(cellMinY - center.GetY(), center.GetY() - (cellMinY + m_cellSize)), 0.0f);
+            for (int32_t x = minX; x <= maxX; ++x)
+            {
+                const float cellMinX = aznumeric_cast<float>(x) * m_cellSize;
+                const float deltaX = AZStd::max(AZStd::max(cellMinX - center.GetX(), center.GetX() - (cellMinX + m_cellSize)), 0.0f);
+                if (deltaX * deltaX + deltaY * deltaY <= radiusSquared)
+                {
+                    visitor(MakeCellKey(x, y));
+                }
+            }
+        }
+    }
+
+    inline float NetworkEntitySpatialIndex::GetCellSize() const
+    {
+        return m_cellSize;
+    }
+
+    inline uint32_t NetworkEntitySpatialIndex::GetEntityCount() const
+    {
+        return aznumeric_cast<uint32_t>(m_trackedEntities.size());
+    }
+
+    inline uint32_t NetworkEntitySpatialIndex::GetCellCount() const
+    {
+        return aznumeric_cast<uint32_t>(m_cells.size());
+    }
+
+    inline uint64_t NetworkEntitySpatialIndex::GetCellTransitionCount() const
+    {
+        return m_cellTransitionCount;
+    }
+
+    inline bool NetworkEntitySpatialIndex::IsActive() const
+    {
+        return m_isActive;
+    }
+
+    inline int32_t NetworkEntitySpatialIndex::GetCellCoordinate(float value) const
+    {
+        return static_cast<int32_t>(AZStd::floor(value * m_invCellSize));
+    }
+
+    inline NetworkEntitySpatialIndex::CellKey NetworkEntitySpatialIndex::MakeCellKey(int32_t x, int32_t y)
+    {
+        return (static_cast<CellKey>(static_cast<uint32_t>(x)) << 32) | static_cast<CellKey>(static_cast<uint32_t>(y));
+    }
+
+    inline NetworkEntitySpatialIndex::CellKey NetworkEntitySpatialIndex::GetCellKey(const AZ::Vector3& position) const
+    {
+        return MakeCellKey(GetCellCoordinate(position.GetX()), GetCellCoordinate(position.GetY()));
+    }
+}
@@ -7,7 +7,10 @@
  */
 
 #include <Source/ReplicationWindows/ServerToClientReplicationWindow.h>
+#include <Source/ReplicationWindows/NetworkEntityAwarenessSet.h>
+#include <Source/ReplicationWindows/NetworkEntitySpatialIndex.h>
 #include <Multiplayer/Components/NetBindComponent.h>
+#include <AzFramework/Visibility/EntityBoundsUnionBus.h>
 #include <AzFramework/Visibility/IVisibilitySystem.h>
 #include <AzCore/Component/TransformBus.h>
 #include <AzCore/Console/ILogger.h>
@@ -29,6 +32,20 @@ namespace Multiplayer
         return isPoor ? "poor" : "ideal";
     }
 
+    static bool IsReplicationAllowed(const NetBindComponent* netBindComponent)
+    {
+        // Proxy replication may be disabled
+        return sv_ReplicateServerProxies || (netBindComponent == nullptr) || (netBindComponent->GetNetEntityRole() != NetEntityRole::Server);
+    }
+
+    static bool IsVisibilityEntity(const NetBindComponent* netBindComponent)
+    {
+        // The visibility system only tracks entities with valid bounds. The spatial index holds every network entity with a transform,
+        // so its candidates are held to the same rule as the ones gathered from the visibility system.
+        AzFramework::IEntityBoundsUnion* entityBoundsUnion = AZ::Interface<AzFramework::IEntityBoundsUnion>::Get();
+        return (entityBoundsUnion == nullptr) || entityBoundsUnion->GetEntityLocalBoundsUnion(netBindComponent->GetEntityId()).IsValid();
+    }
+
     ServerToClientReplicationWindow::PrioritizedReplicationCandidate::PrioritizedReplicationCandidate
     (
         const ConstNetworkEntityHandle& entityHandle,
@@ -50,7 +67,12 @@ namespace Multiplayer
         return m_priority < rhs.m_priority;
     }
 
-    ServerToClientReplicationWindow::ServerToClientReplicationWindow(NetworkEntityHandle controlledEntity, const AzNetworking::IConnection* connection)
+    ServerToClientReplicationWindow::ServerToClientReplicationWindow
+    (
+        NetworkEntityHandle controlledEntity,
+        const AzNetworking::IConnection* connection,
+        NetworkEntitySpatialIndex* spatialIndex
+    )
         : m_controlledEntity(controlledEntity)
         , m_entityActivatedEventHandler([this](AZ::Entity* entity) { OnEntityActivated(entity); })
         , m_entityDeactivatedEventHandler([this](AZ::Entity* entity) { OnEntityDeactivated(entity); })
@@ -68,8 +90,15 @@ namespace Multiplayer
 
         AZ::Interface<AZ::ComponentApplicationRequests>::Get()->RegisterEntityActivatedEventHandler(m_entityActivatedEventHandler);
         AZ::Interface<AZ::ComponentApplicationRequests>::Get()->RegisterEntityDeactivatedEventHandler(m_entityDeactivatedEventHandler);
+
+        if ((spatialIndex != nullptr) && spatialIndex->IsActive())
+        {
+            m_awarenessSet = AZStd::make_unique<NetworkEntityAwarenessSet>(*spatialIndex);
+        }
     }
 
+    ServerToClientReplicationWindow::~ServerToClientReplicationWindow() = default;
+
     bool ServerToClientReplicationWindow::ReplicationSetUpdateReady()
     {
         // if we don't have a controlled entity anymore, don't send updates (validate this)
@@ -106,16 +135,12 @@ namespace Multiplayer
 
     void ServerToClientReplicationWindow::UpdateWindow()
     {
-        // clear the candidate queue, we're going to rebuild it
-        ReplicationCandidateQueue clearQueue;
-        clearQueue.get_container().reserve(sv_MaxEntitiesToTrackReplication);
-        m_candidateQueue.swap(clearQueue);
-        m_replicationSet.clear();
-
         NetBindComponent* netBindComponent = m_controlledEntity.GetNetBindComponent();
         if (!netBindComponent || !netBindComponent->HasController())
         {
             // if we don't have a controlled entity, or we no longer have control of the entity, don't run the update
+            ResetReplicationSet();
+            m_rebuildReplicationSet = true;
             return;
         }
 
@@ -124,8 +149,154 @@ namespace Multiplayer
         AZ::TransformInterface* transformInterface = m_controlledEntity.GetEntity()->GetTransform();
         const AZ::Vector3 controlledEntityPosition = transformInterface->GetWorldTranslation();
 
+        const AZ::Sphere awarenessSphere = AZ::Sphere(controlledEntityPosition, sv_ClientAwarenessRadius);
+        if ((m_awarenessSet != nullptr) && m_awarenessSet->IsAttached())
+        {
+            UpdateFromAwarenessSet(awarenessSphere);
+        }
+        else
+        {
+            // clear the candidate queue, we're going to rebuild it
+            ResetReplicationSet();
+            GatherFromVisibilitySystem(awarenessSphere);
+        }
+
+        // Add in Autonomous Entities
+        // Note: Do not add any Client entities after this point, otherwise you stomp over the Autonomous mode
+        m_replicationSet[m_controlledEntity] = { NetEntityRole::Autonomous, 1.0f };  // Always replicate autonomous entities
+
+        //auto hierarchyController = FindController<EntityHierarchyComponent::Authority>(m_ControlledEntity);
+        //if (hierarchyController != nullptr)
+        //{
+        //    CollectControlledEntitiesRecursive(m_replicationSet, *hierarchyController);
+        //}
+    }
+
+    void ServerToClientReplicationWindow::ResetReplicationSet()
+    {
+        ReplicationCandidateQueue clearQueue;
+        clearQueue.get_container().reserve(sv_MaxEntitiesToTrackReplication);
+        m_candidateQueue.swap(clearQueue);
+        m_replicationSet.clear();
+    }
+
+    void ServerToClientReplicationWindow::UpdateFromAwarenessSet(const AZ::Sphere& awarenessSphere)
+    {
+        // The awareness set follows the cell crossings reported by the shared index, so it's only this window's own move to other
+        // cells that touches the index here
+        const bool observedCellsChanged = m_awarenessSet->SetAwarenessSphere(awarenessSphere);
+
+        const AZ::Vector3& controlledEntityPosition = awarenessSphere.GetCenter();
+        const float awarenessRadiusSquared = awarenessSphere.GetRadius() * awarenessSphere.GetRadius();
+        const NetworkEntityAwarenessSet::AwareEntityMap& awareEntities = m_awarenessSet->GetAwareEntities();
+        NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker();
+        IFilterEntityManager* filterEntityManager = GetMultiplayer()->GetFilterEntityManager();
+
+        // Filters can change their verdict at any time, so moving to other cells or having a filter re-evaluates every entity in the
+        // set. So does exceeding the tracked entity limit, which requires picking the best candidates. Otherwise only the entities
+        // that crossed into, out of or moved within the observed cells are handled.
+        if (m_rebuildReplicationSet || observedCellsChanged || (filterEntityManager != nullptr)
+            || (awareEntities.size() > sv_MaxEntitiesToTrackReplication))
+        {
+            ResetReplicationSet();
+            for (const auto& awarePair : awareEntities)
+            {
+                NetBindComponent* entryNetBindComponent = awarePair.second.m_netBindComponent;
+                if (entryNetBindComponent == nullptr)
+                {
+                    continue;
+                }
+
+                // The cells overlapping the sphere also contain entities outside of it
+                const float distanceSquared = controlledEntityPosition.GetDistanceSq(awarePair.second.m_position);
+                if ((distanceSquared > awarenessRadiusSquared) || !IsVisibilityEntity(entryNetBindComponent))
+                {
+                    continue;
+                }
+
+                if (filterEntityManager && filterEntityManager->IsEntityFiltered(entryNetBindComponent->GetEntity(), m_controlledEntity, m_connection->GetConnectionId()))
+                {
+                    continue;
+                }
+
+                const float priority = (distanceSquared > 0.0f) ? 1.0f / distanceSquared : 0.0f;
+                NetworkEntityHandle entityHandle(entryNetBindComponent, networkEntityTracker);
+                AddEntityToReplicationSet(entityHandle, priority, distanceSquared);
+            }
+
+            // A truncated or filtered set can't be patched from the deltas alone
+            m_rebuildReplicationSet = (filterEntityManager != nullptr) || (awareEntities.size() > sv_MaxEntitiesToTrackReplication);
+        }
+        else
+        {
+            for (NetEntityId netEntityId : m_awarenessSet->GetLeftEntities())
+            {
+                m_replicationSet.erase(ConstNetworkEntityHandle(nullptr, netEntityId, networkEntityTracker));
+            }
+
+            // Priorities and the exact radius are relative to the controlled entity, so all members need to be re-evaluated once it
+            // moved. Otherwise only the members that entered or moved can have changed.
+            if (!controlledEntityPosition.IsClose(m_awarenessCenter))
+            {
+                for (const auto& awarePair : awareEntities)
+                {
+                    UpdateAwareEntity(awarePair.first, awarePair.second, awarenessSphere);
+                }
+            }
+            else
+            {
+                auto updateChangedEntities = [this, &awareEntities, &awarenessSphere](const AZStd::vector<NetEntityId>& changedEntities)
+                {
+                    for (NetEntityId netEntityId : changedEntities)
+                    {
+                        // An entity may have left and entered again, so the final membership decides
+                        auto awareIter = awareEntities.find(netEntityId);
+                        if (awareIter != awareEntities.end())
+                        {
+                            UpdateAwareEntity(awareIter->first, awareIter->second, awarenessSphere);
+                        }
+                    }
+                };
+                updateChangedEntities(m_awarenessSet->GetEnteredEntities());
+                updateChangedEntities(m_awarenessSet->GetMovedEntities());
+            }
+        }
+
+        m_awarenessCenter = controlledEntityPosition;
+        m_awarenessSet->ClearChanges();
+    }
+
+    void ServerToClientReplicationWindow::UpdateAwareEntity(NetEntityId netEntityId, const NetworkEntityAwarenessSet::AwareEntity& awareEntity, const AZ::Sphere& awarenessSphere)
+    {
+        NetBindComponent* entryNetBindComponent = awareEntity.m_netBindComponent;
+        if ((entryNetBindComponent == nullptr) || (netEntityId == m_controlledEntity.GetNetEntityId()))
+        {
+            return;
+        }
+
+        const ConstNetworkEntityHandle entityHandle(entryNetBindComponent, GetNetworkEntityTracker());
+        const float distanceSquared = awarenessSphere.GetCenter().GetDistanceSq(awareEntity.m_position);
+        if (distanceSquared > awarenessSphere.GetRadius() * awarenessSphere.GetRadius())
+        {
+            m_replicationSet.erase(entityHandle);
+            return;
+        }
+
+        const float priority = (distanceSquared > 0.0f) ? 1.0f / distanceSquared : 0.0f;
+        auto replicationIter = m_replicationSet.find(entityHandle);
+        if (replicationIter != m_replicationSet.end())
+        {
+            replicationIter->second.m_priority = priority;
+        }
+        else if (IsReplicationAllowed(entryNetBindComponent) && IsVisibilityEntity(entryNetBindComponent))
+        {
+            m_replicationSet[entityHandle] = { NetEntityRole::Client, priority };
+        }
+    }
+
+    void ServerToClientReplicationWindow::GatherFromVisibilitySystem(const AZ::Sphere& awarenessSphere)
+    {
         AZStd::vector<AzFramework::VisibilityEntry*> gatheredEntries;
-        AZ::Sphere awarenessSphere = AZ::Sphere(controlledEntityPosition, sv_ClientAwarenessRadius);
         AZ::Interface<AzFramework::IVisibilitySystem>::Get()->GetDefaultVisibilityScene()->Enumerate(awarenessSphere, [&gatheredEntries](const AzFramework::IVisibilityScene::NodeData& nodeData)
             {
                 gatheredEntries.reserve(gatheredEntries.size() + nodeData.m_entries.size());
@@ -139,7 +310,8 @@ namespace Multiplayer
             }
         );
 
-        NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker();        
+        const AZ::Vector3& controlledEntityPosition = awarenessSphere.GetCenter();
+        NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker();
         IFilterEntityManager* filterEntityManager = GetMultiplayer()->GetFilterEntityManager();
 
         // Add all the neighbors
@@ -165,16 +337,6 @@ namespace Multiplayer
                 AddEntityToReplicationSet(entityHandle, priority, gatherDistanceSquared);
             }
         }
-
-        // Add in Autonomous Entities
-        // Note: Do not add any Client entities after this point, otherwise you stomp over the Autonomous mode
-        m_replicationSet[m_controlledEntity] = { NetEntityRole::Autonomous, 1.0f };  // Always replicate autonomous entities
-
-        //auto hierarchyController = FindController<EntityHierarchyComponent::Authority>(m_ControlledEntity);
-        //if (hierarchyController != nullptr)
-        //{
-        //    CollectControlledEntitiesRecursive(m_replicationSet, *hierarchyController);
-        //}
     }
 
     void ServerToClientReplicationWindow::DebugDraw() const
@@ -276,14 +438,9 @@ namespace Multiplayer
     {
         // Assumption: the entity has been checked for filtering prior to this call.
 
-        if (!sv_ReplicateServerProxies)
+        if (!IsReplicationAllowed(entityHandle.GetNetBindComponent()))
         {
-            NetBindComponent* netBindComponent = entityHandle.GetNetBindComponent();
-            if ((netBindComponent != nullptr) && (netBindComponent->GetNetEntityRole() == NetEntityRole::Server))
-            {
-                // Proxy replication disabled
-                return;
-            }
+            return;
         }
 
         const bool isQueueFull = (m_candidateQueue.size() >= sv_MaxEntitiesToTrackReplication);  // See if have the maximum number of entities in our set
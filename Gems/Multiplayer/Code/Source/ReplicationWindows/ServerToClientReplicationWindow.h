@@ -11,6 +11,7 @@
 #include <Multiplayer/IMultiplayer.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
 #include <Multiplayer/ReplicationWindows/IReplicationWindow.h>
+#include <Source/ReplicationWindows/NetworkEntityAwarenessSet.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzCore/Component/EntityBus.h>
 #include <AzCore/EBus/ScheduledEvent.h>
@@ -20,6 +21,7 @@
 namespace Multiplayer
 {
     class NetSystemComponent;
+    class NetworkEntitySpatialIndex;
 
     class ServerToClientReplicationWindow
         : public IReplicationWindow
@@ -38,7 +40,12 @@ namespace Multiplayer
         // we sort lowest priority first, so that we can easily keep the biggest N priorities
         using ReplicationCandidateQueue = AZStd::priority_queue<PrioritizedReplicationCandidate>;
 
-        ServerToClientReplicationWindow(NetworkEntityHandle controlledEntity, const AzNetworking::IConnection* connection);
+        //! Constructor.
+        //! @param controlledEntity the entity controlled by the remote connection
+        //! @param connection       the connection this window replicates to
+        //! @param spatialIndex     optional shared spatial index to track candidates with, falls back to the visibility system if nullptr
+        ServerToClientReplicationWindow(NetworkEntityHandle controlledEntity, const AzNetworking::IConnection* connection, NetworkEntitySpatialIndex* spatialIndex = nullptr);
+        ~ServerToClientReplicationWindow() override;
 
         //! IReplicationWindow interface
         //! @{
@@ -56,6 +63,10 @@ namespace Multiplayer
 
         //void CollectControlledEntitiesRecursive(ReplicationSet& replicationSet, EntityHierarchyComponent::Authority& hierarchyController);
 
+        void ResetReplicationSet();
+        void UpdateFromAwarenessSet(const AZ::Sphere& awarenessSphere);
+        void UpdateAwareEntity(NetEntityId netEntityId, const NetworkEntityAwarenessSet::AwareEntity& awareEntity, const AZ::Sphere& awarenessSphere);
+        void GatherFromVisibilitySystem(const AZ::Sphere& awarenessSphere);
         void EvaluateConnection();
         void AddEntityToReplicationSet(ConstNetworkEntityHandle& entityHandle, float priority, float distanceSquared);
 
@@ -76,6 +87,9 @@ namespace Multiplayer
         //NetBindComponent* m_controlledNetBindComponent = nullptr;
 
         const AzNetworking::IConnection* m_connection = nullptr;
+        AZStd::unique_ptr<NetworkEntityAwarenessSet> m_awarenessSet; ///< Entities in the spatial index cells around the controlled entity
+        AZ::Vector3 m_awarenessCenter = AZ::Vector3::CreateZero(); ///< Position of the controlled entity in the last awareness set update
+        bool m_rebuildReplicationSet = true; ///< Whether the next update has to re-evaluate every entity in the awareness set
         float m_minPriorityReplicated = 0.0f; ///< Lowest replicated entity priority in last update
 
         // Cached values to detect a poor network connection
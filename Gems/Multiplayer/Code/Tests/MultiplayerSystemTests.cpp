@@ -6,13 +6,20 @@
  *
  */
 
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/UnitTest/UnitTest.h>
 #include <AzCore/Name/NameDictionary.h>
 #include <AzCore/Name/Name.h>
 #include <AzFramework/Spawnable/SpawnableSystemComponent.h>
 #include <AzNetworking/Framework/NetworkingSystemComponent.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
 #include <AzTest/AzTest.h>
+#include <Multiplayer/Components/NetBindComponent.h>
+#include <Multiplayer/ReplicationWindows/IReplicationWindow.h>
+#include <ConnectionData/ServerToClientConnectionData.h>
+#include <NetworkEntity/NetworkEntityTracker.h>
 #include <MultiplayerSystemComponent.h>
 #include <IMultiplayerConnectionMock.h>
 
@@ -74,6 +81,57 @@ namespace UnitTest
         Multiplayer::MultiplayerSystemComponent* m_mpComponent = nullptr;
     };
 
+    // Replication window that always contains the same set of entities
+    class FixedReplicationWindow
+        : public Multiplayer::IReplicationWindow
+    {
+    public:
+        explicit FixedReplicationWindow(const Multiplayer::ReplicationSet& replicationSet)
+            : m_replicationSet(replicationSet)
+        {
+            ;
+        }
+
+        bool ReplicationSetUpdateReady() override
+        {
+            return true;
+        }
+
+        const Multiplayer::ReplicationSet& GetReplicationSet() const override
+        {
+            return m_replicationSet;
+        }
+
+        uint32_t GetMaxProxyEntityReplicatorSendCount() const override
+        {
+            return AZStd::numeric_limits<uint32_t>::max();
+        }
+
+        bool IsInWindow(const Multiplayer::ConstNetworkEntityHandle& entityHandle, Multiplayer::NetEntityRole& outNetworkRole) const override
+        {
+            auto iter = m_replicationSet.find(entityHandle);
+            if (iter != m_replicationSet.end())
+            {
+                outNetworkRole = iter->second.m_netEntityRole;
+                return true;
+            }
+            return false;
+        }
+
+        void UpdateWindow() override
+        {
+            ;
+        }
+
+        void DebugDraw() const override
+        {
+            ;
+        }
+
+    private:
+        Multiplayer::ReplicationSet m_replicationSet;
+    };
+
     TEST_F(MultiplayerSystemTests, TestInitEvent)
     {
         m_mpComponent->InitializeMultiplayer(Multiplayer::MultiplayerAgentType::DedicatedServer);
@@ -106,5 +164,130 @@ namespace UnitTest
         m_mpComponent->OnDisconnect(&connMock1, AzNetworking::DisconnectReason::None, AzNetworking::TerminationEndpoint::Local);
         m_mpComponent->OnDisconnect(&connMock2, AzNetworking::DisconnectReason::None, AzNetworking::TerminationEndpoint::Local);
     }
-}
 
+    TEST_F(MultiplayerSystemTests, TestDeferredPropertySentStats)
+    {
+        const Multiplayer::NetComponentId netComponentId = Multiplayer::NetComponentId{ 0 };
+        const Multiplayer::PropertyIndex propertyIndex = Multiplayer::PropertyIndex{ 1 };
+        Multiplayer::MultiplayerStats& stats = m_mpComponent->GetStats();
+        stats.ReserveComponentStats(netComponentId, 2, 0);
+
+        Multiplayer::MultiplayerStats::DeferredPropertySentList deferredList;
+        {
+            Multiplayer::MultiplayerStats::ScopedDeferPropertySent deferPropertySent(deferredList);
+            stats.RecordPropertySent(netComponentId, propertyIndex, 16);
+            stats.RecordPropertySent(netComponentId, propertyIndex, 8);
+        }
+
+        // Nothing should be recorded until the deferred metrics are applied
+        EXPECT_EQ(deferredList.size(), 2);
+        EXPECT_EQ(stats.CalculateComponentPropertyUpdateSentMetrics(netComponentId).m_totalCalls, 0);
+
+        stats.ApplyDeferredPropertySent(deferredList);
+        EXPECT_EQ(stats.CalculateComponentPropertyUpdateSentMetrics(netComponentId).m_totalCalls, 2);
+        EXPECT_EQ(stats.CalculateComponentPropertyUpdateSentMetrics(netComponentId).m_totalBytes, 24);
+
+        // Once the scope has ended metrics are recorded immediately again
+        stats.RecordPropertySent(netComponentId, propertyIndex, 4);
+        EXPECT_EQ(stats.CalculateComponentPropertyUpdateSentMetrics(netComponentId).m_totalCalls, 3);
+    }
+
+    TEST_F(MultiplayerSystemTests, TestParallelConnectionUpdatesMatchSerial)
+    {
+        constexpr uint32_t ConnectionCount = 16;
+        constexpr uint32_t EntityCount = 32;
+        constexpr uint32_t TickCount = 3;
+
+        AZ::JobManagerDesc jobDesc;
+        AZ::JobManagerThreadDesc threadDesc;
+        for (uint32_t threadCount = 0; threadCount < 4; ++threadCount)
+        {
+            jobDesc.m_workerThreads.push_back(threadDesc);
+        }
+        AZ::JobManager* jobManager = aznew AZ::JobManager(jobDesc);
+        AZ::JobContext* jobContext = aznew AZ::JobContext(*jobManager);
+        AZ::JobContext::SetGlobalContext(jobContext);
+
+        Multiplayer::INetworkEntityManager* networkEntityManager = m_mpComponent->GetNetworkEntityManager();
+        AZStd::vector<AZStd::unique_ptr<AZ::Entity>> entities;
+        Multiplayer::ReplicationSet replicationSet;
+        for (uint32_t index = 0; index < EntityCount; ++index)
+        {
+            entities.emplace_back(AZStd::make_unique<AZ::Entity>());
+            entities.back()->CreateComponent<Multiplayer::NetBindComponent>();
+            networkEntityManager->SetupNetEntity(entities.back().get(), Multiplayer::PrefabEntityId(), Multiplayer::NetEntityRole::Authority);
+            Multiplayer::EntityReplicationData& replicationData = replicationSet[entities.back()->FindComponent<Multiplayer::NetBindComponent>()->GetEntityHandle()];
+            replicationData.m_netEntityRole = Multiplayer::NetEntityRole::Client;
+        }
+        const Multiplayer::NetworkEntityHandle controlledEntity = entities.front()->FindComponent<Multiplayer::NetBindComponent>()->GetEntityHandle();
+
+        // Runs the same ticks over a fresh set of connections and returns every serialized packet, in send order per connection
+        using SentPackets = AZStd::vector<AZStd::vector<uint8_t>>;
+        auto runConnectionUpdates = [this, &replicationSet, &controlledEntity](bool allowParallel)
+        {
+            AZStd::vector<SentPackets> sentPackets(ConnectionCount);
+            AZStd::vector<AZStd::unique_ptr<::testing::NiceMock<IMultiplayerConnectionMock>>> connections;
+            AZStd::vector<Multiplayer::IConnectionData*> connectionDatas;
+            for (uint32_t index = 0; index < ConnectionCount; ++index)
+            {
+                connections.emplace_back(AZStd::make_unique<::testing::NiceMock<IMultiplayerConnectionMock>>
+                    (aznumeric_cast<AzNetworking::ConnectionId>(index), AzNetworking::IpAddress(), AzNetworking::ConnectionRole::Acceptor));
+                IMultiplayerConnectionMock& connection = *connections.back();
+                ON_CALL(connection, GetConnectionMtu()).WillByDefault(::testing::Return(AzNetworking::MaxUdpTransmissionUnit));
+                ON_CALL(connection, SendReliablePacket(::testing::_)).WillByDefault(::testing::Return(true));
+                ON_CALL(connection, SendUnreliablePacket(::testing::_)).WillByDefault(::testing::Invoke([&packets = sentPackets[index]](const AzNetworking::IPacket& packet)
+                {
+                    AZStd::vector<uint8_t> buffer(AzNetworking::MaxUdpTransmissionUnit * 4);
+                    AzNetworking::NetworkInputSerializer serializer(buffer.data(), aznumeric_cast<uint32_t>(buffer.size()));
+                    AZStd::unique_ptr<AzNetworking::IPacket> packetCopy = packet.Clone();
+                    EXPECT_TRUE(packetCopy->Serialize(serializer));
+                    buffer.resize(serializer.GetSize());
+                    packets.push_back(AZStd::move(buffer));
+                    return AzNetworking::PacketId{ aznumeric_cast<uint32_t>(packets.size()) };
+                }));
+
+                Multiplayer::ServerToClientConnectionData* connectionData = new Multiplayer::ServerToClientConnectionData(&connection, *m_mpComponent, controlledEntity);
+                connectionData->SetCanSendUpdates(true);
+                connectionData->GetReplicationManager().SetReplicationWindow(AZStd::make_unique<FixedReplicationWindow>(replicationSet));
+                connectionDatas.push_back(connectionData);
+            }
+
+            for (uint32_t tick = 0; tick < TickCount; ++tick)
+            {
+                m_mpComponent->UpdateConnections(connectionDatas, AZ::TimeMs{ tick * 100 }, allowParallel);
+            }
+
+            for (Multiplayer::IConnectionData* connectionData : connectionDatas)
+            {
+                delete connectionData;
+            }
+            return sentPackets;
+        };
+
+        const AZStd::vector<SentPackets> serialPackets = runConnectionUpdates(false);
+        const AZStd::vector<SentPackets> parallelPackets = runConnectionUpdates(true);
+
+        ASSERT_EQ(serialPackets.size(), parallelPackets.size());
+        for (uint32_t index = 0; index < ConnectionCount; ++index)
+        {
+            // Every entity in the window is created on the first tick, so something must have been sent
+            EXPECT_FALSE(serialPackets[index].empty());
+            ASSERT_EQ(serialPackets[index].size(), parallelPackets[index].size());
+            for (size_t packetIndex = 0; packetIndex < serialPackets[index].size(); ++packetIndex)
+            {
+                EXPECT_EQ(serialPackets[index][packetIndex], parallelPackets[index][packetIndex]);
+            }
+        }
+
+        Multiplayer::NetworkEntityTracker* networkEntityTracker = networkEntityManager->GetNetworkEntityTracker();
+        for (AZStd::unique_ptr<AZ::Entity>& entity : entities)
+        {
+            networkEntityTracker->erase(entity->FindComponent<Multiplayer::NetBindComponent>()->GetNetEntityId());
+        }
+        entities.clear();
+
+        AZ::JobContext::SetGlobalContext(nullptr);
+        delete jobContext;
+        delete jobManager;
+    }
+}
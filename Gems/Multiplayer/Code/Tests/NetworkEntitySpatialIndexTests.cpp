@@ -0,0 +1,350 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/Random.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzTest/AzTest.h>
+#include <ReplicationWindows/NetworkEntityAwarenessSet.h>
+#include <ReplicationWindows/NetworkEntitySpatialIndex.h>
+
+namespace UnitTest
+{
+    using namespace Multiplayer;
+
+    class NetworkEntitySpatialIndexTests
+        : public AllocatorsFixture
+    {
+    public:
+        static AZStd::unordered_set<NetEntityId> Gather(const NetworkEntitySpatialIndex& index, const AZ::Sphere& sphere)
+        {
+            AZStd::unordered_set<NetEntityId> result;
+            index.EnumerateSphere(sphere, [&result](const NetworkEntitySpatialIndex::CellEntry& entry, [[maybe_unused]] float distanceSquared)
+            {
+                result.insert(entry.m_netEntityId);
+            });
+            return result;
+        }
+    };
+
+    TEST_F(NetworkEntitySpatialIndexTests, EnumerateSphereReturnsOnlyEntitiesInRange)
+    {
+        NetworkEntitySpatialIndex index(10.0f);
+        index.InsertEntity(NetEntityId{ 1 }, nullptr, AZ::Vector3(0.0f, 0.0f, 0.0f));
+        index.InsertEntity(NetEntityId{ 2 }, nullptr, AZ::Vector3(15.0f, 0.0f, 0.0f));
+        index.InsertEntity(NetEntityId{ 3 }, nullptr, AZ::Vector3(-35.0f, 5.0f, 0.0f));
+        index.InsertEntity(NetEntityId{ 4 }, nullptr, AZ::Vector3(0.0f, 0.0f, 100.0f));
+        EXPECT_EQ(index.GetEntityCount(), 4);
+
+        const AZStd::unordered_set<NetEntityId> gathered = Gather(index, AZ::Sphere(AZ::Vector3::CreateZero(), 20.0f));
+        EXPECT_EQ(gathered.size(), 2);
+        EXPECT_EQ(gathered.count(NetEntityId{ 1 }), 1);
+        EXPECT_EQ(gathered.count(NetEntityId{ 2 }), 1);
+    }
+
+    TEST_F(NetworkEntitySpatialIndexTests, UpdateEntityTracksCellTransitions)
+    {
+        NetworkEntitySpatialIndex index(10.0f);
+        index.InsertEntity(NetEntityId{ 1 }, nullptr, AZ::Vector3(1.0f, 1.0f, 0.0f));
+        index.InsertEntity(NetEntityId{ 2 }, nullptr, AZ::Vector3(2.0f, 2.0f, 0.0f));
+
+        // Movement within a cell only updates the cached position
+        EXPECT_FALSE(index.UpdateEntity(NetEntityId{ 1 }, AZ::Vector3(5.0f, 5.0f, 0.0f)));
+        EXPECT_EQ(index.GetCellTransitionCount(), 0);
+        EXPECT_EQ(index.GetCellCount(), 1);
+
+        EXPECT_TRUE(index.UpdateEntity(NetEntityId{ 1 }, AZ::Vector3(-5.0f, 5.0f, 0.0f)));
+        EXPECT_EQ(index.GetCellTransitionCount(), 1);
+        EXPECT_EQ(index.GetCellCount(), 2);
+
+        const AZStd::unordered_set<NetEntityId> gathered = Gather(index, AZ::Sphere(AZ::Vector3(-5.0f, 5.0f, 0.0f), 1.0f));
+        EXPECT_EQ(gathered.size(), 1);
+        EXPECT_EQ(gathered.count(NetEntityId{ 1 }), 1);
+
+        // Unknown entities are ignored
+        EXPECT_FALSE(index.UpdateEntity(NetEntityId{ 3 }, AZ::Vector3::CreateZero()));
+    }
+
+    TEST_F(NetworkEntitySpatialIndexTests, RemoveEntityPreservesCellNeighbours)
+    {
+        NetworkEntitySpatialIndex index(10.0f);
+        for (uint32_t i = 0; i < 8; ++i)
+        {
+            index.InsertEntity(NetEntityId{ i }, nullptr, AZ::Vector3(aznumeric_cast<float>(i), 0.0f, 0.0f));
+        }
+
+        index.RemoveEntity(NetEntityId{ 2 });
+        index.RemoveEntity(NetEntityId{ 7 });
+        index.RemoveEntity(NetEntityId{ 0 });
+        EXPECT_EQ(index.GetEntityCount(), 5);
+
+        // Entities moved around by the swap removal must still be individually addressable
+        EXPECT_TRUE(index.UpdateEntity(NetEntityId{ 6 }, AZ::Vector3(50.0f, 0.0f, 0.0f)));
+        index.RemoveEntity(NetEntityId{ 5 });
+
+        const AZStd::unordered_set<NetEntityId> gathered = Gather(index, AZ::Sphere(AZ::Vector3::CreateZero(), 10.0f));
+        EXPECT_EQ(gathered.size(), 3);
+        EXPECT_EQ(gathered.count(NetEntityId{ 1 }), 1);
+        EXPECT_EQ(gathered.count(NetEntityId{ 3 }), 1);
+        EXPECT_EQ(gathered.count(NetEntityId{ 4 }), 1);
+
+        index.Clear();
+        EXPECT_EQ(index.GetEntityCount(), 0);
+        EXPECT_EQ(index.GetCellCount(), 0);
+    }
+
+    TEST_F(NetworkEntitySpatialIndexTests, AwarenessSetOnlyReportsCellCrossings)
+    {
+        NetworkEntitySpatialIndex index(10.0f);
+        index.InsertEntity(NetEntityId{ 1 }, nullptr, AZ::Vector3(1.0f, 1.0f, 0.0f));
+        index.InsertEntity(NetEntityId{ 2 }, nullptr, AZ::Vector3(55.0f, 5.0f, 0.0f));
+
+        NetworkEntityAwarenessSet awarenessSet(index);
+        EXPECT_TRUE(awarenessSet.SetAwarenessSphere(AZ::Sphere(AZ::Vector3(5.0f, 5.0f, 0.0f), 12.0f)));
+        EXPECT_FALSE(awarenessSet.SetAwarenessSphere(AZ::Sphere(AZ::Vector3(6.0f, 4.0f, 0.0f), 12.0f)));
+        ASSERT_EQ(awarenessSet.GetEnteredEntities().size(), 1);
+        EXPECT_EQ(awarenessSet.GetEnteredEntities()[0], NetEntityId{ 1 });
+        EXPECT_EQ(awarenessSet.GetAwareEntities().size(), 1);
+        awarenessSet.ClearChanges();
+
+        // Moves within an observed cell are reported as moves, moves between unobserved cells aren't reported at all
+        index.UpdateEntity(NetEntityId{ 1 }, AZ::Vector3(9.0f, 9.0f, 0.0f));
+        index.UpdateEntity(NetEntityId{ 2 }, AZ::Vector3(45.0f, 5.0f, 0.0f));
+        EXPECT_TRUE(awarenessSet.GetEnteredEntities().empty());
+        EXPECT_TRUE(awarenessSet.GetLeftEntities().empty());
+        ASSERT_EQ(awarenessSet.GetMovedEntities().size(), 1);
+        EXPECT_EQ(awarenessSet.GetMovedEntities()[0], NetEntityId{ 1 });
+        EXPECT_TRUE(awarenessSet.GetAwareEntities().at(NetEntityId{ 1 }).m_position.IsClose(AZ::Vector3(9.0f, 9.0f, 0.0f)));
+
+        // Moves between observed cells refresh the position, each member is only listed as moved once
+        index.UpdateEntity(NetEntityId{ 1 }, AZ::Vector3(-5.0f, 5.0f, 0.0f));
+        EXPECT_TRUE(awarenessSet.GetEnteredEntities().empty());
+        EXPECT_EQ(awarenessSet.GetMovedEntities().size(), 1);
+        EXPECT_TRUE(awarenessSet.GetAwareEntities().at(NetEntityId{ 1 }).m_position.IsClose(AZ::Vector3(-5.0f, 5.0f, 0.0f)));
+        awarenessSet.ClearChanges();
+        EXPECT_TRUE(awarenessSet.GetMovedEntities().empty());
+
+        index.UpdateEntity(NetEntityId{ 2 }, AZ::Vector3(15.0f, 5.0f, 0.0f));
+        index.UpdateEntity(NetEntityId{ 1 }, AZ::Vector3(-45.0f, 5.0f, 0.0f));
+        ASSERT_EQ(awarenessSet.GetEnteredEntities().size(), 1);
+        EXPECT_EQ(awarenessSet.GetEnteredEntities()[0], NetEntityId{ 2 });
+        ASSERT_EQ(awarenessSet.GetLeftEntities().size(), 1);
+        EXPECT_EQ(awarenessSet.GetLeftEntities()[0], NetEntityId{ 1 });
+        EXPECT_EQ(awarenessSet.GetAwareEntities().size(), 1);
+        awarenessSet.ClearChanges();
+
+        index.RemoveEntity(NetEntityId{ 2 });
+        ASSERT_EQ(awarenessSet.GetLeftEntities().size(), 1);
+        EXPECT_TRUE(awarenessSet.GetAwareEntities().empty());
+    }
+
+    TEST_F(NetworkEntitySpatialIndexTests, AwarenessSetFollowsItsSphere)
+    {
+        NetworkEntitySpatialIndex index(10.0f);
+        index.InsertEntity(NetEntityId{ 1 }, nullptr, AZ::Vector3(5.0f, 5.0f, 0.0f));
+        index.InsertEntity(NetEntityId{ 2 }, nullptr, AZ::Vector3(105.0f, 5.0f, 0.0f));
+
+        NetworkEntityAwarenessSet awarenessSet(index);
+        awarenessSet.SetAwarenessSphere(AZ::Sphere(AZ::Vector3(5.0f, 5.0f, 0.0f), 4.0f));
+        awarenessSet.ClearChanges();
+
+        EXPECT_TRUE(awarenessSet.SetAwarenessSphere(AZ::Sphere(AZ::Vector3(105.0f, 5.0f, 0.0f), 4.0f)));
+        ASSERT_EQ(awarenessSet.GetLeftEntities().size(), 1);
+        EXPECT_EQ(awarenessSet.GetLeftEntities()[0], NetEntityId{ 1 });
+        ASSERT_EQ(awarenessSet.GetEnteredEntities().size(), 1);
+        EXPECT_EQ(awarenessSet.GetEnteredEntities()[0], NetEntityId{ 2 });
+
+        // The set lets go of a cleared index that isn't active
+        index.Clear();
+        EXPECT_FALSE(awarenessSet.IsAttached());
+        EXPECT_TRUE(awarenessSet.GetAwareEntities().empty());
+        EXPECT_FALSE(awarenessSet.SetAwarenessSphere(AZ::Sphere(AZ::Vector3(5.0f, 5.0f, 0.0f), 4.0f)));
+    }
+
+    TEST_F(NetworkEntitySpatialIndexTests, AwarenessSetObservesRebuiltIndex)
+    {
+        NetworkEntitySpatialIndex index(10.0f);
+        index.Activate();
+        index.InsertEntity(NetEntityId{ 1 }, nullptr, AZ::Vector3(5.0f, 5.0f, 0.0f));
+
+        NetworkEntityAwarenessSet awarenessSet(index);
+        awarenessSet.SetAwarenessSphere(AZ::Sphere(AZ::Vector3(5.0f, 5.0f, 0.0f), 4.0f));
+        EXPECT_EQ(awarenessSet.GetAwareEntities().size(), 1);
+        awarenessSet.ClearChanges();
+
+        // Clearing an active index rebuilds it from the active network entities, the set stays attached and observes it again
+        index.Clear();
+        EXPECT_TRUE(awarenessSet.IsAttached());
+        EXPECT_TRUE(awarenessSet.GetAwareEntities().empty());
+        ASSERT_EQ(awarenessSet.GetLeftEntities().size(), 1);
+        awarenessSet.ClearChanges();
+
+        index.InsertEntity(NetEntityId{ 2 }, nullptr, AZ::Vector3(6.0f, 6.0f, 0.0f));
+        EXPECT_TRUE(awarenessSet.SetAwarenessSphere(AZ::Sphere(AZ::Vector3(5.0f, 5.0f, 0.0f), 4.0f)));
+        ASSERT_EQ(awarenessSet.GetEnteredEntities().size(), 1);
+        EXPECT_EQ(awarenessSet.GetEnteredEntities()[0], NetEntityId{ 2 });
+
+        index.Deactivate();
+        EXPECT_FALSE(awarenessSet.IsAttached());
+    }
+}
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    using namespace Multiplayer;
+
+    //! Simulates the per update candidate gathering of many replication windows over a large population of moving entities.
+    class NetworkEntitySpatialIndexBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr uint32_t EntityCount = 50000;
+        static constexpr float WorldExtent = 8000.0f;
+        static constexpr float AwarenessRadius = 500.0f;
+        static constexpr float CellSize = 128.0f;
+
+        using UnitTest::AllocatorsBenchmarkFixture::SetUp;
+        using UnitTest::AllocatorsBenchmarkFixture::TearDown;
+
+        void SetUp(benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            m_index = AZStd::make_unique<NetworkEntitySpatialIndex>(CellSize);
+            m_positions.resize(EntityCount);
+            for (uint32_t i = 0; i < EntityCount; ++i)
+            {
+                m_positions[i] = RandomPosition();
+                m_index->InsertEntity(NetEntityId{ i }, nullptr, m_positions[i]);
+            }
+
+            const uint32_t connectionCount = aznumeric_cast<uint32_t>(state.range(0));
+            m_connectionPositions.resize(connectionCount);
+            for (AZ::Vector3& position : m_connectionPositions)
+            {
+                position = RandomPosition();
+            }
+        }
+
+        void TearDown(benchmark::State& state) override
+        {
+            m_index.reset();
+            m_positions = {};
+            m_connectionPositions = {};
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        //! Moves a fraction of the entity population by a small random offset, as a server tick would.
+        void MoveEntities()
+        {
+            constexpr uint32_t MovedPerTick = EntityCount / 20;
+            for (uint32_t i = 0; i < MovedPerTick; ++i)
+            {
+                const uint32_t entityIndex = m_random.GetRandom() % EntityCount;
+                const AZ::Vector3 offset(m_random.GetRandomFloat() * 8.0f - 4.0f, m_random.GetRandomFloat() * 8.0f - 4.0f, 0.0f);
+                m_positions[entityIndex] += offset;
+                m_index->UpdateEntity(NetEntityId{ entityIndex }, m_positions[entityIndex]);
+            }
+        }
+
+        AZ::Vector3 RandomPosition()
+        {
+            return AZ::Vector3(m_random.GetRandomFloat() * WorldExtent, m_random.GetRandomFloat() * WorldExtent, 0.0f);
+        }
+
+        AZStd::unique_ptr<NetworkEntitySpatialIndex> m_index;
+        AZStd::vector<AZ::Vector3> m_positions;
+        AZStd::vector<AZ::Vector3> m_connectionPositions;
+        AZ::SimpleLcgRandom m_random;
+    };
+
+    BENCHMARK_DEFINE_F(NetworkEntitySpatialIndexBenchmark, GatherSpatialIndex)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            MoveEntities();
+
+            uint32_t gatheredCount = 0;
+            for (const AZ::Vector3& connectionPosition : m_connectionPositions)
+            {
+                m_index->EnumerateSphere(AZ::Sphere(connectionPosition, AwarenessRadius),
+                    [&gatheredCount](const NetworkEntitySpatialIndex::CellEntry&, float) { ++gatheredCount; });
+            }
+            benchmark::DoNotOptimize(gatheredCount);
+        }
+        state.SetItemsProcessed(state.iterations() * m_connectionPositions.size());
+    }
+
+    // Reference point, every connection evaluates every entity
+    BENCHMARK_DEFINE_F(NetworkEntitySpatialIndexBenchmark, GatherBruteForce)(benchmark::State& state)
+    {
+        const float radiusSquared = AwarenessRadius * AwarenessRadius;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            MoveEntities();
+
+            uint32_t gatheredCount = 0;
+            for (const AZ::Vector3& connectionPosition : m_connectionPositions)
+            {
+                for (const AZ::Vector3& position : m_positions)
+                {
+                    gatheredCount += (connectionPosition.GetDistanceSq(position) <= radiusSquared) ? 1 : 0;
+                }
+            }
+            benchmark::DoNotOptimize(gatheredCount);
+        }
+        state.SetItemsProcessed(state.iterations() * m_connectionPositions.size());
+    }
+
+    // Every connection keeps its own awareness set and only handles the entities that crossed into or out of its cells
+    BENCHMARK_DEFINE_F(NetworkEntitySpatialIndexBenchmark, TrackAwarenessSets)(benchmark::State& state)
+    {
+        AZStd::vector<AZStd::unique_ptr<NetworkEntityAwarenessSet>> awarenessSets;
+        awarenessSets.reserve(m_connectionPositions.size());
+        for (const AZ::Vector3& connectionPosition : m_connectionPositions)
+        {
+            awarenessSets.push_back(AZStd::make_unique<NetworkEntityAwarenessSet>(*m_index));
+            awarenessSets.back()->SetAwarenessSphere(AZ::Sphere(connectionPosition, AwarenessRadius));
+            awarenessSets.back()->ClearChanges();
+        }
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            MoveEntities();
+
+            uint32_t changedCount = 0;
+            for (size_t i = 0; i < awarenessSets.size(); ++i)
+            {
+                m_connectionPositions[i] += AZ::Vector3(m_random.GetRandomFloat() * 2.0f - 1.0f, m_random.GetRandomFloat() * 2.0f - 1.0f, 0.0f);
+                NetworkEntityAwarenessSet& awarenessSet = *awarenessSets[i];
+                awarenessSet.SetAwarenessSphere(AZ::Sphere(m_connectionPositions[i], AwarenessRadius));
+                changedCount += aznumeric_cast<uint32_t>(awarenessSet.GetEnteredEntities().size() + awarenessSet.GetLeftEntities().size());
+                awarenessSet.ClearChanges();
+            }
+            benchmark::DoNotOptimize(changedCount);
+        }
+        state.SetItemsProcessed(state.iterations() * m_connectionPositions.size());
+
+        // The sets have to stop observing before the index goes away
+        awarenessSets.clear();
+    }
+
+    BENCHMARK_REGISTER_F(NetworkEntitySpatialIndexBenchmark, TrackAwarenessSets)
+        ->ArgName("Connections")->Arg(64)->Arg(256)->Arg(1024)
+        ->Unit(benchmark::kMillisecond);
+
+    BENCHMARK_REGISTER_F(NetworkEntitySpatialIndexBenchmark, GatherSpatialIndex)
+        ->ArgName("Connections")->Arg(64)->Arg(256)->Arg(1024)
+        ->Unit(benchmark::kMillisecond);
+
+    BENCHMARK_REGISTER_F(NetworkEntitySpatialIndexBenchmark, GatherBruteForce)
+        ->ArgName("Connections")->Arg(64)->Arg(256)->Arg(1024)
+        ->Unit(benchmark::kMillisecond);
+}
+#endif // HAVE_BENCHMARK
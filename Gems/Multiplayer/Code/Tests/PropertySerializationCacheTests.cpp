@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzTest/AzTest.h>
+#include <NetworkEntity/EntityReplication/PropertySerializationCache.h>
+
+namespace UnitTest
+{
+    using namespace Multiplayer;
+
+    class PropertySerializationCacheTests
+        : public AllocatorsFixture
+    {
+    public:
+        static ReplicationRecord MakeRecord(NetEntityRole remoteRole, uint32_t dirtyBit)
+        {
+            ReplicationRecord record(remoteRole);
+            record.m_authorityToClient.Resize(8);
+            record.m_authorityToClient.SetBit(dirtyBit, true);
+            return record;
+        }
+
+        static AzNetworking::PacketEncodingBuffer MakePayload(uint8_t value, uint32_t size)
+        {
+            AzNetworking::PacketEncodingBuffer payload;
+            payload.Resize(size);
+            memset(payload.GetBuffer(), value, size);
+            return payload;
+        }
+    };
+
+    TEST_F(PropertySerializationCacheTests, FetchReturnsStoredPayloadForMatchingRecord)
+    {
+        PropertySerializationCache cache;
+        MultiplayerStats stats;
+        stats.ReserveComponentStats(NetComponentId{ 0 }, 1, 0);
+
+        const ReplicationRecord record = MakeRecord(NetEntityRole::Client, 2);
+        AzNetworking::PacketEncodingBuffer output;
+        EXPECT_FALSE(cache.Fetch(NetEntityId{ 7 }, record, output, stats));
+
+        const MultiplayerStats::DeferredPropertySentList propertySent = { { NetComponentId{ 0 }, PropertyIndex{ 0 }, 12 } };
+        cache.Store(NetEntityId{ 7 }, record, MakePayload(0xAB, 12), propertySent);
+
+        EXPECT_TRUE(cache.Fetch(NetEntityId{ 7 }, record, output, stats));
+        ASSERT_EQ(output.GetSize(), 12);
+        EXPECT_EQ(output.GetBuffer()[0], 0xAB);
+        EXPECT_EQ(output.GetBuffer()[11], 0xAB);
+
+        // The property metrics of the original serialization are recorded for every reuse
+        EXPECT_EQ(stats.CalculateComponentPropertyUpdateSentMetrics(NetComponentId{ 0 }).m_totalBytes, 12);
+
+        EXPECT_EQ(cache.GetHitCount(), 1);
+        EXPECT_EQ(cache.GetMissCount(), 1);
+    }
+
+    TEST_F(PropertySerializationCacheTests, FetchMissesForDifferentRecordOrEntity)
+    {
+        PropertySerializationCache cache;
+        MultiplayerStats stats;
+        cache.Store(NetEntityId{ 1 }, MakeRecord(NetEntityRole::Client, 2), MakePayload(0x01, 4), {});
+
+        AzNetworking::PacketEncodingBuffer output;
+        EXPECT_FALSE(cache.Fetch(NetEntityId{ 1 }, MakeRecord(NetEntityRole::Client, 3), output, stats));
+        EXPECT_FALSE(cache.Fetch(NetEntityId{ 1 }, MakeRecord(NetEntityRole::Autonomous, 2), output, stats));
+        EXPECT_FALSE(cache.Fetch(NetEntityId{ 2 }, MakeRecord(NetEntityRole::Client, 2), output, stats));
+        EXPECT_EQ(cache.GetMissCount(), 3);
+    }
+
+    TEST_F(PropertySerializationCacheTests, ClearDiscardsPayloads)
+    {
+        PropertySerializationCache cache;
+        MultiplayerStats stats;
+        const ReplicationRecord record = MakeRecord(NetEntityRole::Client, 0);
+        cache.Store(NetEntityId{ 1 }, record, MakePayload(0x01, 4), {});
+
+        AzNetworking::PacketEncodingBuffer output;
+        EXPECT_TRUE(cache.Fetch(NetEntityId{ 1 }, record, output, stats));
+
+        cache.Clear();
+        EXPECT_EQ(cache.GetHitCount(), 0);
+        EXPECT_FALSE(cache.Fetch(NetEntityId{ 1 }, record, output, stats));
+    }
+}
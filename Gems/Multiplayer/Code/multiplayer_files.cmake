@@ -74,6 +74,8 @@ set(FILES
     Source/NetworkEntity/EntityReplication/EntityReplicator.inl
     Source/NetworkEntity/EntityReplication/PropertyPublisher.cpp
     Source/NetworkEntity/EntityReplication/PropertyPublisher.h
+    Source/NetworkEntity/EntityReplication/PropertySerializationCache.cpp
+    Source/NetworkEntity/EntityReplication/PropertySerializationCache.h
     Source/NetworkEntity/EntityReplication/PropertySubscriber.cpp
     Source/NetworkEntity/EntityReplication/PropertySubscriber.h
     Source/NetworkEntity/EntityReplication/ReplicationRecord.cpp
@@ -105,6 +107,11 @@ set(FILES
     Source/Pipeline/NetworkSpawnableHolderComponent.cpp
     Source/Pipeline/NetworkSpawnableHolderComponent.h
     Source/Physics/PhysicsUtils.cpp
+    Source/ReplicationWindows/NetworkEntityAwarenessSet.cpp
+    Source/ReplicationWindows/NetworkEntityAwarenessSet.h
+    Source/ReplicationWindows/NetworkEntitySpatialIndex.cpp
+    Source/ReplicationWindows/NetworkEntitySpatialIndex.h
+    Source/ReplicationWindows/NetworkEntitySpatialIndex.inl
     Source/ReplicationWindows/NullReplicationWindow.cpp
     Source/ReplicationWindows/NullReplicationWindow.h
     Source/ReplicationWindows/ServerToClientReplicationWindow.cpp
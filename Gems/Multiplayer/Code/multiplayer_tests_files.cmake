@@ -10,6 +10,8 @@ set(FILES
     Tests/Main.cpp
     Tests/IMultiplayerConnectionMock.h
     Tests/MultiplayerSystemTests.cpp
+    Tests/NetworkEntitySpatialIndexTests.cpp
+    Tests/PropertySerializationCacheTests.cpp
     Tests/RewindableContainerTests.cpp
     Tests/RewindableObjectTests.cpp
 )
@@ -8,11 +8,17 @@
 
 #include "MultiplayerCompressionFactory.h"
 #include "LZ4Compressor.h"
+#include "ZstdDictionaryCompressor.h"
 
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Utils/Utils.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 
 namespace MultiplayerCompression
 {
+    AZ_CVAR(AZ::CVarFixedString, net_ZstdDictionaryPath, "", nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Path to the trained dictionary used by ZstdDictionaryCompressor, both endpoints must use the same dictionary. Empty compresses without a dictionary.");
+    AZ_CVAR(int32_t, net_ZstdCompressionLevel, 3, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "zstd compression level used by ZstdDictionaryCompressor");
+
     AZStd::unique_ptr<AzNetworking::ICompressor> MultiplayerCompressionFactory::Create()
     {
         return AZStd::make_unique<LZ4Compressor>();
@@ -22,4 +28,51 @@ namespace MultiplayerCompression
     {
         return m_name;
     }
+
+    ZstdDictionaryCompressionFactory::ZstdDictionaryCompressionFactory(ZstdDictionaryTrainer* sampleCapture)
+        : m_sampleCapture(sampleCapture)
+    {
+        ;
+    }
+
+    AZStd::unique_ptr<AzNetworking::ICompressor> ZstdDictionaryCompressionFactory::Create()
+    {
+        const AZ::CVarFixedString dictionaryPath = static_cast<AZ::CVarFixedString>(net_ZstdDictionaryPath);
+        const int32_t compressionLevel = net_ZstdCompressionLevel;
+        AZStd::shared_ptr<const ZstdDictionary> dictionary = AcquireDictionary(AZStd::string(dictionaryPath.c_str()), compressionLevel);
+        return AZStd::make_unique<ZstdDictionaryCompressor>(AZStd::move(dictionary), compressionLevel, m_sampleCapture);
+    }
+
+    AZ::Name ZstdDictionaryCompressionFactory::GetFactoryName() const
+    {
+        return m_name;
+    }
+
+    AZStd::shared_ptr<const ZstdDictionary> ZstdDictionaryCompressionFactory::AcquireDictionary(const AZStd::string& dictionaryPath, int32_t compressionLevel)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_dictionaryMutex);
+        if ((dictionaryPath == m_dictionaryPath) && (compressionLevel == m_dictionaryCompressionLevel))
+        {
+            return m_dictionary;
+        }
+
+        m_dictionaryPath = dictionaryPath;
+        m_dictionaryCompressionLevel = compressionLevel;
+        m_dictionary = nullptr;
+
+        if (!dictionaryPath.empty())
+        {
+            auto readResult = AZ::Utils::ReadFile<AZStd::vector<uint8_t>>(dictionaryPath);
+            if (readResult.IsSuccess())
+            {
+                const AZStd::vector<uint8_t>& dictionaryData = readResult.GetValue();
+                m_dictionary = ZstdDictionary::Create(dictionaryData.data(), dictionaryData.size(), compressionLevel);
+            }
+            else
+            {
+                AZ_Warning("Multiplayer Compressor", false, "Failed to read zstd dictionary %s: %s", dictionaryPath.c_str(), readResult.GetError().c_str());
+            }
+        }
+        return m_dictionary;
+    }
 }
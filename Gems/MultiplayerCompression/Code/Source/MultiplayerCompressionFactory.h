@@ -9,7 +9,10 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string.h>
 #include <AzNetworking/Framework/ICompressor.h>
 
 namespace MultiplayerCompression
@@ -29,4 +32,38 @@ namespace MultiplayerCompression
     private:
         const AZ::Name m_name = AZ::Name("MultiplayerCompressor");
     };
+
+    class ZstdDictionary;
+    class ZstdDictionaryTrainer;
+
+    //! Creates zstd compressors using the dictionary file named by net_ZstdDictionaryPath.
+    //! Select it by setting net_UdpCompressor or net_TcpCompressor to ZstdDictionaryCompressor.
+    class ZstdDictionaryCompressionFactory
+        : public AzNetworking::ICompressorFactory
+    {
+    public:
+        //! Constructs the factory.
+        //! @param sampleCapture optional trainer that created compressors record uncompressed payloads to
+        explicit ZstdDictionaryCompressionFactory(ZstdDictionaryTrainer* sampleCapture = nullptr);
+
+        //! Instantiate a new compressor
+        //! @return A unique_ptr to a new Compressor
+        AZStd::unique_ptr<AzNetworking::ICompressor> Create() override;
+
+        //! Gets the AZ Name of this compressor factory
+        //! @return the AZ Name of this compressor factory
+        AZ::Name GetFactoryName() const override;
+
+    private:
+        //! Returns the digested dictionary for the current cvar values, reloading it if the cvars have changed since the last call.
+        AZStd::shared_ptr<const ZstdDictionary> AcquireDictionary(const AZStd::string& dictionaryPath, int32_t compressionLevel);
+
+        const AZ::Name m_name = AZ::Name("ZstdDictionaryCompressor");
+        ZstdDictionaryTrainer* m_sampleCapture = nullptr;
+
+        AZStd::mutex m_dictionaryMutex;
+        AZStd::shared_ptr<const ZstdDictionary> m_dictionary;
+        AZStd::string m_dictionaryPath;
+        int32_t m_dictionaryCompressionLevel = 0;
+    };
 }
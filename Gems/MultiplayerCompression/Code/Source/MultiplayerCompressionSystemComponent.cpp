@@ -7,6 +7,8 @@
  */
 
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/Utils/Utils.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
@@ -51,11 +53,84 @@ namespace MultiplayerCompression
     {
         m_multiplayerCompressionFactory = new MultiplayerCompressionFactory();
         AZ::Interface<AzNetworking::INetworking>::Get()->RegisterCompressorFactory(m_multiplayerCompressionFactory);
+        m_zstdDictionaryCompressionFactory = new ZstdDictionaryCompressionFactory(&m_sampleCapture);
+        AZ::Interface<AzNetworking::INetworking>::Get()->RegisterCompressorFactory(m_zstdDictionaryCompressionFactory);
     }
 
     MultiplayerCompressionSystemComponent::~MultiplayerCompressionSystemComponent()
     {
+        AZ::Interface<AzNetworking::INetworking>::Get()->UnregisterCompressorFactory(m_zstdDictionaryCompressionFactory->GetFactoryName());
+        delete m_zstdDictionaryCompressionFactory;
         AZ::Interface<AzNetworking::INetworking>::Get()->UnregisterCompressorFactory(m_multiplayerCompressionFactory->GetFactoryName());
         delete m_multiplayerCompressionFactory;
     }
+
+    void MultiplayerCompressionSystemComponent::CaptureCompressionSamples(const AZ::ConsoleCommandContainer& arguments)
+    {
+        uint32_t sampleCount = 0;
+        if (arguments.empty() || !AZ::ConsoleTypeHelpers::StringToValue(sampleCount, arguments.front()))
+        {
+            AZLOG_WARN("CaptureCompressionSamples requires a sample count");
+            return;
+        }
+        m_sampleCapture.SetMaxSampleCount(sampleCount);
+        AZLOG_INFO("Capturing up to %u compression samples, %u currently held", sampleCount, m_sampleCapture.GetSampleCount());
+    }
+
+    void MultiplayerCompressionSystemComponent::SaveCompressionSamples(const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (arguments.empty())
+        {
+            AZLOG_WARN("SaveCompressionSamples requires an output path");
+            return;
+        }
+
+        const AZStd::string samplesPath(arguments.front());
+        const auto saveResult = m_sampleCapture.SaveSamples(samplesPath);
+        if (!saveResult.IsSuccess())
+        {
+            AZLOG_ERROR("Failed to save compression samples to %s: %s", samplesPath.c_str(), saveResult.GetError().c_str());
+            return;
+        }
+        AZLOG_INFO("Saved %u compression samples (%zu bytes) to %s", m_sampleCapture.GetSampleCount(), m_sampleCapture.GetTotalSampleSize(), samplesPath.c_str());
+        m_sampleCapture.ClearSamples();
+    }
+
+    void MultiplayerCompressionSystemComponent::TrainCompressionDictionary(const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (arguments.size() < 2)
+        {
+            AZLOG_WARN("TrainCompressionDictionary requires a dictionary output path and at least one samples path");
+            return;
+        }
+
+        ZstdDictionaryTrainer trainer;
+        for (size_t argumentIndex = 1; argumentIndex < arguments.size(); ++argumentIndex)
+        {
+            const AZStd::string samplesPath(arguments[argumentIndex]);
+            const auto loadResult = trainer.LoadSamples(samplesPath);
+            if (!loadResult.IsSuccess())
+            {
+                AZLOG_ERROR("Failed to load compression samples from %s: %s", samplesPath.c_str(), loadResult.GetError().c_str());
+                return;
+            }
+        }
+
+        auto trainResult = trainer.TrainDictionary();
+        if (!trainResult.IsSuccess())
+        {
+            AZLOG_ERROR("Failed to train compression dictionary from %u samples: %s", trainer.GetSampleCount(), trainResult.GetError().c_str());
+            return;
+        }
+
+        const AZStd::string dictionaryPath(arguments.front());
+        const AZStd::vector<uint8_t>& dictionary = trainResult.GetValue();
+        const auto writeResult = AZ::Utils::WriteFile(AZStd::string_view(reinterpret_cast<const char*>(dictionary.data()), dictionary.size()), dictionaryPath);
+        if (!writeResult.IsSuccess())
+        {
+            AZLOG_ERROR("Failed to write compression dictionary to %s: %s", dictionaryPath.c_str(), writeResult.GetError().c_str());
+            return;
+        }
+        AZLOG_INFO("Trained a %zu byte compression dictionary from %u samples and saved it to %s", dictionary.size(), trainer.GetSampleCount(), dictionaryPath.c_str());
+    }
 }
@@ -9,9 +9,11 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/std/containers/unordered_set.h>
 
 #include <MultiplayerCompressionFactory.h>
+#include <ZstdDictionaryTrainer.h>
 
 namespace MultiplayerCompression
 {
@@ -40,6 +42,17 @@ namespace MultiplayerCompression
         void Deactivate() override {}
         ////////////////////////////////////////////////////////////////////////
     private:
+        AZ_CONSOLEFUNC(MultiplayerCompressionSystemComponent, CaptureCompressionSamples, AZ::ConsoleFunctorFlags::Null, "Starts capturing uncompressed payloads sent through ZstdDictionaryCompressor: CaptureCompressionSamples <sampleCount>, 0 stops capturing");
+        void CaptureCompressionSamples(const AZ::ConsoleCommandContainer& arguments);
+
+        AZ_CONSOLEFUNC(MultiplayerCompressionSystemComponent, SaveCompressionSamples, AZ::ConsoleFunctorFlags::Null, "Saves captured uncompressed packet payloads for dictionary training: SaveCompressionSamples <samplesPath>");
+        void SaveCompressionSamples(const AZ::ConsoleCommandContainer& arguments);
+
+        AZ_CONSOLEFUNC(MultiplayerCompressionSystemComponent, TrainCompressionDictionary, AZ::ConsoleFunctorFlags::Null, "Trains a zstd dictionary from one or more sample files: TrainCompressionDictionary <dictionaryPath> <samplesPath>...");
+        void TrainCompressionDictionary(const AZ::ConsoleCommandContainer& arguments);
+
         MultiplayerCompressionFactory* m_multiplayerCompressionFactory;
+        ZstdDictionaryCompressionFactory* m_zstdDictionaryCompressionFactory;
+        ZstdDictionaryTrainer m_sampleCapture;
     };
 }
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "ZstdDictionaryCompressor.h"
+#include "ZstdDictionaryTrainer.h"
+
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+#define ZSTD_STATIC_LINKING_ONLY
+#include <zstd.h>
+
+namespace MultiplayerCompression
+{
+    AZStd::shared_ptr<const ZstdDictionary> ZstdDictionary::Create(const void* dictionaryData, size_t dictionarySize, int32_t compressionLevel)
+    {
+        if (dictionaryData == nullptr || dictionarySize == 0)
+        {
+            return nullptr;
+        }
+
+        AZStd::shared_ptr<ZstdDictionary> dictionary(new ZstdDictionary());
+        dictionary->m_compressionDictionary = ZSTD_createCDict(dictionaryData, dictionarySize, compressionLevel);
+        dictionary->m_decompressionDictionary = ZSTD_createDDict(dictionaryData, dictionarySize);
+        if (dictionary->m_compressionDictionary == nullptr || dictionary->m_decompressionDictionary == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Failed to digest zstd dictionary of size (%lu B)", dictionarySize);
+            return nullptr;
+        }
+        dictionary->m_dictionaryId = ZSTD_getDictID_fromDict(dictionaryData, dictionarySize);
+        return dictionary;
+    }
+
+    ZstdDictionary::~ZstdDictionary()
+    {
+        ZSTD_freeCDict(m_compressionDictionary);
+        ZSTD_freeDDict(m_decompressionDictionary);
+    }
+
+    const ZSTD_CDict_s* ZstdDictionary::GetCompressionDictionary() const
+    {
+        return m_compressionDictionary;
+    }
+
+    const ZSTD_DDict_s* ZstdDictionary::GetDecompressionDictionary() const
+    {
+        return m_decompressionDictionary;
+    }
+
+    uint32_t ZstdDictionary::GetDictionaryId() const
+    {
+        return m_dictionaryId;
+    }
+
+    ZstdDictionaryCompressor::ZstdDictionaryCompressor(AZStd::shared_ptr<const ZstdDictionary> dictionary, int32_t compressionLevel, ZstdDictionaryTrainer* sampleCapture)
+        : m_dictionary(AZStd::move(dictionary))
+        , m_sampleCapture(sampleCapture)
+        , m_compressionLevel(compressionLevel)
+    {
+        // AzNetworking does not call Init() on the compressors it creates, so contexts are allocated up front
+        Init();
+    }
+
+    ZstdDictionaryCompressor::~ZstdDictionaryCompressor()
+    {
+        ZSTD_freeCCtx(m_compressionContext);
+        ZSTD_freeDCtx(m_decompressionContext);
+    }
+
+    bool ZstdDictionaryCompressor::Init()
+    {
+        if (m_compressionContext == nullptr)
+        {
+            m_compressionContext = ZSTD_createCCtx();
+        }
+        if (m_decompressionContext == nullptr)
+        {
+            m_decompressionContext = ZSTD_createDCtx();
+        }
+        return (m_compressionContext != nullptr) && (m_decompressionContext != nullptr);
+    }
+
+    size_t ZstdDictionaryCompressor::GetMaxChunkSize(size_t maxCompSize) const
+    {
+        return maxCompSize;
+    }
+
+    size_t ZstdDictionaryCompressor::GetMaxCompressedBufferSize(size_t uncompSize) const
+    {
+        return ZSTD_compressBound(uncompSize);
+    }
+
+    AzNetworking::CompressorError ZstdDictionaryCompressor::Compress
+    (
+        const void* uncompData,
+        size_t uncompSize,
+        void* compData,
+        size_t compDataSize,
+        size_t& compSize
+    )
+    {
+        if (uncompData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Input buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (compData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Output buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (m_compressionContext == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Compression context failed to initialize");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (m_sampleCapture != nullptr && m_sampleCapture->IsCapturing())
+        {
+            m_sampleCapture->AddSample(uncompData, uncompSize);
+        }
+
+        size_t result = 0;
+        if (m_dictionary != nullptr)
+        {
+            // Both endpoints share the dictionary out of band, so skip the checksum and dictionary id to keep frame overhead minimal
+            ZSTD_frameParameters frameParameters;
+            frameParameters.contentSizeFlag = 1;
+            frameParameters.checksumFlag = 0;
+            frameParameters.noDictIDFlag = 1;
+            result = ZSTD_compress_usingCDict_advanced
+            (
+                m_compressionContext,
+                compData,
+                compDataSize,
+                uncompData,
+                uncompSize,
+                m_dictionary->GetCompressionDictionary(),
+                frameParameters
+            );
+        }
+        else
+        {
+            result = ZSTD_compressCCtx(m_compressionContext, compData, compDataSize, uncompData, uncompSize, m_compressionLevel);
+        }
+
+        if (ZSTD_isError(result))
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Compression failed for uncompSize:(%lu B) compDataSize:(%lu B) error:(%s)", uncompSize, compDataSize, ZSTD_getErrorName(result));
+            return (compDataSize < ZSTD_compressBound(uncompSize)) ? AzNetworking::CompressorError::InsufficientBuffer : AzNetworking::CompressorError::CorruptData;
+        }
+
+        compSize = result;
+        return AzNetworking::CompressorError::Ok;
+    }
+
+    AzNetworking::CompressorError ZstdDictionaryCompressor::Decompress(const void* compData, size_t compDataSize, void* uncompData, size_t uncompDataSize, size_t& consumedSizeOut, size_t& uncompSizeOut)
+    {
+        if (uncompData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Input buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (compData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Output buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (m_decompressionContext == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Decompression context failed to initialize");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        const size_t result = (m_dictionary != nullptr)
+            ? ZSTD_decompress_usingDDict(m_decompressionContext, uncompData, uncompDataSize, compData, compDataSize, m_dictionary->GetDecompressionDictionary())
+            : ZSTD_decompressDCtx(m_decompressionContext, uncompData, uncompDataSize, compData, compDataSize);
+        consumedSizeOut = compDataSize;
+
+        if (ZSTD_isError(result))
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Decompression failed for compDataSize:(%lu B) uncompDataSize:(%lu B) error:(%s)", compDataSize, uncompDataSize, ZSTD_getErrorName(result));
+            return AzNetworking::CompressorError::CorruptData;
+        }
+
+        uncompSizeOut = result;
+        return AzNetworking::CompressorError::Ok;
+    }
+}
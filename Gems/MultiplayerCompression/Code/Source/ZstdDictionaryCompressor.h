@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzNetworking/Framework/ICompressor.h>
+
+struct ZSTD_CCtx_s;
+struct ZSTD_DCtx_s;
+struct ZSTD_CDict_s;
+struct ZSTD_DDict_s;
+
+namespace MultiplayerCompression
+{
+    class ZstdDictionaryTrainer;
+
+    static const char* ZstdDictionaryCompressorName = "ZstdDictionary";
+    static const AzNetworking::CompressorType ZstdDictionaryCompressorType = aznumeric_cast<AzNetworking::CompressorType>(static_cast<AZ::u32>(AZ::Crc32(ZstdDictionaryCompressorName)));
+
+    //! @class ZstdDictionary
+    //! @brief Immutable digested zstd dictionary, shared by every compressor created from the same dictionary file.
+    //!
+    //! Digested dictionaries are read only once created, so a single instance may be used by any number of compressors concurrently.
+    class ZstdDictionary
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ZstdDictionary, AZ::SystemAllocator, 0);
+
+        //! Digests a raw dictionary, as produced by ZstdDictionaryTrainer.
+        //! @param dictionaryData    the raw dictionary contents
+        //! @param dictionarySize    the size of the raw dictionary in bytes
+        //! @param compressionLevel  the zstd compression level to digest the dictionary for
+        //! @return the digested dictionary, or nullptr if the dictionary could not be digested
+        static AZStd::shared_ptr<const ZstdDictionary> Create(const void* dictionaryData, size_t dictionarySize, int32_t compressionLevel);
+
+        ~ZstdDictionary();
+
+        const ZSTD_CDict_s* GetCompressionDictionary() const;
+        const ZSTD_DDict_s* GetDecompressionDictionary() const;
+
+        //! Returns the zstd identifier embedded in the dictionary, 0 for raw content dictionaries.
+        uint32_t GetDictionaryId() const;
+
+    private:
+        ZstdDictionary() = default;
+        AZ_DISABLE_COPY_MOVE(ZstdDictionary);
+
+        ZSTD_CDict_s* m_compressionDictionary = nullptr;
+        ZSTD_DDict_s* m_decompressionDictionary = nullptr;
+        uint32_t m_dictionaryId = 0;
+    };
+
+    //! @class ZstdDictionaryCompressor
+    //! @brief Implements a zstd compressor primed with a dictionary trained on captured packet payloads.
+    //!
+    //! Game packets are small and highly repetitive between packets but not within a single packet, so independent per packet
+    //! compression has little history to work from. A dictionary trained offline provides that history up front without adding
+    //! any state shared between packets, keeping every packet independently decodable. Both endpoints must use the same dictionary.
+    //! Without a dictionary the compressor falls back to plain zstd compression of each packet.
+    class ZstdDictionaryCompressor
+        : public AzNetworking::ICompressor
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ZstdDictionaryCompressor, AZ::SystemAllocator, 0);
+
+        //! Constructs a compressor.
+        //! @param dictionary        the dictionary to compress with, may be nullptr to compress without a dictionary
+        //! @param compressionLevel  the zstd compression level to use when no dictionary is provided
+        //! @param sampleCapture     optional trainer that uncompressed payloads are recorded to for later dictionary training
+        ZstdDictionaryCompressor(AZStd::shared_ptr<const ZstdDictionary> dictionary, int32_t compressionLevel, ZstdDictionaryTrainer* sampleCapture = nullptr);
+        ~ZstdDictionaryCompressor() override;
+
+        const char* GetName() const { return ZstdDictionaryCompressorName; }
+        AzNetworking::CompressorType GetType() const override { return ZstdDictionaryCompressorType; }
+
+        bool Init() override;
+        size_t GetMaxChunkSize(size_t maxCompSize) const override;
+        size_t GetMaxCompressedBufferSize(size_t uncompSize) const override;
+
+        AzNetworking::CompressorError Compress(const void* uncompData, size_t uncompSize, void* compData, size_t compDataSize, size_t& compSize) override;
+        AzNetworking::CompressorError Decompress(const void* compData, size_t compDataSize, void* uncompData, size_t uncompDataSize, size_t& consumedSize, size_t& uncompSize) override;
+
+    private:
+        AZ_DISABLE_COPY_MOVE(ZstdDictionaryCompressor);
+
+        AZStd::shared_ptr<const ZstdDictionary> m_dictionary;
+        ZstdDictionaryTrainer* m_sampleCapture = nullptr;
+        ZSTD_CCtx_s* m_compressionContext = nullptr;
+        ZSTD_DCtx_s* m_decompressionContext = nullptr;
+        int32_t m_compressionLevel = 0;
+    };
+}
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "ZstdDictionaryTrainer.h"
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Utils/Utils.h>
+#include <AzCore/std/string/conversions.h>
+
+#include <zdict.h>
+
+namespace MultiplayerCompression
+{
+    static constexpr size_t SampleSizeFieldSize = sizeof(uint32_t);
+
+    void ZstdDictionaryTrainer::SetMaxSampleCount(uint32_t maxSampleCount)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_maxSampleCount = maxSampleCount;
+        UpdateIsCapturing();
+    }
+
+    bool ZstdDictionaryTrainer::IsCapturing() const
+    {
+        return m_isCapturing.load(AZStd::memory_order_acquire);
+    }
+
+    void ZstdDictionaryTrainer::AddSample(const void* data, size_t size)
+    {
+        if (data == nullptr || size == 0)
+        {
+            return;
+        }
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        if (m_sampleSizes.size() >= m_maxSampleCount)
+        {
+            return;
+        }
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+        m_sampleData.insert(m_sampleData.end(), bytes, bytes + size);
+        m_sampleSizes.push_back(size);
+        UpdateIsCapturing();
+    }
+
+    void ZstdDictionaryTrainer::ClearSamples()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_sampleData.clear();
+        m_sampleSizes.clear();
+        UpdateIsCapturing();
+    }
+
+    uint32_t ZstdDictionaryTrainer::GetSampleCount() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        return aznumeric_cast<uint32_t>(m_sampleSizes.size());
+    }
+
+    size_t ZstdDictionaryTrainer::GetTotalSampleSize() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        return m_sampleData.size();
+    }
+
+    AZ::Outcome<void, AZStd::string> ZstdDictionaryTrainer::SaveSamples(AZStd::string_view filePath) const
+    {
+        AZStd::string fileContents;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            fileContents.reserve(m_sampleData.size() + m_sampleSizes.size() * SampleSizeFieldSize);
+            size_t sampleOffset = 0;
+            for (const size_t sampleSize : m_sampleSizes)
+            {
+                const uint32_t encodedSize = aznumeric_cast<uint32_t>(sampleSize);
+                const uint8_t sizeBytes[SampleSizeFieldSize] =
+                {
+                    static_cast<uint8_t>(encodedSize),
+                    static_cast<uint8_t>(encodedSize >> 8),
+                    static_cast<uint8_t>(encodedSize >> 16),
+                    static_cast<uint8_t>(encodedSize >> 24)
+                };
+                fileContents.append(reinterpret_cast<const char*>(sizeBytes), SampleSizeFieldSize);
+                fileContents.append(reinterpret_cast<const char*>(m_sampleData.data() + sampleOffset), sampleSize);
+                sampleOffset += sampleSize;
+            }
+        }
+        return AZ::Utils::WriteFile(fileContents, filePath);
+    }
+
+    AZ::Outcome<void, AZStd::string> ZstdDictionaryTrainer::LoadSamples(AZStd::string_view filePath)
+    {
+        auto readResult = AZ::Utils::ReadFile<AZStd::vector<uint8_t>>(filePath);
+        if (!readResult.IsSuccess())
+        {
+            return AZ::Failure(readResult.TakeError());
+        }
+
+        const AZStd::vector<uint8_t>& fileContents = readResult.GetValue();
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        size_t offset = 0;
+        while (offset + SampleSizeFieldSize <= fileContents.size())
+        {
+            const uint32_t sampleSize = static_cast<uint32_t>(fileContents[offset])
+                | (static_cast<uint32_t>(fileContents[offset + 1]) << 8)
+                | (static_cast<uint32_t>(fileContents[offset + 2]) << 16)
+                | (static_cast<uint32_t>(fileContents[offset + 3]) << 24);
+            offset += SampleSizeFieldSize;
+            if (offset + sampleSize > fileContents.size())
+            {
+                UpdateIsCapturing();
+                return AZ::Failure(AZStd::string::format("Sample file %.*s is truncated", aznumeric_cast<int>(filePath.size()), filePath.data()));
+            }
+            m_sampleData.insert(m_sampleData.end(), fileContents.begin() + offset, fileContents.begin() + offset + sampleSize);
+            m_sampleSizes.push_back(sampleSize);
+            offset += sampleSize;
+        }
+        UpdateIsCapturing();
+        return AZ::Success();
+    }
+
+    AZ::Outcome<AZStd::vector<uint8_t>, AZStd::string> ZstdDictionaryTrainer::TrainDictionary(size_t dictionaryCapacity) const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        if (m_sampleSizes.empty())
+        {
+            return AZ::Failure(AZStd::string("No samples have been captured"));
+        }
+
+        AZStd::vector<uint8_t> dictionary(dictionaryCapacity);
+        const size_t dictionarySize = ZDICT_trainFromBuffer
+        (
+            dictionary.data(),
+            dictionary.size(),
+            m_sampleData.data(),
+            m_sampleSizes.data(),
+            aznumeric_cast<unsigned>(m_sampleSizes.size())
+        );
+
+        if (ZDICT_isError(dictionarySize))
+        {
+            return AZ::Failure(AZStd::string::format("Dictionary training failed: %s", ZDICT_getErrorName(dictionarySize)));
+        }
+
+        dictionary.resize(dictionarySize);
+        return AZ::Success(AZStd::move(dictionary));
+    }
+
+    void ZstdDictionaryTrainer::UpdateIsCapturing()
+    {
+        m_isCapturing.store(m_sampleSizes.size() < m_maxSampleCount, AZStd::memory_order_release);
+    }
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Outcome/Outcome.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/string/string_view.h>
+
+namespace MultiplayerCompression
+{
+    //! @class ZstdDictionaryTrainer
+    //! @brief Captures uncompressed packet payloads and trains zstd dictionaries from them.
+    //!
+    //! Samples are stored back to back in a single buffer alongside their sizes, which is the layout zstd's trainer consumes directly.
+    //! Sample files written by SaveSamples are a sequence of little endian uint32 sizes each followed by that many payload bytes,
+    //! so captures from several sessions can be concatenated before training.
+    class ZstdDictionaryTrainer
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ZstdDictionaryTrainer, AZ::SystemAllocator, 0);
+
+        //! Default dictionary capacity, large enough to cover the common structure of entity update and rpc packets.
+        static constexpr size_t DefaultDictionaryCapacity = 16 * 1024;
+
+        ZstdDictionaryTrainer() = default;
+        ~ZstdDictionaryTrainer() = default;
+
+        //! Sets the number of samples to capture, AddSample ignores payloads once this many samples are held.
+        //! @param maxSampleCount maximum number of samples to hold, 0 disables capture
+        void SetMaxSampleCount(uint32_t maxSampleCount);
+
+        //! Returns true if AddSample will currently record payloads. Doesn't lock, so it can be checked for every packet.
+        bool IsCapturing() const;
+
+        //! Records a single uncompressed payload. Thread safe.
+        //! @param data the payload to record
+        //! @param size the size of the payload in bytes
+        void AddSample(const void* data, size_t size);
+
+        //! Removes all captured samples.
+        void ClearSamples();
+
+        uint32_t GetSampleCount() const;
+        size_t GetTotalSampleSize() const;
+
+        //! Writes all captured samples to a sample file.
+        AZ::Outcome<void, AZStd::string> SaveSamples(AZStd::string_view filePath) const;
+
+        //! Appends the samples stored in a sample file to the captured samples.
+        AZ::Outcome<void, AZStd::string> LoadSamples(AZStd::string_view filePath);
+
+        //! Trains a dictionary from the captured samples.
+        //! @param dictionaryCapacity the maximum size of the trained dictionary in bytes
+        //! @return the raw dictionary on success, or a description of the failure
+        AZ::Outcome<AZStd::vector<uint8_t>, AZStd::string> TrainDictionary(size_t dictionaryCapacity = DefaultDictionaryCapacity) const;
+
+    private:
+        //! Refreshes m_isCapturing after the sample count or limit changed, expects m_mutex to be held.
+        void UpdateIsCapturing();
+
+        mutable AZStd::mutex m_mutex;
+        AZStd::atomic<bool> m_isCapturing{ false };
+        AZStd::vector<uint8_t> m_sampleData;
+        AZStd::vector<size_t> m_sampleSizes;
+        uint32_t m_maxSampleCount = 0;
+    };
+}
@@ -0,0 +1,366 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/Random.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzNetworking/DataStructures/ByteBuffer.h>
+#include <AzTest/AzTest.h>
+
+#include <LZ4Compressor.h>
+#include <ZstdDictionaryCompressor.h>
+#include <ZstdDictionaryTrainer.h>
+
+namespace UnitTest
+{
+    using namespace MultiplayerCompression;
+
+    //! Generates payloads shaped like entity update packets, a packet header followed by several entity updates, each made up of
+    //! a net entity id, a role, dirty property bits and quantized transform deltas. No recorded game traffic ships with the gem,
+    //! so these stand in for captured packets when training and measuring dictionaries.
+    class EntityUpdatePacketGenerator
+    {
+    public:
+        static constexpr uint32_t EntityCount = 256;
+
+        explicit EntityUpdatePacketGenerator(uint64_t seed)
+            : m_random(seed)
+        {
+            m_positions.resize(EntityCount * 3);
+            for (uint16_t& position : m_positions)
+            {
+                position = aznumeric_cast<uint16_t>(m_random.GetRandom());
+            }
+        }
+
+        AZStd::vector<uint8_t> Generate()
+        {
+            AZStd::vector<uint8_t> packet;
+            Write<uint8_t>(packet, 0x07);                                // packet type
+            Write<uint32_t>(packet, ++m_sequence);                       // sequence
+            Write<uint32_t>(packet, m_sequence - 3);                     // acked sequence
+            Write<uint32_t>(packet, 0xFFFFFFF0u | (m_random.GetRandom() & 0xF)); // ack bits
+
+            const uint32_t updateCount = 4 + m_random.GetRandom() % 12;
+            Write<uint16_t>(packet, aznumeric_cast<uint16_t>(updateCount));
+            for (uint32_t update = 0; update < updateCount; ++update)
+            {
+                const uint32_t entityIndex = m_random.GetRandom() % EntityCount;
+                Write<uint64_t>(packet, 0x100000ull + entityIndex);     // net entity id
+                Write<uint8_t>(packet, (entityIndex % 16 == 0) ? 2 : 1); // update type and role
+                Write<uint32_t>(packet, 0x3u << ((entityIndex % 4) * 2)); // dirty property bits
+
+                // Quantized position, most entities move a small amount each update
+                for (uint32_t axis = 0; axis < 3; ++axis)
+                {
+                    uint16_t& position = m_positions[entityIndex * 3 + axis];
+                    position = aznumeric_cast<uint16_t>(position + (m_random.GetRandom() % 9) - 4);
+                    Write<uint16_t>(packet, position);
+                }
+
+                // Quantized rotation, usually unchanged around the up axis
+                Write<uint32_t>(packet, (entityIndex * 2654435761u) & 0xFFFF0000u);
+
+                if (entityIndex % 4 == 0)
+                {
+                    // Occasional extra gameplay property, such as health or ammunition
+                    Write<uint16_t>(packet, aznumeric_cast<uint16_t>(100 - (m_random.GetRandom() % 4)));
+                }
+            }
+            return packet;
+        }
+
+    private:
+        template <typename TYPE>
+        static void Write(AZStd::vector<uint8_t>& packet, TYPE value)
+        {
+            const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+            packet.insert(packet.end(), bytes, bytes + sizeof(TYPE));
+        }
+
+        AZ::SimpleLcgRandom m_random;
+        AZStd::vector<uint16_t> m_positions;
+        uint32_t m_sequence = 0;
+    };
+
+    static AZStd::shared_ptr<const ZstdDictionary> TrainTestDictionary(EntityUpdatePacketGenerator& generator, uint32_t sampleCount, int32_t compressionLevel)
+    {
+        ZstdDictionaryTrainer trainer;
+        trainer.SetMaxSampleCount(sampleCount);
+        for (uint32_t sample = 0; sample < sampleCount; ++sample)
+        {
+            const AZStd::vector<uint8_t> packet = generator.Generate();
+            trainer.AddSample(packet.data(), packet.size());
+        }
+
+        auto trainResult = trainer.TrainDictionary(ZstdDictionaryTrainer::DefaultDictionaryCapacity);
+        if (!trainResult.IsSuccess())
+        {
+            return nullptr;
+        }
+        return ZstdDictionary::Create(trainResult.GetValue().data(), trainResult.GetValue().size(), compressionLevel);
+    }
+
+    class ZstdDictionaryCompressorTests
+        : public AllocatorsTestFixture
+    {
+    public:
+        static void ExpectRoundTrip(ZstdDictionaryCompressor& compressor, const AZStd::vector<uint8_t>& packet, size_t& compressedSize)
+        {
+            AZStd::vector<uint8_t> compressed(compressor.GetMaxCompressedBufferSize(packet.size()));
+            AZStd::vector<uint8_t> decompressed(packet.size());
+            size_t consumedSize = 0;
+            size_t uncompressedSize = 0;
+
+            ASSERT_EQ(compressor.Compress(packet.data(), packet.size(), compressed.data(), compressed.size(), compressedSize), AzNetworking::CompressorError::Ok);
+            ASSERT_EQ(compressor.Decompress(compressed.data(), compressedSize, decompressed.data(), decompressed.size(), consumedSize, uncompressedSize), AzNetworking::CompressorError::Ok);
+            EXPECT_EQ(consumedSize, compressedSize);
+            ASSERT_EQ(uncompressedSize, packet.size());
+            EXPECT_EQ(memcmp(decompressed.data(), packet.data(), packet.size()), 0);
+        }
+    };
+
+    TEST_F(ZstdDictionaryCompressorTests, RoundTripWithoutDictionary)
+    {
+        EntityUpdatePacketGenerator generator(1234);
+        ZstdDictionaryCompressor compressor(nullptr, 3);
+        EXPECT_TRUE(compressor.Init());
+
+        for (uint32_t i = 0; i < 16; ++i)
+        {
+            size_t compressedSize = 0;
+            ExpectRoundTrip(compressor, generator.Generate(), compressedSize);
+        }
+    }
+
+    TEST_F(ZstdDictionaryCompressorTests, DictionaryImprovesCompressionOfSmallPackets)
+    {
+        EntityUpdatePacketGenerator generator(1234);
+        AZStd::shared_ptr<const ZstdDictionary> dictionary = TrainTestDictionary(generator, 2048, 3);
+        ASSERT_NE(dictionary, nullptr);
+
+        ZstdDictionaryCompressor plainCompressor(nullptr, 3);
+        ZstdDictionaryCompressor dictionaryCompressor(dictionary, 3);
+
+        size_t plainTotal = 0;
+        size_t dictionaryTotal = 0;
+        for (uint32_t i = 0; i < 64; ++i)
+        {
+            const AZStd::vector<uint8_t> packet = generator.Generate();
+            size_t plainSize = 0;
+            size_t dictionarySize = 0;
+            ExpectRoundTrip(plainCompressor, packet, plainSize);
+            ExpectRoundTrip(dictionaryCompressor, packet, dictionarySize);
+            plainTotal += plainSize;
+            dictionaryTotal += dictionarySize;
+        }
+        EXPECT_LT(dictionaryTotal, plainTotal);
+    }
+
+    TEST_F(ZstdDictionaryCompressorTests, MismatchedDictionaryFailsToDecompress)
+    {
+        EntityUpdatePacketGenerator generator(1234);
+        AZStd::shared_ptr<const ZstdDictionary> dictionary = TrainTestDictionary(generator, 2048, 3);
+        ASSERT_NE(dictionary, nullptr);
+
+        ZstdDictionaryCompressor dictionaryCompressor(dictionary, 3);
+        ZstdDictionaryCompressor plainCompressor(nullptr, 3);
+
+        const AZStd::vector<uint8_t> packet = generator.Generate();
+        AZStd::vector<uint8_t> compressed(dictionaryCompressor.GetMaxCompressedBufferSize(packet.size()));
+        AZStd::vector<uint8_t> decompressed(packet.size());
+        size_t compressedSize = 0;
+        size_t consumedSize = 0;
+        size_t uncompressedSize = 0;
+        ASSERT_EQ(dictionaryCompressor.Compress(packet.data(), packet.size(), compressed.data(), compressed.size(), compressedSize), AzNetworking::CompressorError::Ok);
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        const AzNetworking::CompressorError result = plainCompressor.Decompress(compressed.data(), compressedSize, decompressed.data(), decompressed.size(), consumedSize, uncompressedSize);
+        AZ_TEST_STOP_TRACE_SUPPRESSION_NO_COUNT;
+        if (result == AzNetworking::CompressorError::Ok)
+        {
+            // Decoding with the wrong history must never reproduce the original payload
+            EXPECT_FALSE((uncompressedSize == packet.size()) && (memcmp(decompressed.data(), packet.data(), packet.size()) == 0));
+        }
+    }
+
+    TEST_F(ZstdDictionaryCompressorTests, SampleCaptureRecordsUncompressedPayloads)
+    {
+        EntityUpdatePacketGenerator generator(1234);
+        ZstdDictionaryTrainer trainer;
+        trainer.SetMaxSampleCount(2);
+        ZstdDictionaryCompressor compressor(nullptr, 3, &trainer);
+
+        for (uint32_t i = 0; i < 4; ++i)
+        {
+            size_t compressedSize = 0;
+            ExpectRoundTrip(compressor, generator.Generate(), compressedSize);
+        }
+        EXPECT_EQ(trainer.GetSampleCount(), 2u);
+        EXPECT_FALSE(trainer.IsCapturing());
+
+        trainer.ClearSamples();
+        EXPECT_EQ(trainer.GetSampleCount(), 0u);
+        EXPECT_EQ(trainer.GetTotalSampleSize(), 0u);
+    }
+
+    TEST_F(ZstdDictionaryCompressorTests, NullBuffers)
+    {
+        size_t compressedSize = 0;
+        size_t consumedSize = 0;
+        size_t uncompressedSize = 0;
+
+        ZstdDictionaryCompressor compressor(nullptr, 3);
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_EQ(compressor.Compress(nullptr, 4, nullptr, 4, compressedSize), AzNetworking::CompressorError::Uninitialized);
+        EXPECT_EQ(compressor.Decompress(nullptr, 4, nullptr, 4, consumedSize, uncompressedSize), AzNetworking::CompressorError::Uninitialized);
+        AZ_TEST_STOP_TRACE_SUPPRESSION_NO_COUNT;
+    }
+
+    TEST_F(ZstdDictionaryCompressorTests, InsufficientBuffer)
+    {
+        EntityUpdatePacketGenerator generator(1234);
+        const AZStd::vector<uint8_t> packet = generator.Generate();
+        uint8_t compressed[4];
+        size_t compressedSize = 0;
+
+        ZstdDictionaryCompressor compressor(nullptr, 3);
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_EQ(compressor.Compress(packet.data(), packet.size(), compressed, sizeof(compressed), compressedSize), AzNetworking::CompressorError::InsufficientBuffer);
+        AZ_TEST_STOP_TRACE_SUPPRESSION_NO_COUNT;
+    }
+}
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    using namespace MultiplayerCompression;
+
+    //! Compares per packet compression of entity update packets between LZ4 and zstd with and without a trained dictionary.
+    //! Each iteration compresses a single packet, so the reported time is the cost per packet. The dictionary is trained on a
+    //! separate set of packets from the ones being measured.
+    class PacketCompressionBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr uint32_t TrainingPacketCount = 4096;
+        static constexpr uint32_t MeasuredPacketCount = 1024;
+        static constexpr int32_t CompressionLevel = 3;
+
+        using UnitTest::AllocatorsBenchmarkFixture::SetUp;
+        using UnitTest::AllocatorsBenchmarkFixture::TearDown;
+
+        void SetUp(benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            UnitTest::EntityUpdatePacketGenerator generator(1234);
+            m_dictionary = UnitTest::TrainTestDictionary(generator, TrainingPacketCount, CompressionLevel);
+
+            m_packets.resize(MeasuredPacketCount);
+            for (AZStd::vector<uint8_t>& packet : m_packets)
+            {
+                packet = generator.Generate();
+            }
+        }
+
+        void TearDown(benchmark::State& state) override
+        {
+            m_dictionary = nullptr;
+            m_packets = {};
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        template <typename COMPRESSOR>
+        void RunCompress(benchmark::State& state, COMPRESSOR& compressor)
+        {
+            AZStd::vector<uint8_t> compressed(compressor.GetMaxCompressedBufferSize(AzNetworking::MaxUdpTransmissionUnit));
+            size_t packetIndex = 0;
+            size_t uncompressedTotal = 0;
+            size_t compressedTotal = 0;
+            for ([[maybe_unused]] auto _ : state)
+            {
+                const AZStd::vector<uint8_t>& packet = m_packets[packetIndex];
+                packetIndex = (packetIndex + 1) % m_packets.size();
+
+                size_t compressedSize = 0;
+                compressor.Compress(packet.data(), packet.size(), compressed.data(), compressed.size(), compressedSize);
+                benchmark::DoNotOptimize(compressedSize);
+                uncompressedTotal += packet.size();
+                compressedTotal += compressedSize;
+            }
+            state.counters["CompressionRatio"] = (compressedTotal > 0) ? static_cast<double>(uncompressedTotal) / static_cast<double>(compressedTotal) : 0.0;
+            state.SetBytesProcessed(aznumeric_cast<int64_t>(uncompressedTotal));
+        }
+
+        template <typename COMPRESSOR>
+        void RunDecompress(benchmark::State& state, COMPRESSOR& compressor)
+        {
+            AZStd::vector<AZStd::vector<uint8_t>> compressedPackets(m_packets.size());
+            for (size_t i = 0; i < m_packets.size(); ++i)
+            {
+                compressedPackets[i].resize(compressor.GetMaxCompressedBufferSize(m_packets[i].size()));
+                size_t compressedSize = 0;
+                compressor.Compress(m_packets[i].data(), m_packets[i].size(), compressedPackets[i].data(), compressedPackets[i].size(), compressedSize);
+                compressedPackets[i].resize(compressedSize);
+            }
+
+            AZStd::vector<uint8_t> decompressed(AzNetworking::MaxUdpTransmissionUnit);
+            size_t packetIndex = 0;
+            size_t uncompressedTotal = 0;
+            for ([[maybe_unused]] auto _ : state)
+            {
+                const AZStd::vector<uint8_t>& packet = compressedPackets[packetIndex];
+                packetIndex = (packetIndex + 1) % compressedPackets.size();
+
+                size_t consumedSize = 0;
+                size_t uncompressedSize = 0;
+                compressor.Decompress(packet.data(), packet.size(), decompressed.data(), decompressed.size(), consumedSize, uncompressedSize);
+                benchmark::DoNotOptimize(uncompressedSize);
+                uncompressedTotal += uncompressedSize;
+            }
+            state.SetBytesProcessed(aznumeric_cast<int64_t>(uncompressedTotal));
+        }
+
+        AZStd::shared_ptr<const ZstdDictionary> m_dictionary;
+        AZStd::vector<AZStd::vector<uint8_t>> m_packets;
+    };
+
+    BENCHMARK_F(PacketCompressionBenchmark, LZ4Compress)(benchmark::State& state)
+    {
+        LZ4Compressor compressor;
+        RunCompress(state, compressor);
+    }
+
+    BENCHMARK_F(PacketCompressionBenchmark, ZstdCompress)(benchmark::State& state)
+    {
+        ZstdDictionaryCompressor compressor(nullptr, CompressionLevel);
+        RunCompress(state, compressor);
+    }
+
+    BENCHMARK_F(PacketCompressionBenchmark, ZstdDictionaryCompress)(benchmark::State& state)
+    {
+        ZstdDictionaryCompressor compressor(m_dictionary, CompressionLevel);
+        RunCompress(state, compressor);
+    }
+
+    BENCHMARK_F(PacketCompressionBenchmark, LZ4Decompress)(benchmark::State& state)
+    {
+        LZ4Compressor compressor;
+        RunDecompress(state, compressor);
+    }
+
+    BENCHMARK_F(PacketCompressionBenchmark, ZstdDictionaryDecompress)(benchmark::State& state)
+    {
+        ZstdDictionaryCompressor compressor(m_dictionary, CompressionLevel);
+        RunDecompress(state, compressor);
+    }
+}
+#endif // HAVE_BENCHMARK
@@ -13,4 +13,8 @@ set(FILES
     Source/MultiplayerCompressionFactory.h
     Source/MultiplayerCompressionSystemComponent.cpp
     Source/MultiplayerCompressionSystemComponent.h
+    Source/ZstdDictionaryCompressor.cpp
+    Source/ZstdDictionaryCompressor.h
+    Source/ZstdDictionaryTrainer.cpp
+    Source/ZstdDictionaryTrainer.h
 )
@@ -801,6 +801,8 @@ namespace Vegetation
                         m_threadData.m_vegetationThreadState = PersistentThreadData::VegetationThreadState::Stopped;
                         m_threadData.m_vegetationDataSyncState = PersistentThreadData::VegetationDataSyncState::Synchronized;
                     }, true);
+                    // The vegetation thread keeps running as long as there's work, keep it off workers needed by frame critical jobs.
+                    job->SetPriorityClass(AZ::JobPriorityClass::Background);
                     job->Start();
                 }
             }
@@ -583,6 +583,7 @@ namespace Vegetation
 
         //offloading garbage collection to job to save time deallocating tasks on main thread
         auto garbageCollectionJob = AZ::CreateJobFunction([removedTasksPtr]() mutable {}, true);
+        garbageCollectionJob->SetPriorityClass(AZ::JobPriorityClass::Background);
         garbageCollectionJob->Start();
     }
 